@@ -0,0 +1,108 @@
+// -----------------------------------------------------------------------------
+//    ASPiK Plugin Kernel File:  denormalguard.h
+//
+/**
+    \file   denormalguard.h
+    \author Will Pirkle
+    \date   17-September-2018
+    \brief  interface file for the scoped flush-to-zero/denormals-are-zero guard
+    		- http://www.aspikplugins.com
+    		- http://www.willpirkle.com
+*/
+// -----------------------------------------------------------------------------
+#ifndef _DenormalGuard_H_
+#define _DenormalGuard_H_
+
+#include <stdint.h>
+
+// --- FTZ/DAZ only covers double math when it is done in SSE registers (not x87) or on ARM64
+#if defined(__x86_64__) || defined(_M_X64) || defined(__SSE2_MATH__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#include <xmmintrin.h>
+	#define DENORMAL_GUARD_SSE 1
+#elif defined(__aarch64__)
+	#define DENORMAL_GUARD_ARM64 1
+#endif
+
+#if defined(DENORMAL_GUARD_SSE) || defined(DENORMAL_GUARD_ARM64)
+	#define DENORMAL_GUARD_SUPPORTED 1
+#else
+	#define DENORMAL_GUARD_SUPPORTED 0
+#endif
+
+// --- FLUSH_DENORMALS is set by the build (VST3_FLUSH_DENORMALS); the guard is only active if the CPU
+//     supports it, otherwise the per-sample underflow checks in fxobjects stay in place
+#if defined(FLUSH_DENORMALS) && FLUSH_DENORMALS && DENORMAL_GUARD_SUPPORTED
+	#define DENORMAL_GUARD_ACTIVE 1
+#else
+	#define DENORMAL_GUARD_ACTIVE 0
+#endif
+
+/**
+\class ScopedDenormalGuard
+\ingroup ASPiK-Core
+\brief
+Sets flush-to-zero and denormals-are-zero for the current thread and restores the previous
+floating point mode when it goes out of scope.
+
+ScopedDenormalGuard Operations:
+- x86/x64: sets the FTZ and DAZ bits of the SSE control/status register (MXCSR)
+- ARM64: sets the FZ bit of the FPCR (which covers both inputs and outputs)
+- other CPUs: does nothing
+- declare one at the top of the API process function, before any DSP code runs
+
+\author Will Pirkle http://www.willpirkle.com
+\remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
+\version Revision : 1.0
+\date Date : 2018 / 09 / 7
+*/
+class ScopedDenormalGuard
+{
+public:
+	/** set FTZ/DAZ if enable is true */
+	ScopedDenormalGuard(bool enable = true)
+	{
+		if (!enable)
+			return;
+
+#if defined(DENORMAL_GUARD_SSE)
+		savedMode = _mm_getcsr();
+		_mm_setcsr((uint32_t)savedMode | kSSEFlushToZero | kSSEDenormalsAreZero);
+		restore = true;
+#elif defined(DENORMAL_GUARD_ARM64)
+		uint64_t fpcr = 0;
+		asm volatile("mrs %0, fpcr" : "=r"(fpcr));
+		savedMode = fpcr;
+		fpcr |= kARMFlushToZero;
+		asm volatile("msr fpcr, %0" : : "r"(fpcr));
+		restore = true;
+#endif
+	}
+
+	/** restore the previous mode */
+	~ScopedDenormalGuard()
+	{
+		if (!restore)
+			return;
+
+#if defined(DENORMAL_GUARD_SSE)
+		_mm_setcsr((uint32_t)savedMode);
+#elif defined(DENORMAL_GUARD_ARM64)
+		uint64_t fpcr = savedMode;
+		asm volatile("msr fpcr, %0" : : "r"(fpcr));
+#endif
+	}
+
+protected:
+	static const uint32_t kSSEFlushToZero = 0x8000;		///< MXCSR FTZ bit
+	static const uint32_t kSSEDenormalsAreZero = 0x0040;	///< MXCSR DAZ bit
+	static const uint64_t kARMFlushToZero = 1 << 24;		///< FPCR FZ bit
+
+	uint64_t savedMode = 0;	///< MXCSR or FPCR on entry
+	bool restore = false;	///< true if the mode was changed
+
+private:
+	ScopedDenormalGuard(const ScopedDenormalGuard&);
+	ScopedDenormalGuard& operator=(const ScopedDenormalGuard&);
+};
+
+#endif /* defined(_DenormalGuard_H_) */
@@ -14,6 +14,12 @@
 #define __pluginCore_h__
 
 #include "pluginbase.h"
+#include "parallelrender.h"
+#include "subblockscheduler.h"
+#include "silencedetector.h"
+#include "presetfader.h"
+#include "voicegovernor.h"
+#include "stageprofiler.h"
 
 // --- synths
 #include "examples/synthlab_examples/synthengine.h"
@@ -254,11 +260,27 @@ enum controlID {
 	fmo1_EG = 98,
 	fmo2_EG = 118,
 	fmo3_EG = 138,
-	fmo4_EG = 158
+	fmo4_EG = 158,
+	governorLoad = 1000,
+	governorLevel = 1001,
+	governorVoices = 1002,
+	profileParameters = 1010,
+	profileMidi = 1011,
+	profileUpdateParameters = 1012,
+	profileRender = 1013,
+	profileOutputCopy = 1014,
+	profileOutBound = 1015
 };
 
 	// **--0x0F1F--**
 
+// --- render quantum limits; the synth engines are allocated for the largest
+const uint32_t MIN_RENDER_QUANTUM = 32;
+const uint32_t MAX_RENDER_QUANTUM = 256;
+
+// --- synth MIDI queue capacity reserved at initialize( ), so pushMidiEvent( ) does not allocate while rendering
+const uint32_t SYNTH_MIDI_EVENT_RESERVE = 256;
+
 // --- block processing data struct
 //
 // --- contains info about the block to process, 
@@ -272,6 +294,8 @@ struct ProcessBlockInfo
 	float** auxInputs = nullptr;			///< aux (sidechain) input buffers
 	float** auxOutputs = nullptr;			///< aux outputs - for future use
 
+	double** outputs64 = nullptr;			///< audio output buffers, 64-bit hosts (outputs is then nullptr)
+
 	uint32_t numAudioInChannels = 0;		///< audio input channel count
 	uint32_t numAudioOutChannels = 0;		///< audio input channel count
 	uint32_t numAuxAudioInChannels = 0;		///< audio input channel count
@@ -308,7 +332,7 @@ PluginCore Operations:
 \version Revision : 1.0
 \date Date : 2018 / 09 / 7
 */
-class PluginCore : public PluginBase
+class PluginCore : public PluginBase, public IRenderJob
 {
 public:
     PluginCore();
@@ -363,8 +387,8 @@ public:
 	/** specialized joystick servicing (currently not used) */
 	virtual bool setVectorJoystickParameters(const VectorJoystickData& vectorJoysickData);
 
-	/** create the presets */
-	bool initPluginPresets();
+	/** fill the shared preset catalog; called once per process, see PluginBase::getPresetCatalog( ) */
+	virtual bool initPluginPresets(PresetCatalog& presetCatalog);
 
 	// --- BEGIN USER VARIABLES AND FUNCTIONS -------------------------------------- //
 	//	   Add your variables and methods here
@@ -390,16 +414,144 @@ public:
 	void updateEngineParameters();
 	void updateVoiceParameters();
 	void updateModMatrixParameters();
+
+	// --- dirty tracking: one bound variable group per parameter structure (see initParameterGroups( ))
+	enum parameterGroup
+	{
+		kEngineGroup,
+		kVoiceGroup,
+		kLFO1Group,
+		kLFO2Group,
+		kAmpEGGroup,
+		kFilterEGGroup,
+		kAuxEGGroup,
+		kFilter1Group,
+		kFilter2Group,
+		kOsc1Group,
+		kOsc2Group,
+		kOsc3Group,
+		kOsc4Group,
+		kDCAGroup,
+		kModMatrixGroup,
+		kNumParameterGroups
+	};
+	void initParameterGroups();
+
+	/** number of bound variables copied into the engine structures in the last block, for metering */
+	uint32_t getParameterFieldsPushed() { return parameterFieldsPushed.load(std::memory_order_relaxed); }
+	std::atomic<uint32_t> parameterFieldsPushed{ 0 };			///< telemetry
+
+	/** number of blocks skipped by the idle detector since the last reset, for metering */
+	uint32_t getIdleBlockCount() { return idleBlockCount.load(std::memory_order_relaxed); }
+	std::atomic<uint32_t> idleBlockCount{ 0 };					///< telemetry
 	
 	// --- for all versions RAFX/ASPiK	
 	std::unique_ptr<DynamicStringManager> dynStringManager = nullptr;
 
 	// --- for DM ONLY
 	DynamicModuleManager dynModuleManager;
+	void loadDynamicModules(SynthLab::SynthEngine* engine, const std::string& modulePath);
 
 	// --- for disabling (VST3 windows)
 	void enableParamSmoothing(bool enable);
 
+	// --- parallel rendering (opt-in with kRenderShardCount > 1)
+	//     shard 0 is synthEngine/synthBlockProcInfo, shards 1..N-1 are extra engines that
+	//     own a share of the notes and are rendered on the worker pool
+	struct RenderShard
+	{
+		std::shared_ptr<SynthLab::SynthEngine> engine = nullptr;
+		std::shared_ptr<SynthLab::SynthEngineParameters> engineParameters = nullptr;
+		std::shared_ptr<SynthLab::SynthVoiceParameters> voiceParameters = nullptr;
+		SynthLab::SynthProcessInfo synthProcInfo;
+	};
+	RenderShard renderShards[MAX_RENDER_JOBS];
+	uint32_t renderShardCount = 1;
+	ShardNoteRouter shardNoteRouter;
+	RenderWorkerPool renderWorkerPool; ///< declared last: threads are joined before the engines go away
+
+	void updateShardParameters();
+	void routeShardMidiEvent(SynthLab::midiEvent& event);
+
+	// --- sample accurate MIDI: the block is rendered in sub-blocks split at MIDI event offsets
+	MidiSubBlockScheduler midiSubBlockScheduler;
+	uint32_t midiFireOffset = 0; ///< offset into the block of the sample whose MIDI is being fired
+	void setMinMidiSubBlockSize(uint32_t size) { midiSubBlockScheduler.setMinSubBlockSize(size); }
+	void scheduleSynthMidiEvent(midiEvent& event);
+	void dispatchSynthMidiEvent(midiEvent& event);
+	void clearSynthMidiEvents();
+	void reserveSynthMidiEvents();
+	void renderSynthSubBlock(ProcessBlockInfo& blockInfo, uint32_t subBlockStart, uint32_t subBlockLength);
+
+	// --- zero-copy rendering: the synth's output channel pointers are re-targeted at the host buffers
+	bool enableZeroCopyRender = false;
+	float* ownedSynthOutputs[SynthLab::STEREO_CHANNELS] = { nullptr, nullptr }; ///< the synth's own buffers, restored after each render
+	bool canRenderToHostBuffers(ProcessBlockInfo& blockInfo, uint32_t subBlockStart, uint32_t subBlockLength);
+
+	// --- idle render skipping: with no notes held and the tail settled, blocks are cleared, not rendered
+	bool enableIdleRenderSkip = false;
+	SynthSilenceDetector silenceDetector;
+	bool blockRenderSkipped = false; ///< the last block was skipped
+
+	// --- preset changes: posted parameter snapshots are swapped in at a block boundary, faded out and in
+	PresetFader presetFader;
+
+	// --- CPU deadline governor: trades quality for time in steps when blocks get close to their deadline
+	VoiceGovernor voiceGovernor;
+	void updateVoiceGovernor(uint32_t blockSize);
+
+#if SYNTHLAB_PROFILER
+	// --- per-stage audio thread profiler (SYNTHLAB_PROFILER builds only); the stats and the Chrome
+	//     trace can be read from any thread while the audio thread runs
+	StageProfiler stageProfiler;
+	bool getProfilerStageStats(uint32_t stage, ProfilerStageStats& stats) { return stageProfiler.getStageStats(stage, stats); }
+	bool dumpProfilerTrace(const char* path) { return stageProfiler.dumpChromeTrace(path); }
+	void updateProfilerMeters();
+#endif
+
+	/** clear a block of the host outputs, float or double */
+	template <typename SampleType>
+	void clearOutputs(SampleType** outputs, uint32_t numChannels, uint32_t outputStart, uint32_t length)
+	{
+		for (uint32_t channel = 0; channel < numChannels; channel++)
+		{
+			if (outputs[channel])
+				memset(outputs[channel] + outputStart, 0, length * sizeof(SampleType));
+		}
+	}
+
+	/** copy a rendered sub-block to the host outputs, float or double */
+	template <typename SampleType>
+	void writeSynthOutputs(SampleType** outputs, uint32_t numChannels, uint32_t outputStart, float** synthOutputs, uint32_t length)
+	{
+		for (uint32_t channel = 0; channel < numChannels; channel++)
+		{
+			SampleType* output = outputs[channel] + outputStart;
+			for (uint32_t i = 0; i < length; i++)
+				output[i] = (SampleType)synthOutputs[channel][i];
+		}
+	}
+
+	/** IRenderJob: render one shard */
+	virtual void renderJob(uint32_t jobIndex);
+
+	/** per-shard CPU time of the last block, for metering */
+	uint32_t getRenderShardCount() { return renderShardCount; }
+	float getShardRenderTime_uSec(uint32_t shard) { return renderWorkerPool.getJobTime_uSec(shard); }
+
+	// --- render quantum: the block size the synth renders with
+	bool setRenderQuantum(uint32_t quantum);
+	uint32_t getRenderQuantum() { return renderQuantum.load(std::memory_order_relaxed); }
+	void setEnableAdaptiveRenderQuantum(bool enable) { enableAdaptiveRenderQuantum.store(enable, std::memory_order_relaxed); }
+	uint32_t getRenderQuantumForBuffer(uint32_t numFrames);
+
+	/** quantum used for the last host buffer, for metering */
+	uint32_t getEffectiveRenderQuantum() { return effectiveRenderQuantum.load(std::memory_order_relaxed); }
+
+	std::atomic<uint32_t> renderQuantum{ 64 };					///< base quantum (32, 64, 128 or 256)
+	std::atomic<bool> enableAdaptiveRenderQuantum{ false };		///< grow the quantum to match host buffer sizes
+	std::atomic<uint32_t> effectiveRenderQuantum{ 64 };			///< telemetry
+
 	// --- END USER VARIABLES AND FUNCTIONS -------------------------------------- //
 	// --- CORE_ADD_STEP 2
 	inline uint32_t getSubModuleType(uint32_t _controlID)
@@ -913,6 +1065,17 @@ private:
 	float EG_SWITCH = 0.f;
 	float FILTER_SWITCH = 0.f;
 
+	// --- Meter Plugin Variables
+	float governorLoad = 0.f;
+	float governorLevel = 0.f;
+	float governorVoices = 0.f;
+	float profileParameters = 0.f;
+	float profileMidi = 0.f;
+	float profileUpdateParameters = 0.f;
+	float profileRender = 0.f;
+	float profileOutputCopy = 0.f;
+	float profileOutBound = 0.f;
+
 	// **--0x1A7F--**
     // --- end member variables
 
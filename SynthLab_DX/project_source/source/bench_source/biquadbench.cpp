@@ -0,0 +1,246 @@
+// -----------------------------------------------------------------------------
+//    ASPiK Bench File:  biquadbench.cpp
+//
+/**
+    \file   biquadbench.cpp
+    \author Will Pirkle
+    \date   17-September-2018
+    \brief  BiquadBank (SIMD lanes) throughput against the same filters as scalar Biquads
+    		- one LPF per lane and stage, each with its own cutoff, fed with noise
+    		- the scalar filters run once per sample (processAudioSample) and once per
+    		  512 sample block (processBlockInPlace); the bank runs per 512 sample block
+    		  (processAudioBlock)
+    		- maxDiff is the largest difference between the bank and the scalar outputs;
+    		  the bank uses the Biquad math, so it should be 0
+    		- prints one JSON object per (structure, lanes, stages, mode) run to stdout
+    		- http://www.aspikplugins.com
+    		- http://www.willpirkle.com
+*/
+// -----------------------------------------------------------------------------
+#include "fxobjects.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+const double kBenchSampleRate = 48000.0;
+const uint32_t kBenchBlockSize = 512;
+
+/**
+\brief the filter of one lane and stage: a resonant LPF2 with its own cutoff
+*/
+AudioFilterParameters getLaneFilter(uint32_t lane, uint32_t stage)
+{
+	AudioFilterParameters params;
+	params.algorithm = filterAlgorithm::kLPF2;
+	params.fc = 200.0 * (lane + 1) + 50.0 * stage;
+	params.Q = 2.0;
+	return params;
+}
+
+/**
+\brief fill the channels with noise
+*/
+void fillNoise(float** channels, uint32_t numChannels, uint32_t frames, uint32_t& seed)
+{
+	for (uint32_t channel = 0; channel < numChannels; channel++)
+	{
+		for (uint32_t i = 0; i < frames; i++)
+		{
+			seed = seed * 1664525 + 1013904223;
+			channels[channel][i] = (float)(((double)seed / 4294967295.0) * 2.0 - 1.0);
+		}
+	}
+}
+
+/**
+\brief the scalar reference: lanes x stages Biquads with the AudioFilter coefficients
+*/
+struct ScalarBank
+{
+	Biquad biquads[BIQUAD_BANK_MAX_LANES][BIQUAD_BANK_MAX_STAGES];
+	double work[kBenchBlockSize];
+	uint32_t lanes = 1;
+	uint32_t stages = 1;
+
+	void setup(uint32_t _lanes, uint32_t _stages, biquadAlgorithm algorithm)
+	{
+		lanes = _lanes;
+		stages = _stages;
+
+		BiquadParameters biquadParams;
+		biquadParams.biquadCalcType = algorithm;
+
+		AudioFilter calculator;
+		calculator.reset(kBenchSampleRate);
+		for (uint32_t lane = 0; lane < lanes; lane++)
+		{
+			for (uint32_t stage = 0; stage < stages; stage++)
+			{
+				calculator.setParameters(getLaneFilter(lane, stage));
+				calculator.setSampleRate(kBenchSampleRate);
+
+				double coeffs[numCoeffs];
+				memcpy(&coeffs[0], calculator.getCoefficients(), sizeof(double) * numCoeffs);
+
+				biquads[lane][stage].reset(kBenchSampleRate);
+				biquads[lane][stage].setParameters(biquadParams);
+				biquads[lane][stage].setCoefficients(coeffs);
+			}
+		}
+	}
+
+	void processPerSample(float** channels, uint32_t frames)
+	{
+		for (uint32_t i = 0; i < frames; i++)
+		{
+			for (uint32_t lane = 0; lane < lanes; lane++)
+			{
+				double xn = channels[lane][i];
+				for (uint32_t stage = 0; stage < stages; stage++)
+					xn = biquads[lane][stage].processAudioSample(xn);
+				channels[lane][i] = (float)xn;
+			}
+		}
+	}
+
+	void processBlock(float** channels, uint32_t frames)
+	{
+		for (uint32_t lane = 0; lane < lanes; lane++)
+		{
+			for (uint32_t i = 0; i < frames; i++)
+				work[i] = channels[lane][i];
+			for (uint32_t stage = 0; stage < stages; stage++)
+				biquads[lane][stage].processBlockInPlace(work, frames);
+			for (uint32_t i = 0; i < frames; i++)
+				channels[lane][i] = (float)work[i];
+		}
+	}
+};
+
+/**
+\brief set the bank up with the same filters as ScalarBank::setup( )
+*/
+void setupBank(BiquadBank& bank, uint32_t lanes, uint32_t stages, biquadAlgorithm algorithm)
+{
+	BiquadBankParameters params;
+	params.lanes = lanes;
+	params.stages = stages;
+	params.input = biquadBankInput::kPerLane;
+	params.biquadCalcType = algorithm;
+
+	bank.reset(kBenchSampleRate);
+	bank.setParameters(params);
+	for (uint32_t lane = 0; lane < lanes; lane++)
+	{
+		for (uint32_t stage = 0; stage < stages; stage++)
+			bank.setFilterParameters(lane, stage, getLaneFilter(lane, stage));
+	}
+}
+
+enum benchMode { kBenchPerSample, kBenchScalarBlock, kBenchBank, kNumBenchModes };
+
+/**
+\brief run one mode over numBlocks blocks of noise; the outputs of the last block are left in channels
+
+\return nanoseconds per lane-sample
+*/
+double runBench(uint32_t mode, ScalarBank& scalar, BiquadBank& bank, float** channels, uint32_t lanes, uint32_t numBlocks)
+{
+	uint32_t seed = 12345;
+	double sink = 0.0;
+	double elapsed = 0.0;
+	for (uint32_t block = 0; block < numBlocks; block++)
+	{
+		fillNoise(channels, lanes, kBenchBlockSize, seed);
+
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		if (mode == kBenchPerSample)
+			scalar.processPerSample(channels, kBenchBlockSize);
+		else if (mode == kBenchScalarBlock)
+			scalar.processBlock(channels, kBenchBlockSize);
+		else
+			bank.processAudioBlock(channels, channels, lanes, kBenchBlockSize);
+		std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+		elapsed += std::chrono::duration<double>(end - start).count();
+		sink += channels[0][kBenchBlockSize - 1];
+	}
+
+	// --- keep the output alive
+	if (sink == 1.2345)
+		printf("%f\n", sink);
+
+	return elapsed * 1.0e9 / ((double)numBlocks * kBenchBlockSize * lanes);
+}
+
+/**
+\brief bench entry point: [numBlocks] (2000)
+*/
+int main(int argc, char* argv[])
+{
+	uint32_t numBlocks = argc > 1 ? (uint32_t)atoi(argv[1]) : 2000;
+	if (numBlocks == 0)
+		numBlocks = 1;
+
+	const char* algorithmNames[2] = { "kDirect", "kTransposeCanonical" };
+	const biquadAlgorithm algorithms[2] = { biquadAlgorithm::kDirect, biquadAlgorithm::kTransposeCanonical };
+	const char* modeNames[kNumBenchModes] = { "scalarSample", "scalarBlock", "bank" };
+	const uint32_t laneCounts[3] = { 2, 4, 8 };
+	const uint32_t stageCounts[2] = { 1, 4 };
+
+	static float buffers[kNumBenchModes][BIQUAD_BANK_MAX_LANES][kBenchBlockSize];
+	static ScalarBank scalar;
+	BiquadBank bank;
+
+	for (uint32_t a = 0; a < 2; a++)
+	{
+		for (uint32_t l = 0; l < 3; l++)
+		{
+			for (uint32_t s = 0; s < 2; s++)
+			{
+				uint32_t lanes = laneCounts[l];
+				uint32_t stages = stageCounts[s];
+
+				double nsPerLaneSample[kNumBenchModes];
+				for (uint32_t mode = 0; mode < kNumBenchModes; mode++)
+				{
+					float* channels[BIQUAD_BANK_MAX_LANES];
+					for (uint32_t lane = 0; lane < BIQUAD_BANK_MAX_LANES; lane++)
+						channels[lane] = buffers[mode][lane];
+
+					scalar.setup(lanes, stages, algorithms[a]);
+					setupBank(bank, lanes, stages, algorithms[a]);
+					nsPerLaneSample[mode] = runBench(mode, scalar, bank, channels, lanes, numBlocks);
+				}
+
+				// --- every mode saw the same input, so the last blocks must match
+				double maxDiff = 0.0;
+				for (uint32_t mode = 1; mode < kNumBenchModes; mode++)
+				{
+					for (uint32_t lane = 0; lane < lanes; lane++)
+					{
+						for (uint32_t i = 0; i < kBenchBlockSize; i++)
+						{
+							double diff = fabs((double)buffers[mode][lane][i] - (double)buffers[kBenchPerSample][lane][i]);
+							maxDiff = diff > maxDiff ? diff : maxDiff;
+						}
+					}
+				}
+
+				for (uint32_t mode = 0; mode < kNumBenchModes; mode++)
+				{
+					printf("{\"structure\":\"%s\",\"lanes\":%u,\"stages\":%u,\"vectorWidth\":%d,\"mode\":\"%s\",\"nsPerLaneSample\":%.3f,\"speedup\":%.2f,\"maxDiff\":%g}\n",
+						   algorithmNames[a], lanes, stages, (int)BiquadBankVector<double>::width, modeNames[mode],
+						   nsPerLaneSample[mode],
+						   nsPerLaneSample[mode] > 0.0 ? nsPerLaneSample[kBenchPerSample] / nsPerLaneSample[mode] : 0.0,
+						   maxDiff);
+				}
+				fflush(stdout);
+			}
+		}
+	}
+
+	return 0;
+}
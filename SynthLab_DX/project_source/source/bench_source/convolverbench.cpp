@@ -0,0 +1,240 @@
+// -----------------------------------------------------------------------------
+//    ASPiK Bench File:  convolverbench.cpp
+//
+/**
+    \file   convolverbench.cpp
+    \author Will Pirkle
+    \date   17-September-2018
+    \brief  PartitionedConvolver throughput against the ImpulseConvolver (time domain)
+    		and the FastConvolver (one FFT block)
+    		- the IRs are exponentially decaying noise, from 512 taps to 5 seconds
+    		- PartitionedConvolver runs processAudioBlock( ) with uniform partitions,
+    		  non-uniform partitions, and non-uniform partitions with the background
+    		  tail, in mono, stereo and true stereo
+    		- maxDiff compares the first kBenchCheckLength outputs with a direct
+    		  convolution (0 = not checked); latency is in samples
+    		- uses FFTW with HAVE_FFTW, otherwise the built-in FFT (fftbackend.h); prints
+    		  one JSON object per run to stdout
+    		- http://www.aspikplugins.com
+    		- http://www.willpirkle.com
+*/
+// -----------------------------------------------------------------------------
+#include "fxobjects.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+const double kBenchSampleRate = 48000.0;
+const uint32_t kBenchBlockSize = 256;
+const uint32_t kBenchCheckLength = 8192;
+
+/**
+\brief one IR: decaying noise, about -60dB at the end
+*/
+void makeIR(std::vector<double>& ir, uint32_t length, uint32_t seed)
+{
+	ir.resize(length);
+	double decay = length > 1 ? pow(0.001, 1.0 / (double)(length - 1)) : 1.0;
+	double gain = 0.5;
+	for (uint32_t i = 0; i < length; i++)
+	{
+		seed = seed * 1664525 + 1013904223;
+		ir[i] = gain * (((double)seed / 4294967295.0) - 0.5);
+		gain *= decay;
+	}
+}
+
+/**
+\brief largest difference between the first kBenchCheckLength outputs of a channel and a direct convolution
+*/
+double checkOutput(const std::vector<float>& output, uint32_t length, uint32_t outputChannel, uint32_t latency,
+				   const std::vector<float>& input, const std::vector<std::vector<double> >& irs, convolverChannels channels)
+{
+	uint32_t checkLength = length < kBenchCheckLength ? length : kBenchCheckLength;
+	double maxDiff = 0.0;
+	for (uint32_t n = 0; n < checkLength; n++)
+	{
+		double sum = 0.0;
+		for (uint32_t path = 0; path < irs.size(); path++)
+		{
+			// --- same routing as the convolver
+			uint32_t pathInput = path;
+			uint32_t pathOutput = path;
+			if (channels == convolverChannels::kTrueStereo)
+			{
+				pathInput = path / 2;
+				pathOutput = path % 2;
+			}
+			if (pathOutput != outputChannel)
+				continue;
+
+			const std::vector<double>& ir = irs[path];
+			for (uint32_t k = 0; k < ir.size() && k + latency <= n; k++)
+				sum += ir[k] * (double)input[pathInput * length + n - latency - k];
+		}
+		maxDiff = fmax(maxDiff, fabs(sum - (double)output[outputChannel * length + n]));
+	}
+	return maxDiff;
+}
+
+/**
+\brief print one result
+*/
+void printResult(const char* engine, const char* channels, uint32_t irLength, uint32_t blockSize, uint32_t maxBlockSize,
+				 bool background, uint32_t latency, uint32_t segments, double nsPerSample, double maxDiff)
+{
+	// --- realtime factor: seconds of audio per second of CPU, one channel
+	double realtime = nsPerSample > 0.0 ? 1.0e9 / (nsPerSample * kBenchSampleRate) : 0.0;
+	printf("{\"engine\":\"%s\",\"channels\":\"%s\",\"irLength\":%u,\"blockSize\":%u,\"maxBlockSize\":%u,\"background\":%s,\"latency\":%u,\"segments\":%u,\"nsPerSample\":%.3f,\"realtime\":%.1f,\"maxDiff\":%g}\n",
+		   engine, channels, irLength, blockSize, maxBlockSize, background ? "true" : "false", latency, segments, nsPerSample, realtime, maxDiff);
+	fflush(stdout);
+}
+
+/**
+\brief PartitionedConvolver over the input in kBenchBlockSize blocks
+
+\return nanoseconds per sample (per frame for the stereo modes)
+*/
+double runPartitioned(convolverChannels channels, uint32_t irLength, uint32_t blockSize, uint32_t maxBlockSize, bool background,
+					  const std::vector<float>& input, uint32_t length)
+{
+	uint32_t numIRs = channels == convolverChannels::kTrueStereo ? 4 : (channels == convolverChannels::kStereo ? 2 : 1);
+	uint32_t numChannels = channels == convolverChannels::kMono ? 1 : 2;
+
+	std::vector<std::vector<double> > irs(numIRs);
+	const double* irPtrs[4] = { nullptr, nullptr, nullptr, nullptr };
+	for (uint32_t i = 0; i < numIRs; i++)
+	{
+		makeIR(irs[i], irLength, 777 + i);
+		irPtrs[i] = &irs[i][0];
+	}
+
+	PartitionedConvolver convolver;
+	PartitionedConvolverParameters params;
+	params.channels = channels;
+	params.blockSize = blockSize;
+	params.maxBlockSize = maxBlockSize;
+	params.latency = 0;
+	params.backgroundTail = background;
+	convolver.setParameters(params);
+	convolver.setImpulseResponses(irPtrs, irLength);
+	convolver.reset(kBenchSampleRate);
+
+	std::vector<float> output(length * 2, 0.f);
+
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for (uint32_t n = 0; n < length; n += kBenchBlockSize)
+	{
+		uint32_t frames = length - n < kBenchBlockSize ? length - n : kBenchBlockSize;
+		const float* inputs[2] = { &input[n], &input[length + n] };
+		float* outputs[2] = { &output[n], &output[length + n] };
+		convolver.processAudioBlock(inputs, outputs, numChannels, frames);
+	}
+	std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+	double ns = std::chrono::duration<double>(end - start).count() * 1.0e9 / (double)length;
+
+	double maxDiff = 0.0;
+	for (uint32_t channel = 0; channel < numChannels; channel++)
+		maxDiff = fmax(maxDiff, checkOutput(output, length, channel, convolver.getLatency_Samples(), input, irs, channels));
+
+	const char* channelNames[3] = { "mono", "stereo", "trueStereo" };
+	const char* engine = maxBlockSize == blockSize ? "PartitionedUniform" : "PartitionedNonUniform";
+	printResult(engine, channelNames[(int)channels], irLength, blockSize, maxBlockSize, background,
+				convolver.getLatency_Samples(), convolver.getSegmentCount(), ns, maxDiff);
+	return ns;
+}
+
+/**
+\brief ImpulseConvolver (time domain) over channel 0; irLength must be a power of 2
+*/
+void runImpulseConvolver(uint32_t irLength, const std::vector<float>& input, uint32_t length)
+{
+	std::vector<std::vector<double> > irs(1);
+	makeIR(irs[0], irLength, 777);
+
+	ImpulseConvolver convolver;
+	convolver.setImpulseResponse(&irs[0][0], irLength);
+	convolver.reset(kBenchSampleRate);
+
+	std::vector<float> output(length * 2, 0.f);
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for (uint32_t n = 0; n < length; n++)
+		output[n] = (float)convolver.processAudioSample(input[n]);
+	std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+	double ns = std::chrono::duration<double>(end - start).count() * 1.0e9 / (double)length;
+
+	double maxDiff = checkOutput(output, length, 0, 0, input, irs, convolverChannels::kMono);
+	printResult("ImpulseConvolver", "mono", irLength, 1, 1, false, 0, 0, ns, maxDiff);
+}
+
+/**
+\brief FastConvolver (one FFT block, latency = IR length) over channel 0; not checked
+*/
+void runFastConvolver(uint32_t irLength, const std::vector<float>& input, uint32_t length)
+{
+	std::vector<double> ir;
+	makeIR(ir, irLength, 777);
+
+	FastConvolver convolver;
+	convolver.initialize(irLength);
+	convolver.setFilterIR(&ir[0]);
+
+	double sink = 0.0;
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for (uint32_t n = 0; n < length; n++)
+		sink += convolver.processAudioSample(input[n]);
+	std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+	double ns = std::chrono::duration<double>(end - start).count() * 1.0e9 / (double)length;
+
+	// --- keep the output alive
+	if (sink == 1.2345)
+		printf("%f\n", sink);
+
+	printResult("FastConvolver", "mono", irLength, irLength, irLength, false, irLength, 1, ns, 0.0);
+}
+
+/**
+\brief bench entry point: [seconds] (2)
+*/
+int main(int argc, char* argv[])
+{
+	double seconds = argc > 1 ? atof(argv[1]) : 2.0;
+	if (seconds <= 0.0)
+		seconds = 1.0;
+
+	// --- stereo noise at -6dB, channel-major
+	uint32_t length = (uint32_t)(seconds * kBenchSampleRate);
+	std::vector<float> input(length * 2);
+	uint32_t seed = 12345;
+	for (size_t i = 0; i < input.size(); i++)
+	{
+		seed = seed * 1664525 + 1013904223;
+		input[i] = (float)(((double)seed / 4294967295.0) - 0.5);
+	}
+
+	// --- short IRs: all three engines
+	uint32_t shortIRs[2] = { 512, 4096 };
+	for (uint32_t i = 0; i < 2; i++)
+	{
+		runImpulseConvolver(shortIRs[i], input, length);
+		runFastConvolver(shortIRs[i], input, length);
+		runPartitioned(convolverChannels::kMono, shortIRs[i], 64, 64, false, input, length);
+		runPartitioned(convolverChannels::kMono, shortIRs[i], 64, 4096, false, input, length);
+	}
+
+	// --- long IRs: 1 and 5 seconds
+	uint32_t longIRs[2] = { (uint32_t)kBenchSampleRate, (uint32_t)(5.0 * kBenchSampleRate) };
+	for (uint32_t i = 0; i < 2; i++)
+	{
+		runPartitioned(convolverChannels::kMono, longIRs[i], 64, 64, false, input, length);
+		runPartitioned(convolverChannels::kMono, longIRs[i], 64, 8192, false, input, length);
+		runPartitioned(convolverChannels::kMono, longIRs[i], 64, 8192, true, input, length);
+		runPartitioned(convolverChannels::kStereo, longIRs[i], 64, 8192, true, input, length);
+		runPartitioned(convolverChannels::kTrueStereo, longIRs[i], 64, 8192, true, input, length);
+	}
+
+	return 0;
+}
@@ -0,0 +1,201 @@
+// -----------------------------------------------------------------------------
+//    ASPiK Bench File:  startupbench.cpp
+//
+/**
+    \file   startupbench.cpp
+    \author Will Pirkle
+    \date   17-September-2018
+    \brief  plugin instance startup cost, as in a project load with many instances
+    		- creates N PluginCore instances the way a plugin shell does: construct,
+    		  initialize, enumerate the factory preset names
+    		- then applies every factory preset once and again, to separate the one-time
+    		  preset materialization from the cost of applying it, and once more as posted
+    		  parameter snapshots (the audio thread part is the swap)
+    		- prints one JSON object per phase to stdout
+    		- http://www.aspikplugins.com
+    		- http://www.willpirkle.com
+*/
+// -----------------------------------------------------------------------------
+#include "plugincore.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <unistd.h>
+
+/**
+\brief seconds since the previous call with the same time point; resets the time point
+*/
+double lapSeconds(std::chrono::steady_clock::time_point& last)
+{
+	std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+	double seconds = std::chrono::duration<double>(now - last).count();
+	last = now;
+	return seconds;
+}
+
+/**
+\brief current resident set size in kB (Linux), 0 if not available
+*/
+long getResidentSize_kB()
+{
+	long pages = 0;
+	long resident = 0;
+	FILE* statm = fopen("/proc/self/statm", "r");
+	if (!statm)
+		return 0;
+	if (fscanf(statm, "%ld %ld", &pages, &resident) != 2)
+		resident = 0;
+	fclose(statm);
+	return resident * (sysconf(_SC_PAGESIZE) / 1024);
+}
+
+/**
+\brief value at a percentile of a sorted list
+*/
+double getPercentile(const std::vector<double>& sorted, double percent)
+{
+	if (sorted.empty())
+		return 0.0;
+	size_t index = (size_t)(percent * 0.01 * (double)(sorted.size() - 1) + 0.5);
+	return sorted[index];
+}
+
+/**
+\brief print the stats of one per-instance timing list (microseconds)
+*/
+void printTimes(const char* name, std::vector<double> microseconds)
+{
+	double first = microseconds.empty() ? 0.0 : microseconds[0];
+	double total = 0.0;
+	for (size_t i = 0; i < microseconds.size(); i++)
+		total += microseconds[i];
+	std::sort(microseconds.begin(), microseconds.end());
+
+	printf(",\"%s\":{\"first_us\":%.2f,\"mean_us\":%.2f,\"p50_us\":%.2f,\"max_us\":%.2f}",
+		   name, first,
+		   microseconds.empty() ? 0.0 : total / (double)microseconds.size(),
+		   getPercentile(microseconds, 50.0),
+		   microseconds.empty() ? 0.0 : microseconds.back());
+}
+
+/**
+\brief apply every factory preset to a core
+
+\return elapsed microseconds
+*/
+double applyAllPresets(PluginCore* pluginCore)
+{
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for (uint32_t i = 0; i < pluginCore->getPresetCount(); i++)
+	{
+		const PresetInfo* preset = pluginCore->getPreset(i);
+		if (!preset)
+			continue;
+		for (size_t j = 0; j < preset->presetParameters.size(); j++)
+			pluginCore->setPIParamValue(preset->presetParameters[j].controlID, preset->presetParameters[j].actualValue);
+	}
+	return lapSeconds(start) * 1.0e6;
+}
+
+/**
+\brief post every factory preset as a parameter snapshot and swap each one in, as the API shell
+       and the audio thread do
+
+\param postTime_us total time spent building and posting (non-realtime thread)
+\param swapTime_us total time spent swapping in (audio thread)
+*/
+void swapAllPresets(PluginCore* pluginCore, double& postTime_us, double& swapTime_us)
+{
+	postTime_us = 0.0;
+	swapTime_us = 0.0;
+	std::chrono::steady_clock::time_point lap = std::chrono::steady_clock::now();
+	for (uint32_t i = 0; i < pluginCore->getPresetCount(); i++)
+	{
+		pluginCore->postPresetSnapshot(i);
+		postTime_us += lapSeconds(lap) * 1.0e6;
+
+		pluginCore->applyParameterSnapshot();
+		swapTime_us += lapSeconds(lap) * 1.0e6;
+	}
+}
+
+/**
+\brief bench entry point: [numInstances] (100) [dll path] (.)
+
+Operation:
+- first_us is the first instance; it pays for anything built once per process (the preset
+  catalog is built during the first preset name enumeration)
+- residentGrowth_kB is the resident set size after creating all instances minus the size
+  before the first one
+
+\return 0
+*/
+int main(int argc, char* argv[])
+{
+	uint32_t numInstances = argc > 1 ? (uint32_t)atoi(argv[1]) : 100;
+	if (numInstances == 0)
+		numInstances = 1;
+	const char* dllPath = argc > 2 ? argv[2] : ".";
+
+	PluginInfo pluginInfo;
+	pluginInfo.pathToDLL = dllPath;
+	pluginInfo.pathToPluginFolder = dllPath;
+
+	std::vector<PluginCore*> pluginCores;
+	std::vector<double> constructTimes;
+	std::vector<double> initializeTimes;
+	std::vector<double> presetNameTimes;
+	pluginCores.reserve(numInstances);
+
+	long residentStart_kB = getResidentSize_kB();
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	std::chrono::steady_clock::time_point lap = start;
+	for (uint32_t i = 0; i < numInstances; i++)
+	{
+		PluginCore* pluginCore = new PluginCore;
+		constructTimes.push_back(lapSeconds(lap) * 1.0e6);
+
+		pluginCore->initialize(pluginInfo);
+		initializeTimes.push_back(lapSeconds(lap) * 1.0e6);
+
+		// --- a shell lists the factory presets when it is created (VST3 program list, AU factory presets)
+		size_t nameLength = 0;
+		for (uint32_t p = 0; p < pluginCore->getPresetCount(); p++)
+			nameLength += strlen(pluginCore->getPresetName(p));
+		presetNameTimes.push_back(lapSeconds(lap) * 1.0e6);
+
+		if (nameLength == 0 && pluginCore->getPresetCount() > 0)
+			fprintf(stderr, "empty preset names\n");
+
+		pluginCores.push_back(pluginCore);
+	}
+	double totalSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	long residentGrowth_kB = getResidentSize_kB() - residentStart_kB;
+
+	printf("{\"plugin\":\"%s\",\"phase\":\"startup\",\"instances\":%u,\"presets\":%u,\"total_ms\":%.3f,\"perInstance_us\":%.2f,\"residentGrowth_kB\":%ld",
+		   pluginCores[0]->getPluginName(), numInstances, (uint32_t)pluginCores[0]->getPresetCount(), totalSeconds * 1.0e3,
+		   totalSeconds * 1.0e6 / (double)numInstances, residentGrowth_kB);
+	printTimes("construct", constructTimes);
+	printTimes("initialize", initializeTimes);
+	printTimes("presetNames", presetNameTimes);
+	printf("}\n");
+
+	// --- the first pass materializes each preset's parameter list, the second only applies it
+	double firstApply_us = applyAllPresets(pluginCores[0]);
+	double secondApply_us = applyAllPresets(pluginCores[0]);
+	double snapshotPost_us = 0.0;
+	double snapshotSwap_us = 0.0;
+	swapAllPresets(pluginCores[0], snapshotPost_us, snapshotSwap_us);
+	printf("{\"plugin\":\"%s\",\"phase\":\"presetApply\",\"presets\":%u,\"firstApply_us\":%.2f,\"secondApply_us\":%.2f,\"snapshotPost_us\":%.2f,\"snapshotSwap_us\":%.2f}\n",
+		   pluginCores[0]->getPluginName(), (uint32_t)pluginCores[0]->getPresetCount(), firstApply_us, secondApply_us,
+		   snapshotPost_us, snapshotSwap_us);
+	fflush(stdout);
+
+	for (size_t i = 0; i < pluginCores.size(); i++)
+		delete pluginCores[i];
+
+	return 0;
+}
@@ -0,0 +1,384 @@
+// -----------------------------------------------------------------------------
+//    ASPiK Plugin Kernel File:  blocksmoother.cpp
+//
+/**
+    \file   blocksmoother.cpp
+    \author Will Pirkle
+    \date   17-September-2018
+    \brief  implementation file for the block parameter smoother
+    		- http://www.aspikplugins.com
+    		- http://www.willpirkle.com
+*/
+// -----------------------------------------------------------------------------
+#include "blocksmoother.h"
+
+/**
+\brief allocate the active list arrays
+
+\param size maximum number of entries
+*/
+void BlockParamSmoother::ActiveList::create(uint32_t size)
+{
+	destroy();
+	slot = new uint32_t[size];
+	value = new double[size];
+	target = new double[size];
+	coeff = new double[size];
+	blockCoeff = new double[size];
+	count = 0;
+}
+
+/**
+\brief free the active list arrays
+*/
+void BlockParamSmoother::ActiveList::destroy()
+{
+	delete[] slot;
+	delete[] value;
+	delete[] target;
+	delete[] coeff;
+	delete[] blockCoeff;
+	slot = nullptr;
+	value = nullptr;
+	target = nullptr;
+	coeff = nullptr;
+	blockCoeff = nullptr;
+	count = 0;
+}
+
+/**
+\brief allocate the slots
+
+Operation:
+- all slots start idle at 0.0 as LPF smoothers; call initSlot( ) for each one
+- both active lists are sized for every slot so activation never allocates
+
+\param _numSlots number of slots
+*/
+void BlockParamSmoother::create(uint32_t _numSlots)
+{
+	destroy();
+	if (_numSlots == 0)
+		return;
+
+	numSlots = _numSlots;
+	value = new double[numSlots];
+	target = new double[numSlots];
+	pole = new double[numSlots];
+	increment = new double[numSlots];
+	settleThreshold = new double[numSlots];
+	linear = new bool[numSlots];
+	activeIndex = new int32_t[numSlots];
+	updatedSlots = new uint32_t[numSlots];
+
+	for (uint32_t i = 0; i < numSlots; i++)
+	{
+		value[i] = 0.0;
+		target[i] = 0.0;
+		pole[i] = 0.0;
+		increment[i] = 0.0;
+		settleThreshold[i] = 0.0;
+		linear[i] = false;
+		activeIndex[i] = -1;
+	}
+
+	lpfActive.create(numSlots);
+	linearActive.create(numSlots);
+	blockCoeffLength = 0;
+	numUpdated = 0;
+}
+
+/**
+\brief free the slots
+*/
+void BlockParamSmoother::destroy()
+{
+	delete[] value;
+	delete[] target;
+	delete[] pole;
+	delete[] increment;
+	delete[] settleThreshold;
+	delete[] linear;
+	delete[] activeIndex;
+	delete[] updatedSlots;
+	value = nullptr;
+	target = nullptr;
+	pole = nullptr;
+	increment = nullptr;
+	settleThreshold = nullptr;
+	linear = nullptr;
+	activeIndex = nullptr;
+	updatedSlots = nullptr;
+
+	lpfActive.destroy();
+	linearActive.destroy();
+	numSlots = 0;
+	numUpdated = 0;
+}
+
+/**
+\brief set up a slot and snap it to a value
+
+Operation:
+- calculates the same coefficients as ParamSmoother: the LPF pole for the smoothing time and the
+  linear increment that crosses the whole control range in the smoothing time
+- removes the slot from its active list
+
+\param slot the slot index
+\param smoothingTimeMsec smoothing time in mSec
+\param sampleRate fs
+\param minValue minimum control value
+\param maxValue maximum control value
+\param method LPF or linear smoothing
+\param initValue the value (and target) of the slot
+\param settleEpsilon the slot arrives within this fraction of the control range
+*/
+void BlockParamSmoother::initSlot(uint32_t slot, double smoothingTimeMsec, double sampleRate,
+								  double minValue, double maxValue, smoothingMethod method, double initValue,
+								  double settleEpsilon)
+{
+	if (slot >= numSlots)
+		return;
+
+	if (activeIndex[slot] >= 0)
+		removeActive(linear[slot] ? linearActive : lpfActive, (uint32_t)activeIndex[slot]);
+
+	double smoothingSamples = smoothingTimeMsec * 0.001 * sampleRate;
+	if (smoothingSamples > 0.0)
+	{
+		pole[slot] = exp(-kTwoPi / smoothingSamples);
+		increment[slot] = (maxValue - minValue) / smoothingSamples;
+	}
+	else
+	{
+		// --- no smoothing time: arrive in one sample
+		pole[slot] = 0.0;
+		increment[slot] = fabs(maxValue - minValue);
+	}
+
+	settleThreshold[slot] = fabs(maxValue - minValue) * settleEpsilon;
+	linear[slot] = method == smoothingMethod::kLinearSmoother;
+	value[slot] = initValue;
+	target[slot] = initValue;
+}
+
+/**
+\brief set a new target
+
+Operation:
+- an unchanged target is ignored, so this may be called every block for every parameter
+- a slot that is already moving keeps its place in the active list and simply retargets
+
+\param slot the slot index
+\param newTarget the new target value
+*/
+void BlockParamSmoother::setTarget(uint32_t slot, double newTarget)
+{
+	if (newTarget == target[slot])
+		return;
+
+	target[slot] = newTarget;
+
+	int32_t index = activeIndex[slot];
+	if (index >= 0)
+	{
+		ActiveList& list = linear[slot] ? linearActive : lpfActive;
+		list.target[index] = newTarget;
+		return;
+	}
+
+	if (!hasArrived(slot, value[slot], newTarget))
+		activate(slot);
+	else
+		value[slot] = newTarget;
+}
+
+/**
+\brief jump a slot to a value
+
+Operation:
+- value and target are both set, so the slot is at rest
+- a moving slot is removed from its active list; it is NOT reported by getUpdatedCount( )
+
+\param slot the slot index
+\param newValue the new value
+*/
+void BlockParamSmoother::snapSlot(uint32_t slot, double newValue)
+{
+	if (slot >= numSlots)
+		return;
+
+	if (activeIndex[slot] >= 0)
+		removeActive(linear[slot] ? linearActive : lpfActive, (uint32_t)activeIndex[slot]);
+
+	value[slot] = newValue;
+	target[slot] = newValue;
+}
+
+/**
+\brief add an idle slot to the end of its active list
+*/
+void BlockParamSmoother::activate(uint32_t slot)
+{
+	ActiveList& list = linear[slot] ? linearActive : lpfActive;
+	uint32_t index = list.count++;
+
+	list.slot[index] = slot;
+	list.value[index] = value[slot];
+	list.target[index] = target[slot];
+	list.coeff[index] = linear[slot] ? increment[slot] : pole[slot];
+	list.blockCoeff[index] = getBlockCoeff(slot, blockCoeffLength);
+	activeIndex[slot] = (int32_t)index;
+}
+
+/**
+\brief remove an entry from an active list by moving the last entry into its place
+*/
+void BlockParamSmoother::removeActive(ActiveList& list, uint32_t index)
+{
+	uint32_t slot = list.slot[index];
+	uint32_t last = --list.count;
+
+	if (index != last)
+	{
+		list.slot[index] = list.slot[last];
+		list.value[index] = list.value[last];
+		list.target[index] = list.target[last];
+		list.coeff[index] = list.coeff[last];
+		list.blockCoeff[index] = list.blockCoeff[last];
+		activeIndex[list.slot[index]] = (int32_t)index;
+	}
+	activeIndex[slot] = -1;
+}
+
+/**
+\brief coefficient that advances a slot by numSamples in one step: pole^N or N * increment
+*/
+double BlockParamSmoother::getBlockCoeff(uint32_t slot, uint32_t numSamples)
+{
+	if (linear[slot])
+		return increment[slot] * numSamples;
+	return pow(pole[slot], (double)numSamples);
+}
+
+/**
+\brief advance all active slots by numSamples
+
+Operation:
+- the block coefficients are cached per active entry; they are only recalculated (with pow( ))
+  when the block length changes, e.g. for a partial block
+- one branch free pass over each active list moves every value to its end-of-block value
+- a second pass snaps arrivals to their targets, removes them from the active list and
+  records every moved slot in the updated list
+- idle slots are never touched
+
+\param numSamples number of samples in the block
+*/
+void BlockParamSmoother::advanceBlock(uint32_t numSamples)
+{
+	numUpdated = 0;
+	if (numSamples == 0)
+		return;
+
+	// --- block length changed; re-cache the block coefficients of the moving slots
+	if (numSamples != blockCoeffLength)
+	{
+		blockCoeffLength = numSamples;
+		for (uint32_t i = 0; i < lpfActive.count; i++)
+			lpfActive.blockCoeff[i] = pow(lpfActive.coeff[i], (double)numSamples);
+		for (uint32_t i = 0; i < linearActive.count; i++)
+			linearActive.blockCoeff[i] = linearActive.coeff[i] * numSamples;
+	}
+
+	// --- LPF: v[N] = target + (v[0] - target) * a^N
+	{
+		double* v = lpfActive.value;
+		const double* t = lpfActive.target;
+		const double* aN = lpfActive.blockCoeff;
+		uint32_t count = lpfActive.count;
+		for (uint32_t i = 0; i < count; i++)
+			v[i] = t[i] + (v[i] - t[i]) * aN[i];
+	}
+
+	// --- linear: v[N] = v[0] + clamp(target - v[0], -N * inc, +N * inc)
+	{
+		double* v = linearActive.value;
+		const double* t = linearActive.target;
+		const double* step = linearActive.blockCoeff;
+		uint32_t count = linearActive.count;
+		for (uint32_t i = 0; i < count; i++)
+		{
+			double delta = t[i] - v[i];
+			delta = delta > step[i] ? step[i] : delta;
+			delta = delta < -step[i] ? -step[i] : delta;
+			v[i] += delta;
+		}
+	}
+
+	// --- write back, then retire the slots that arrived (backwards, removal swaps in the last entry)
+	ActiveList* lists[2] = { &lpfActive, &linearActive };
+	for (uint32_t n = 0; n < 2; n++)
+	{
+		ActiveList& list = *lists[n];
+		for (uint32_t i = list.count; i-- > 0;)
+		{
+			uint32_t slot = list.slot[i];
+			updatedSlots[numUpdated++] = slot;
+
+			if (hasArrived(slot, list.value[i], list.target[i]))
+			{
+				value[slot] = list.target[i];
+				removeActive(list, i);
+			}
+			else
+				value[slot] = list.value[i];
+		}
+	}
+}
+
+/**
+\brief write the per-sample ramp of the next numSamples of a slot
+
+Operation:
+- uses the per-sample recursion, so ramp[numSamples - 1] matches the value after advanceBlock(numSamples)
+- an idle slot produces a flat ramp
+- does not change the slot; call advanceBlock( ) as usual
+
+\param slot the slot index
+\param ramp output array of at least numSamples values
+\param numSamples number of samples to write
+*/
+void BlockParamSmoother::getRamp(uint32_t slot, double* ramp, uint32_t numSamples)
+{
+	double v = value[slot];
+	double t = target[slot];
+
+	if (activeIndex[slot] < 0)
+	{
+		for (uint32_t i = 0; i < numSamples; i++)
+			ramp[i] = v;
+		return;
+	}
+
+	if (linear[slot])
+	{
+		double step = increment[slot];
+		for (uint32_t i = 0; i < numSamples; i++)
+		{
+			double delta = t - v;
+			delta = delta > step ? step : delta;
+			delta = delta < -step ? -step : delta;
+			v += delta;
+			ramp[i] = v;
+		}
+	}
+	else
+	{
+		double a = pole[slot];
+		for (uint32_t i = 0; i < numSamples; i++)
+		{
+			v = t + (v - t) * a;
+			ramp[i] = v;
+		}
+	}
+}
@@ -0,0 +1,494 @@
+// -----------------------------------------------------------------------------
+//    ASPiK Plugin Kernel File:  fftbackend.h
+//
+/**
+    \file   fftbackend.h
+    \author Will Pirkle
+    \date   17-September-2018
+    \brief  FFT backend for the FFT objects (fxobjects) and the spectrum view (customviews)
+    		- builds that define HAVE_FFTW=1 (see LINK_FFTW in the top level CMakeLists.txt)
+    		  use FFTW; fftw3.h must be on the include path and libfftw3 linked
+    		- all other builds use the built-in FFT below, behind the subset of the FFTW API
+    		  that the objects use, so the same code compiles against either backend
+    		- http://www.aspikplugins.com
+    		- http://www.willpirkle.com
+*/
+// -----------------------------------------------------------------------------
+#ifndef _FFTBackend_H_
+#define _FFTBackend_H_
+
+#ifdef HAVE_FFTW
+
+#include "fftw3.h"
+
+#else
+
+#include <atomic>
+#include <math.h>
+#include <memory>
+#include <mutex>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+// --- built-in FFT SIMD width: doubles per vector register, chosen at compile time
+#if defined(__AVX__)
+	#include <immintrin.h>
+	#define FFT_BACKEND_AVX 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#include <emmintrin.h>
+	#define FFT_BACKEND_SSE2 1
+#endif
+
+// --- built-in FFT limits: lengths are powers of 2 up to 2^FFT_BACKEND_MAX_LOG2
+const uint32_t FFT_BACKEND_MAX_LOG2 = 24;
+
+/**
+\struct FFTBackendVector
+\ingroup ASPiK-Core
+\brief
+A few doubles in one vector register for the FFT butterflies: 4 with AVX, 2 with SSE2, otherwise 1 (scalar).
+Loads and stores are unaligned.
+*/
+#if defined(FFT_BACKEND_AVX)
+struct FFTBackendVector
+{
+	enum { kWidth = 4 };
+	__m256d v;
+	static inline FFTBackendVector load(const double* p) { FFTBackendVector r; r.v = _mm256_loadu_pd(p); return r; }
+	static inline FFTBackendVector set1(double x) { FFTBackendVector r; r.v = _mm256_set1_pd(x); return r; }
+	inline void store(double* p) const { _mm256_storeu_pd(p, v); }
+	inline FFTBackendVector operator+(const FFTBackendVector& b) const { FFTBackendVector r; r.v = _mm256_add_pd(v, b.v); return r; }
+	inline FFTBackendVector operator-(const FFTBackendVector& b) const { FFTBackendVector r; r.v = _mm256_sub_pd(v, b.v); return r; }
+	inline FFTBackendVector operator*(const FFTBackendVector& b) const { FFTBackendVector r; r.v = _mm256_mul_pd(v, b.v); return r; }
+};
+#elif defined(FFT_BACKEND_SSE2)
+struct FFTBackendVector
+{
+	enum { kWidth = 2 };
+	__m128d v;
+	static inline FFTBackendVector load(const double* p) { FFTBackendVector r; r.v = _mm_loadu_pd(p); return r; }
+	static inline FFTBackendVector set1(double x) { FFTBackendVector r; r.v = _mm_set1_pd(x); return r; }
+	inline void store(double* p) const { _mm_storeu_pd(p, v); }
+	inline FFTBackendVector operator+(const FFTBackendVector& b) const { FFTBackendVector r; r.v = _mm_add_pd(v, b.v); return r; }
+	inline FFTBackendVector operator-(const FFTBackendVector& b) const { FFTBackendVector r; r.v = _mm_sub_pd(v, b.v); return r; }
+	inline FFTBackendVector operator*(const FFTBackendVector& b) const { FFTBackendVector r; r.v = _mm_mul_pd(v, b.v); return r; }
+};
+#else
+struct FFTBackendVector
+{
+	enum { kWidth = 1 };
+	double v;
+	static inline FFTBackendVector load(const double* p) { FFTBackendVector r; r.v = *p; return r; }
+	static inline FFTBackendVector set1(double x) { FFTBackendVector r; r.v = x; return r; }
+	inline void store(double* p) const { *p = v; }
+	inline FFTBackendVector operator+(const FFTBackendVector& b) const { FFTBackendVector r; r.v = v + b.v; return r; }
+	inline FFTBackendVector operator-(const FFTBackendVector& b) const { FFTBackendVector r; r.v = v - b.v; return r; }
+	inline FFTBackendVector operator*(const FFTBackendVector& b) const { FFTBackendVector r; r.v = v * b.v; return r; }
+};
+#endif
+
+/**
+\class BuiltInFFT
+\ingroup ASPiK-Core
+\brief
+The tables of the built-in FFT for one power of 2 length N; shared by every plan of that length.
+
+BuiltInFFT Operations:
+- complex FFT: radix-2 Stockham autosort on split real/imaginary arrays, so no bit reversal pass is needed
+  and the butterflies of the later stages run on whole vector registers
+- real FFT of length N: one complex FFT of length N/2 on the even/odd samples packed as real/imaginary
+  parts, then a post-processing pass that splits their spectra; the output is the half spectrum, bins 0 to N/2
+- inverse transforms are unnormalized (scaled by N), the same as FFTW
+- one twiddle table, exp(-2*pi*i*k/N) for k < N/2, serves every stage and both real FFT passes
+- getTables( ) creates the tables once per length and caches them for the life of the process; creating
+  them is NOT realtime safe, but plans are only made in the objects' initialize( ) calls; the cached
+  tables are read only, so any number of threads may transform with them at once
+- the work arrays belong to the caller (see fftw_plan_s), never to the shared tables
+*/
+class BuiltInFFT
+{
+public:
+	/** the shared tables for a length; nullptr if it is not a power of 2 within the limits; NOT realtime safe the first time */
+	static const BuiltInFFT* getTables(uint32_t length)
+	{
+		uint32_t log2Length = 0;
+		while (log2Length <= FFT_BACKEND_MAX_LOG2 && ((uint32_t)1 << log2Length) < length)
+			log2Length++;
+		if (log2Length > FFT_BACKEND_MAX_LOG2 || ((uint32_t)1 << log2Length) != length)
+			return nullptr;
+
+		TableCache& cache = getCache();
+		const BuiltInFFT* tables = cache.tables[log2Length].load(std::memory_order_acquire);
+		if (tables)
+			return tables;
+
+		std::lock_guard<std::mutex> lock(cache.mutex);
+		tables = cache.tables[log2Length].load(std::memory_order_relaxed);
+		if (!tables)
+		{
+			tables = new BuiltInFFT(length);
+			cache.tables[log2Length].store(tables, std::memory_order_release);
+		}
+		return tables;
+	}
+
+	/** FFT length N */
+	uint32_t getLength() const { return length; }
+
+	/** forward complex FFT of length N, in place in split format; work arrays are N long */
+	void complexForward(double* real, double* imag, double* workReal, double* workImag) const
+	{
+		stockham(real, imag, workReal, workImag, length);
+	}
+
+	/** inverse complex FFT of length N (scaled by N), in place in split format; work arrays are N long */
+	void complexInverse(double* real, double* imag, double* workReal, double* workImag) const
+	{
+		// --- the inverse DFT is the forward DFT with the real and imaginary parts swapped going in and out
+		stockham(imag, real, workImag, workReal, length);
+	}
+
+	/**
+	\brief forward real FFT of length N: N samples in, bins 0 to N/2 out (interleaved real/imaginary)
+
+	\param input N real samples
+	\param output N/2 + 1 complex bins; may not alias the work arrays
+	\param work 4 * N/2 doubles
+	*/
+	void realForward(const double* input, double (*output)[2], double* work) const
+	{
+		uint32_t half = length / 2;
+		double* zReal = work;
+		double* zImag = work + half;
+
+		// --- pack: z(n) = x(2n) + i x(2n + 1)
+		for (uint32_t n = 0; n < half; n++)
+		{
+			zReal[n] = input[2 * n];
+			zImag[n] = input[2 * n + 1];
+		}
+		stockham(zReal, zImag, work + 2 * half, work + 3 * half, half);
+
+		// --- split: E(k) = (Z(k) + Z*(M-k))/2, O(k) = (Z(k) - Z*(M-k))/2i, X(k) = E(k) + W^k O(k), X(M-k) = (E(k) - W^k O(k))*
+		output[0][0] = zReal[0] + zImag[0];
+		output[0][1] = 0.0;
+		output[half][0] = zReal[0] - zImag[0];
+		output[half][1] = 0.0;
+		for (uint32_t k = 1; k <= half / 2; k++)
+		{
+			uint32_t j = half - k;
+			double eReal = 0.5 * (zReal[k] + zReal[j]);
+			double eImag = 0.5 * (zImag[k] - zImag[j]);
+			double oReal = 0.5 * (zImag[k] + zImag[j]);
+			double oImag = 0.5 * (zReal[j] - zReal[k]);
+			double wReal = twiddleReal[k] * oReal - twiddleImag[k] * oImag;
+			double wImag = twiddleReal[k] * oImag + twiddleImag[k] * oReal;
+			output[k][0] = eReal + wReal;
+			output[k][1] = eImag + wImag;
+			output[j][0] = eReal - wReal;
+			output[j][1] = wImag - eImag;
+		}
+	}
+
+	/**
+	\brief inverse real FFT of length N (scaled by N): bins 0 to N/2 in, N samples out
+
+	\param input N/2 + 1 complex bins; the imaginary parts of bins 0 and N/2 are ignored
+	\param output N real samples; may not alias the work arrays
+	\param work 4 * N/2 doubles
+	*/
+	void realInverse(const double (*input)[2], double* output, double* work) const
+	{
+		uint32_t half = length / 2;
+		double* zReal = work;
+		double* zImag = work + half;
+
+		// --- merge: E(k) = X(k) + X*(M-k), O(k) = (X(k) - X*(M-k)) W^-k, Z(k) = E(k) + i O(k)
+		zReal[0] = input[0][0] + input[half][0];
+		zImag[0] = input[0][0] - input[half][0];
+		for (uint32_t k = 1; k <= half / 2; k++)
+		{
+			uint32_t j = half - k;
+			double eReal = input[k][0] + input[j][0];
+			double eImag = input[k][1] - input[j][1];
+			double dReal = input[k][0] - input[j][0];
+			double dImag = input[k][1] + input[j][1];
+			double oReal = dReal * twiddleReal[k] + dImag * twiddleImag[k];
+			double oImag = dImag * twiddleReal[k] - dReal * twiddleImag[k];
+			zReal[k] = eReal - oImag;
+			zImag[k] = eImag + oReal;
+			zReal[j] = eReal + oImag;
+			zImag[j] = oReal - eImag;
+		}
+		stockham(zImag, zReal, work + 3 * half, work + 2 * half, half);
+
+		// --- unpack: x(2n) + i x(2n + 1) = z(n)
+		for (uint32_t n = 0; n < half; n++)
+		{
+			output[2 * n] = zReal[n];
+			output[2 * n + 1] = zImag[n];
+		}
+	}
+
+protected:
+	/** the cache of tables, one slot per power of 2 */
+	struct TableCache
+	{
+		std::mutex mutex;
+		std::atomic<const BuiltInFFT*> tables[FFT_BACKEND_MAX_LOG2 + 1];
+
+		TableCache()
+		{
+			for (uint32_t i = 0; i <= FFT_BACKEND_MAX_LOG2; i++)
+				tables[i].store(nullptr, std::memory_order_relaxed);
+		}
+		~TableCache()
+		{
+			for (uint32_t i = 0; i <= FFT_BACKEND_MAX_LOG2; i++)
+				delete tables[i].load(std::memory_order_relaxed);
+		}
+	};
+
+	static TableCache& getCache()
+	{
+		static TableCache cache;
+		return cache;
+	}
+
+	explicit BuiltInFFT(uint32_t _length)
+		: length(_length)
+	{
+		uint32_t half = length > 1 ? length / 2 : 1;
+		twiddleReal.reset(new double[half]);
+		twiddleImag.reset(new double[half]);
+		for (uint32_t k = 0; k < half; k++)
+		{
+			double angle = -2.0 * 3.14159265358979323846 * (double)k / (double)length;
+			twiddleReal[k] = cos(angle);
+			twiddleImag[k] = sin(angle);
+		}
+	}
+
+	/**
+	\brief forward complex FFT of length n (a power of 2, at most N), in place; x ping-pongs with y
+	and the result is copied back to x if it ends up in y
+
+	Operation:
+	- stage with sub-transform length L and stride s = n/L: for p < L/2 and q < s,
+	  y[q + s(2p)] = a + b and y[q + s(2p + 1)] = (a - b) W_L^p, with a = x[q + sp] and b = x[q + s(p + L/2)]
+	- W_L^p = exp(-2*pi*i*p/L) is entry p * N/L of the table
+	- q runs over contiguous samples, so once s reaches the vector width the butterflies are vectorized
+	*/
+	void stockham(double* xReal, double* xImag, double* yReal, double* yImag, uint32_t n) const
+	{
+		double* srcReal = xReal;
+		double* srcImag = xImag;
+		double* dstReal = yReal;
+		double* dstImag = yImag;
+
+		uint32_t stride = 1;
+		for (uint32_t subLength = n; subLength > 1; subLength >>= 1)
+		{
+			uint32_t m = subLength / 2;
+			uint32_t twiddleStep = length / subLength;
+
+			for (uint32_t p = 0; p < m; p++)
+			{
+				double wReal = twiddleReal[p * twiddleStep];
+				double wImag = twiddleImag[p * twiddleStep];
+				const double* aReal = srcReal + stride * p;
+				const double* aImag = srcImag + stride * p;
+				const double* bReal = srcReal + stride * (p + m);
+				const double* bImag = srcImag + stride * (p + m);
+				double* cReal = dstReal + stride * 2 * p;
+				double* cImag = dstImag + stride * 2 * p;
+				double* dReal = cReal + stride;
+				double* dImag = cImag + stride;
+
+				uint32_t q = 0;
+				if (stride >= (uint32_t)FFTBackendVector::kWidth)
+				{
+					FFTBackendVector vwReal = FFTBackendVector::set1(wReal);
+					FFTBackendVector vwImag = FFTBackendVector::set1(wImag);
+					for (; q < stride; q += FFTBackendVector::kWidth)
+					{
+						FFTBackendVector ar = FFTBackendVector::load(aReal + q);
+						FFTBackendVector ai = FFTBackendVector::load(aImag + q);
+						FFTBackendVector br = FFTBackendVector::load(bReal + q);
+						FFTBackendVector bi = FFTBackendVector::load(bImag + q);
+						(ar + br).store(cReal + q);
+						(ai + bi).store(cImag + q);
+						FFTBackendVector tr = ar - br;
+						FFTBackendVector ti = ai - bi;
+						(tr * vwReal - ti * vwImag).store(dReal + q);
+						(tr * vwImag + ti * vwReal).store(dImag + q);
+					}
+				}
+				for (; q < stride; q++)
+				{
+					double ar = aReal[q], ai = aImag[q];
+					double br = bReal[q], bi = bImag[q];
+					cReal[q] = ar + br;
+					cImag[q] = ai + bi;
+					double tr = ar - br;
+					double ti = ai - bi;
+					dReal[q] = tr * wReal - ti * wImag;
+					dImag[q] = tr * wImag + ti * wReal;
+				}
+			}
+
+			double* swap = srcReal; srcReal = dstReal; dstReal = swap;
+			swap = srcImag; srcImag = dstImag; dstImag = swap;
+			stride <<= 1;
+		}
+
+		if (srcReal != xReal)
+		{
+			memcpy(xReal, srcReal, n * sizeof(double));
+			memcpy(xImag, srcImag, n * sizeof(double));
+		}
+	}
+
+	uint32_t length = 0;							///< N
+	std::unique_ptr<double[]> twiddleReal = nullptr;	///< cos(-2*pi*k/N), k < N/2
+	std::unique_ptr<double[]> twiddleImag = nullptr;	///< sin(-2*pi*k/N), k < N/2
+
+private:
+	BuiltInFFT(const BuiltInFFT&);
+	BuiltInFFT& operator=(const BuiltInFFT&);
+};
+
+// --- the FFTW API subset used by the FFT objects; power of 2 lengths only
+typedef double fftw_complex[2];
+
+#define FFTW_FORWARD (-1)
+#define FFTW_BACKWARD (+1)
+#define FFTW_MEASURE (0U)
+#define FFTW_ESTIMATE (1U << 6)
+
+/**
+\struct fftw_plan_s
+\ingroup ASPiK-Core
+\brief
+A built-in FFT plan: the arrays it was made for, the shared tables of its length and its own work arrays,
+so plans of the same length never share scratch memory.
+*/
+struct fftw_plan_s
+{
+	enum { kComplex, kRealToComplex, kComplexToReal };
+	int kind = kComplex;				///< transform type
+	int sign = FFTW_FORWARD;			///< complex transforms: FFTW_FORWARD or FFTW_BACKWARD
+	uint32_t length = 0;				///< N
+	const BuiltInFFT* tables = nullptr;	///< shared tables
+	fftw_complex* complexIn = nullptr;	///< complex and c2r input
+	fftw_complex* complexOut = nullptr;	///< complex and r2c output
+	double* realIn = nullptr;			///< r2c input
+	double* realOut = nullptr;			///< c2r output
+	std::unique_ptr<double[]> work = nullptr;	///< 4 * N doubles
+};
+typedef fftw_plan_s* fftw_plan;
+
+/** allocate an FFT array; the built-in FFT does not need aligned memory */
+inline void* fftw_malloc(size_t bytes) { return malloc(bytes); }
+
+/** free an array from fftw_malloc( ) */
+inline void fftw_free(void* pointer) { free(pointer); }
+
+/** make a plan; nullptr if the length is not a power of 2 within the limits */
+inline fftw_plan makeBuiltInFFTPlan(int kind, int n, int sign)
+{
+	const BuiltInFFT* tables = n > 0 ? BuiltInFFT::getTables((uint32_t)n) : nullptr;
+	if (!tables || (kind != fftw_plan_s::kComplex && n < 2))
+		return nullptr;
+
+	fftw_plan plan = new fftw_plan_s;
+	plan->kind = kind;
+	plan->sign = sign;
+	plan->length = (uint32_t)n;
+	plan->tables = tables;
+	plan->work.reset(new double[4 * (size_t)n]);
+	return plan;
+}
+
+/** complex FFT plan: n complex points in, n complex points out; in and out may be the same array */
+inline fftw_plan fftw_plan_dft_1d(int n, fftw_complex* in, fftw_complex* out, int sign, unsigned /*flags*/)
+{
+	fftw_plan plan = makeBuiltInFFTPlan(fftw_plan_s::kComplex, n, sign);
+	if (plan)
+	{
+		plan->complexIn = in;
+		plan->complexOut = out;
+	}
+	return plan;
+}
+
+/** real FFT plan: n real points in, n/2 + 1 complex bins out */
+inline fftw_plan fftw_plan_dft_r2c_1d(int n, double* in, fftw_complex* out, unsigned /*flags*/)
+{
+	fftw_plan plan = makeBuiltInFFTPlan(fftw_plan_s::kRealToComplex, n, FFTW_FORWARD);
+	if (plan)
+	{
+		plan->realIn = in;
+		plan->complexOut = out;
+	}
+	return plan;
+}
+
+/** inverse real FFT plan: n/2 + 1 complex bins in, n real points out (scaled by n) */
+inline fftw_plan fftw_plan_dft_c2r_1d(int n, fftw_complex* in, double* out, unsigned /*flags*/)
+{
+	fftw_plan plan = makeBuiltInFFTPlan(fftw_plan_s::kComplexToReal, n, FFTW_BACKWARD);
+	if (plan)
+	{
+		plan->complexIn = in;
+		plan->realOut = out;
+	}
+	return plan;
+}
+
+/** run a plan on its arrays; realtime safe */
+inline void fftw_execute(const fftw_plan plan)
+{
+	if (!plan)
+		return;
+
+	uint32_t n = plan->length;
+	double* work = &plan->work[0];
+
+	if (plan->kind == fftw_plan_s::kRealToComplex)
+		plan->tables->realForward(plan->realIn, plan->complexOut, work);
+	else if (plan->kind == fftw_plan_s::kComplexToReal)
+		plan->tables->realInverse(plan->complexIn, plan->realOut, work);
+	else
+	{
+		double* real = work;
+		double* imag = work + n;
+		for (uint32_t i = 0; i < n; i++)
+		{
+			real[i] = plan->complexIn[i][0];
+			imag[i] = plan->complexIn[i][1];
+		}
+
+		if (plan->sign == FFTW_FORWARD)
+			plan->tables->complexForward(real, imag, work + 2 * n, work + 3 * n);
+		else
+			plan->tables->complexInverse(real, imag, work + 2 * n, work + 3 * n);
+
+		for (uint32_t i = 0; i < n; i++)
+		{
+			plan->complexOut[i][0] = real[i];
+			plan->complexOut[i][1] = imag[i];
+		}
+	}
+}
+
+/** destroy a plan; the shared tables stay cached */
+inline void fftw_destroy_plan(fftw_plan plan)
+{
+	delete plan;
+}
+
+#endif // HAVE_FFTW
+
+#endif /* defined(_FFTBackend_H_) */
@@ -28,6 +28,7 @@ PluginBase::PluginBase()
     memset(&auxOutputFrame, 0, sizeof(float)*MAX_CHANNEL_COUNT);
 
     pluginHostConnector = nullptr;
+	smoothingSnapPending = false;
 }
 
 /**
@@ -36,7 +37,7 @@ PluginBase::PluginBase()
 Operation:
 - destroy all plugin parameters and remove pointers from all lists
 - clean out I/O combinations
-- remove presets
+- NOTE: the presets belong to the shared PresetCatalog and are not destroyed here
 */
 PluginBase::~PluginBase()
 {
@@ -48,16 +49,20 @@ PluginBase::~PluginBase()
 		delete[] pluginDescriptor.supportedAuxIOCombinations;
 	pluginDescriptor.supportedAuxIOCombinations = 0;
 
-    removeAllPresets();
-
     for(std::vector<PluginParameter*>::iterator it = pluginParameters.begin(); it != pluginParameters.end(); ++it) {
         delete *it;
     }
     pluginParameters.clear();
     pluginParameterMap.clear();
+	destroyParameterIndex();
 	delete [] pluginParameterArray;
 	delete [] smoothablePluginParameters;
+	delete [] smoothableSlotOfParameter;
+	delete [] activeSmoothingSlots;
+	delete [] activeSmoothingIndex;
+	delete [] queuedSmoothingSlots;
 	delete [] outboundPluginParameters;
+	delete [] boundVariableGroupMasks;
 }
 
 /**
@@ -77,6 +82,9 @@ bool PluginBase::reset(ResetInfo& resetInfo)
 			piParam->updateSampleRate(resetInfo.sampleRate);
 	}
 
+	// --- and the block smoother
+	initBlockParamSmoother(resetInfo.sampleRate);
+
 	return true;
 }
 
@@ -98,8 +106,17 @@ bool PluginBase::initialize(PluginInfo& _pluginInfo)
 \brief initialize object for a new run of audio; called just before audio streams
 
 Operation:
-- iterate through parameters and copy their values into the bound variables you set up
+- take the parameters flagged in the ParameterChangeSet since the last sync and copy their values
+  into the bound variables you set up; parameters that did not change are not visited
 - then, call the postUpdatePluginParameter method to do any post-update cooking required to use the variable for processing
+- every parameter is flagged at startup and after a bulk state restore, so those syncs visit them
+  all; a snapshot swap only flags the parameters it changed
+- getInBoundUpdateCount( ) reports how many parameters this sync visited
+- a changed smoothable parameter is put on the active smoothing list, so
+  doSampleAccurateParameterUpdates( ) starts moving it towards its new target (or
+  doBlockParameterUpdates( ) hands the new target to the block smoother)
+- the parameters handed a VST3 update queue since the last sync replace the queued list that
+  doBlockParameterUpdates( ) drains
 */
 void PluginBase::syncInBoundVariables()
 {
@@ -107,14 +124,94 @@ void PluginBase::syncInBoundVariables()
 	info.bufferProcUpdate = true;
 	info.boundVariableUpdate = true;
 
-	// --- rip through and synch em
-	for (unsigned int i = 0; i < numPluginParameters; i++)
+	// --- a bulk state restore happened since the last block: no gliding to the restored values
+	if (smoothingSnapPending.exchange(false))
+		snapParameterSmoothing();
+
+	// --- new VST3 queues (the API sets them just before the buffer); a sync with none keeps the list
+	uint32_t numWords = parameterChanges.getWordCount();
+	bool queuesTaken = false;
+	for (uint32_t word = 0; word < numWords; word++)
 	{
-		if (pluginParameterArray[i] && pluginParameterArray[i]->updateInBoundVariable())
+		uint64_t queued = parameterQueueChanges.takeWord(word);
+		if (queued && !queuesTaken)
 		{
-			postUpdatePluginParameter(pluginParameterArray[i]->getControlID(), pluginParameterArray[i]->getControlValue(), info);
+			numQueuedSmoothingSlots = 0;
+			queuesTaken = true;
+		}
+
+		while (queued)
+		{
+			uint32_t i = word * 64 + ParameterChangeSet::getLowestBit(queued);
+			queued &= queued - 1;
+
+			if (smoothableSlotOfParameter[i] < numSmoothablePluginParameters)
+				queuedSmoothingSlots[numQueuedSmoothingSlots++] = smoothableSlotOfParameter[i];
+		}
+	}
+
+	// --- rip through the changed ones and synch em
+	inBoundUpdateCount = 0;
+	for (uint32_t word = 0; word < numWords; word++)
+	{
+		uint64_t changed = parameterChanges.takeWord(word);
+		while (changed)
+		{
+			uint32_t i = word * 64 + ParameterChangeSet::getLowestBit(changed);
+			changed &= changed - 1;
+
+			// --- a new target (or a new VST3 automation queue) wakes the per-sample smoother
+			if (smoothableSlotOfParameter[i] < numSmoothablePluginParameters)
+				activateSmoothingSlot(smoothableSlotOfParameter[i]);
+
+			if (pluginParameterArray[i] && pluginParameterArray[i]->updateInBoundVariable())
+			{
+				// --- only new values flag their groups
+				if (pluginParameterArray[i]->getInBoundVariableChanged())
+					setBoundVariableChanged(pluginParameterArray[i]->getControlID());
+
+				postUpdatePluginParameter(pluginParameterArray[i]->getControlID(), pluginParameterArray[i]->getControlValue(), info);
+			}
+			inBoundUpdateCount++;
 		}
 	}
+	totalInBoundUpdates += inBoundUpdateCount;
+}
+
+/**
+\brief add a bound variable to a change tracking group
+
+Operation:
+- groups let a derived class skip work for bound variables that did not change, e.g. only rewriting
+  the parameter structures of the modules whose controls moved
+- a control ID may be added to several groups; a control ID that is never added belongs to every group
+- NOT realtime safe; call once after initPluginParameterArray( )
+
+\param controlID the control ID of the bound variable
+\param group the group index (0 to MAX_BOUND_VARIABLE_GROUPS - 1)
+*/
+void PluginBase::addBoundVariableGroup(uint32_t controlID, uint32_t group)
+{
+	if (group >= MAX_BOUND_VARIABLE_GROUPS || controlID >= numBoundVariableGroupMasks)
+		return;
+
+	uint64_t groupBit = (uint64_t)1 << group;
+	if (boundVariableGroupMasks[controlID] & groupBit)
+		return;
+
+	boundVariableGroupMasks[controlID] |= groupBit;
+	boundVariableGroupSize[group]++;
+}
+
+/**
+\brief flag the groups of a bound variable as changed
+
+\param controlID the control ID of the bound variable
+*/
+void PluginBase::setBoundVariableChanged(uint32_t controlID)
+{
+	uint64_t mask = controlID < numBoundVariableGroupMasks ? boundVariableGroupMasks[controlID] : 0;
+	changedBoundVariableGroups |= mask ? mask : ~(uint64_t)0;
 }
 
 /**
@@ -172,12 +269,12 @@ bool PluginBase::processAudioBuffers(ProcessBufferInfo& processBufferInfo)
 		{
 			for (uint32_t i = 0; i<processBufferInfo.numAudioInChannels; i++)
 			{
-				inputFrame[i] = processBufferInfo.inputs[i][frame];
+				inputFrame[i] = processBufferInfo.doublePrecision ? (float)processBufferInfo.inputs64[i][frame] : processBufferInfo.inputs[i][frame];
 			}
 
 			for (uint32_t i = 0; i<processBufferInfo.numAuxAudioInChannels; i++)
 			{
-				auxInputFrame[i] = processBufferInfo.auxInputs[i][frame];
+				auxInputFrame[i] = processBufferInfo.doublePrecision ? (float)processBufferInfo.auxInputs64[i][frame] : processBufferInfo.auxInputs[i][frame];
 			}
 
 			info.currentFrame = frame;
@@ -187,11 +284,17 @@ bool PluginBase::processAudioBuffers(ProcessBufferInfo& processBufferInfo)
 
 			for (uint32_t i = 0; i<processBufferInfo.numAudioOutChannels; i++)
 			{
-				processBufferInfo.outputs[i][frame] = outputFrame[i];
+				if (processBufferInfo.doublePrecision)
+					processBufferInfo.outputs64[i][frame] = outputFrame[i];
+				else
+					processBufferInfo.outputs[i][frame] = outputFrame[i];
 			}
 			for (uint32_t i = 0; i<processBufferInfo.numAuxAudioOutChannels; i++)
 			{
-				processBufferInfo.auxOutputs[i][frame] = auxOutputFrame[i];
+				if (processBufferInfo.doublePrecision)
+					processBufferInfo.auxOutputs64[i][frame] = auxOutputFrame[i];
+				else
+					processBufferInfo.auxOutputs[i][frame] = auxOutputFrame[i];
 			}
 
 			// --- update per-frame
@@ -242,14 +345,17 @@ NOTE:
 - beware: this function can eat a lot of CPU if the sample accurate updates trigger complex cooking functions
 - to combat CPU usage, you can set the VST3 sample granularity in initPluginDescriptors() apiSpecificInfo.vst3SampleAccurateGranularity
 - you can also change the parameter smoothing granularity
-- but in either case, the list MUST be iterated; this function is the reason for the old-fashioned C-array of pointers\n
-  as it was found to be faster than any other list method for entire-list iteration (if you have a faster way, let me knmow!)
+- only the active smoothing list is iterated: syncInBoundVariables( ) adds the parameters that changed
+  and a smoother that settles on its target (within its settle epsilon) drops off the list, so the
+  cost follows the number of knobs that are actually moving
+- parameters with a VST3 sample accurate queue stay on the list, since the queue may deliver a value
+  on any sample of the buffer
 - the parameter is updated with the smoothed value
 - the post-parameter update function is then called (complex cooking functions here will eat the CPU as well)
 */
 void PluginBase::doSampleAccurateParameterUpdates()
 {
-	if (numSmoothablePluginParameters == 0)
+	if (numActiveSmoothingSlots == 0)
 		return;
 
 	// --- do updates
@@ -261,10 +367,10 @@ void PluginBase::doSampleAccurateParameterUpdates()
 	ParameterUpdateInfo paramSmoothUpdate(true, false); /// true = this is called from smoothing operation, false = NOT VST sample accurate update
 	paramSmoothUpdate.isSmoothing = true;
 
-	// --- rip through the array
-	for (unsigned int i = 0; i < numSmoothablePluginParameters; i++)
+	// --- rip through the active list (backwards, deactivation swaps in the last entry)
+	for (uint32_t n = numActiveSmoothingSlots; n-- > 0;)
 	{
-		PluginParameter* piParam = smoothablePluginParameters[i];
+		PluginParameter* piParam = smoothablePluginParameters[activeSmoothingSlots[n]];
 		if (piParam)
 		{
 			// --- do smoothing: first choice is for VST SAA (VST3 hosts only)
@@ -272,11 +378,13 @@ void PluginBase::doSampleAccurateParameterUpdates()
 			{
 				if (piParam->getParameterUpdateQueue()->getNextValue(value))
 				{
-					piParam->setControlValueNormalized(value, false, true); // false = do not apply taper, true = ignore smoothing (not needed here)
+					piParam->applySmoothedControlValue(piParam->getControlValueWithNormalizedValue(value, false)); // false = do not apply taper
 					// --- now update the bound variable
 					if (piParam->updateInBoundVariable())
 					{
 						vst3Update.boundVariableUpdate = true;
+						if (piParam->getInBoundVariableChanged())
+							setBoundVariableChanged(piParam->getControlID());
 					}
 					postUpdatePluginParameter(piParam->getControlID(), piParam->getControlValue(), vst3Update);
 				}
@@ -288,13 +396,175 @@ void PluginBase::doSampleAccurateParameterUpdates()
 				if (piParam->updateInBoundVariable())
 				{
 					paramSmoothUpdate.boundVariableUpdate = true;
+					if (piParam->getInBoundVariableChanged())
+						setBoundVariableChanged(piParam->getControlID());
 				}
 				postUpdatePluginParameter(piParam->getControlID(), piParam->getControlValue(), paramSmoothUpdate);
 			}
+			// --- settled
+			else
+				deactivateSmoothingSlot(n);
 		}
 	}
 }
 
+/**
+\brief add a smoothable parameter to the end of the active smoothing list; audio thread only
+
+\param slot the smoothablePluginParameters index
+*/
+void PluginBase::activateSmoothingSlot(uint32_t slot)
+{
+	if (activeSmoothingIndex[slot] >= 0)
+		return;
+
+	activeSmoothingIndex[slot] = (int32_t)numActiveSmoothingSlots;
+	activeSmoothingSlots[numActiveSmoothingSlots++] = slot;
+}
+
+/**
+\brief remove an entry from the active smoothing list by moving the last entry into its place; audio thread only
+
+\param index the activeSmoothingSlots index
+*/
+void PluginBase::deactivateSmoothingSlot(uint32_t index)
+{
+	uint32_t slot = activeSmoothingSlots[index];
+	uint32_t last = --numActiveSmoothingSlots;
+
+	if (index != last)
+	{
+		activeSmoothingSlots[index] = activeSmoothingSlots[last];
+		activeSmoothingIndex[activeSmoothingSlots[index]] = (int32_t)index;
+	}
+	activeSmoothingIndex[slot] = -1;
+}
+
+/**
+\brief combines parameter smoothing and VST3 sample accurate updates for a whole block
+
+Operation:
+- this is the block version of doSampleAccurateParameterUpdates( ) for processors that only
+  use the parameter values once per block (e.g. block rendering synths)
+- VST3 sample accurate updates: only the parameters on the queued list (the ones the API handed a
+  queue for this buffer) are visited; the queue is drained for the block and only the last value
+  is applied
+- smoothing: the active smoothing list holds the parameters that changed since the last block
+  (syncInBoundVariables( )); each hands its new target to the BlockParamSmoother and leaves the
+  list, and the smoother moves all moving parameters to their end-of-block values in one pass
+- idle parameters are not visited, so the cost follows the number of changing and moving parameters
+- postUpdatePluginParameter( ) is called once per changed parameter per block, not once per sample
+
+\param numSamples number of samples in the block
+*/
+void PluginBase::doBlockParameterUpdates(uint32_t numSamples)
+{
+	if (numSmoothablePluginParameters == 0)
+		return;
+
+	// --- do updates
+	double value = 0;
+	bool vstSAAEnabled = wantsVST3SampleAccurateAutomation();
+	ParameterUpdateInfo vst3Update(false, true); /// false = this is NOT called from smoothing operation, true: this is a VST sample accurate update
+	vst3Update.isVSTSampleAccurateUpdate = true;
+
+	ParameterUpdateInfo paramSmoothUpdate(true, false); /// true = this is called from smoothing operation, false = NOT VST sample accurate update
+	paramSmoothUpdate.isSmoothing = true;
+
+	// --- VST SAA first: only the parameters with a queue for this buffer
+	for (uint32_t n = 0; vstSAAEnabled && n < numQueuedSmoothingSlots; n++)
+	{
+		PluginParameter* piParam = smoothablePluginParameters[queuedSmoothingSlots[n]];
+		if (piParam && piParam->getEnableVSTSampleAccurateAutomation() && piParam->getParameterUpdateQueue())
+		{
+			bool changed = false;
+			for (uint32_t sample = 0; sample < numSamples; sample++)
+			{
+				if (piParam->getParameterUpdateQueue()->getNextValue(value))
+					changed = true;
+			}
+
+			if (changed)
+			{
+				piParam->applySmoothedControlValue(piParam->getControlValueWithNormalizedValue(value, false)); // false = do not apply taper
+				// --- now update the bound variable
+				if (piParam->updateInBoundVariable())
+				{
+					vst3Update.boundVariableUpdate = true;
+					if (piParam->getInBoundVariableChanged())
+						setBoundVariableChanged(piParam->getControlID());
+				}
+				postUpdatePluginParameter(piParam->getControlID(), piParam->getControlValue(), vst3Update);
+			}
+		}
+	}
+
+	// --- hand the new targets of the changed parameters to the block smoother and empty the list
+	//     (backwards, deactivation swaps in the last entry); automated parameters follow their queue
+	for (uint32_t n = numActiveSmoothingSlots; n-- > 0;)
+	{
+		uint32_t slot = activeSmoothingSlots[n];
+		PluginParameter* piParam = smoothablePluginParameters[slot];
+		if (piParam && piParam->getParameterSmoothing() &&
+			!(vstSAAEnabled && piParam->getEnableVSTSampleAccurateAutomation() && piParam->getParameterUpdateQueue()))
+			blockParamSmoother.setTarget(slot, piParam->getSmoothingTargetValue());
+
+		deactivateSmoothingSlot(n);
+	}
+
+	// --- one pass over the moving parameters only
+	blockParamSmoother.advanceBlock(numSamples);
+
+	for (uint32_t i = 0; i < blockParamSmoother.getUpdatedCount(); i++)
+	{
+		uint32_t slot = blockParamSmoother.getUpdatedSlot(i);
+		PluginParameter* piParam = smoothablePluginParameters[slot];
+
+		piParam->applySmoothedControlValue(blockParamSmoother.getValue(slot)); // this is the smoothed value
+
+		// --- update bound variable, if there is one
+		if (piParam->updateInBoundVariable())
+		{
+			paramSmoothUpdate.boundVariableUpdate = true;
+			if (piParam->getInBoundVariableChanged())
+				setBoundVariableChanged(piParam->getControlID());
+		}
+		postUpdatePluginParameter(piParam->getControlID(), piParam->getControlValue(), paramSmoothUpdate);
+	}
+}
+
+/**
+\brief set up the block smoother slots for the smoothable parameters
+
+Operation:
+- one slot per smoothablePluginParameters entry, using the parameter's smoothing settings
+- each slot is snapped to the parameter's current value and put on the active smoothing list, so
+  the next doBlockParameterUpdates( ) gives it the parameter's target
+- NOT realtime safe; called from reset( ) and initPluginParameterArray( )
+
+\param sampleRate fs (needed for coefficient calc)
+*/
+void PluginBase::initBlockParamSmoother(double sampleRate)
+{
+	if (blockParamSmoother.getSlotCount() != numSmoothablePluginParameters)
+		blockParamSmoother.create(numSmoothablePluginParameters);
+
+	for (unsigned int i = 0; i < numSmoothablePluginParameters; i++)
+	{
+		PluginParameter* piParam = smoothablePluginParameters[i];
+		if (!piParam)
+			continue;
+
+		blockParamSmoother.initSlot(i, piParam->getSmoothingTimeMsec(), sampleRate,
+									piParam->getMinValue(), piParam->getMaxValue(),
+									piParam->getSmoothingMethod(), piParam->getControlValue(),
+									piParam->getSmoothingEpsilon());
+
+		// --- the next block hands the slot its target, in case the parameter was still gliding
+		activateSmoothingSlot(i);
+	}
+}
+
 /**
 \brief adds a new plugin parameter to the parameter map
 
@@ -308,8 +578,9 @@ NOTE:
 */
 int32_t PluginBase::addPluginParameter(PluginParameter* piParam, double sampleRate)
 {
-	// --- map for controlID-indexing
+	// --- map for controlID-indexing; the index is stale until the next initPluginParameterArray( )
 	pluginParameterMap.insert(std::make_pair(piParam->getControlID(), piParam));
+	parameterIndexValid = false;
 
 	// --- vector for fast iteration and 0-indexing
 	pluginParameters.push_back(piParam);
@@ -320,6 +591,78 @@ int32_t PluginBase::addPluginParameter(PluginParameter* piParam, double sampleRa
 	return (int32_t)pluginParameters.size() - 1;
 }
 
+/**
+\brief build the immutable controlID -> parameter index used by getPluginParameterByControlID( )
+
+Operation:
+- regular IDs (below PLUGIN_SIDE_BYPASS) use a two-level table: the upper bits select a page of
+  PARAMETER_INDEX_PAGE_SIZE pointers, the lower bits the entry; pages without parameters stay nullptr,
+  so widely spaced IDs (e.g. 0 - 400 and 65568+) cost a few pages instead of one giant array
+- reserved IDs (PLUGIN_SIDE_BYPASS through CUSTOM_VIEW_BASE - 1) have their own flat array
+- NOT realtime safe; lookups never allocate afterwards, including lookups of unknown IDs
+*/
+void PluginBase::buildParameterIndex()
+{
+	destroyParameterIndex();
+
+	// --- size the page table for the largest regular ID
+	uint32_t maxRegularID = 0;
+	bool hasRegularIDs = false;
+	for (unsigned int i = 0; i < numPluginParameters; i++)
+	{
+		uint32_t controlID = pluginParameters[i]->getControlID();
+		if (controlID < PLUGIN_SIDE_BYPASS)
+		{
+			maxRegularID = controlID > maxRegularID ? controlID : maxRegularID;
+			hasRegularIDs = true;
+		}
+	}
+
+	if (hasRegularIDs)
+	{
+		numParameterIndexPages = (maxRegularID >> PARAMETER_INDEX_PAGE_BITS) + 1;
+		parameterIndexPages = new PluginParameter**[numParameterIndexPages];
+		memset(parameterIndexPages, 0, numParameterIndexPages * sizeof(PluginParameter**));
+	}
+
+	for (unsigned int i = 0; i < numPluginParameters; i++)
+	{
+		PluginParameter* piParam = pluginParameters[i];
+		uint32_t controlID = piParam->getControlID();
+
+		if (controlID < PLUGIN_SIDE_BYPASS)
+		{
+			PluginParameter**& page = parameterIndexPages[controlID >> PARAMETER_INDEX_PAGE_BITS];
+			if (!page)
+			{
+				page = new PluginParameter*[PARAMETER_INDEX_PAGE_SIZE];
+				memset(page, 0, PARAMETER_INDEX_PAGE_SIZE * sizeof(PluginParameter*));
+			}
+			page[controlID & (PARAMETER_INDEX_PAGE_SIZE - 1)] = piParam;
+		}
+		else if (controlID < CUSTOM_VIEW_BASE)
+			reservedParameterIndex[controlID - PLUGIN_SIDE_BYPASS] = piParam;
+	}
+
+	parameterIndexValid = true;
+}
+
+/**
+\brief free the controlID -> parameter index
+*/
+void PluginBase::destroyParameterIndex()
+{
+	parameterIndexValid = false;
+
+	for (uint32_t i = 0; i < numParameterIndexPages; i++)
+		delete[] parameterIndexPages[i];
+	delete[] parameterIndexPages;
+	parameterIndexPages = nullptr;
+	numParameterIndexPages = 0;
+
+	memset(reservedParameterIndex, 0, sizeof(reservedParameterIndex));
+}
+
 /**
 \brief adds an auxilliary attribute to the plugin parameter; you can have as many auxilliary attributes as you like for each parameter.
 
@@ -628,7 +971,11 @@ bool PluginBase::updatePIParamBoundValue(uint32_t _controlID)
 	if (!piParam) return false; /// not handled
 
 	// --- update
-	return piParam->updateInBoundVariable();
+	bool updated = piParam->updateInBoundVariable();
+	if (updated && piParam->getInBoundVariableChanged())
+		setBoundVariableChanged(_controlID);
+
+	return updated;
 }
 
 
@@ -724,72 +1071,312 @@ bool PluginBase::setPresetParameter(std::vector<PresetParameter>& presetParamete
 */
 const char* PluginBase::getPresetName(uint32_t index)
 {
-	if (index < presets.size())
+	return getPresetCatalog()->getPresetName(index);
+}
+
+/**
+\brief get a preset; the full parameter list is created the first time the preset is requested
+
+\return a naked pointer to the preset object, owned by the shared PresetCatalog
+*/
+const PresetInfo* PluginBase::getPreset(uint32_t index)
+{
+	return getPresetCatalog()->getPreset(index);
+}
+
+/**
+\brief get the factory preset catalog that all instances share
+
+Operation:
+- the first call (from any instance) builds the catalog: the default parameter values are
+  recorded once, then the derived class initPluginPresets( ) adds the presets
+- later calls return the same catalog; nothing is built per instance
+
+\return the catalog
+*/
+PresetCatalog* PluginBase::getPresetCatalog()
+{
+	static PresetCatalog presetCatalog;
+	static std::once_flag presetCatalogBuilt;
+
+	std::call_once(presetCatalogBuilt, [this]()
 	{
-		return presets[index]->presetName.c_str();
+		std::vector<PresetParameter> defaultParameters;
+		initPresetParameters(defaultParameters);
+		presetCatalog.setDefaultParameters(defaultParameters);
+		initPluginPresets(presetCatalog);
+	});
+
+	return &presetCatalog;
+}
+
+/**
+\brief write the parameter state chunk
+
+Operation:
+- only parameters whose value differs from the default are written, keyed by control ID
+- meters are not written
+- NOT realtime safe (the chunk may grow); call from the API's state save function
+
+\param chunk the output chunk; the memory is reused between calls
+\param flags STATE_CHUNK_FLAG_ bits (e.g. plugin side bypass)
+*/
+void PluginBase::getStateChunk(std::vector<uint8_t>& chunk, uint16_t flags)
+{
+	stateChunkValues.clear();
+	for (unsigned int i = 0; i < numPluginParameters; i++)
+	{
+		PluginParameter* piParam = pluginParameterArray[i];
+		if (!piParam || piParam->getControlVariableType() == controlVariableType::kMeter)
+			continue;
+
+		// --- the value is an atomic float; compare at that precision
+		float value = (float)piParam->getControlValue();
+		if (value != (float)piParam->getDefaultValue())
+			stateChunkValues.push_back(PresetParameter(piParam->getControlID(), value));
 	}
-	return "";
+
+	PluginStateChunk::write(chunk, stateChunkValues, flags);
 }
 
 /**
-\brief add a new preset
+\brief restore the parameter state from a chunk written by getStateChunk( )
 
-\param preset a PresetInfo strucutre that describes the preset
+Operation:
+- parameters missing from the chunk go back to their defaults; unknown control IDs are skipped
+- see setPIParamValues( ) for the bulk restore
+- NOT realtime safe; call from the API's state load function
+
+\param chunk the chunk data
+\param size chunk size in bytes
+\param flags STATE_CHUNK_FLAG_ bits stored with the chunk
 
-\return the new numbner of presets in the list
+\return true if the state was restored
 */
-size_t PluginBase::addPreset(PresetInfo* preset)
+bool PluginBase::setStateChunk(const uint8_t* chunk, size_t size, uint16_t& flags)
 {
-	presets.push_back(preset);
-	return presets.size();
+	if (!PluginStateChunk::read(chunk, size, stateChunkValues, flags))
+		return false;
+
+	setPIParamValues(stateChunkValues, true);
+	return true;
 }
 
 /**
-\brief remove a  preset - NOTE: does not delete object
+\brief decode a state chunk into one value per (non-meter) parameter, in parameter order; for
+       API shells that must push every value to a separate controller or GUI parameter list
 
-\param index index of preset to remove
+\param chunk the chunk data
+\param size chunk size in bytes
+\param values the full value list
+\param flags STATE_CHUNK_FLAG_ bits stored with the chunk
+
+\return true if the chunk was decoded
 */
-void PluginBase::removePreset(uint32_t index)
+bool PluginBase::getStateChunkValues(const uint8_t* chunk, size_t size, std::vector<PresetParameter>& values, uint16_t& flags)
 {
-	if (index < presets.size())
+	values.clear();
+	if (!PluginStateChunk::read(chunk, size, stateChunkValues, flags))
+		return false;
+
+	std::unordered_map<uint32_t, double> chunkValues;
+	for (size_t i = 0; i < stateChunkValues.size(); i++)
+		chunkValues[stateChunkValues[i].controlID] = stateChunkValues[i].actualValue;
+
+	for (unsigned int i = 0; i < numPluginParameters; i++)
 	{
-		PresetInfo* preset = presets[index];
-		// --- clean up
-		for (uint32_t i = 0; i < preset->presetParameters.size(); i++)
-			preset->presetParameters.pop_back();
+		PluginParameter* piParam = pluginParameterArray[i];
+		if (!piParam || piParam->getControlVariableType() == controlVariableType::kMeter)
+			continue;
 
-		delete preset;
-		presets.erase(presets.begin() + index);
+		std::unordered_map<uint32_t, double>::iterator it = chunkValues.find(piParam->getControlID());
+		values.push_back(PresetParameter(piParam->getControlID(), it != chunkValues.end() ? it->second : piParam->getDefaultValue()));
 	}
+
+	return true;
 }
 
 /**
-\brief remove all presets - NOTE: does not delete objects
+\brief set many parameter values at once (state and preset restores)
+
+Operation:
+- one pass over the parameters (if resetToDefaults) and one O(1) lookup per value
+- the value and the smoothing target are set together, so nothing glides and the per-parameter
+  smoothing flags are left alone
+- the audio thread picks the new values up at its next syncInBoundVariables( ): it snaps the
+  smoothers, syncs every bound variable and flags every bound variable group once, so the
+  cooking cost is paid once per restore instead of once per parameter
+- NOT realtime safe; call from the API's state load function
+
+\param values controlID/value pairs; unknown control IDs and meters are skipped
+\param resetToDefaults set every parameter to its default value first
 */
-void PluginBase::removeAllPresets()
+void PluginBase::setPIParamValues(const std::vector<PresetParameter>& values, bool resetToDefaults)
 {
-	for (std::vector<PresetInfo*>::iterator it = presets.begin(); it != presets.end(); ++it)
+	if (resetToDefaults)
 	{
-		// --- clean up
-		for (uint32_t i = 0; i < (*it)->presetParameters.size(); i++)
-			(*it)->presetParameters.pop_back();
+		for (unsigned int i = 0; i < numPluginParameters; i++)
+		{
+			PluginParameter* piParam = pluginParameterArray[i];
+			if (piParam && piParam->getControlVariableType() != controlVariableType::kMeter)
+				piParam->snapControlValue(piParam->getDefaultValue());
+		}
+	}
 
-		delete *it;
+	for (size_t i = 0; i < values.size(); i++)
+	{
+		PluginParameter* piParam = getPluginParameterByControlID(values[i].controlID);
+		if (piParam && piParam->getControlVariableType() != controlVariableType::kMeter)
+			piParam->snapControlValue(values[i].actualValue);
 	}
-	presets.clear();
+
+	// --- the next sync visits every parameter
+	parameterChanges.markAllChanged();
+	smoothingSnapPending = true;
 }
 
 /**
-\brief get a preset
+\brief build a complete parameter snapshot and post it for the audio thread
 
-\return a naked pointer to the preset object
+Operation:
+- the snapshot holds one value per parameter, so all the lookups, defaults and conversions
+  happen here and not on the audio thread
+- it also flags the parameters whose value (or smoothing target) differs from the current one;
+  the swap only writes those, so its cost follows the size of the preset change
+- the audio thread picks it up with applyParameterSnapshot( ) at a block boundary; a snapshot
+  posted before the previous one was applied replaces it
+- a parameter that matched when the snapshot was posted is left alone by the swap, so a value
+  set in between (automation, a GUI move) is kept
+- NOT realtime safe; call from the API's preset selection (GUI or host thread)
+
+\param values controlID/value pairs; unknown control IDs and meters are skipped
+\param resetToDefaults start from the default values; otherwise start from the current values
+
+\return true if the snapshot was posted
 */
-PresetInfo* PluginBase::getPreset(uint32_t index)
+bool PluginBase::postParameterSnapshot(const std::vector<PresetParameter>& values, bool resetToDefaults)
 {
-	if (index < presets.size())
-		return presets[index];
+	std::lock_guard<std::mutex> lock(parameterSnapshotMutex);
 
-	return nullptr;
+	ParameterSnapshot& snapshot = parameterSnapshots.getWriteSnapshot();
+	if (snapshot.values.size() != numPluginParameters)
+		return false;
+
+	for (unsigned int i = 0; i < numPluginParameters; i++)
+	{
+		PluginParameter* piParam = pluginParameterArray[i];
+		if (piParam)
+			snapshot.values[i] = resetToDefaults ? piParam->getDefaultValue() : piParam->getControlValue();
+	}
+
+	for (size_t i = 0; i < values.size(); i++)
+	{
+		std::unordered_map<uint32_t, uint32_t>::iterator it = parameterArrayIndex.find(values[i].controlID);
+		if (it != parameterArrayIndex.end())
+			snapshot.values[it->second] = values[i].actualValue;
+	}
+
+	// --- flag what the swap has to write; the smoothing target is a float
+	snapshot.clearChanged();
+	for (unsigned int i = 0; i < numPluginParameters; i++)
+	{
+		PluginParameter* piParam = pluginParameterArray[i];
+		if (!piParam || piParam->getControlVariableType() == controlVariableType::kMeter)
+			continue;
+
+		double value = snapshot.values[i];
+		if (value != piParam->getControlValue() ||
+			(piParam->getParameterSmoothing() && (float)value != (float)piParam->getSmoothingTargetValue()))
+			snapshot.setChanged(i);
+	}
+
+	parameterSnapshots.publish();
+	return true;
+}
+
+/**
+\brief post a factory preset from the shared catalog; see postParameterSnapshot( )
+
+\param presetIndex index of the preset
+
+\return true if the snapshot was posted
+*/
+bool PluginBase::postPresetSnapshot(uint32_t presetIndex)
+{
+	const PresetInfo* preset = getPreset(presetIndex);
+	if (!preset)
+		return false;
+
+	return postParameterSnapshot(preset->presetParameters, true);
+}
+
+/**
+\brief swap in the newest posted snapshot; audio thread only, at a block boundary
+
+Operation:
+- the snapshot itself is taken with one atomic exchange
+- only the parameters the snapshot flags as changed are written (value and smoothing target
+  together) and have their smoothers snapped, so the new preset does not morph in
+- writing a parameter flags it in the change set, so the next sync visits only those
+- call syncInBoundVariables( ) afterwards to push the values through the bound variables; it flags
+  the bound variable groups of the values that changed, so only their engine structures are rebuilt
+
+\return true if a snapshot was applied
+*/
+bool PluginBase::applyParameterSnapshot()
+{
+	const ParameterSnapshot* snapshot = parameterSnapshots.acquire();
+	if (!snapshot || snapshot->values.size() != numPluginParameters)
+		return false;
+
+	// --- a word with no flags set costs one compare
+	for (uint32_t word = 0; word < (uint32_t)snapshot->changed.size(); word++)
+	{
+		uint64_t changed = snapshot->changed[word];
+		while (changed)
+		{
+			uint32_t i = word * 64 + ParameterChangeSet::getLowestBit(changed);
+			changed &= changed - 1;
+
+			PluginParameter* piParam = pluginParameterArray[i];
+			if (!piParam)
+				continue;
+
+			// --- value and target together; the next sync visits it
+			piParam->snapControlValue(snapshot->values[i]);
+
+			// --- no glide to the new value
+			uint32_t slot = smoothableSlotOfParameter[i];
+			if (slot < numSmoothablePluginParameters)
+			{
+				piParam->snapParamSmoother();
+				blockParamSmoother.snapSlot(slot, piParam->getControlValue());
+			}
+		}
+	}
+	return true;
+}
+
+/**
+\brief end every glide after a bulk restore or a snapshot swap; audio thread only
+
+Operation:
+- the per-sample smoothers and the block smoother slots jump to their targets
+- every bound variable group is flagged as changed
+*/
+void PluginBase::snapParameterSmoothing()
+{
+	for (unsigned int i = 0; i < numSmoothablePluginParameters; i++)
+	{
+		PluginParameter* piParam = smoothablePluginParameters[i];
+		if (!piParam)
+			continue;
+
+		piParam->snapParamSmoother();
+		blockParamSmoother.snapSlot(i, piParam->getControlValue());
+	}
+
+	setAllBoundVariablesChanged();
 }
 
 /**
@@ -806,9 +1393,20 @@ void PluginBase::initPluginParameterArray()
 	numOutboundPluginParameters = 0;
 
 	pluginParameterArray = new PluginParameter*[numPluginParameters];
+
+	// --- one change flag per parameter, all set so the first sync visits every parameter; no
+	//     parameter has a VST3 queue yet
+	parameterChanges.create(numPluginParameters);
+	parameterQueueChanges.create(numPluginParameters);
+	parameterQueueChanges.clearAll();
+
 	for (unsigned int i = 0; i < numPluginParameters; i++)
 	{
 		pluginParameterArray[i] = pluginParameters[i];
+		pluginParameters[i]->setChangeSet(&parameterChanges, i, &parameterQueueChanges);
+
+		// --- the parameter is complete: later instances share its descriptor (only the first one published is kept)
+		pluginParameters[i]->publishDescriptor();
 
 		// --- how many are potentially smoothable?
 		if ((pluginParameters[i]->getParameterSmoothing() || pluginParameters[i]->getEnableVSTSampleAccurateAutomation()) &&
@@ -826,17 +1424,40 @@ void PluginBase::initPluginParameterArray()
 	// --- smoothable parameters; this is called during audio processing so we want this array to be as small as possible
 	if (smoothablePluginParameters)
 		delete[] smoothablePluginParameters;
+	smoothablePluginParameters = nullptr;
+
+	// --- the active smoothing list and its lookups; sized for every parameter so activation never allocates
+	delete[] smoothableSlotOfParameter;
+	delete[] activeSmoothingSlots;
+	delete[] activeSmoothingIndex;
+	delete[] queuedSmoothingSlots;
+	smoothableSlotOfParameter = new uint32_t[numPluginParameters];
+	activeSmoothingSlots = nullptr;
+	activeSmoothingIndex = nullptr;
+	queuedSmoothingSlots = nullptr;
+	numActiveSmoothingSlots = 0;
+	numQueuedSmoothingSlots = 0;
 
 	int m = 0;
+	for (unsigned int i = 0; i < numPluginParameters; i++)
+		smoothableSlotOfParameter[i] = numSmoothablePluginParameters;
+
 	if (numSmoothablePluginParameters > 0)
 	{
 		smoothablePluginParameters = new PluginParameter*[numSmoothablePluginParameters];
+		activeSmoothingSlots = new uint32_t[numSmoothablePluginParameters];
+		activeSmoothingIndex = new int32_t[numSmoothablePluginParameters];
+		queuedSmoothingSlots = new uint32_t[numSmoothablePluginParameters];
 		for (unsigned int i = 0; i < numPluginParameters; i++)
 		{
 			if ((pluginParameters[i]->getParameterSmoothing() || pluginParameters[i]->getEnableVSTSampleAccurateAutomation()) &&
 				(pluginParameters[i]->getControlVariableType() == controlVariableType::kDouble ||
 				 pluginParameters[i]->getControlVariableType() == controlVariableType::kFloat) )
+			{
+				activeSmoothingIndex[m] = -1;
+				smoothableSlotOfParameter[i] = m;
 				smoothablePluginParameters[m++] = pluginParameters[i];
+			}
 		}
 	}
 
@@ -854,6 +1475,35 @@ void PluginBase::initPluginParameterArray()
 		}
 	}
 
+	// --- block smoother slots follow the smoothable array
+	initBlockParamSmoother(audioProcDescriptor.sampleRate);
+
+	// --- realtime controlID lookups
+	buildParameterIndex();
+
+	// --- preset snapshots
+	parameterArrayIndex.clear();
+	for (unsigned int i = 0; i < numPluginParameters; i++)
+		parameterArrayIndex[pluginParameterArray[i]->getControlID()] = i;
+	parameterSnapshots.create(numPluginParameters);
+
+	// --- change tracking group masks, indexed by control ID (large reserved IDs stay untracked)
+	if (boundVariableGroupMasks)
+		delete[] boundVariableGroupMasks;
+
+	numBoundVariableGroupMasks = 0;
+	for (unsigned int i = 0; i < numPluginParameters; i++)
+	{
+		uint32_t controlID = pluginParameters[i]->getControlID();
+		if (controlID < 65536 && controlID >= numBoundVariableGroupMasks)
+			numBoundVariableGroupMasks = controlID + 1;
+	}
+
+	boundVariableGroupMasks = new uint64_t[numBoundVariableGroupMasks + 1];
+	memset(boundVariableGroupMasks, 0, (numBoundVariableGroupMasks + 1) * sizeof(uint64_t));
+	memset(boundVariableGroupSize, 0, MAX_BOUND_VARIABLE_GROUPS * sizeof(uint32_t));
+	setAllBoundVariablesChanged();
+
 }
 
 /**
@@ -562,25 +562,19 @@ void PluginGUI::writeToPresetFile()
 	{
 		stream.seek(0, SeekableStream::kSeekEnd);
 
-		stream << "\tint index = 0;\t/*** declare this once at the top of the presets function, comment out otherwise */\n";
 		std::string comment = "\t// --- Plugin Preset: ";
 		comment.append(presetName);
 		comment.append("\n");
 		stream << comment;
 
-		std::string declaration = "\tPresetInfo* ";
+		// --- add the preset to the catalog; unset parameters keep their defaults
+		std::string declaration = "\tuint32_t ";
 		declaration.append(presetName);
-		declaration.append(" = new PresetInfo(index++, \"");
+		declaration.append(" = presetCatalog.addPreset(\"");
 		declaration.append(presetName);
 		declaration.append("\");\n");
 		stream << declaration;
 
-		// --- initialize
-		std::string presetStr2 = "\tinitPresetParameters(";
-		presetStr2.append(presetName);
-		presetStr2.append("->presetParameters);\n");
-		stream << presetStr2;
-
 		size_t size = this->pluginParameters.size();
 		for (unsigned int i = 0; i<size - 1; i++) // size-1 because last parameter is WRITE_PRESET_FILE
 		{
@@ -594,9 +588,9 @@ void PluginGUI::writeToPresetFile()
 				uint32_t id = piParam->getControlID();
 				double value = guiPluginConnector->getActualPluginParameter(piParam->getControlID());
 
-				std::string presetStr2 = "\tsetPresetParameter(";
+				std::string presetStr2 = "\tpresetCatalog.setPresetParameter(";
 				presetStr2.append(presetName);
-				presetStr2.append("->presetParameters, ");
+				presetStr2.append(", ");
 
 				std::ostringstream controlID_ss;
 				std::ostringstream controlValue_ss;
@@ -614,14 +608,7 @@ void PluginGUI::writeToPresetFile()
 				stream << presetStr2;
 			}
 		}
-		// --- add the preset
-		if (size > 1)
-		{
-			std::string presetStr3 = "\taddPreset(";
-			presetStr3.append(presetName);
-			presetStr3.append(");\n\n");
-			stream << presetStr3;
-		}
+		stream << "\n";
 	}
 }
 
@@ -1832,12 +1819,8 @@ CView* PluginGUI::createUserCustomView(std::string viewname, const CRect rect, I
 
 	if (viewname.compare("CustomSpectrumView") == 0)
 	{
-#ifdef HAVE_FFTW
 		// --- create our custom view
 		return new SpectrumView(rect, listener, tag);
-#else
-		return new WaveView(rect, listener, tag);
-#endif
 	}
 
 	return nullptr;
@@ -28,20 +28,31 @@
 PluginParameter::PluginParameter(int _controlID, const char* _controlName, const char* _controlUnits,
                                  controlVariableType _controlType, double _minValue, double _maxValue, double _defaultValue,
                                  taper _controlTaper, uint32_t _displayPrecision)
-: controlID(_controlID)
-, controlName(_controlName)
-, controlUnits(_controlUnits)
-, controlType(_controlType)
-, minValue(_minValue)
-, maxValue(_maxValue)
-, defaultValue(_defaultValue)
-, controlTaper(_controlTaper)
-, displayPrecision(_displayPrecision)
 {
-    setControlValue(_defaultValue);
+	bool shared = attachDescriptor(_controlID, [&](const ParameterDescriptor& published)
+	{
+		return published.controlName == _controlName && published.controlUnits == _controlUnits &&
+			   published.controlType == _controlType && published.minValue == _minValue &&
+			   published.maxValue == _maxValue && published.defaultValue == _defaultValue &&
+			   published.controlTaper == _controlTaper && published.displayPrecision == _displayPrecision;
+	});
+
+	if (!shared)
+	{
+		descriptor->controlName = _controlName;
+		descriptor->controlUnits = _controlUnits;
+		descriptor->controlType = _controlType;
+		descriptor->minValue = _minValue;
+		descriptor->maxValue = _maxValue;
+		descriptor->defaultValue = _defaultValue;
+		descriptor->controlTaper = _controlTaper;
+		descriptor->displayPrecision = _displayPrecision;
+		descriptor->isWritable = false;
+	}
+
+    setAtomicControlValueDouble(_defaultValue);
     setSmoothedTargetValue(_defaultValue);
     useParameterSmoothing = false;
-    setIsWritable(false);
 }
 
 /**
@@ -53,28 +64,30 @@ PluginParameter::PluginParameter(int _controlID, const char* _controlName, const
 \param _defaultString default string value as std::string
 */
 PluginParameter::PluginParameter(int _controlID, const char* _controlName, std::vector<std::string> _stringList, std::string _defaultString)
-: controlID(_controlID)
-, controlName(_controlName)
-, stringList(_stringList)
 {
-    setControlValue(0.0);
-    setSmoothedTargetValue(0.0);
-    setControlVariableType(controlVariableType::kTypedEnumStringList);
-    setMaxValue((double)stringList.size()-1);
+	bool shared = attachDescriptor(_controlID, [&](const ParameterDescriptor& published)
+	{
+		return published.controlName == _controlName &&
+			   published.controlType == controlVariableType::kTypedEnumStringList &&
+			   published.stringList == _stringList;
+	});
 
-    int defaultStringIndex = findStringIndex(_defaultString);
-    if(defaultStringIndex >= 0)
-    {
-        setDefaultValue((double)defaultStringIndex);
-        setControlValue((double)defaultStringIndex);
-    }
-    useParameterSmoothing = false;
-    setIsWritable(false);
-    setCommaSeparatedStringList();
+	if (!shared)
+	{
+		descriptor->controlName = _controlName;
+		descriptor->stringList = _stringList;
+		descriptor->controlType = controlVariableType::kTypedEnumStringList;
+		descriptor->maxValue = (double)descriptor->stringList.size() - 1;
+		descriptor->isWritable = false;
+		setCommaSeparatedStringList();
+	}
+
+	initStringListValue(_defaultString);
 }
 
 /**
-\brief second method of constructing a string-list parameter
+\brief second method of constructing a string-list parameter; when the list matches a published
+       descriptor the list is not split again
 
 \param _controlID numerical control identifier -- MUST BE UNIQUE among all parameter ID values
 \param _controlName name string
@@ -82,35 +95,35 @@ PluginParameter::PluginParameter(int _controlID, const char* _controlName, std::
 \param _defaultString default string value as std::string
 */
 PluginParameter::PluginParameter(int _controlID, const char* _controlName, const char* _commaSeparatedList, std::string _defaultString)
-: controlID(_controlID)
-, controlName(_controlName)
 {
-    setControlValue(0.0);
-    setSmoothedTargetValue(0.0);
-
-    std::stringstream ss(_commaSeparatedList);
-    while(ss.good())
-    {
-        std::string substr;
-        getline(ss, substr, ',');
-        stringList.push_back(substr);
-    }
-
-	// --- create csvlist
-	setCommaSeparatedStringList();
+	bool shared = attachDescriptor(_controlID, [&](const ParameterDescriptor& published)
+	{
+		return published.controlName == _controlName &&
+			   published.controlType == controlVariableType::kTypedEnumStringList &&
+			   published.commaSeparatedStringList == _commaSeparatedList;
+	});
 
-    setControlVariableType(controlVariableType::kTypedEnumStringList);
-    setMaxValue((double)stringList.size()-1);
+	if (!shared)
+	{
+		descriptor->controlName = _controlName;
+
+		std::stringstream ss(_commaSeparatedList);
+		while(ss.good())
+		{
+			std::string substr;
+			getline(ss, substr, ',');
+			descriptor->stringList.push_back(substr);
+		}
+
+		// --- create csvlist
+		setCommaSeparatedStringList();
+
+		descriptor->controlType = controlVariableType::kTypedEnumStringList;
+		descriptor->maxValue = (double)descriptor->stringList.size() - 1;
+		descriptor->isWritable = false;
+	}
 
-    int defaultStringIndex = findStringIndex(_defaultString);
-    if(defaultStringIndex >= 0)
-    {
-        setDefaultValue((double)defaultStringIndex);
-        setControlValue((double)defaultStringIndex);
-    }
-    useParameterSmoothing = false;
-    setIsWritable(false);
-    setCommaSeparatedStringList();
+	initStringListValue(_defaultString);
 }
 
 
@@ -125,23 +138,30 @@ PluginParameter::PluginParameter(int _controlID, const char* _controlName, const
 \param _meterCal linear or log calibration
 */
 PluginParameter::PluginParameter(int _controlID, const char* _controlName, double _meterAttack_ms, double _meterRelease_ms, uint32_t _detectorMode, meterCal _meterCal)
-: controlID(_controlID)
-, controlName(_controlName)
-, meterAttack_ms(_meterAttack_ms)
-, meterRelease_ms(_meterRelease_ms)
-, detectorMode(_detectorMode)
 {
-	if (_meterCal == meterCal::kLinearMeter)
-		setLogMeter(false);
-	else
-		setLogMeter(true);
+	bool logMeter = _meterCal != meterCal::kLinearMeter;
+	bool shared = attachDescriptor(_controlID, [&](const ParameterDescriptor& published)
+	{
+		return published.controlName == _controlName &&
+			   published.controlType == controlVariableType::kMeter &&
+			   published.meterAttack_ms == _meterAttack_ms && published.meterRelease_ms == _meterRelease_ms &&
+			   published.detectorMode == _detectorMode && published.logMeter == logMeter;
+	});
 
-    setControlValue(0.0);
-    setSmoothedTargetValue(0.0);
+	if (!shared)
+	{
+		descriptor->controlName = _controlName;
+		descriptor->meterAttack_ms = _meterAttack_ms;
+		descriptor->meterRelease_ms = _meterRelease_ms;
+		descriptor->detectorMode = _detectorMode;
+		descriptor->logMeter = logMeter;
+		descriptor->controlType = controlVariableType::kMeter;
+		descriptor->isWritable = true;
+	}
 
-    setControlVariableType(controlVariableType::kMeter);
+    setAtomicControlValueDouble(0.0);
+    setSmoothedTargetValue(0.0);
     useParameterSmoothing = false;
-    setIsWritable(true);
 }
 
 /**
@@ -152,71 +172,73 @@ PluginParameter::PluginParameter(int _controlID, const char* _controlName, doubl
 \param _controlType type of control
 */
 PluginParameter::PluginParameter(int _controlID, const char* _controlName, controlVariableType _controlType)
-: controlID(_controlID)
-, controlName(_controlName)
-, controlType(_controlType)
 {
-    setControlValue(0.0);
-    setSmoothedTargetValue(0.0);
+	bool shared = attachDescriptor(_controlID, [&](const ParameterDescriptor& published)
+	{
+		return published.controlName == _controlName && published.controlType == _controlType;
+	});
 
+	if (!shared)
+	{
+		descriptor->controlName = _controlName;
+		descriptor->controlType = _controlType;
+		descriptor->isWritable = false;
+	}
+
+    setAtomicControlValueDouble(0.0);
+    setSmoothedTargetValue(0.0);
     useParameterSmoothing = false;
-    setIsWritable(false);
 }
 
 /**
 \brief simple constructor - you can always use this and then use the massive number of get/set functions to customize in any manner
 */
 PluginParameter::PluginParameter()
+: descriptor(std::make_shared<ParameterDescriptor>())
 {
-    setControlValue(0.0);
+    setAtomicControlValueDouble(0.0);
     setSmoothedTargetValue(0.0);
 
     useParameterSmoothing = false;
-    setIsWritable(false);
+    descriptor->isWritable = false;
 }
 
 
 /**
-\brief copy constructor
+\brief copy constructor; the copy shares the descriptor
 */
 PluginParameter::PluginParameter(const PluginParameter& initGuiControl)
+: descriptor(initGuiControl.descriptor)
 {
-    controlID = initGuiControl.controlID;
-    controlName = initGuiControl.controlName;
-	controlUnits = initGuiControl.controlUnits;
-	commaSeparatedStringList = initGuiControl.commaSeparatedStringList;
-	controlType = initGuiControl.controlType;
-    minValue = initGuiControl.minValue;
-    maxValue = initGuiControl.maxValue;
-    defaultValue = initGuiControl.defaultValue;
     controlValueAtomic = initGuiControl.getAtomicControlValueFloat();
-    controlTaper = initGuiControl.controlTaper;
-    displayPrecision = initGuiControl.displayPrecision;
-    stringList = initGuiControl.stringList;
+    smoothedTargetValueAtomic = initGuiControl.getAtomicControlValueFloat();
     useParameterSmoothing = initGuiControl.useParameterSmoothing;
-    smoothingType = initGuiControl.smoothingType;
-    smoothingTimeMsec = initGuiControl.smoothingTimeMsec;
-    meterAttack_ms = initGuiControl.meterAttack_ms;
-    meterRelease_ms = initGuiControl.meterRelease_ms;
-	detectorMode = initGuiControl.detectorMode;
-    logMeter = initGuiControl.logMeter;
-    isWritable = initGuiControl.isWritable;
-	isDiscreteSwitch = initGuiControl.isDiscreteSwitch;
-	invertedMeter = initGuiControl.invertedMeter;
 }
 
 /**
-\brief only need to clean out the aux parameters - everything else is self deleting
+\brief everything is self deleting; the descriptor is released when the last parameter that shares it is gone
 */
 PluginParameter::~PluginParameter()
 {
-	// --- clear aux attributes
-	for (auxParameterAttributeMap::const_iterator it = auxAttributeMap.begin(), end = auxAttributeMap.end(); it != end; ++it)
-	{
-		delete it->second;
-	}
+}
+
+/**
+\brief set the value of a string-list parameter to its default string (during construction)
 
-	auxAttributeMap.clear();
+\param _defaultString default string value
+*/
+void PluginParameter::initStringListValue(const std::string& _defaultString)
+{
+    setAtomicControlValueDouble(0.0);
+    setSmoothedTargetValue(0.0);
+
+    int defaultStringIndex = findStringIndex(_defaultString);
+    if(defaultStringIndex >= 0)
+    {
+        setDefaultValue((double)defaultStringIndex);
+        setAtomicControlValueDouble((double)defaultStringIndex);
+    }
+    useParameterSmoothing = false;
 }
 
 /**
@@ -227,12 +249,12 @@ PluginParameter::~PluginParameter()
 std::string PluginParameter::getControlValueAsString()
 {
 	std::string empty;
-	if (controlType == controlVariableType::kTypedEnumStringList)
+	if (descriptor->controlType == controlVariableType::kTypedEnumStringList)
 	{
-		if ((uint32_t)getAtomicControlValueFloat() >= stringList.size())
+		if ((uint32_t)getAtomicControlValueFloat() >= descriptor->stringList.size())
 			return empty;
 
-		return stringList[(uint32_t)getAtomicControlValueFloat()];
+		return descriptor->stringList[(uint32_t)getAtomicControlValueFloat()];
 	}
 
 	std::ostringstream ss;
@@ -259,14 +281,14 @@ std::string PluginParameter::getControlValueAsString()
 
 	numString += "00000000000000000000000000000000";
 
-	if (controlType != controlVariableType::kInt)
-		pos += displayPrecision + 1;
+	if (descriptor->controlType != controlVariableType::kInt)
+		pos += descriptor->displayPrecision + 1;
 
 	std::string formattedString = numString.substr(0, pos);
-	if (appendUnits)
+	if (descriptor->appendUnits)
 	{
 		formattedString += " ";
-		formattedString += controlUnits;
+		formattedString += descriptor->controlUnits;
 	}
 
 	return formattedString;
@@ -281,10 +303,10 @@ std::string PluginParameter::getControlValueAsString()
 std::string PluginParameter::getStringByIndex(uint32_t index)
 {
 	std::string empty;
-	if (index >= stringList.size())
+	if (index >= descriptor->stringList.size())
 		return empty;
 
-	return stringList[index];
+	return descriptor->stringList[index];
 }
 
 /**
@@ -292,19 +314,23 @@ std::string PluginParameter::getStringByIndex(uint32_t index)
 */
 void PluginParameter::setCommaSeparatedStringList()
 {
-    commaSeparatedStringList.clear();
+    std::string commaSeparatedStringList;
+    const std::vector<std::string>& stringList = descriptor->stringList;
 
-    for(std::vector<std::string>::iterator it = stringList.begin(); it != stringList.end(); ++it)
+    for(std::vector<std::string>::const_iterator it = stringList.begin(); it != stringList.end(); ++it)
     {
-        std::string subStr = *it;
+        const std::string& subStr = *it;
         if(commaSeparatedStringList.size() > 0)
             commaSeparatedStringList.append(",");
         commaSeparatedStringList.append(subStr);
     }
+
+    if (descriptor->commaSeparatedStringList != commaSeparatedStringList)
+        editDescriptor()->commaSeparatedStringList = commaSeparatedStringList;
 }
 
 /**
-\brief set an aux attribute
+\brief set an aux attribute; like std::map::insert, an existing attribute with the same ID is kept
 
 \param attributeID unique identifier of attribute
 \param auxParameterAtribute information about the aux attribute
@@ -313,12 +339,14 @@ void PluginParameter::setCommaSeparatedStringList()
 */
 uint32_t PluginParameter::setAuxAttribute(uint32_t attributeID, const AuxParameterAttribute& auxParameterAtribute)
 {
-	AuxParameterAttribute* newAttribute = new AuxParameterAttribute(auxParameterAtribute);
-	if (!newAttribute) return 0;
+	// --- already there: nothing changes, so a shared descriptor stays shared
+	if (descriptor->auxAttributes.find(attributeID) != descriptor->auxAttributes.end())
+		return (uint32_t)descriptor->auxAttributes.size();
 
-	auxAttributeMap.insert(std::make_pair(attributeID, newAttribute));
+	ParameterDescriptor* editable = editDescriptor();
+	editable->auxAttributes.insert(std::make_pair(attributeID, auxParameterAtribute));
 
-	return (uint32_t)auxAttributeMap.size();
+	return (uint32_t)editable->auxAttributes.size();
 }
 
 /**
@@ -326,13 +354,64 @@ uint32_t PluginParameter::setAuxAttribute(uint32_t attributeID, const AuxParamet
 
 \param attributeID unique identifier of attribute
 
-\return a naked pointer to the attribute
+\return a naked pointer to the attribute (read only; the descriptor may be shared)
 */
-AuxParameterAttribute* PluginParameter::getAuxAttribute(uint32_t attributeID)
+const AuxParameterAttribute* PluginParameter::getAuxAttribute(uint32_t attributeID)
 {
-	if (auxAttributeMap.find(attributeID) == auxAttributeMap.end()) {
+	std::map<uint32_t, AuxParameterAttribute>::const_iterator it = descriptor->auxAttributes.find(attributeID);
+	if (it == descriptor->auxAttributes.end()) {
 		return nullptr;
 	}
 
-	return  auxAttributeMap[attributeID];
+	return &it->second;
+}
+
+/**
+\brief the mutex that guards the table
+*/
+std::mutex& ParameterDescriptorTable::getMutex()
+{
+	static std::mutex tableMutex;
+	return tableMutex;
+}
+
+/**
+\brief the table itself (one per process)
+*/
+std::map<int, std::shared_ptr<ParameterDescriptor>>& ParameterDescriptorTable::getTable()
+{
+	static std::map<int, std::shared_ptr<ParameterDescriptor>> table;
+	return table;
+}
+
+/**
+\brief find a published descriptor
+
+\param controlID the control ID
+
+\return the descriptor or nullptr if none was published for the ID
+*/
+std::shared_ptr<ParameterDescriptor> ParameterDescriptorTable::find(int controlID)
+{
+	std::lock_guard<std::mutex> lock(getMutex());
+	std::map<int, std::shared_ptr<ParameterDescriptor>>::iterator it = getTable().find(controlID);
+	if (it == getTable().end())
+		return nullptr;
+
+	return it->second;
+}
+
+/**
+\brief publish a descriptor; from now on it is never modified (the table holds a reference, so
+       PluginParameter::editDescriptor( ) always copies it)
+
+\param descriptor the descriptor to publish
+*/
+void ParameterDescriptorTable::publish(const std::shared_ptr<ParameterDescriptor>& descriptor)
+{
+	if (!descriptor)
+		return;
+
+	std::lock_guard<std::mutex> lock(getMutex());
+	getTable().insert(std::make_pair(descriptor->controlID, descriptor));
 }
@@ -0,0 +1,113 @@
+// -----------------------------------------------------------------------------
+//    ASPiK Plugin Kernel File:  pluginstate.cpp
+//
+/**
+    \file   pluginstate.cpp
+    \author Will Pirkle
+    \date   17-September-2018
+    \brief  implementation file for the binary plugin state chunk
+    		- http://www.aspikplugins.com
+    		- http://www.willpirkle.com
+*/
+// -----------------------------------------------------------------------------
+#include "pluginstate.h"
+#include <string.h>
+
+/**
+\brief check the magic number
+
+\param chunk the data
+\param size data size in bytes
+
+\return true if the data is (or starts like) a state chunk
+*/
+bool PluginStateChunk::isStateChunk(const uint8_t* chunk, size_t size)
+{
+	return chunk && size >= STATE_CHUNK_HEADER_SIZE && readUInt32(chunk) == STATE_CHUNK_MAGIC;
+}
+
+/**
+\brief encode a value list
+
+\param chunk the output; cleared and resized to fit
+\param values the controlID/value pairs to store (usually the non-default values only)
+\param flags STATE_CHUNK_FLAG_ bits
+*/
+void PluginStateChunk::write(std::vector<uint8_t>& chunk, const std::vector<PresetParameter>& values, uint16_t flags)
+{
+	chunk.resize(STATE_CHUNK_HEADER_SIZE + values.size() * STATE_CHUNK_VALUE_SIZE);
+	uint8_t* data = &chunk[0];
+
+	writeUInt32(data, STATE_CHUNK_MAGIC);
+	writeUInt32(data + 4, (uint32_t)STATE_CHUNK_VERSION | ((uint32_t)flags << 16));
+	writeUInt32(data + 8, (uint32_t)values.size());
+	data += STATE_CHUNK_HEADER_SIZE;
+
+	for (size_t i = 0; i < values.size(); i++)
+	{
+		float value = (float)values[i].actualValue;
+		uint32_t bits = 0;
+		memcpy(&bits, &value, sizeof(float));
+
+		writeUInt32(data, values[i].controlID);
+		writeUInt32(data + 4, bits);
+		data += STATE_CHUNK_VALUE_SIZE;
+	}
+}
+
+/**
+\brief decode a value list
+
+\param chunk the data
+\param size data size in bytes
+\param values the controlID/value pairs; cleared first (the capacity is kept)
+\param flags STATE_CHUNK_FLAG_ bits
+
+\return true if the chunk was decoded, false if it is not a state chunk or is truncated
+*/
+bool PluginStateChunk::read(const uint8_t* chunk, size_t size, std::vector<PresetParameter>& values, uint16_t& flags)
+{
+	values.clear();
+	if (!isStateChunk(chunk, size))
+		return false;
+
+	uint32_t versionAndFlags = readUInt32(chunk + 4);
+	uint32_t count = readUInt32(chunk + 8);
+	if (count > (size - STATE_CHUNK_HEADER_SIZE) / STATE_CHUNK_VALUE_SIZE)
+		return false;
+
+	flags = (uint16_t)(versionAndFlags >> 16);
+	values.reserve(count);
+
+	const uint8_t* data = chunk + STATE_CHUNK_HEADER_SIZE;
+	for (uint32_t i = 0; i < count; i++)
+	{
+		uint32_t bits = readUInt32(data + 4);
+		float value = 0.f;
+		memcpy(&value, &bits, sizeof(float));
+
+		values.push_back(PresetParameter(readUInt32(data), value));
+		data += STATE_CHUNK_VALUE_SIZE;
+	}
+
+	return true;
+}
+
+/**
+\brief little endian store, independent of the CPU byte order
+*/
+void PluginStateChunk::writeUInt32(uint8_t* data, uint32_t value)
+{
+	data[0] = (uint8_t)(value & 0xFF);
+	data[1] = (uint8_t)((value >> 8) & 0xFF);
+	data[2] = (uint8_t)((value >> 16) & 0xFF);
+	data[3] = (uint8_t)((value >> 24) & 0xFF);
+}
+
+/**
+\brief little endian load, independent of the CPU byte order
+*/
+uint32_t PluginStateChunk::readUInt32(const uint8_t* data)
+{
+	return (uint32_t)data[0] | ((uint32_t)data[1] << 8) | ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24);
+}
@@ -0,0 +1,114 @@
+// -----------------------------------------------------------------------------
+//    ASPiK Plugin Kernel File:  presetcatalog.cpp
+//
+/**
+    \file   presetcatalog.cpp
+    \author Will Pirkle
+    \date   17-September-2018
+    \brief  implementation file for the shared factory preset catalog
+    		- http://www.aspikplugins.com
+    		- http://www.willpirkle.com
+*/
+// -----------------------------------------------------------------------------
+#include "presetcatalog.h"
+
+/**
+\brief destroy the materialized presets
+*/
+PresetCatalog::~PresetCatalog()
+{
+	for (std::vector<PresetInfo*>::iterator it = presets.begin(); it != presets.end(); ++it)
+		delete *it;
+	presets.clear();
+}
+
+/**
+\brief store the default ID/value list that every preset starts from
+
+\param _defaultParameters list from PluginBase::initPresetParameters( )
+*/
+void PresetCatalog::setDefaultParameters(const std::vector<PresetParameter>& _defaultParameters)
+{
+	defaultParameters = _defaultParameters;
+	defaultParameterIndex.clear();
+	for (size_t i = 0; i < defaultParameters.size(); i++)
+		defaultParameterIndex[defaultParameters[i].controlID] = i;
+}
+
+/**
+\brief add a preset to the end of the list
+
+\param presetName name of the preset
+
+\return index of the new preset, for setPresetParameter( )
+*/
+uint32_t PresetCatalog::addPreset(const char* presetName)
+{
+	presetNames.push_back(presetName);
+	presetValues.push_back(std::vector<PresetParameter>());
+	presets.push_back(nullptr);
+	return (uint32_t)(presetNames.size() - 1);
+}
+
+/**
+\brief set a preset value; like PluginBase::setPresetParameter( ), values for unknown control IDs are ignored
+
+\param presetIndex index from addPreset( )
+\param _controlID control ID of parameter to set
+\param _controlValue the preset control value
+
+\return true if the control ID exists
+*/
+bool PresetCatalog::setPresetParameter(uint32_t presetIndex, uint32_t _controlID, double _controlValue)
+{
+	if (presetIndex >= presetValues.size())
+		return false;
+
+	if (defaultParameterIndex.find(_controlID) == defaultParameterIndex.end())
+		return false;
+
+	presetValues[presetIndex].push_back(PresetParameter(_controlID, _controlValue));
+	return true;
+}
+
+/**
+\brief gets name as a const char* for connecting with all APIs at some level
+
+\param index index of preset
+
+\return name as const char*
+*/
+const char* PresetCatalog::getPresetName(uint32_t index) const
+{
+	if (index < presetNames.size())
+		return presetNames[index].c_str();
+
+	return "";
+}
+
+/**
+\brief get a preset, creating the full parameter list the first time it is requested
+
+\param index index of preset
+
+\return the preset or nullptr if the index is out of range; owned by the catalog
+*/
+const PresetInfo* PresetCatalog::getPreset(uint32_t index)
+{
+	if (index >= presetNames.size())
+		return nullptr;
+
+	std::lock_guard<std::mutex> lock(presetMutex);
+	if (presets[index])
+		return presets[index];
+
+	PresetInfo* preset = new PresetInfo(index, presetNames[index].c_str());
+	preset->presetParameters = defaultParameters;
+
+	const std::vector<PresetParameter>& values = presetValues[index];
+	for (size_t i = 0; i < values.size(); i++)
+		preset->presetParameters[defaultParameterIndex[values[i].controlID]].actualValue = values[i].actualValue;
+
+	presets[index] = preset;
+	return preset;
+}
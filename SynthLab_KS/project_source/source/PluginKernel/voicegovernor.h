@@ -0,0 +1,395 @@
+// -----------------------------------------------------------------------------
+//    ASPiK Plugin Kernel File:  voicegovernor.h
+//
+/**
+    \file   voicegovernor.h
+    \author Will Pirkle
+    \date   17-September-2018
+    \brief  interface file for the CPU deadline polyphony governor
+    		- http://www.aspikplugins.com
+    		- http://www.willpirkle.com
+*/
+// -----------------------------------------------------------------------------
+#ifndef _VoiceGovernor_H_
+#define _VoiceGovernor_H_
+
+#include "pluginstructures.h"
+#include <chrono>
+#include <math.h>
+
+// --- render load (render time / block deadline) above which the governor steps down
+const double GOVERNOR_HIGH_LOAD = 0.85;
+
+// --- render load below which the governor may step back up
+const double GOVERNOR_LOW_LOAD = 0.5;
+
+// --- load follower time constants; fast attack so a chord pile-up is caught within a few blocks
+const double GOVERNOR_ATTACK_MSEC = 5.0;
+const double GOVERNOR_RELEASE_MSEC = 200.0;
+
+// --- minimum time between two steps down, so each step shows up in the load first
+const double GOVERNOR_STEP_DOWN_MSEC = 50.0;
+
+// --- time the load must stay low before each step back up
+const double GOVERNOR_STEP_UP_MSEC = 1000.0;
+
+// --- amp EG release time limit from the kGovernorShortRelease level on
+const double GOVERNOR_SHORT_RELEASE_MSEC = 30.0;
+
+// --- the voice limit is never lowered below this
+const uint32_t GOVERNOR_MIN_VOICES = 2;
+
+// --- notes tracked for voice stealing
+const uint32_t GOVERNOR_MAX_NOTES = 128;
+
+/**
+\enum governorLevel
+\ingroup ASPiK-Core
+\brief
+Degradation levels; each level includes the ones below it
+
+- kGovernorOff: nothing is degraded
+- kGovernorDelayFXOff: the delay FX is bypassed
+- kGovernorUnisonOff: Unison plays as Mono, UniLegato as Legato
+- kGovernorShortRelease: the amp EG release is cut to GOVERNOR_SHORT_RELEASE_MSEC so releasing voices free up quickly
+- kGovernorVoiceLimit: the voice limit is halved for this level and every level above it, down to GOVERNOR_MIN_VOICES
+*/
+enum governorLevel { kGovernorOff, kGovernorDelayFXOff, kGovernorUnisonOff, kGovernorShortRelease, kGovernorVoiceLimit };
+
+/**
+\class VoiceGovernor
+\ingroup ASPiK-Core
+\brief
+Keeps a synth inside its real-time budget by degrading gracefully when blocks take too long to render.
+
+VoiceGovernor Operations:
+- beginBlock( )/endBlock( ) time each block against its deadline (block size / sample rate) and
+  follow the load with a fast attack, slow release envelope
+- above GOVERNOR_HIGH_LOAD the level steps up one at a time (optional stages first, then the voice limit);
+  below GOVERNOR_LOW_LOAD for GOVERNOR_STEP_UP_MSEC it steps back down one at a time
+- addMidiEvent( ) tracks the sounding notes in age order; getNoteToSteal( ) then names the oldest notes to
+  release until the count is back at the voice limit; notes released under the sustain pedal keep counting
+  until the pedal is up
+- notes on channels without the pedal down are stolen first; getNoteToSteal( ) stops tracking them
+- a note on a channel with the pedal down keeps sounding after its note-off, so it is only stolen when
+  nothing else is left; it stays tracked (sustained) until the pedal is up
+- the owner must send the note-off for every note getNoteToSteal( ) names; modes that do not steal
+  (Mono, Legato, Unison, UniLegato) must not call it
+- the owner applies the levels to its parameter structures (allowDelayFX( ), allowUnison( ),
+  limitReleaseTime_mSec( )) whenever endBlock( ) returns true
+- no allocation, no locks; audio thread only
+
+\author Will Pirkle http://www.willpirkle.com
+\remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
+\version Revision : 1.0
+\date Date : 2018 / 09 / 7
+*/
+class VoiceGovernor
+{
+public:
+	VoiceGovernor() { clearNotes(); }
+
+	/** back to full quality; call from reset( ) with the total voice count of the engine(s) */
+	void reset(double _sampleRate, uint32_t _maxVoices)
+	{
+		sampleRate = _sampleRate;
+		maxVoices = _maxVoices > 0 ? _maxVoices : 1;
+
+		// --- one level per halving of the voice limit
+		maxLevel = kGovernorShortRelease;
+		for (uint32_t voices = maxVoices; voices / 2 >= GOVERNOR_MIN_VOICES; voices /= 2)
+			maxLevel++;
+
+		level = kGovernorOff;
+		peakLevel = kGovernorOff;
+		load = 0.0;
+		samplesSinceStep = 0;
+		lowLoadSamples = 0;
+		clearNotes();
+	}
+
+	/** off = always full quality; the load is still measured */
+	void setEnabled(bool _enabled)
+	{
+		enabled = _enabled;
+		if (!enabled)
+			level = kGovernorOff;
+	}
+
+	/** start timing a block */
+	void beginBlock() { blockStart = std::chrono::steady_clock::now(); }
+
+	/**
+	\brief stop timing a block and update the level
+
+	\param blockSize the block length in samples
+
+	\return true if the level changed and the degraded settings must be pushed again
+	*/
+	bool endBlock(uint32_t blockSize)
+	{
+		if (blockSize == 0)
+			return false;
+
+		std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - blockStart;
+		double deadline = (double)blockSize / sampleRate;
+		double blockLoad = elapsed.count() / deadline;
+
+		// --- envelope follower, time constants independent of the block size
+		double tau_mSec = blockLoad > load ? GOVERNOR_ATTACK_MSEC : GOVERNOR_RELEASE_MSEC;
+		load += (blockLoad - load) * (1.0 - exp(-1000.0 * deadline / tau_mSec));
+
+		samplesSinceStep += blockSize;
+		if (!enabled)
+			return false;
+
+		uint32_t lastLevel = level;
+		if (load > GOVERNOR_HIGH_LOAD)
+		{
+			lowLoadSamples = 0;
+			if (level < maxLevel && samplesSinceStep >= msecToSamples(GOVERNOR_STEP_DOWN_MSEC))
+				level++;
+		}
+		else if (load < GOVERNOR_LOW_LOAD && level > kGovernorOff)
+		{
+			lowLoadSamples += blockSize;
+			if (lowLoadSamples >= msecToSamples(GOVERNOR_STEP_UP_MSEC))
+			{
+				level--;
+				lowLoadSamples = 0;
+			}
+		}
+		else
+			lowLoadSamples = 0;
+
+		if (level == lastLevel)
+			return false;
+
+		samplesSinceStep = 0;
+		peakLevel = level > peakLevel ? level : peakLevel;
+		return true;
+	}
+
+	/** track a MIDI event: note-ons, note-offs, the sustain pedal and all notes/sound off */
+	void addMidiEvent(const midiEvent& event)
+	{
+		uint32_t channel = event.midiChannel & 0x0F;
+		uint32_t note = event.midiData1 & 0x7F;
+
+		if (event.midiMessage == MIDI_NOTE_ON && event.midiData2 > 0)
+			addNoteOn(channel, note);
+		else if (event.midiMessage == MIDI_NOTE_OFF || event.midiMessage == MIDI_NOTE_ON)
+			addNoteOff(channel, note);
+		else if (event.midiMessage == MIDI_CONTROL_CHANGE)
+		{
+			if (event.midiData1 == MIDI_CC_SUSTAIN)
+				setSustainPedal(channel, event.midiData2 >= 64);
+			else if (event.midiData1 == MIDI_CC_ALL_SOUND_OFF || event.midiData1 == MIDI_CC_ALL_NOTES_OFF)
+				clearChannelNotes(channel);
+		}
+	}
+
+	/**
+	\brief enforce the voice limit after a note-on went to addMidiEvent( ); call until it returns false
+
+	\param stealChannel the channel of the note to release
+	\param stealNote the note to release
+
+	\return true if stealChannel/stealNote must be released before the new note starts; the caller must
+	release it; false if the count is within the limit or every note left is held by the pedal
+	*/
+	bool getNoteToSteal(uint32_t& stealChannel, uint32_t& stealNote)
+	{
+		if (numNotes <= getVoiceLimit())
+			return false;
+
+		// --- oldest first: it has been decaying (or releasing) longest, so it is the best guess for the quietest;
+		//     notes on channels without the pedal down stop sounding at the note-off, so they go first
+		for (uint32_t i = 0; i < numNotes; i++)
+		{
+			if (!sustainPedal[notes[i].channel])
+			{
+				stealChannel = notes[i].channel;
+				stealNote = notes[i].note;
+				removeNoteAt(i);
+				return true;
+			}
+		}
+
+		// --- only pedal channels left: the note-off releases the note when the pedal comes up, so it
+		//     keeps counting until then (see setSustainPedal( ))
+		for (uint32_t i = 0; i < numNotes; i++)
+		{
+			if (!notes[i].sustained)
+			{
+				stealChannel = notes[i].channel;
+				stealNote = notes[i].note;
+				notes[i].sustained = 1;
+				return true;
+			}
+		}
+
+		// --- everything left is already held by the pedal
+		return false;
+	}
+
+	/** current level, see governorLevel */
+	uint32_t getLevel() { return level; }
+
+	/** highest level reached since the last reset( ) */
+	uint32_t getPeakLevel() { return peakLevel; }
+
+	/** the last level, where the voice limit is GOVERNOR_MIN_VOICES */
+	uint32_t getMaxLevel() { return maxLevel; }
+
+	/** render load, 1.0 = the whole block deadline */
+	double getLoad() { return load; }
+
+	/** number of notes counted against the voice limit */
+	uint32_t getNoteCount() { return numNotes; }
+
+	/** total voice count */
+	uint32_t getMaxVoices() { return maxVoices; }
+
+	/** the current voice limit */
+	uint32_t getVoiceLimit()
+	{
+		if (level < kGovernorVoiceLimit)
+			return maxVoices;
+
+		uint32_t voices = maxVoices >> (level - kGovernorShortRelease);
+		return voices > GOVERNOR_MIN_VOICES ? voices : GOVERNOR_MIN_VOICES;
+	}
+
+	/** false from kGovernorDelayFXOff on */
+	bool allowDelayFX() { return level < kGovernorDelayFXOff; }
+
+	/** false from kGovernorUnisonOff on */
+	bool allowUnison() { return level < kGovernorUnisonOff; }
+
+	/** the amp EG release time to use */
+	double limitReleaseTime_mSec(double releaseTime_mSec)
+	{
+		if (level < kGovernorShortRelease)
+			return releaseTime_mSec;
+		return releaseTime_mSec < GOVERNOR_SHORT_RELEASE_MSEC ? releaseTime_mSec : GOVERNOR_SHORT_RELEASE_MSEC;
+	}
+
+protected:
+	static const uint32_t MIDI_NOTE_OFF = 0x80;
+	static const uint32_t MIDI_NOTE_ON = 0x90;
+	static const uint32_t MIDI_CONTROL_CHANGE = 0xB0;
+	static const uint32_t MIDI_CC_SUSTAIN = 64;
+	static const uint32_t MIDI_CC_ALL_SOUND_OFF = 120;
+	static const uint32_t MIDI_CC_ALL_NOTES_OFF = 123;
+
+	/** a sounding note, oldest first */
+	struct GovernedNote
+	{
+		uint8_t channel = 0;
+		uint8_t note = 0;
+		uint8_t sustained = 0;	///< released while the pedal was down
+	};
+
+	bool enabled = true;						///< on/off
+	double sampleRate = 44100.0;				///< fs
+	uint32_t maxVoices = 1;						///< voice limit at full quality
+	uint32_t level = kGovernorOff;				///< current governorLevel
+	uint32_t peakLevel = kGovernorOff;			///< highest level since reset
+	uint32_t maxLevel = kGovernorShortRelease;	///< last level
+	double load = 0.0;							///< followed render load
+	uint32_t samplesSinceStep = 0;				///< time since the last level change
+	uint32_t lowLoadSamples = 0;				///< time the load has been low
+	std::chrono::steady_clock::time_point blockStart;	///< timing
+
+	GovernedNote notes[GOVERNOR_MAX_NOTES];	///< sounding notes in age order
+	uint32_t numNotes = 0;					///< count
+	bool sustainPedal[16];					///< CC64 per channel
+
+	/** track a note-on; a re-struck note becomes the newest note again */
+	void addNoteOn(uint32_t channel, uint32_t note)
+	{
+		removeNote(channel, note);
+		if (numNotes >= GOVERNOR_MAX_NOTES)
+			removeNoteAt(0);
+
+		notes[numNotes].channel = (uint8_t)channel;
+		notes[numNotes].note = (uint8_t)note;
+		notes[numNotes].sustained = 0;
+		numNotes++;
+	}
+
+	/** track a note-off; with the pedal down the note keeps counting until the pedal is up */
+	void addNoteOff(uint32_t channel, uint32_t note)
+	{
+		if (!sustainPedal[channel])
+		{
+			removeNote(channel, note);
+			return;
+		}
+
+		for (uint32_t i = 0; i < numNotes; i++)
+		{
+			if (notes[i].channel == channel && notes[i].note == note)
+				notes[i].sustained = 1;
+		}
+	}
+
+	/** track the sustain pedal; releasing it frees the sustained notes */
+	void setSustainPedal(uint32_t channel, bool down)
+	{
+		sustainPedal[channel] = down;
+		if (down)
+			return;
+
+		for (uint32_t i = 0; i < numNotes;)
+		{
+			if (notes[i].channel == channel && notes[i].sustained)
+				removeNoteAt(i);
+			else
+				i++;
+		}
+	}
+
+	/** all notes (or all sound) off on a channel */
+	void clearChannelNotes(uint32_t channel)
+	{
+		for (uint32_t i = 0; i < numNotes;)
+		{
+			if (notes[i].channel == channel)
+				removeNoteAt(i);
+			else
+				i++;
+		}
+	}
+
+	uint32_t msecToSamples(double mSec) { return (uint32_t)(mSec * 0.001 * sampleRate); }
+
+	void removeNoteAt(uint32_t index)
+	{
+		for (uint32_t i = index + 1; i < numNotes; i++)
+			notes[i - 1] = notes[i];
+		numNotes--;
+	}
+
+	void removeNote(uint32_t channel, uint32_t note)
+	{
+		for (uint32_t i = 0; i < numNotes; i++)
+		{
+			if (notes[i].channel == channel && notes[i].note == note)
+			{
+				removeNoteAt(i);
+				return;
+			}
+		}
+	}
+
+	void clearNotes()
+	{
+		numNotes = 0;
+		for (uint32_t channel = 0; channel < 16; channel++)
+			sustainPedal[channel] = false;
+	}
+};
+
+#endif /* defined(_VoiceGovernor_H_) */
@@ -29,7 +29,8 @@ and transposed canonical\n
 
 \returns the storage component of the filter
 */
-double Biquad::getS_value()
+template <typename T>
+double BiquadT<T>::getS_value()
 {
 	storageComponent = 0.0;
 	if (parameters.biquadCalcType == biquadAlgorithm::kDirect)
@@ -61,15 +62,18 @@ double Biquad::getS_value()
 the storageComponent or "S" value is used for Zavalishin's VA filters and is only
 available on two of the forms: direct and transposed canonical\n
 
-\param xn the input sample x(n)
+\param input the input sample x(n)
 \returns the biquad processed output y(n)
 */
-double Biquad::processAudioSample(double xn)
+template <typename T>
+double BiquadT<T>::processAudioSample(double input)
 {
+	T xn = (T)input;
+
 	if (parameters.biquadCalcType == biquadAlgorithm::kDirect)
 	{
 		// --- 1)  form output y(n) = a0*x(n) + a1*x(n-1) + a2*x(n-2) - b1*y(n-1) - b2*y(n-2)
-		double yn = coeffArray[a0] * xn + 
+		T yn = coeffArray[a0] * xn + 
 					coeffArray[a1] * stateArray[x_z1] +
 					coeffArray[a2] * stateArray[x_z2] -
 					coeffArray[b1] * stateArray[y_z1] -
@@ -93,10 +97,10 @@ double Biquad::processAudioSample(double xn)
 		// --- 1)  form output y(n) = a0*w(n) + m_f_a1*stateArray[x_z1] + m_f_a2*stateArray[x_z2][x_z2];
 		//
 		// --- w(n) = x(n) - b1*stateArray[x_z1] - b2*stateArray[x_z2]
-		double wn = xn - coeffArray[b1] * stateArray[x_z1] - coeffArray[b2] * stateArray[x_z2];
+		T wn = xn - coeffArray[b1] * stateArray[x_z1] - coeffArray[b2] * stateArray[x_z2];
 
 		// --- y(n):
-		double yn = coeffArray[a0] * wn + coeffArray[a1] * stateArray[x_z1] + coeffArray[a2] * stateArray[x_z2];
+		T yn = coeffArray[a0] * wn + coeffArray[a1] * stateArray[x_z1] + coeffArray[a2] * stateArray[x_z2];
 
 		// --- 2) underflow check
 		checkFloatUnderflow(yn);
@@ -113,10 +117,10 @@ double Biquad::processAudioSample(double xn)
 		// --- 1)  form output y(n) = a0*w(n) + stateArray[x_z1]
 		//
 		// --- w(n) = x(n) + stateArray[y_z1]
-		double wn = xn + stateArray[y_z1];
+		T wn = xn + stateArray[y_z1];
 
 		// --- y(n) = a0*w(n) + stateArray[x_z1]
-		double yn = coeffArray[a0] * wn + stateArray[x_z1];
+		T yn = coeffArray[a0] * wn + stateArray[x_z1];
 
 		// --- 2) underflow check
 		checkFloatUnderflow(yn);
@@ -134,7 +138,7 @@ double Biquad::processAudioSample(double xn)
 	else if (parameters.biquadCalcType == biquadAlgorithm::kTransposeCanonical)
 	{
 		// --- 1)  form output y(n) = a0*x(n) + stateArray[x_z1]
-		double yn = coeffArray[a0] * xn + stateArray[x_z1];
+		T yn = coeffArray[a0] * xn + stateArray[x_z1];
 
 		// --- 2) underflow check
 		checkFloatUnderflow(yn);
@@ -146,9 +150,122 @@ double Biquad::processAudioSample(double xn)
 		// --- return value
 		return yn;
 	}
-	return xn; // didn't process anything :(
+	return input; // didn't process anything :(
+}
+
+/**
+\brief process a block in place, with the same math as processAudioSample( )
+
+Operation:
+- decode the structure once per block instead of once per sample
+- run the loop on local copies of the coefficients and states (no aliasing with the block), then
+  store the states back
+
+\param block the samples; the input is replaced with the output
+\param frames number of samples
+*/
+template <typename T>
+template <typename S>
+void BiquadT<T>::processBlockOf(S* block, uint32_t frames)
+{
+	const T ca0 = coeffArray[a0];
+	const T ca1 = coeffArray[a1];
+	const T ca2 = coeffArray[a2];
+	const T cb1 = coeffArray[b1];
+	const T cb2 = coeffArray[b2];
+
+	T xz1 = stateArray[x_z1];
+	T xz2 = stateArray[x_z2];
+	T yz1 = stateArray[y_z1];
+	T yz2 = stateArray[y_z2];
+
+	if (parameters.biquadCalcType == biquadAlgorithm::kDirect)
+	{
+		for (uint32_t i = 0; i < frames; i++)
+		{
+			T xn = (T)block[i];
+			T yn = ca0 * xn + ca1 * xz1 + ca2 * xz2 - cb1 * yz1 - cb2 * yz2;
+			checkFloatUnderflow(yn);
+			xz2 = xz1;
+			xz1 = xn;
+			yz2 = yz1;
+			yz1 = yn;
+			block[i] = (S)yn;
+		}
+	}
+	else if (parameters.biquadCalcType == biquadAlgorithm::kCanonical)
+	{
+		for (uint32_t i = 0; i < frames; i++)
+		{
+			T wn = (T)block[i] - cb1 * xz1 - cb2 * xz2;
+			T yn = ca0 * wn + ca1 * xz1 + ca2 * xz2;
+			checkFloatUnderflow(yn);
+			xz2 = xz1;
+			xz1 = wn;
+			block[i] = (S)yn;
+		}
+	}
+	else if (parameters.biquadCalcType == biquadAlgorithm::kTransposeDirect)
+	{
+		for (uint32_t i = 0; i < frames; i++)
+		{
+			T wn = (T)block[i] + yz1;
+			T yn = ca0 * wn + xz1;
+			checkFloatUnderflow(yn);
+			yz1 = yz2 - cb1 * wn;
+			yz2 = -cb2 * wn;
+			xz1 = xz2 + ca1 * wn;
+			xz2 = ca2 * wn;
+			block[i] = (S)yn;
+		}
+	}
+	else if (parameters.biquadCalcType == biquadAlgorithm::kTransposeCanonical)
+	{
+		for (uint32_t i = 0; i < frames; i++)
+		{
+			T xn = (T)block[i];
+			T yn = ca0 * xn + xz1;
+			checkFloatUnderflow(yn);
+			xz1 = ca1 * xn - cb1 * yn + xz2;
+			xz2 = ca2 * xn - cb2 * yn;
+			block[i] = (S)yn;
+		}
+	}
+
+	stateArray[x_z1] = xz1;
+	stateArray[x_z2] = xz2;
+	stateArray[y_z1] = yz1;
+	stateArray[y_z2] = yz2;
+}
+
+/**
+\brief process a block of doubles in place, with the same math as processAudioSample( )
+
+\param block the samples; the input is replaced with the output
+\param frames number of samples
+*/
+template <typename T>
+void BiquadT<T>::processBlockInPlace(double* block, uint32_t frames)
+{
+	processBlockOf(block, frames);
+}
+
+/**
+\brief process a block of the object's own sample type in place; for BiquadF this is the all-float path
+
+\param block the samples; the input is replaced with the output
+\param frames number of samples
+*/
+template <typename T>
+void BiquadT<T>::processBlock(T* block, uint32_t frames)
+{
+	processBlockOf(block, frames);
 }
 
+// --- the sample types BiquadT is built for
+template class BiquadT<double>;
+template class BiquadT<float>;
+
 // --- returns true if coeffs were updated
 bool AudioFilter::calculateFilterCoeffs()
 {
@@ -949,6 +1066,360 @@ double AudioFilter::processAudioSample(double xn)
 	return coeffArray[d0] * xn + coeffArray[c0] * biquad.processAudioSample(xn);
 }
 
+/**
+\brief process a block in place: biquad first, then the wet/dry mix
+
+Operation:
+- the common case (no dry signal, unity wet gain) is the biquad loop alone
+- otherwise the dry signal is kept in a local chunk for the mix
+
+\param block the samples; the input is replaced with the output
+\param frames number of samples
+*/
+void AudioFilter::processBlockInPlace(double* block, uint32_t frames)
+{
+	const double dry = coeffArray[d0];
+	const double wet = coeffArray[c0];
+	if (dry == 0.0 && wet == 1.0)
+	{
+		biquad.processBlockInPlace(block, frames);
+		return;
+	}
+
+	double dryChunk[FX_BLOCK_CHUNK_SIZE];
+	for (uint32_t start = 0; start < frames; start += FX_BLOCK_CHUNK_SIZE)
+	{
+		uint32_t length = frames - start < FX_BLOCK_CHUNK_SIZE ? frames - start : FX_BLOCK_CHUNK_SIZE;
+		double* chunk = block + start;
+		memcpy(dryChunk, chunk, sizeof(double)*length);
+
+		biquad.processBlockInPlace(chunk, length);
+
+		for (uint32_t i = 0; i < length; i++)
+			chunk[i] = dry * dryChunk[i] + wet * chunk[i];
+	}
+}
+
+/**
+\brief set every biquad of the bank to pass-through (a0 = 1, c0 = 1, the rest 0)
+*/
+template <typename T>
+void BiquadBankT<T>::clearCoefficients()
+{
+	memset(&coeffArray[0][0][0], 0, sizeof(coeffArray));
+	for (uint32_t stage = 0; stage < BIQUAD_BANK_MAX_STAGES; stage++)
+	{
+		for (uint32_t lane = 0; lane < BIQUAD_BANK_MAX_LANES; lane++)
+		{
+			coeffArray[stage][a0][lane] = 1.0;
+			coeffArray[stage][c0][lane] = 1.0;
+		}
+		stageWetDry[stage] = false;
+	}
+}
+
+/**
+\brief clear out the state arrays (flush delays)
+*/
+template <typename T>
+void BiquadBankT<T>::clearStates()
+{
+	memset(&stateArray[0][0][0], 0, sizeof(stateArray));
+}
+
+/**
+\brief set the topology; lanes and stages are clamped to the bank limits and a new topology clears the states
+
+\param _parameters the new topology
+*/
+template <typename T>
+void BiquadBankT<T>::setParameters(const BiquadBankParameters& _parameters)
+{
+	BiquadBankParameters newParameters = _parameters;
+	newParameters.lanes = newParameters.lanes < 1 ? 1 : (newParameters.lanes > BIQUAD_BANK_MAX_LANES ? BIQUAD_BANK_MAX_LANES : newParameters.lanes);
+	newParameters.stages = newParameters.stages < 1 ? 1 : (newParameters.stages > BIQUAD_BANK_MAX_STAGES ? BIQUAD_BANK_MAX_STAGES : newParameters.stages);
+
+	if (newParameters.lanes != parameters.lanes ||
+		newParameters.stages != parameters.stages ||
+		newParameters.input != parameters.input ||
+		newParameters.biquadCalcType != parameters.biquadCalcType)
+		clearStates();
+
+	parameters = newParameters;
+}
+
+/**
+\brief set the coefficients of one biquad; the other lanes are not touched
+
+\param lane the lane, 0 to BIQUAD_BANK_MAX_LANES - 1
+\param stage the stage, 0 to BIQUAD_BANK_MAX_STAGES - 1
+\param coeffs numCoeffs values: a0, a1, a2, b1, b2, c0 (wet), d0 (dry)
+*/
+template <typename T>
+void BiquadBankT<T>::setCoefficients(uint32_t lane, uint32_t stage, const double* coeffs)
+{
+	if (lane >= BIQUAD_BANK_MAX_LANES || stage >= BIQUAD_BANK_MAX_STAGES)
+		return;
+
+	for (uint32_t coeff = 0; coeff < numCoeffs; coeff++)
+		coeffArray[stage][coeff][lane] = coeffs[coeff];
+
+	// --- the mix costs two multiplies per sample; only do it for stages that need it
+	stageWetDry[stage] = false;
+	for (uint32_t i = 0; i < BIQUAD_BANK_MAX_LANES; i++)
+	{
+		if (coeffArray[stage][c0][i] != 1.0 || coeffArray[stage][d0][i] != 0.0)
+			stageWetDry[stage] = true;
+	}
+}
+
+/**
+\brief set the coefficients of one biquad from AudioFilter parameters, with the AudioFilter equations
+
+\param lane the lane
+\param stage the stage
+\param filterParameters the filter
+*/
+template <typename T>
+void BiquadBankT<T>::setFilterParameters(uint32_t lane, uint32_t stage, const AudioFilterParameters& filterParameters)
+{
+	coeffCalculator.setParameters(filterParameters);
+	coeffCalculator.setSampleRate(sampleRate); // --- always recalculates
+	setCoefficients(lane, stage, coeffCalculator.getCoefficients());
+}
+
+/**
+\brief run one stage of one vector of lanes over an interleaved chunk, with the same math as Biquad::processAudioSample( )
+
+Operation:
+- the structure and the wet/dry mix are template arguments, so each instantiation is one tight loop
+- the coefficients and states live in registers for the whole chunk
+
+\param stage the stage
+\param lane the first lane of the vector
+\param work interleaved samples: work[frame * BIQUAD_BANK_MAX_LANES + lane], replaced with the output
+\param frames number of frames
+*/
+template <typename T>
+template <biquadAlgorithm algorithm, bool wetDry>
+void BiquadBankT<T>::processStageVector(uint32_t stage, uint32_t lane, T* work, uint32_t frames)
+{
+	typedef BiquadBankVector<T> V;
+	const V ca0 = V::load(&coeffArray[stage][a0][lane]);
+	const V ca1 = V::load(&coeffArray[stage][a1][lane]);
+	const V ca2 = V::load(&coeffArray[stage][a2][lane]);
+	const V cb1 = V::load(&coeffArray[stage][b1][lane]);
+	const V cb2 = V::load(&coeffArray[stage][b2][lane]);
+	const V wet = V::load(&coeffArray[stage][c0][lane]);
+	const V dry = V::load(&coeffArray[stage][d0][lane]);
+
+	V xz1 = V::load(&stateArray[stage][x_z1][lane]);
+	V xz2 = V::load(&stateArray[stage][x_z2][lane]);
+	V yz1 = V::load(&stateArray[stage][y_z1][lane]);
+	V yz2 = V::load(&stateArray[stage][y_z2][lane]);
+
+	T* sample = work + lane;
+	for (uint32_t i = 0; i < frames; i++, sample += BIQUAD_BANK_MAX_LANES)
+	{
+		V xn = V::load(sample);
+		V yn;
+		if (algorithm == biquadAlgorithm::kDirect)
+		{
+			yn = ca0 * xn + ca1 * xz1 + ca2 * xz2 - cb1 * yz1 - cb2 * yz2;
+#if !DENORMAL_GUARD_ACTIVE
+			yn.flushUnderflow();
+#endif
+			xz2 = xz1;
+			xz1 = xn;
+			yz2 = yz1;
+			yz1 = yn;
+		}
+		else if (algorithm == biquadAlgorithm::kCanonical)
+		{
+			V wn = xn - cb1 * xz1 - cb2 * xz2;
+			yn = ca0 * wn + ca1 * xz1 + ca2 * xz2;
+#if !DENORMAL_GUARD_ACTIVE
+			yn.flushUnderflow();
+#endif
+			xz2 = xz1;
+			xz1 = wn;
+		}
+		else if (algorithm == biquadAlgorithm::kTransposeDirect)
+		{
+			V wn = xn + yz1;
+			yn = ca0 * wn + xz1;
+#if !DENORMAL_GUARD_ACTIVE
+			yn.flushUnderflow();
+#endif
+			yz1 = yz2 - cb1 * wn;
+			yz2 = -cb2 * wn;
+			xz1 = xz2 + ca1 * wn;
+			xz2 = ca2 * wn;
+		}
+		else // kTransposeCanonical
+		{
+			yn = ca0 * xn + xz1;
+#if !DENORMAL_GUARD_ACTIVE
+			yn.flushUnderflow();
+#endif
+			xz1 = ca1 * xn - cb1 * yn + xz2;
+			xz2 = ca2 * xn - cb2 * yn;
+		}
+
+		// --- AudioFilter wet/dry: d0 * x(n) + c0 * y(n)
+		if (wetDry)
+			yn = dry * xn + wet * yn;
+
+		yn.store(sample);
+	}
+
+	xz1.store(&stateArray[stage][x_z1][lane]);
+	xz2.store(&stateArray[stage][x_z2][lane]);
+	yz1.store(&stateArray[stage][y_z1][lane]);
+	yz2.store(&stateArray[stage][y_z2][lane]);
+}
+
+/**
+\brief run all stages over an interleaved chunk; the structure is decoded once per stage and vector of lanes
+
+\param work interleaved samples: work[frame * BIQUAD_BANK_MAX_LANES + lane], replaced with the output
+\param frames number of frames
+*/
+template <typename T>
+void BiquadBankT<T>::processWork(T* work, uint32_t frames)
+{
+	const uint32_t vectors = getVectorCount();
+	for (uint32_t stage = 0; stage < parameters.stages; stage++)
+	{
+		bool wetDry = stageWetDry[stage];
+		for (uint32_t vector = 0; vector < vectors; vector++)
+		{
+			uint32_t lane = vector * BiquadBankVector<T>::width;
+			switch (parameters.biquadCalcType)
+			{
+			case biquadAlgorithm::kDirect:
+				wetDry ? processStageVector<biquadAlgorithm::kDirect, true>(stage, lane, work, frames)
+					   : processStageVector<biquadAlgorithm::kDirect, false>(stage, lane, work, frames);
+				break;
+			case biquadAlgorithm::kCanonical:
+				wetDry ? processStageVector<biquadAlgorithm::kCanonical, true>(stage, lane, work, frames)
+					   : processStageVector<biquadAlgorithm::kCanonical, false>(stage, lane, work, frames);
+				break;
+			case biquadAlgorithm::kTransposeDirect:
+				wetDry ? processStageVector<biquadAlgorithm::kTransposeDirect, true>(stage, lane, work, frames)
+					   : processStageVector<biquadAlgorithm::kTransposeDirect, false>(stage, lane, work, frames);
+				break;
+			case biquadAlgorithm::kTransposeCanonical:
+				wetDry ? processStageVector<biquadAlgorithm::kTransposeCanonical, true>(stage, lane, work, frames)
+					   : processStageVector<biquadAlgorithm::kTransposeCanonical, false>(stage, lane, work, frames);
+				break;
+			}
+		}
+	}
+}
+
+/**
+\brief process xn through every lane
+
+\param xn input
+\return the lane 0 output
+*/
+template <typename T>
+double BiquadBankT<T>::processAudioSample(double xn)
+{
+	T work[BIQUAD_BANK_MAX_LANES] = { 0 };
+	for (uint32_t lane = 0; lane < parameters.lanes; lane++)
+		work[lane] = (T)xn;
+
+	processWork(work, 1);
+	return work[0];
+}
+
+/**
+\brief process one frame
+
+\param inputFrame kPerLane: one input per lane (missing channels are silent); kFanOut: inputFrame[0] feeds every lane
+\param outputFrame one output per lane, up to outputChannels
+\param inputChannels number of input channels
+\param outputChannels number of output channels
+\return true if processed
+*/
+template <typename T>
+bool BiquadBankT<T>::processAudioFrame(const float* inputFrame, float* outputFrame, uint32_t inputChannels, uint32_t outputChannels)
+{
+	if (inputChannels == 0)
+		return false;
+
+	T work[BIQUAD_BANK_MAX_LANES] = { 0 };
+	for (uint32_t lane = 0; lane < parameters.lanes; lane++)
+	{
+		if (parameters.input == biquadBankInput::kFanOut)
+			work[lane] = inputFrame[0];
+		else
+			work[lane] = lane < inputChannels ? inputFrame[lane] : 0.0;
+	}
+
+	processWork(work, 1);
+
+	uint32_t outputLanes = outputChannels < parameters.lanes ? outputChannels : parameters.lanes;
+	for (uint32_t lane = 0; lane < outputLanes; lane++)
+		outputFrame[lane] = (float)work[lane];
+	return true;
+}
+
+/**
+\brief process a block in FX_BLOCK_CHUNK_SIZE chunks: interleave the lanes, run the stages, de-interleave
+
+\param inputs kPerLane: channel n feeds lane n (missing channels are silent); kFanOut: inputs[0] feeds every lane
+\param outputs channel n is lane n, for the first channels lanes
+\param channels number of channels
+\param frames number of frames
+\return true if processed
+*/
+template <typename T>
+bool BiquadBankT<T>::processAudioBlock(const float* const* inputs, float* const* outputs, uint32_t channels, uint32_t frames)
+{
+	if (channels == 0)
+		return false;
+
+	const uint32_t lanes = parameters.lanes;
+	const uint32_t paddedLanes = getVectorCount() * BiquadBankVector<T>::width;
+	const uint32_t outputLanes = channels < lanes ? channels : lanes;
+
+	T work[FX_BLOCK_CHUNK_SIZE * BIQUAD_BANK_MAX_LANES];
+	for (uint32_t start = 0; start < frames; start += FX_BLOCK_CHUNK_SIZE)
+	{
+		uint32_t length = frames - start < FX_BLOCK_CHUNK_SIZE ? frames - start : FX_BLOCK_CHUNK_SIZE;
+
+		// --- interleave; the lanes that only pad out the last vector are silent
+		for (uint32_t lane = 0; lane < paddedLanes; lane++)
+		{
+			const float* input = nullptr;
+			if (lane < lanes)
+				input = parameters.input == biquadBankInput::kFanOut ? inputs[0] : (lane < channels ? inputs[lane] : nullptr);
+
+			T* sample = work + lane;
+			for (uint32_t i = 0; i < length; i++, sample += BIQUAD_BANK_MAX_LANES)
+				*sample = input ? input[start + i] : 0.0;
+		}
+
+		processWork(work, length);
+
+		// --- de-interleave
+		for (uint32_t lane = 0; lane < outputLanes; lane++)
+		{
+			const T* sample = work + lane;
+			for (uint32_t i = 0; i < length; i++, sample += BIQUAD_BANK_MAX_LANES)
+				outputs[lane][start + i] = (float)*sample;
+		}
+	}
+	return true;
+}
+
+// --- the sample types BiquadBankT is built for
+template class BiquadBankT<double>;
+template class BiquadBankT<float>;
+
 /**
 \brief sets the new attack time and re-calculates the time constant
 
@@ -1043,18 +1514,21 @@ const SignalGenData LFO::renderAudioOutput()
 }
 
 
-#ifdef HAVE_FFTW
+// --- FFT objects: fftbackend.h supplies FFTW or the built-in FFT
 
 /**
 \brief destroys the FFTW arrays and plans.
 */
 void FastFFT::destroyFFTW()
 {
-#ifdef HAVE_FFTW
 	if (plan_forward)
 		fftw_destroy_plan(plan_forward);
 	if (plan_backward)
 		fftw_destroy_plan(plan_backward);
+	if (plan_real_forward)
+		fftw_destroy_plan(plan_real_forward);
+	if (plan_real_backward)
+		fftw_destroy_plan(plan_real_backward);
 
 	if (fft_input)
 		fftw_free(fft_input);
@@ -1065,7 +1539,20 @@ void FastFFT::destroyFFTW()
 		fftw_free(ifft_input);
 	if (ifft_result)
 		fftw_free(ifft_result);
-#endif
+
+	if (real_fft_input)
+		fftw_free(real_fft_input);
+	if (real_fft_result)
+		fftw_free(real_fft_result);
+	if (real_ifft_input)
+		fftw_free(real_ifft_input);
+	if (real_ifft_result)
+		fftw_free(real_ifft_result);
+
+	plan_forward = plan_backward = plan_real_forward = plan_real_backward = nullptr;
+	fft_input = fft_result = ifft_input = ifft_result = nullptr;
+	real_fft_input = real_ifft_result = nullptr;
+	real_fft_result = real_ifft_input = nullptr;
 }
 
 
@@ -1086,7 +1573,7 @@ void FastFFT::initialize(unsigned int _frameLength, windowType _window)
 	windowGainCorrection = 0.0;
 
 	if (windowBuffer)
-		delete windowBuffer;
+		delete [] windowBuffer;
 
 	windowBuffer = new double[frameLength];
 	memset(&windowBuffer[0], 0, frameLength * sizeof(double));
@@ -1102,7 +1589,7 @@ void FastFFT::initialize(unsigned int _frameLength, windowType _window)
 	// --- WP: this is why denominators are (frameLength) rather than (frameLength - 1)
 	if (window == windowType::kRectWindow)
 	{
-		for (int n = 0; n < frameLength - 1; n++)
+		for (unsigned int n = 0; n < frameLength - 1; n++)
 		{
 			windowBuffer[n] = 1.0;
 			windowGainCorrection += windowBuffer[n];
@@ -1110,7 +1597,7 @@ void FastFFT::initialize(unsigned int _frameLength, windowType _window)
 	}
 	else if (window == windowType::kHammingWindow)
 	{
-		for (int n = 0; n < frameLength - 1; n++)
+		for (unsigned int n = 0; n < frameLength - 1; n++)
 		{
 			windowBuffer[n] = 0.54 - 0.46*cos((n*2.0*kPi) / (frameLength));
 			windowGainCorrection += windowBuffer[n];
@@ -1118,7 +1605,7 @@ void FastFFT::initialize(unsigned int _frameLength, windowType _window)
 	}
 	else if (window == windowType::kHannWindow)
 	{
-		for (int n = 0; n < frameLength; n++)
+		for (unsigned int n = 0; n < frameLength; n++)
 		{
 			windowBuffer[n] = 0.5 * (1 - cos((n*2.0*kPi) / (frameLength)));
 			windowGainCorrection += windowBuffer[n];
@@ -1126,7 +1613,7 @@ void FastFFT::initialize(unsigned int _frameLength, windowType _window)
 	}
 	else if (window == windowType::kBlackmanHarrisWindow)
 	{
-		for (int n = 0; n < frameLength; n++)
+		for (unsigned int n = 0; n < frameLength; n++)
 		{
 			windowBuffer[n] = (0.42323 - (0.49755*cos((n*2.0*kPi) / (frameLength))) + 0.07922*cos((2 * n*2.0*kPi) / (frameLength)));
 			windowGainCorrection += windowBuffer[n];
@@ -1134,7 +1621,7 @@ void FastFFT::initialize(unsigned int _frameLength, windowType _window)
 	}
 	else if (window == windowType::kNoWindow)
 	{
-		for (int n = 0; n < frameLength; n++)
+		for (unsigned int n = 0; n < frameLength; n++)
 		{
 			windowBuffer[n] = 1.0;
 			windowGainCorrection += windowBuffer[n];
@@ -1142,7 +1629,7 @@ void FastFFT::initialize(unsigned int _frameLength, windowType _window)
 	}
 	else // --- default to kNoWindow
 	{
-		for (int n = 0; n < frameLength; n++)
+		for (unsigned int n = 0; n < frameLength; n++)
 		{
 			windowBuffer[n] = 1.0;
 			windowGainCorrection += windowBuffer[n];
@@ -1161,6 +1648,15 @@ void FastFFT::initialize(unsigned int _frameLength, windowType _window)
 
 	plan_forward = fftw_plan_dft_1d(frameLength, fft_input, fft_result, FFTW_FORWARD, FFTW_ESTIMATE);
 	plan_backward = fftw_plan_dft_1d(frameLength, ifft_input, ifft_result, FFTW_BACKWARD, FFTW_ESTIMATE);
+
+	// --- real FFTs: N samples <-> N/2 + 1 bins
+	real_fft_input = (double*)fftw_malloc(sizeof(double) * frameLength);
+	real_fft_result = (fftw_complex*)fftw_malloc(sizeof(fftw_complex) * getBinCount());
+	real_ifft_input = (fftw_complex*)fftw_malloc(sizeof(fftw_complex) * getBinCount());
+	real_ifft_result = (double*)fftw_malloc(sizeof(double) * frameLength);
+
+	plan_real_forward = fftw_plan_dft_r2c_1d(frameLength, real_fft_input, real_fft_result, FFTW_ESTIMATE);
+	plan_real_backward = fftw_plan_dft_c2r_1d(frameLength, real_ifft_input, real_ifft_result, FFTW_ESTIMATE);
 }
 
 /**
@@ -1176,7 +1672,7 @@ void FastFFT::initialize(unsigned int _frameLength, windowType _window)
 fftw_complex* FastFFT::doFFT(double* inputReal, double* inputImag)
 {
 	// ------ load up the FFT input array
-	for (int i = 0; i < frameLength; i++)
+	for (unsigned int i = 0; i < frameLength; i++)
 	{
 		fft_input[i][0] = inputReal[i];		// --- real
 		if (inputImag)
@@ -1204,7 +1700,7 @@ fftw_complex* FastFFT::doFFT(double* inputReal, double* inputImag)
 fftw_complex* FastFFT::doInverseFFT(double* inputReal, double* inputImag)
 {
 	// ------ load up the iFFT input array
-	for (int i = 0; i < frameLength; i++)
+	for (unsigned int i = 0; i < frameLength; i++)
 	{
 		ifft_input[i][0] = inputReal[i];		// --- real
 		if (inputImag)
@@ -1219,6 +1715,43 @@ fftw_complex* FastFFT::doInverseFFT(double* inputReal, double* inputImag)
 	return ifft_result;
 }
 
+/**
+\brief perform the real FFT operation
+
+- NOTES:<br>
+The spectrum of a real signal is conjugate symmetric, X(N - k) = X*(k), so only bins 0 to N/2 are computed.<br>
+
+\param input an array of N real valued points
+
+\returns a pointer to a fftw_complex array of N/2 + 1 bins: real (column 0) and imaginary (column 1) parts
+*/
+fftw_complex* FastFFT::doRealFFT(const double* input)
+{
+	// ------ load up the FFT input array
+	memcpy(real_fft_input, input, frameLength * sizeof(double));
+
+	// --- do the FFT
+	fftw_execute(plan_real_forward);
+
+	return real_fft_result;
+}
+
+/**
+\brief perform the inverse real FFT operation on the N/2 + 1 bins in getRealIFFTInput( )
+
+- NOTES:<br>
+The output is unnormalized (scaled by N). FFTW overwrites the input bins.<br>
+
+\returns a pointer to the N real valued output points
+*/
+double* FastFFT::doInverseRealFFT()
+{
+	// --- do the IFFT
+	fftw_execute(plan_real_backward);
+
+	return real_ifft_result;
+}
+
 /**
 \brief destroys the FFTW arrays and plans.
 */
@@ -1235,6 +1768,10 @@ void PhaseVocoder::destroyFFTW()
 		fftw_free(fft_result);
 	if (ifft_result)
 		fftw_free(ifft_result);
+
+	plan_forward = plan_backward = nullptr;
+	fft_input = ifft_result = nullptr;
+	fft_result = nullptr;
 }
 
 /**
@@ -1303,7 +1840,7 @@ void PhaseVocoder::initialize(unsigned int _frameLength, unsigned int _hopSize,
 	// --- WP: this is why denominators are (frameLength) rather than (frameLength - 1)
 	if (window == windowType::kRectWindow)
 	{
-		for (int n = 0; n < frameLength - 1; n++)
+		for (unsigned int n = 0; n < frameLength - 1; n++)
 		{
 			windowBuffer[n] = 1.0;
 			windowHopCorrection += windowBuffer[n];
@@ -1311,7 +1848,7 @@ void PhaseVocoder::initialize(unsigned int _frameLength, unsigned int _hopSize,
 	}
 	else if (window == windowType::kHammingWindow)
 	{
-		for (int n = 0; n < frameLength - 1; n++)
+		for (unsigned int n = 0; n < frameLength - 1; n++)
 		{
 			windowBuffer[n] = 0.54 - 0.46*cos((n*2.0*kPi) / (frameLength));
 			windowHopCorrection += windowBuffer[n];
@@ -1319,7 +1856,7 @@ void PhaseVocoder::initialize(unsigned int _frameLength, unsigned int _hopSize,
 	}
 	else if (window == windowType::kHannWindow)
 	{
-		for (int n = 0; n < frameLength; n++)
+		for (unsigned int n = 0; n < frameLength; n++)
 		{
 			windowBuffer[n] = 0.5 * (1 - cos((n*2.0*kPi) / (frameLength)));
 			windowHopCorrection += windowBuffer[n];
@@ -1327,7 +1864,7 @@ void PhaseVocoder::initialize(unsigned int _frameLength, unsigned int _hopSize,
 	}
 	else if (window == windowType::kBlackmanHarrisWindow)
 	{
-		for (int n = 0; n < frameLength; n++)
+		for (unsigned int n = 0; n < frameLength; n++)
 		{
 			windowBuffer[n] = (0.42323 - (0.49755*cos((n*2.0*kPi) / (frameLength))) + 0.07922*cos((2 * n*2.0*kPi) / (frameLength)));
 			windowHopCorrection += windowBuffer[n];
@@ -1335,7 +1872,7 @@ void PhaseVocoder::initialize(unsigned int _frameLength, unsigned int _hopSize,
 	}
 	else if (window == windowType::kNoWindow)
 	{
-		for (int n = 0; n < frameLength; n++)
+		for (unsigned int n = 0; n < frameLength; n++)
 		{
 			windowBuffer[n] = 1.0;
 			windowHopCorrection += windowBuffer[n];
@@ -1343,7 +1880,7 @@ void PhaseVocoder::initialize(unsigned int _frameLength, unsigned int _hopSize,
 	}
 	else // --- default to kNoWindow
 	{
-		for (int n = 0; n < frameLength; n++)
+		for (unsigned int n = 0; n < frameLength; n++)
 		{
 			windowBuffer[n] = 1.0;
 			windowHopCorrection += windowBuffer[n];
@@ -1369,15 +1906,14 @@ void PhaseVocoder::initialize(unsigned int _frameLength, unsigned int _hopSize,
 	needInverseFFT = false;
 	needOverlapAdd = false;
 
-#ifdef HAVE_FFTW
+	// --- real FFTs: the frames are real, so only bins 0 to N/2 are computed
 	destroyFFTW();
-	fft_input = (fftw_complex*)fftw_malloc(sizeof(fftw_complex) * frameLength);
-	fft_result = (fftw_complex*)fftw_malloc(sizeof(fftw_complex) * frameLength);
-	ifft_result = (fftw_complex*)fftw_malloc(sizeof(fftw_complex) * frameLength);
+	fft_input = (double*)fftw_malloc(sizeof(double) * frameLength);
+	fft_result = (fftw_complex*)fftw_malloc(sizeof(fftw_complex) * getBinCount());
+	ifft_result = (double*)fftw_malloc(sizeof(double) * frameLength);
 
-	plan_forward = fftw_plan_dft_1d(frameLength, fft_input, fft_result, FFTW_FORWARD, FFTW_ESTIMATE);
-	plan_backward = fftw_plan_dft_1d(frameLength, fft_result, ifft_result, FFTW_BACKWARD, FFTW_ESTIMATE);
-#endif
+	plan_forward = fftw_plan_dft_r2c_1d(frameLength, fft_input, fft_result, FFTW_ESTIMATE);
+	plan_backward = fftw_plan_dft_c2r_1d(frameLength, fft_result, ifft_result, FFTW_ESTIMATE);
 }
 
 /**
@@ -1429,10 +1965,9 @@ bool PhaseVocoder::advanceAndCheckFFT()
 
 	// --- we have a FFT ready
 	// --- load up the input to the FFT
-	for (int i = 0; i < frameLength; i++)
+	for (unsigned int i = 0; i < frameLength; i++)
 	{
-		fft_input[i][0] = inputBuffer[inputReadIndex++] * windowBuffer[i];
-		fft_input[i][1] = 0.0; // use this if your data is complex valued
+		fft_input[i] = inputBuffer[inputReadIndex++] * windowBuffer[i];
 
 		// --- wrap if index > bufferlength - 1
 		inputReadIndex &= wrapMask;
@@ -1552,10 +2087,10 @@ void PhaseVocoder::doOverlapAdd(double* outputData, int length)
 		return;
 	}
 
-	for (int i = 0; i < frameLength; i++)
+	for (unsigned int i = 0; i < frameLength; i++)
 	{
 		// --- accumulate
-		outputBuffer[outputWriteIndex++] += windowHopCorrection * ifft_result[i][0];
+		outputBuffer[outputWriteIndex++] += windowHopCorrection * ifft_result[i];
 
 		// --- wrap if index > bufferlength - 1
 		outputWriteIndex &= wrapMaskOut;
@@ -1565,5 +2100,661 @@ void PhaseVocoder::doOverlapAdd(double* outputData, int length)
 	needOverlapAdd = false;
 }
 
+// --- PartitionedConvolver worker: spin, then yield, then short sleeps while there is no tail block
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#include <emmintrin.h>
+#define CONVOLVER_CPU_RELAX() _mm_pause()
+#elif defined(__aarch64__) || defined(__arm__)
+#define CONVOLVER_CPU_RELAX() __asm__ __volatile__("yield")
+#else
+#define CONVOLVER_CPU_RELAX()
+#endif
+
+#include <chrono>
+
+#if defined(__APPLE__) || defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+const uint32_t kConvolverSpinCount = 4096;
+const uint32_t kConvolverYieldCount = 16384;
+const uint32_t kConvolverSleep_uSec = 100;
+
+/**
+\brief smallest power of 2 that is >= value
+*/
+static inline uint32_t nextPowerOfTwo(uint32_t value)
+{
+	uint32_t power = 1;
+	while (power < value)
+		power <<= 1;
+	return power;
+}
+
+/**
+\brief PartitionedConvolver constructor; there is no IR (silence) until setImpulseResponses( )
+*/
+PartitionedConvolver::PartitionedConvolver()
+{
+	running.store(false);
+	tailState.store(kTailIdle);
+
+	for (uint32_t i = 0; i < CONVOLVER_MAX_PATHS; i++)
+	{
+		pathInput[i] = 0;
+		pathOutput[i] = 0;
+	}
+}
+
+/**
+\brief PartitionedConvolver destructor; joins the worker thread
+*/
+PartitionedConvolver::~PartitionedConvolver()
+{
+	stopWorker();
+}
+
+/**
+\brief flush the input history, the delay lines and the pending output; the IRs are kept
+
+Operation:
+- a background block in flight is finished (and dropped) first, so the worker is idle afterwards
+
+\param _sampleRate not used; the IRs are sample rate specific
+*/
+bool PartitionedConvolver::reset(double _sampleRate)
+{
+	if (tailInFlight)
+	{
+		collectTail();
+		tailInFlight = false;
+		tailState.store(kTailIdle, std::memory_order_relaxed);
+	}
+
+	if (inputHistory)
+		memset(&inputHistory[0], 0, numInputs * 2 * historyLength * sizeof(double));
+	if (outputRing)
+		memset(&outputRing[0], 0, numOutputs * ringLength * sizeof(double));
+
+	for (uint32_t i = 0; i < numSegments; i++)
+	{
+		ConvolverSegment& segment = segments[i];
+		memset(&segment.fdlReal[0], 0, numInputs * segment.partitions * segment.getBins() * sizeof(double));
+		memset(&segment.fdlImag[0], 0, numInputs * segment.partitions * segment.getBins() * sizeof(double));
+		memset(&segment.blockOutput[0], 0, numOutputs * segment.blockSize * sizeof(double));
+		segment.fdlIndex = 0;
+		segment.blockEnd = 0;
+	}
+
+	sampleCount = 0;
+	return true;
+}
+
+/**
+\brief add one segment to the layout and allocate its delay line and work arrays
+
+\param partitionSize P, power of 2
+\param partitions number of partitions of P taps
+\param irOffset the first IR tap of the segment
+\param background true if the worker thread convolves it
+*/
+void PartitionedConvolver::addSegment(uint32_t partitionSize, uint32_t partitions, uint32_t irOffset, bool background)
+{
+	ConvolverSegment& segment = segments[numSegments++];
+	segment.blockSize = partitionSize;
+	segment.partitions = partitions;
+	segment.irOffset = irOffset;
+	segment.outputOffset = irOffset + latency;
+	segment.background = background;
+	segment.fdlIndex = 0;
+	segment.blockEnd = 0;
+
+	uint32_t bins = segment.getBins();
+	segment.fastFFT.initialize(2 * partitionSize, windowType::kNoWindow);
+	segment.irReal.reset(new double[numPaths * partitions * bins]);
+	segment.irImag.reset(new double[numPaths * partitions * bins]);
+	segment.fdlReal.reset(new double[numInputs * partitions * bins]);
+	segment.fdlImag.reset(new double[numInputs * partitions * bins]);
+	segment.spectrumReal.reset(new double[bins]);
+	segment.spectrumImag.reset(new double[bins]);
+	segment.blockOutput.reset(new double[numOutputs * partitionSize]);
+
+	memset(&segment.fdlReal[0], 0, numInputs * partitions * bins * sizeof(double));
+	memset(&segment.fdlImag[0], 0, numInputs * partitions * bins * sizeof(double));
+	memset(&segment.blockOutput[0], 0, numOutputs * partitionSize * sizeof(double));
+}
+
+/**
+\brief partition the IRs and snapshot the FFTs of the partitions; NOT realtime safe
+
+Operation:
+- the head (the first blockSize - latency taps) is kept in the time domain
+- the rest is split into segments: CONVOLVER_PARTITIONS_PER_SIZE partitions of each size, doubling from
+  blockSize to maxBlockSize, with the remainder in partitions of the last size; a segment's output offset is
+  always at least its partition size, so a block can be convolved as soon as it is complete
+- with backgroundTail, the last segment goes to the worker; it is collected a block late, so its first
+  partitions are kept on the audio thread if its output offset is less than twice its partition size
+
+\param irs the IRs, see convolverChannels for the number and order
+\param irLength the length of every IR
+
+\return true if operation succeeds, false otherwise
+*/
+bool PartitionedConvolver::setImpulseResponses(const double* const* irs, uint32_t irLength)
+{
+	if (!irs)
+		return false;
+
+	stopWorker();
+	tailInFlight = false;
+	tailState.store(kTailIdle);
+
+	// --- routing
+	if (parameters.channels == convolverChannels::kTrueStereo)
+	{
+		numInputs = 2;
+		numOutputs = 2;
+		numPaths = 4;
+		uint32_t routing[4][2] = { { 0, 0 }, { 0, 1 }, { 1, 0 }, { 1, 1 } }; // --- LL, LR, RL, RR
+		for (uint32_t i = 0; i < numPaths; i++)
+		{
+			pathInput[i] = routing[i][0];
+			pathOutput[i] = routing[i][1];
+		}
+	}
+	else
+	{
+		numInputs = parameters.channels == convolverChannels::kStereo ? 2 : 1;
+		numOutputs = numInputs;
+		numPaths = numInputs;
+		for (uint32_t i = 0; i < numPaths; i++)
+		{
+			pathInput[i] = i;
+			pathOutput[i] = i;
+		}
+	}
+
+	for (uint32_t i = 0; i < numPaths; i++)
+	{
+		if (!irs[i])
+			return false;
+	}
+
+	// --- partition sizes: powers of 2 within the limits
+	blockSize = nextPowerOfTwo(parameters.blockSize);
+	if (blockSize < CONVOLVER_MIN_BLOCK_SIZE)
+		blockSize = CONVOLVER_MIN_BLOCK_SIZE;
+	if (blockSize > CONVOLVER_MAX_BLOCK_SIZE)
+		blockSize = CONVOLVER_MAX_BLOCK_SIZE;
+
+	uint32_t maxBlockSize = nextPowerOfTwo(parameters.maxBlockSize);
+	if (maxBlockSize < blockSize)
+		maxBlockSize = blockSize;
+	if (maxBlockSize > CONVOLVER_MAX_BLOCK_SIZE)
+		maxBlockSize = CONVOLVER_MAX_BLOCK_SIZE;
+	latency = parameters.latency;
+
+	// --- time domain head, time reversed for the dot product
+	headLength = latency < blockSize ? blockSize - latency : 0;
+	if (headLength > irLength)
+		headLength = irLength;
+
+	headTaps.reset(headLength > 0 ? new double[numPaths * headLength] : nullptr);
+	for (uint32_t path = 0; path < numPaths; path++)
+	{
+		for (uint32_t i = 0; i < headLength; i++)
+			headTaps[path * headLength + i] = irs[path][headLength - 1 - i];
+	}
+
+	// --- segments
+	numSegments = 0;
+	uint32_t partitionSize = blockSize;
+	uint32_t irOffset = headLength;
+	while (irOffset < irLength)
+	{
+		uint32_t partitions = (irLength - irOffset + partitionSize - 1) / partitionSize;
+		bool lastSize = partitionSize >= maxBlockSize || partitions <= CONVOLVER_PARTITIONS_PER_SIZE;
+
+		if (!lastSize)
+		{
+			addSegment(partitionSize, CONVOLVER_PARTITIONS_PER_SIZE, irOffset, false);
+			irOffset += CONVOLVER_PARTITIONS_PER_SIZE * partitionSize;
+			partitionSize *= 2;
+			continue;
+		}
+
+		if (parameters.backgroundTail)
+		{
+			// --- a background block is collected one block late, so its output must be at least 2P out
+			uint32_t outputOffset = irOffset + latency;
+			if (outputOffset < 2 * partitionSize)
+			{
+				uint32_t foreground = (2 * partitionSize - outputOffset + partitionSize - 1) / partitionSize;
+				if (foreground > partitions)
+					foreground = partitions;
+
+				addSegment(partitionSize, foreground, irOffset, false);
+				irOffset += foreground * partitionSize;
+				partitions -= foreground;
+			}
+
+			if (partitions > 0)
+				addSegment(partitionSize, partitions, irOffset, true);
+		}
+		else
+			addSegment(partitionSize, partitions, irOffset, false);
+
+		break;
+	}
+
+	// --- IR spectra, scaled for the IFFT
+	for (uint32_t i = 0; i < numSegments; i++)
+	{
+		ConvolverSegment& segment = segments[i];
+		uint32_t fftLength = 2 * segment.blockSize;
+		uint32_t bins = segment.getBins();
+		double scale = 1.0 / (double)fftLength;
+		std::unique_ptr<double[]> timeData(new double[fftLength]);
+
+		for (uint32_t path = 0; path < numPaths; path++)
+		{
+			for (uint32_t partition = 0; partition < segment.partitions; partition++)
+			{
+				// --- P taps, then P zeros
+				memset(&timeData[0], 0, fftLength * sizeof(double));
+				uint32_t start = segment.irOffset + partition * segment.blockSize;
+				for (uint32_t n = 0; n < segment.blockSize && start + n < irLength; n++)
+					timeData[n] = irs[path][start + n];
+
+				fftw_complex* irFFT = segment.fastFFT.doRealFFT(&timeData[0]);
+
+				double* real = &segment.irReal[(path * segment.partitions + partition) * bins];
+				double* imag = &segment.irImag[(path * segment.partitions + partition) * bins];
+				for (uint32_t bin = 0; bin < bins; bin++)
+				{
+					real[bin] = irFFT[bin][0] * scale;
+					imag[bin] = irFFT[bin][1] * scale;
+				}
+			}
+		}
+
+		if (segment.background)
+			tailSegment = i;
+	}
+
+	// --- input history: the longest FFT window, plus the block written while the worker reads it
+	uint32_t maxSegmentBlock = numSegments > 0 ? segments[numSegments - 1].blockSize : blockSize;
+	historyLength = nextPowerOfTwo(4 * maxSegmentBlock);
+	inputHistory.reset(new double[numInputs * 2 * historyLength]);
+
+	// --- output ring: everything up to the furthest segment output
+	uint32_t maxOutputOffset = numSegments > 0 ? segments[numSegments - 1].outputOffset : 0;
+	ringLength = nextPowerOfTwo(maxOutputOffset + 2 * maxSegmentBlock);
+	outputRing.reset(new double[numOutputs * ringLength]);
+
+	reset(0.0);
+
+	if (numSegments > 0 && segments[numSegments - 1].background)
+		startWorker();
+
+	return true;
+}
+
+/**
+\brief process one sample; stereo modes feed xn to both inputs and return the left output
+*/
+double PartitionedConvolver::processAudioSample(double xn)
+{
+	double input[2] = { xn, xn };
+	double output[2] = { 0.0, 0.0 };
+	double* inputs[2] = { &input[0], &input[1] };
+	double* outputs[2] = { &output[0], &output[1] };
+
+	processFrames(inputs, outputs, 1);
+	return output[0];
+}
+
+/**
+\brief process one frame: a mono input feeds both inputs, a mono output gets the left output
+*/
+bool PartitionedConvolver::processAudioFrame(const float* inputFrame,
+	float* outputFrame,
+	uint32_t inputChannels,
+	uint32_t outputChannels)
+{
+	if (inputChannels == 0 || outputChannels == 0)
+		return false;
+
+	double input[2] = { inputFrame[0], inputChannels > 1 ? inputFrame[1] : inputFrame[0] };
+	double output[2] = { 0.0, 0.0 };
+	double* inputs[2] = { &input[0], &input[1] };
+	double* outputs[2] = { &output[0], &output[1] };
+
+	processFrames(inputs, outputs, 1);
+
+	outputFrame[0] = (float)output[0];
+	if (outputChannels > 1)
+		outputFrame[1] = (float)output[numOutputs > 1 ? 1 : 0];
+
+	return true;
+}
+
+/**
+\brief process a block in double precision chunks; kMono processes channel 0 only, the stereo modes
+channels 0 and 1 (a mono block feeds both inputs and gets the left output)
+*/
+bool PartitionedConvolver::processAudioBlock(const float* const* inputs, float* const* outputs, uint32_t channels, uint32_t frames)
+{
+	if (channels == 0)
+		return false;
+
+	double inputChunk[2][FX_BLOCK_CHUNK_SIZE];
+	double outputChunk[2][FX_BLOCK_CHUNK_SIZE];
+	double* inputPtrs[2] = { &inputChunk[0][0], &inputChunk[1][0] };
+	double* outputPtrs[2] = { &outputChunk[0][0], &outputChunk[1][0] };
+	uint32_t outputChannels = channels < numOutputs ? channels : numOutputs;
+
+	for (uint32_t start = 0; start < frames; start += FX_BLOCK_CHUNK_SIZE)
+	{
+		uint32_t length = frames - start < FX_BLOCK_CHUNK_SIZE ? frames - start : FX_BLOCK_CHUNK_SIZE;
+		for (uint32_t input = 0; input < numInputs; input++)
+		{
+			const float* source = inputs[input < channels ? input : 0];
+			for (uint32_t i = 0; i < length; i++)
+				inputChunk[input][i] = source[start + i];
+		}
+
+		processFrames(inputPtrs, outputPtrs, length);
+
+		for (uint32_t output = 0; output < outputChannels; output++)
+		{
+			for (uint32_t i = 0; i < length; i++)
+				outputs[output][start + i] = (float)outputChunk[output][i];
+		}
+	}
+	return true;
+}
+
+/**
+\brief split frames on the blockSize boundaries
+*/
+void PartitionedConvolver::processFrames(double* const* inputs, double* const* outputs, uint32_t frames)
+{
+	uint32_t done = 0;
+	while (done < frames)
+	{
+		uint32_t toBoundary = blockSize - (uint32_t)(sampleCount & (blockSize - 1));
+		uint32_t length = frames - done < toBoundary ? frames - done : toBoundary;
+		processChunk(inputs, outputs, done, length);
+		done += length;
+	}
+}
+
+/**
+\brief process frames that do not cross a blockSize boundary
+
+Operation:
+- write the inputs into the history
+- output = the time domain head + the segment outputs summed in the ring ahead of time
+- on a boundary, convolve every segment whose block is complete; a segment's output offset is at
+  least its block size, so its output lands at or after the next sample
+
+\param offset first frame in the input and output arrays
+\param frames frames to process
+*/
+void PartitionedConvolver::processChunk(double* const* inputs, double* const* outputs, uint32_t offset, uint32_t frames)
+{
+	uint32_t historyMask = historyLength - 1;
+	uint32_t ringMask = ringLength - 1;
+
+	// --- no IR yet
+	if (historyLength == 0)
+	{
+		for (uint32_t output = 0; output < numOutputs; output++)
+			memset(&outputs[output][offset], 0, frames * sizeof(double));
+		return;
+	}
+
+	for (uint32_t input = 0; input < numInputs; input++)
+	{
+		double* history = &inputHistory[input * 2 * historyLength];
+		for (uint32_t i = 0; i < frames; i++)
+		{
+			uint32_t index = (uint32_t)(sampleCount + i) & historyMask;
+			history[index] = inputs[input][offset + i];
+			history[index + historyLength] = inputs[input][offset + i];
+		}
+	}
+
+	for (uint32_t output = 0; output < numOutputs; output++)
+	{
+		double* ring = &outputRing[output * ringLength];
+		for (uint32_t i = 0; i < frames; i++)
+		{
+			uint32_t index = (uint32_t)(sampleCount + i) & ringMask;
+			outputs[output][offset + i] = ring[index];
+			ring[index] = 0.0;
+		}
+	}
+
+	for (uint32_t path = 0; path < numPaths && headLength > 0; path++)
+	{
+		const double* taps = &headTaps[path * headLength];
+		const double* history = &inputHistory[pathInput[path] * 2 * historyLength];
+		double* output = &outputs[pathOutput[path]][offset];
+		for (uint32_t i = 0; i < frames; i++)
+		{
+			// --- x(n - latency - headLength + 1) to x(n - latency), contiguous in the mirrored history
+			const double* x = &history[((uint32_t)(sampleCount + i - latency) & historyMask) + historyLength - headLength + 1];
+			double sum = 0.0;
+			for (uint32_t k = 0; k < headLength; k++)
+				sum += taps[k] * x[k];
+			output[i] += sum;
+		}
+	}
+
+	sampleCount += frames;
+	if ((sampleCount & (blockSize - 1)) != 0)
+		return;
+
+	for (uint32_t i = 0; i < numSegments; i++)
+	{
+		ConvolverSegment& segment = segments[i];
+		if ((sampleCount & (segment.blockSize - 1)) != 0)
+			continue;
+
+		if (!segment.background)
+		{
+			segment.blockEnd = sampleCount;
+			convolveSegmentBlock(segment);
+			addSegmentOutput(segment);
+			continue;
+		}
+
+		// --- the previous background block is due now; then hand over this one
+		if (tailInFlight)
+			collectTail();
+
+		segment.blockEnd = sampleCount;
+		tailState.store(kTailPending, std::memory_order_release);
+		tailInFlight = true;
+	}
+}
+
+/**
+\brief convolve one block of a segment (overlap-save); audio thread, or the worker for the background segment
+
+Operation:
+- FFT of the last 2P input samples into the newest slot of the delay line
+- multiply-add the delay line with the IR partition spectra: Y = sum X(k - j) H(j), half spectrum
+- inverse real FFT, and keep the last P samples (the first P are circular wrap-around)
+*/
+void PartitionedConvolver::convolveSegmentBlock(ConvolverSegment& segment)
+{
+	uint32_t P = segment.blockSize;
+	uint32_t bins = segment.getBins();
+	uint32_t partitions = segment.partitions;
+	uint32_t historyMask = historyLength - 1;
+
+	segment.fdlIndex = segment.fdlIndex + 1 < partitions ? segment.fdlIndex + 1 : 0;
+
+	for (uint32_t input = 0; input < numInputs; input++)
+	{
+		double* window = &inputHistory[input * 2 * historyLength + ((uint32_t)(segment.blockEnd - 2 * P) & historyMask)];
+		fftw_complex* inputFFT = segment.fastFFT.doRealFFT(window);
+
+		double* real = &segment.fdlReal[(input * partitions + segment.fdlIndex) * bins];
+		double* imag = &segment.fdlImag[(input * partitions + segment.fdlIndex) * bins];
+		for (uint32_t bin = 0; bin < bins; bin++)
+		{
+			real[bin] = inputFFT[bin][0];
+			imag[bin] = inputFFT[bin][1];
+		}
+	}
+
+	double* accReal = &segment.spectrumReal[0];
+	double* accImag = &segment.spectrumImag[0];
+	for (uint32_t output = 0; output < numOutputs; output++)
+	{
+		memset(accReal, 0, bins * sizeof(double));
+		memset(accImag, 0, bins * sizeof(double));
+
+		for (uint32_t path = 0; path < numPaths; path++)
+		{
+			if (pathOutput[path] != output)
+				continue;
+
+			uint32_t input = pathInput[path];
+			uint32_t slot = segment.fdlIndex;
+			for (uint32_t partition = 0; partition < partitions; partition++)
+			{
+				const double* xReal = &segment.fdlReal[(input * partitions + slot) * bins];
+				const double* xImag = &segment.fdlImag[(input * partitions + slot) * bins];
+				const double* hReal = &segment.irReal[(path * partitions + partition) * bins];
+				const double* hImag = &segment.irImag[(path * partitions + partition) * bins];
+				for (uint32_t bin = 0; bin < bins; bin++)
+				{
+					accReal[bin] += xReal[bin] * hReal[bin] - xImag[bin] * hImag[bin];
+					accImag[bin] += xReal[bin] * hImag[bin] + xImag[bin] * hReal[bin];
+				}
+
+				// --- older input spectra go with later partitions
+				slot = slot > 0 ? slot - 1 : partitions - 1;
+			}
+		}
+
+		fftw_complex* outputSpectrum = segment.fastFFT.getRealIFFTInput();
+		for (uint32_t bin = 0; bin < bins; bin++)
+		{
+			outputSpectrum[bin][0] = accReal[bin];
+			outputSpectrum[bin][1] = accImag[bin];
+		}
+
+		double* outputIFFT = segment.fastFFT.doInverseRealFFT();
+		memcpy(&segment.blockOutput[output * P], &outputIFFT[P], P * sizeof(double));
+	}
+}
+
+/**
+\brief add the segment's last block output to the ring: the block that ended at blockEnd covers
+outputs blockEnd - P + outputOffset and on
+*/
+void PartitionedConvolver::addSegmentOutput(ConvolverSegment& segment)
+{
+	uint32_t ringMask = ringLength - 1;
+	uint64_t start = segment.blockEnd - segment.blockSize + segment.outputOffset;
+	for (uint32_t output = 0; output < numOutputs; output++)
+	{
+		double* ring = &outputRing[output * ringLength];
+		const double* blockOutput = &segment.blockOutput[output * segment.blockSize];
+		for (uint32_t n = 0; n < segment.blockSize; n++)
+			ring[(uint32_t)(start + n) & ringMask] += blockOutput[n];
+	}
+}
+
+/**
+\brief audio thread: finish the background block in flight and add its output
+
+Operation:
+- unclaimed: the worker has not woken up yet, so convolve it here
+- claimed: spin until the worker is done; it has had a whole block of time already
+*/
+void PartitionedConvolver::collectTail()
+{
+	ConvolverSegment& segment = segments[tailSegment];
+
+	uint32_t expected = kTailPending;
+	if (tailState.compare_exchange_strong(expected, kTailClaimed, std::memory_order_acq_rel, std::memory_order_acquire))
+		convolveSegmentBlock(segment);
+	else
+	{
+		while (tailState.load(std::memory_order_acquire) != kTailDone)
+			CONVOLVER_CPU_RELAX();
+	}
+
+	addSegmentOutput(segment);
+	tailState.store(kTailIdle, std::memory_order_relaxed);
+	tailInFlight = false;
+}
+
+/**
+\brief create the worker thread; NOT realtime safe
+
+Operation:
+- tries to raise the thread to realtime priority; failure is harmless (e.g. no privileges)
+*/
+void PartitionedConvolver::startWorker()
+{
+	stopWorker();
+
+	running.store(true);
+	worker = std::thread(&PartitionedConvolver::workerLoop, this);
+
+#if defined(__APPLE__) || defined(__linux__)
+	sched_param param;
+	memset(&param, 0, sizeof(sched_param));
+	param.sched_priority = sched_get_priority_max(SCHED_FIFO) - 1;
+	pthread_setschedparam(worker.native_handle(), SCHED_FIFO, &param);
 #endif
+}
+
+/**
+\brief stop and join the worker thread; NOT realtime safe
+*/
+void PartitionedConvolver::stopWorker()
+{
+	running.store(false);
+	if (worker.joinable())
+		worker.join();
+}
+
+/**
+\brief worker thread: claim and convolve the background blocks as they are handed over
+*/
+void PartitionedConvolver::workerLoop()
+{
+	uint32_t idleCount = 0;
+	while (running.load(std::memory_order_relaxed))
+	{
+		uint32_t expected = kTailPending;
+		if (tailState.load(std::memory_order_relaxed) == kTailPending &&
+			tailState.compare_exchange_strong(expected, kTailClaimed, std::memory_order_acq_rel, std::memory_order_acquire))
+		{
+			convolveSegmentBlock(segments[tailSegment]);
+			tailState.store(kTailDone, std::memory_order_release);
+			idleCount = 0;
+			continue;
+		}
+
+		// --- back off
+		idleCount++;
+		if (idleCount < kConvolverSpinCount)
+			CONVOLVER_CPU_RELAX();
+		else if (idleCount < kConvolverYieldCount)
+			std::this_thread::yield();
+		else
+			std::this_thread::sleep_for(std::chrono::microseconds(kConvolverSleep_uSec));
+	}
+}
 
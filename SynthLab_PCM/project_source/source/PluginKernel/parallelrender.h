@@ -0,0 +1,165 @@
+// -----------------------------------------------------------------------------
+//    ASPiK Plugin Kernel File:  parallelrender.h
+//
+/**
+    \file   parallelrender.h
+    \author Will Pirkle
+    \date   17-September-2018
+    \brief  interface file for the optional multi-threaded render objects
+    		- http://www.aspikplugins.com
+    		- http://www.willpirkle.com
+*/
+// -----------------------------------------------------------------------------
+#ifndef _ParallelRender_H_
+#define _ParallelRender_H_
+
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <stdint.h>
+
+#include "atomicops.h"
+
+// --- maximum number of jobs (render shards) per block
+const uint32_t MAX_RENDER_JOBS = 8;
+
+/**
+\class IRenderJob
+\ingroup Interfaces
+\brief
+Interface for an object that splits its block processing into independent jobs that may
+run concurrently on the RenderWorkerPool threads.
+
+NOTES:
+- renderJob( ) is called exactly once per job index per block
+- jobs must not share any mutable state
+
+\author Will Pirkle http://www.willpirkle.com
+\remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
+\version Revision : 1.0
+\date Date : 2018 / 09 / 7
+*/
+class IRenderJob
+{
+public:
+	virtual ~IRenderJob() {}
+
+	/** render one job of the current block */
+	virtual void renderJob(uint32_t jobIndex) = 0;
+};
+
+/**
+\class RenderWorkerPool
+\ingroup ASPiK-Core
+\brief
+Lock-free real-time worker pool; idle workers sleep on a semaphore that each block posts.
+
+RenderWorkerPool Operations:
+- start( ) creates the worker threads (non-realtime thread only)
+- runJobs( ) publishes a block of jobs, wakes the parked workers, helps render the jobs on the
+  calling (audio) thread and spins until all jobs are done; no locks and no allocation on the
+  audio thread, and the only system call is the (non-blocking) semaphore post for parked workers
+- an idle worker parks on the semaphore, so it uses no CPU between blocks
+- any job that the workers have not claimed yet is rendered by the calling thread, so a waking
+  worker can never cause a missed deadline, only a loss of parallelism
+- the workers take the scheduling policy and priority of the thread that calls runJobs( ) (read
+  on the first call), so they never outrank the host's own audio threads
+- measures the render time of each job for CPU metering
+
+\author Will Pirkle http://www.willpirkle.com
+\remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
+\version Revision : 1.0
+\date Date : 2018 / 09 / 7
+*/
+class RenderWorkerPool
+{
+public:
+	RenderWorkerPool();
+	~RenderWorkerPool();
+
+	/** create the worker threads; NOT realtime safe */
+	bool start(uint32_t _numWorkers);
+
+	/** join the worker threads; NOT realtime safe */
+	void stop();
+
+	/** render jobs [0, numJobs) and return when all are finished; realtime safe */
+	void runJobs(IRenderJob* job, uint32_t numJobs);
+
+	/** number of worker threads (not counting the calling thread) */
+	uint32_t getWorkerCount() { return (uint32_t)workers.size(); }
+
+	/** CPU time of the last render of a job, in microseconds */
+	float getJobTime_uSec(uint32_t jobIndex)
+	{
+		if (jobIndex >= MAX_RENDER_JOBS) return 0.f;
+		return jobTime_uSec[jobIndex].load(std::memory_order_relaxed);
+	}
+
+protected:
+	void workerLoop();
+	void claimAndRenderJobs(uint32_t generation);
+	void readCallerPriority();
+	void applyCallerPriority();
+
+	std::vector<std::thread> workers;		///< the worker threads
+	std::atomic<bool> running;				///< worker loop flag
+
+	// --- upper 32 bits = block generation, lower 32 bits = next unclaimed job index
+	std::atomic<uint64_t> jobCursor;		///< claim counter for the current block
+	std::atomic<uint32_t> jobsDone;			///< completion counter for the current block
+
+	std::atomic<IRenderJob*> currentJob;	///< published with jobCursor
+	std::atomic<uint32_t> currentJobCount;	///< published with jobCursor
+	uint32_t generation = 0;				///< audio thread block counter
+
+	// --- idle workers park here; runJobs( ) posts once per parked worker
+	moodycamel::spsc_sema::Semaphore wakeSemaphore;	///< OS semaphore: safe with several waiting workers
+	std::atomic<uint32_t> parkedWorkers;	///< workers that may be waiting on wakeSemaphore
+
+	// --- worker priority follows the audio thread; read on the first runJobs( ), applied by each worker
+	bool callerPriorityRead = false;		///< audio thread only
+	int callerPolicy = 0;					///< written before callerPriorityReady
+	int callerPriority = 0;					///< written before callerPriorityReady
+	std::atomic<bool> callerPriorityReady;	///< the policy and priority are valid
+
+	std::atomic<float> jobTime_uSec[MAX_RENDER_JOBS];	///< per-job render time
+};
+
+/**
+\class ShardNoteRouter
+\ingroup ASPiK-Core
+\brief
+Assigns MIDI notes to render shards (independent synth engines) so that each note lives in
+exactly one shard for its entire lifetime.
+
+ShardNoteRouter Operations:
+- note-on messages go to the shard holding the fewest notes
+- note-off and poly pressure messages follow their note-on
+- all other channel messages (CC, pitch bend, etc...) are broadcast to every shard
+
+\author Will Pirkle http://www.willpirkle.com
+\remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
+\version Revision : 1.0
+\date Date : 2018 / 09 / 7
+*/
+class ShardNoteRouter
+{
+public:
+	ShardNoteRouter() { reset(1); }
+
+	/** forget all notes and set the shard count */
+	void reset(uint32_t _numShards);
+
+	/** returns the shard for this message, or -1 if it should go to all shards
+	    \param allowSpread false forces all notes into shard 0 (mono, legato and unison modes) */
+	int32_t getShardForMessage(uint32_t message, uint32_t channel, uint32_t note, uint32_t velocity, bool allowSpread);
+
+protected:
+	uint32_t numShards = 1;							///< shard count
+	uint32_t nextShard = 0;							///< round-robin tie breaker
+	uint32_t heldNotes[MAX_RENDER_JOBS] = { 0 };	///< notes held per shard
+	uint8_t noteShard[16][128];						///< shard owning each channel/note; 0xFF = none
+};
+
+#endif
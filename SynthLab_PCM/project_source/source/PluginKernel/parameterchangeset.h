@@ -0,0 +1,137 @@
+// -----------------------------------------------------------------------------
+//    ASPiK Plugin Kernel File:  parameterchangeset.h
+//
+/**
+    \file   parameterchangeset.h
+    \author Will Pirkle
+    \date   17-September-2018
+    \brief  interface file for the lock-free parameter change set (inbound variable sync)
+    		- http://www.aspikplugins.com
+    		- http://www.willpirkle.com
+*/
+// -----------------------------------------------------------------------------
+#ifndef _ParameterChangeSet_H_
+#define _ParameterChangeSet_H_
+
+#include <atomic>
+#include <stdint.h>
+
+#if defined(_MSC_VER) && defined(_M_X64)
+	#include <intrin.h>
+#endif
+
+/**
+\class ParameterChangeSet
+\ingroup ASPiK-Core
+\brief
+Atomic dirty bitset with one bit per parameter (in parameter array order), so the audio thread
+only visits the parameters that changed.
+
+ParameterChangeSet Operations:
+- writers (GUI, host, API threads or the audio thread) mark a parameter after storing its new value;
+  marking is one atomic fetch_or, so any number of writers may mark at the same time
+- the audio thread takes 64 flags at a time with takeWord( ) and visits the set bits; a word with
+  no flags set costs one load
+- a value stored after its word was taken is marked again and picked up next time, so no change
+  is lost; a parameter marked several times between two takes is only visited once
+- create( ) is NOT realtime safe and must not run while either side is in use
+
+\author Will Pirkle http://www.willpirkle.com
+\remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
+\version Revision : 1.0
+\date Date : 2018 / 09 / 7
+*/
+class ParameterChangeSet
+{
+public:
+	ParameterChangeSet() {}
+	~ParameterChangeSet() { destroy(); }
+
+	/** allocate one flag per parameter, all set; NOT realtime safe */
+	void create(uint32_t _numParameters)
+	{
+		destroy();
+		numParameters = _numParameters;
+		numWords = (numParameters + 63) / 64;
+		if (numWords > 0)
+			words = new std::atomic<uint64_t>[numWords];
+		for (uint32_t word = 0; word < numWords; word++)
+			words[word].store(0, std::memory_order_relaxed);
+		markAllChanged();
+	}
+
+	/** any thread: flag one parameter as changed */
+	void markChanged(uint32_t index)
+	{
+		if (index < numParameters)
+			words[index >> 6].fetch_or((uint64_t)1 << (index & 63), std::memory_order_release);
+	}
+
+	/** any thread: flag every parameter as changed (bulk restores, preset swaps) */
+	void markAllChanged()
+	{
+		for (uint32_t word = 0; word < numWords; word++)
+		{
+			uint32_t bitsInWord = numParameters - word * 64 >= 64 ? 64 : numParameters - word * 64;
+			words[word].fetch_or(bitsInWord == 64 ? ~(uint64_t)0 : ((uint64_t)1 << bitsInWord) - 1, std::memory_order_release);
+		}
+	}
+
+	/** any thread: clear every flag (a set that should start empty) */
+	void clearAll()
+	{
+		for (uint32_t word = 0; word < numWords; word++)
+			words[word].store(0, std::memory_order_relaxed);
+	}
+
+	/** number of 64 flag words */
+	uint32_t getWordCount() { return numWords; }
+
+	/** audio thread: take (and clear) the flags of one word; bit n is parameter word * 64 + n */
+	uint64_t takeWord(uint32_t word)
+	{
+		if (words[word].load(std::memory_order_relaxed) == 0)
+			return 0;
+		return words[word].exchange(0, std::memory_order_acquire);
+	}
+
+	/** index of the lowest set bit; bits must not be 0 */
+	static inline uint32_t getLowestBit(uint64_t bits)
+	{
+#if defined(_MSC_VER) && defined(_M_X64)
+		unsigned long index = 0;
+		_BitScanForward64(&index, bits);
+		return (uint32_t)index;
+#elif defined(__GNUC__) || defined(__clang__)
+		return (uint32_t)__builtin_ctzll(bits);
+#else
+		uint32_t index = 0;
+		while ((bits & 1) == 0)
+		{
+			bits >>= 1;
+			index++;
+		}
+		return index;
+#endif
+	}
+
+protected:
+	std::atomic<uint64_t>* words = nullptr;	///< old-fashioned C-array of flag words
+	uint32_t numWords = 0;					///< flag words
+	uint32_t numParameters = 0;				///< flags in use
+
+	void destroy()
+	{
+		if (words)
+			delete[] words;
+		words = nullptr;
+		numWords = 0;
+		numParameters = 0;
+	}
+
+private:
+	ParameterChangeSet(const ParameterChangeSet&);
+	ParameterChangeSet& operator=(const ParameterChangeSet&);
+};
+
+#endif /* defined(_ParameterChangeSet_H_) */
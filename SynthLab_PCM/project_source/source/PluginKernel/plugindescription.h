@@ -49,4 +49,14 @@ const bool kVSTSAA = false;
 const uint32_t kVST3SAAGranularity = 1;
 const uint32_t kAAXCategory = aaxPlugInCategory_None;
 
+// --- SynthLab Options 
+const uint32_t kRenderShardCount = 1;
+const uint32_t kMinMidiSubBlockSize = 16;
+const bool kZeroCopyRender = false;
+const uint32_t kRenderQuantum = 64;
+const bool kAdaptiveRenderQuantum = false;
+const bool kIdleRenderSkip = true;
+const double kPresetFadeTime_mSec = 5.0;
+const bool kVoiceGovernor = true;
+
 #endif
@@ -0,0 +1,79 @@
+// -----------------------------------------------------------------------------
+//    ASPiK Plugin Kernel File:  presetcatalog.h
+//
+/**
+    \file   presetcatalog.h
+    \author Will Pirkle
+    \date   17-September-2018
+    \brief  interface file for the shared factory preset catalog
+    		- http://www.aspikplugins.com
+    		- http://www.willpirkle.com
+*/
+// -----------------------------------------------------------------------------
+#ifndef _PresetCatalog_H_
+#define _PresetCatalog_H_
+
+#include "pluginstructures.h"
+#include <mutex>
+#include <unordered_map>
+
+/**
+\class PresetCatalog
+\ingroup ASPiK-Core
+\brief
+Immutable list of factory presets, built once per process and shared by every plugin instance.
+
+PresetCatalog Operations:
+- setDefaultParameters( ) stores the default ID/value list once, instead of once per preset
+- addPreset( ) and setPresetParameter( ) record only the name and the ID/value pairs the preset
+  sets; setPresetParameter( ) is a hash lookup instead of a linear search
+- getPresetCount( ) and getPresetName( ) read the recorded list and never allocate
+- getPreset( ) materializes the full PresetInfo (defaults overlaid with the preset values) the
+  first time the preset is applied; the PresetInfo is kept for the life of the catalog so the
+  pointer stays valid
+- build functions are NOT thread safe and are only called inside PluginBase::getPresetCatalog( );
+  after that the catalog is read-only except for the mutex-protected materialization
+
+\author Will Pirkle http://www.willpirkle.com
+\remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
+\version Revision : 1.0
+\date Date : 2018 / 09 / 7
+*/
+class PresetCatalog
+{
+public:
+	PresetCatalog() {}
+	~PresetCatalog();
+
+	/** store the default parameter list; build only */
+	void setDefaultParameters(const std::vector<PresetParameter>& _defaultParameters);
+
+	/** add a preset; build only */
+	uint32_t addPreset(const char* presetName);
+
+	/** set a preset value; build only */
+	bool setPresetParameter(uint32_t presetIndex, uint32_t _controlID, double _controlValue);
+
+	/** number of presets */
+	size_t getPresetCount() const { return presetNames.size(); }
+
+	/** preset name */
+	const char* getPresetName(uint32_t index) const;
+
+	/** full preset, materialized on first use; NOT realtime safe */
+	const PresetInfo* getPreset(uint32_t index);
+
+protected:
+	std::vector<PresetParameter> defaultParameters;				///< defaults, in parameter order
+	std::unordered_map<uint32_t, size_t> defaultParameterIndex;	///< controlID -> index in defaultParameters
+	std::vector<std::string> presetNames;						///< preset names
+	std::vector<std::vector<PresetParameter>> presetValues;		///< values set by each preset
+	std::vector<PresetInfo*> presets;							///< materialized presets (nullptr until applied)
+	std::mutex presetMutex;										///< guards presets
+
+private:
+	PresetCatalog(const PresetCatalog&);
+	PresetCatalog& operator=(const PresetCatalog&);
+};
+
+#endif /* defined(_PresetCatalog_H_) */
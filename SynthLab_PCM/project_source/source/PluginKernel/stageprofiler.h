@@ -0,0 +1,241 @@
+// -----------------------------------------------------------------------------
+//    ASPiK Plugin Kernel File:  stageprofiler.h
+//
+/**
+    \file   stageprofiler.h
+    \author Will Pirkle
+    \date   17-September-2018
+    \brief  interface file for the per-stage audio thread profiler
+    		- compiled in only when the build defines SYNTHLAB_PROFILER=1 (see SYNTHLAB_PROFILER
+    		  in the top level CMakeLists.txt); otherwise PROFILE_STAGE( ) expands to nothing
+    		- http://www.aspikplugins.com
+    		- http://www.willpirkle.com
+*/
+// -----------------------------------------------------------------------------
+#ifndef _StageProfiler_H_
+#define _StageProfiler_H_
+
+#ifndef SYNTHLAB_PROFILER
+	#define SYNTHLAB_PROFILER 0
+#endif
+
+#if SYNTHLAB_PROFILER
+
+#include <atomic>
+#include <chrono>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+// --- time stamp counter where there is a cheap one, the steady clock everywhere else
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+	#include <intrin.h>
+	#define PROFILER_TSC 1
+#elif defined(__x86_64__) || defined(__i386__)
+	#include <x86intrin.h>
+	#define PROFILER_TSC 1
+#else
+	#define PROFILER_TSC 0
+#endif
+
+// --- trace events kept for the Chrome trace dump (power of 2)
+const uint32_t PROFILER_TRACE_EVENTS = 16384;
+
+// --- histogram: 4 buckets per octave of ticks
+const uint32_t PROFILER_HISTOGRAM_BUCKETS = 256;
+
+/**
+\enum profilerStage
+\ingroup ASPiK-Core
+\brief
+Audio thread stages timed by the StageProfiler
+
+- kProfileParameters: bound variable sync, preset snapshot swap and parameter smoothing
+- kProfileMidi: firing the host MIDI events and dispatching them to the engine(s)
+- kProfileUpdateParameters: pushing the bound variables into the engine parameter structures
+- kProfileRender: synth engine render (all shards, including the shard mix)
+- kProfileOutputCopy: writing (or clearing) the host output buffers
+- kProfileOutBound: updateOutBoundVariables( ), the meters
+- kProfileBuffer: the whole processAudioBuffers( ) call; the stages are shares of this
+*/
+enum profilerStage
+{
+	kProfileParameters,
+	kProfileMidi,
+	kProfileUpdateParameters,
+	kProfileRender,
+	kProfileOutputCopy,
+	kProfileOutBound,
+	kNumProfilerStages,
+	kProfileBuffer = kNumProfilerStages
+};
+
+/**
+\struct ProfilerStageStats
+\ingroup ASPiK-Core
+\brief
+Per-buffer time of one stage, in microseconds; the percentiles come from a histogram with
+four buckets per octave, so they are accurate to about 10%
+*/
+struct ProfilerStageStats
+{
+	uint64_t buffers = 0;	///< buffers measured
+	double mean_us = 0.0;	///< mean time per buffer
+	double p50_us = 0.0;	///< median
+	double p90_us = 0.0;	///< 90th percentile
+	double p99_us = 0.0;	///< 99th percentile
+	double max_us = 0.0;	///< longest buffer
+};
+
+/**
+\class StageProfiler
+\ingroup ASPiK-Core
+\brief
+Low overhead, lock-free timing of the audio thread stages.
+
+StageProfiler Operations:
+- audio thread: beginBuffer( ), then addStageTime( ) (usually through PROFILE_STAGE( )) any number
+  of times per stage, then endBuffer( ); the per-buffer stage totals go into lock-free accumulators
+  and histograms and each timed section is stored in a trace event ring
+- any other thread: getStageStats( ) and writeChromeTrace( ) read them without stopping the audio thread
+- the audio thread side never allocates, locks or waits; it is the only writer
+- reset( ) is NOT realtime safe and must not run while the audio thread is using the profiler
+- ticks are TSC counts on x86/x64 and steady clock nanoseconds elsewhere; the reader converts them
+  to time against the steady clock
+
+\author Will Pirkle http://www.willpirkle.com
+\remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
+\version Revision : 1.0
+\date Date : 2018 / 09 / 7
+*/
+class StageProfiler
+{
+public:
+	StageProfiler();
+
+	/** clear everything and restart the tick calibration */
+	void reset();
+
+	/** current time in ticks */
+	static inline uint64_t getTicks()
+	{
+#if PROFILER_TSC
+		return (uint64_t)__rdtsc();
+#else
+		return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+	}
+
+	/** audio thread: top of processAudioBuffers( ) */
+	void beginBuffer()
+	{
+		bufferStart = getTicks();
+		for (uint32_t stage = 0; stage < kNumProfilerStages; stage++)
+			bufferStageTicks[stage] = 0;
+	}
+
+	/** audio thread: one timed section of a stage */
+	void addStageTime(uint32_t stage, uint64_t start, uint64_t end)
+	{
+		bufferStageTicks[stage] += end - start;
+		addTraceEvent(stage, start, end);
+	}
+
+	/** audio thread: bottom of processAudioBuffers( ); commits the buffer's stage totals */
+	void endBuffer();
+
+	/** audio thread: the share of the last buffer's time spent in a stage, 0.0 to 1.0 */
+	float getStageShare(uint32_t stage) { return stage < kNumProfilerStages ? stageShare[stage] : 0.f; }
+
+	/** any thread: stats of a stage (or of kProfileBuffer) since the last reset( ) */
+	bool getStageStats(uint32_t stage, ProfilerStageStats& stats);
+
+	/** any thread: the recorded trace events as Chrome trace JSON (chrome://tracing, Perfetto) */
+	void writeChromeTrace(std::string& json);
+
+	/** any thread: writeChromeTrace( ) into a file */
+	bool dumpChromeTrace(const char* path);
+
+	/** stage name, as used in the trace */
+	static const char* getStageName(uint32_t stage);
+
+protected:
+	/** one timed section; the fields are atomics so the reader can copy them while they are rewritten */
+	struct TraceEvent
+	{
+		std::atomic<uint32_t> stage{ 0 };
+		std::atomic<uint64_t> start{ 0 };
+		std::atomic<uint64_t> end{ 0 };
+	};
+
+	// --- audio thread only
+	uint64_t bufferStart = 0;							///< ticks at beginBuffer( )
+	uint64_t bufferStageTicks[kNumProfilerStages];		///< stage totals of this buffer
+	float stageShare[kNumProfilerStages];				///< stage shares of the last buffer
+
+	// --- written by the audio thread, read by any thread
+	std::atomic<uint64_t> totalTicks[kNumProfilerStages + 1];	///< sum of the per-buffer totals
+	std::atomic<uint64_t> maxTicks[kNumProfilerStages + 1];		///< longest per-buffer total
+	std::atomic<uint64_t> bufferCount{ 0 };						///< buffers committed
+	std::atomic<uint32_t> histogram[kNumProfilerStages + 1][PROFILER_HISTOGRAM_BUCKETS];	///< per-buffer totals
+	std::vector<TraceEvent> traceEvents;						///< ring, PROFILER_TRACE_EVENTS long
+	std::atomic<uint64_t> traceWriteIndex{ 0 };					///< events written so far
+
+	// --- tick calibration: the tick and steady clock readings at reset( )
+	uint64_t originTicks = 0;
+	std::chrono::steady_clock::time_point originTime;
+
+	void addTraceEvent(uint32_t stage, uint64_t start, uint64_t end)
+	{
+		uint64_t index = traceWriteIndex.load(std::memory_order_relaxed);
+		TraceEvent& event = traceEvents[index & (PROFILER_TRACE_EVENTS - 1)];
+		event.stage.store(stage, std::memory_order_relaxed);
+		event.start.store(start, std::memory_order_relaxed);
+		event.end.store(end, std::memory_order_relaxed);
+		traceWriteIndex.store(index + 1, std::memory_order_release);
+	}
+
+	void addBufferTicks(uint32_t stage, uint64_t ticks);
+	double getTicksPerMicrosecond();
+
+	static uint32_t getHistogramBucket(uint64_t ticks);
+	static double getHistogramBucketTicks(uint32_t bucket);
+
+private:
+	StageProfiler(const StageProfiler&);
+	StageProfiler& operator=(const StageProfiler&);
+};
+
+/**
+\class StageProfileScope
+\ingroup ASPiK-Core
+\brief
+Times the rest of the enclosing scope as one section of a stage; use PROFILE_STAGE( )
+*/
+class StageProfileScope
+{
+public:
+	StageProfileScope(StageProfiler& _profiler, uint32_t _stage)
+		: profiler(_profiler)
+		, stage(_stage)
+		, start(StageProfiler::getTicks()) {}
+
+	~StageProfileScope() { profiler.addStageTime(stage, start, StageProfiler::getTicks()); }
+
+protected:
+	StageProfiler& profiler;
+	uint32_t stage = 0;
+	uint64_t start = 0;
+};
+
+#define PROFILE_STAGE_NAME(line) profileStageScope##line
+#define PROFILE_STAGE_LINE(profiler, stage, line) StageProfileScope PROFILE_STAGE_NAME(line)(profiler, stage)
+#define PROFILE_STAGE(profiler, stage) PROFILE_STAGE_LINE(profiler, stage, __LINE__)
+
+#else
+
+#define PROFILE_STAGE(profiler, stage)
+
+#endif // SYNTHLAB_PROFILER
+
+#endif /* defined(_StageProfiler_H_) */
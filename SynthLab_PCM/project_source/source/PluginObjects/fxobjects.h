@@ -21,7 +21,9 @@
 
 #include <memory>
 #include <math.h>
+#include <string.h>
 #include "guiconstants.h"
+#include "denormalguard.h"
 #include "filters.h"
 #include <time.h>       /* time */
 
@@ -53,11 +55,17 @@ const double ARC4RANDOMMAX = 4294967295.0;  // (2^32 - 1)
 
 @brief Perform underflow check; returns true if we did underflow (user may not care)
 
+- compiled out when the build runs the DSP under a ScopedDenormalGuard (DENORMAL_GUARD_ACTIVE);
+  the FPU then flushes denormals to zero so the per-sample compare and branch is not needed
+
 \param value - the value to check for underflow
 \return true if overflowed, false otherwise
 */
 inline bool checkFloatUnderflow(double& value)
 {
+#if DENORMAL_GUARD_ACTIVE
+	return false;
+#else
 	bool retValue = false;
 	if (value > 0.0 && value < kSmallestPositiveFloatValue)
 	{
@@ -70,6 +78,36 @@ inline bool checkFloatUnderflow(double& value)
 		retValue = true;
 	}
 	return retValue;
+#endif
+}
+
+/**
+@checkFloatUnderflow
+\ingroup FX-Functions
+
+@brief float version of checkFloatUnderflow( ), for the float instantiations of the templated objects
+
+\param value - the value to check for underflow
+\return true if overflowed, false otherwise
+*/
+inline bool checkFloatUnderflow(float& value)
+{
+#if DENORMAL_GUARD_ACTIVE
+	return false;
+#else
+	bool retValue = false;
+	if (value > 0.f && value < (float)kSmallestPositiveFloatValue)
+	{
+		value = 0.f;
+		retValue = true;
+	}
+	else if (value < 0.f && value > (float)kSmallestNegativeFloatValue)
+	{
+		value = 0.f;
+		retValue = true;
+	}
+	return retValue;
+#endif
 }
 
 /**
@@ -1147,12 +1185,29 @@ inline bool resample(double* input, double* output, uint32_t inLength, uint32_t
 // --- INTERFACES --------------------------------------------------- //
 // ------------------------------------------------------------------ //
 
+// --- block processing: mono blocks are converted to double precision in chunks of this many samples
+const uint32_t FX_BLOCK_CHUNK_SIZE = 64;
+
+// --- block processing: frame processors see at most this many channels (all of the stock ones are stereo)
+const uint32_t FX_BLOCK_MAX_CHANNELS = 2;
+
 /**
 \class IAudioSignalProcessor
 \ingroup Interfaces
 \brief
 Use this interface for objects that process audio input samples to produce audio output samples. A derived class must implement the three abstract methods. The others are optional.
 
+Block processing:
+- processAudioBlock( ) processes a whole block with one virtual call instead of one per sample
+- mono objects (canProcessAudioFrame( ) returns false) process channel 0 only; like processAudioSample( ),
+  one object holds one channel of state, so use one object per channel; the block is converted to
+  double precision in chunks and run through processBlockInPlace( )
+- frame objects run processAudioFrame( ) once per frame over the first FX_BLOCK_MAX_CHANNELS channels
+- the default processBlockInPlace( ) calls processAudioSample( ) per sample; objects override it with a
+  native version that runs each of their stages over the whole block, so the inner loops can be inlined
+  and vectorized; the results are the same as processing the block one sample at a time
+- the input and output buffers may be the same (in-place processing)
+
 \author Will Pirkle http://www.willpirkle.com
 \remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
 \version Revision : 1.0
@@ -1200,6 +1255,54 @@ public:
 		// --- do nothing
 		return false; // NOT handled
 	}
+
+	/** process a block of double precision samples in place (mono); the default processes one sample at a time */
+	virtual void processBlockInPlace(double* block, uint32_t frames)
+	{
+		for (uint32_t i = 0; i < frames; i++)
+			block[i] = processAudioSample(block[i]);
+	}
+
+	/** process a block of audio: inputs[channel][frame] to outputs[channel][frame]; see the class notes for the channel handling */
+	virtual bool processAudioBlock(const float* const* inputs, float* const* outputs, uint32_t channels, uint32_t frames)
+	{
+		if (channels == 0)
+			return false;
+
+		// --- frame processors: one frame at a time
+		if (canProcessAudioFrame())
+		{
+			uint32_t frameChannels = channels < FX_BLOCK_MAX_CHANNELS ? channels : FX_BLOCK_MAX_CHANNELS;
+			float inputFrame[FX_BLOCK_MAX_CHANNELS] = { 0.f };
+			float outputFrame[FX_BLOCK_MAX_CHANNELS] = { 0.f };
+			for (uint32_t i = 0; i < frames; i++)
+			{
+				for (uint32_t channel = 0; channel < frameChannels; channel++)
+					inputFrame[channel] = inputs[channel][i];
+
+				processAudioFrame(inputFrame, outputFrame, frameChannels, frameChannels);
+
+				for (uint32_t channel = 0; channel < frameChannels; channel++)
+					outputs[channel][i] = outputFrame[channel];
+			}
+			return true;
+		}
+
+		// --- mono processors: channel 0, in double precision chunks
+		double chunk[FX_BLOCK_CHUNK_SIZE];
+		for (uint32_t start = 0; start < frames; start += FX_BLOCK_CHUNK_SIZE)
+		{
+			uint32_t length = frames - start < FX_BLOCK_CHUNK_SIZE ? frames - start : FX_BLOCK_CHUNK_SIZE;
+			for (uint32_t i = 0; i < length; i++)
+				chunk[i] = inputs[0][start + i];
+
+			processBlockInPlace(chunk, length);
+
+			for (uint32_t i = 0; i < length; i++)
+				outputs[0][start + i] = (float)chunk[i];
+		}
+		return true;
+	}
 };
 
 /**
@@ -1352,10 +1455,10 @@ struct BiquadParameters
 };
 
 /**
-\class Biquad
+\class BiquadT
 \ingroup FX-Objects
 \brief
-The Biquad object implements a first or second order H(z) transfer function using one of four standard structures: Direct, Canonical, Transpose Direct, Transpose Canonical.
+The BiquadT object implements a first or second order H(z) transfer function using one of four standard structures: Direct, Canonical, Transpose Direct, Transpose Canonical.
 
 Audio I/O:
 - Processes mono input to mono output.
@@ -1363,23 +1466,30 @@ Audio I/O:
 Control I/F:
 - Use BiquadParameters structure to get/set object params.
 
+Sample type:
+- T is the type of the coefficients, the states and the math; Biquad is BiquadT<double> and BiquadF is BiquadT<float>
+- float is fine for the transposed structures with cutoffs above a few hundred Hz and moderate Q; keep double
+  for low cutoffs and high Q, where the quantized b1/b2 move the poles (AudioFilter always uses double)
+- processBlock( ) runs a block of T, so the float version never converts
+
 \author Will Pirkle http://www.willpirkle.com
 \remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
 \version Revision : 1.0
 \date Date : 2018 / 09 / 7
 */
-class Biquad : public IAudioSignalProcessor
+template <typename T>
+class BiquadT : public IAudioSignalProcessor
 {
 public:
-	Biquad() {}		/* C-TOR */
-	~Biquad() {}	/* D-TOR */
+	BiquadT() {}	/* C-TOR */
+	~BiquadT() {}	/* D-TOR */
 
 	// --- IAudioSignalProcessor FUNCTIONS --- //
 	//
 	/** reset: clear out the state array (flush delays); can safely ignore sampleRate argument - we don't need/use it */
 	virtual bool reset(double _sampleRate)
 	{
-		memset(&stateArray[0], 0, sizeof(double)*numStates);
+		memset(&stateArray[0], 0, sizeof(T)*numStates);
 		return true;  // handled = true
 	}
 
@@ -1393,6 +1503,12 @@ public:
 	*/
 	virtual double processAudioSample(double xn);
 
+	/** process a block in place; the structure is decoded once and the loop runs on local copies of the coefficients and states */
+	virtual void processBlockInPlace(double* block, uint32_t frames);
+
+	/** processBlockInPlace( ) on a block of the object's own sample type */
+	void processBlock(T* block, uint32_t frames);
+
 	/** get parameters: note use of custom structure for passing param data */
 	/**
 	\return BiquadParameters custom data structure
@@ -1408,19 +1524,20 @@ public:
 	// --- MUTATORS & ACCESSORS --- //
 	/** set the coefficient array NOTE: passing by pointer to array; allows us to use "array notation" with pointers i.e. [ ] */
 	void setCoefficients(double* coeffs){
-		// --- fast block memory copy:
-		memcpy(&coeffArray[0], &coeffs[0], sizeof(double)*numCoeffs);
+		// --- copy (and convert, for float)
+		for (uint32_t i = 0; i < numCoeffs; i++)
+			coeffArray[i] = (T)coeffs[i];
 	}
 
 	/** get the coefficient array for read/write access to the array (not used in current objects) */
-	double* getCoefficients()
+	T* getCoefficients()
 	{
 		// --- read/write access to the array (not used)
 		return &coeffArray[0];
 	}
 
 	/** get the state array for read/write access to the array (used only in direct form oscillator) */
-	double* getStateArray()
+	T* getStateArray()
 	{
 		// --- read/write access to the array (used only in direct form oscillator)
 		return &stateArray[0];
@@ -1434,18 +1551,25 @@ public:
 
 protected:
 	/** array of coefficients */
-	double coeffArray[numCoeffs] = { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 };
+	T coeffArray[numCoeffs] = { 0, 0, 0, 0, 0, 0, 0 };
 
 	/** array of state (z^-1) registers */
-	double stateArray[numStates] = { 0.0, 0.0, 0.0, 0.0 };
+	T stateArray[numStates] = { 0, 0, 0, 0 };
 
 	/** type of calculation (algorithm  structure) */
 	BiquadParameters parameters;
 
 	/** for Harma loop resolution */
 	double storageComponent = 0.0;
+
+	/** the processBlockInPlace( ) loops for a block of S; the math is done in T */
+	template <typename S>
+	void processBlockOf(S* block, uint32_t frames);
 };
 
+typedef BiquadT<double> Biquad;	///< double precision biquad (all existing objects)
+typedef BiquadT<float> BiquadF;	///< single precision biquad
+
 
 /**
 \enum filterAlgorithm
@@ -1550,6 +1674,9 @@ public:
 	*/
 	virtual double processAudioSample(double xn);
 
+	/** process a block in place through the biquad, then mix in the dry signal if the algorithm has one */
+	virtual void processBlockInPlace(double* block, uint32_t frames);
+
 	/** --- sample rate change necessarily requires recalculation */
 	virtual void setSampleRate(double _sampleRate)
 	{
@@ -1588,6 +1715,9 @@ public:
 	/** --- helper for Harma filters (phaser) */
 	double getS_value() { return biquad.getS_value(); }
 
+	/** --- get the coefficient array (a0, a1, a2, b1, b2 and the c0/d0 wet/dry gains) */
+	const double* getCoefficients() { return &coeffArray[0]; }
+
 protected:
 	// --- our calculator
 	Biquad biquad; ///< the biquad object
@@ -1604,6 +1734,311 @@ protected:
 };
 
 
+// --- BiquadBank SIMD lanes: doubles per vector register, chosen at compile time
+#if defined(__AVX__)
+	#include <immintrin.h>
+	#define BIQUAD_BANK_AVX 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#include <emmintrin.h>
+	#define BIQUAD_BANK_SSE2 1
+#endif
+
+// --- BiquadBank limits
+const uint32_t BIQUAD_BANK_MAX_LANES = 8;
+const uint32_t BIQUAD_BANK_MAX_STAGES = 8;
+
+/**
+\struct BiquadBankVector
+\ingroup FX-Objects
+\brief
+A few BiquadBank lanes of type T in one vector register: 4 doubles or 8 floats with AVX, 2 doubles or 4 floats
+with SSE2, otherwise 1 (scalar). Only the operations the biquad structures need are defined; loads and stores
+are unaligned.
+
+\author Will Pirkle http://www.willpirkle.com
+\remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
+\version Revision : 1.0
+\date Date : 2018 / 09 / 7
+*/
+template <typename T>
+struct BiquadBankVector;
+
+/** BiquadBankVector of doubles */
+template <>
+struct BiquadBankVector<double>
+{
+#if defined(BIQUAD_BANK_AVX)
+	enum { width = 4 };
+	__m256d v;
+	static inline BiquadBankVector load(const double* source) { BiquadBankVector r; r.v = _mm256_loadu_pd(source); return r; }
+	static inline BiquadBankVector set1(double value) { BiquadBankVector r; r.v = _mm256_set1_pd(value); return r; }
+	inline void store(double* destination) const { _mm256_storeu_pd(destination, v); }
+	inline BiquadBankVector operator+(const BiquadBankVector& b) const { BiquadBankVector r; r.v = _mm256_add_pd(v, b.v); return r; }
+	inline BiquadBankVector operator-(const BiquadBankVector& b) const { BiquadBankVector r; r.v = _mm256_sub_pd(v, b.v); return r; }
+	inline BiquadBankVector operator*(const BiquadBankVector& b) const { BiquadBankVector r; r.v = _mm256_mul_pd(v, b.v); return r; }
+	inline BiquadBankVector operator-() const { BiquadBankVector r; r.v = _mm256_xor_pd(v, _mm256_set1_pd(-0.0)); return r; }
+
+	/** zero the lanes that underflowed (magnitude below the smallest float) */
+	inline void flushUnderflow()
+	{
+		__m256d magnitude = _mm256_andnot_pd(_mm256_set1_pd(-0.0), v);
+		v = _mm256_and_pd(v, _mm256_cmp_pd(magnitude, _mm256_set1_pd(kSmallestPositiveFloatValue), _CMP_GE_OQ));
+	}
+#elif defined(BIQUAD_BANK_SSE2)
+	enum { width = 2 };
+	__m128d v;
+	static inline BiquadBankVector load(const double* source) { BiquadBankVector r; r.v = _mm_loadu_pd(source); return r; }
+	static inline BiquadBankVector set1(double value) { BiquadBankVector r; r.v = _mm_set1_pd(value); return r; }
+	inline void store(double* destination) const { _mm_storeu_pd(destination, v); }
+	inline BiquadBankVector operator+(const BiquadBankVector& b) const { BiquadBankVector r; r.v = _mm_add_pd(v, b.v); return r; }
+	inline BiquadBankVector operator-(const BiquadBankVector& b) const { BiquadBankVector r; r.v = _mm_sub_pd(v, b.v); return r; }
+	inline BiquadBankVector operator*(const BiquadBankVector& b) const { BiquadBankVector r; r.v = _mm_mul_pd(v, b.v); return r; }
+	inline BiquadBankVector operator-() const { BiquadBankVector r; r.v = _mm_xor_pd(v, _mm_set1_pd(-0.0)); return r; }
+
+	/** zero the lanes that underflowed (magnitude below the smallest float) */
+	inline void flushUnderflow()
+	{
+		__m128d magnitude = _mm_andnot_pd(_mm_set1_pd(-0.0), v);
+		v = _mm_and_pd(v, _mm_cmpge_pd(magnitude, _mm_set1_pd(kSmallestPositiveFloatValue)));
+	}
+#else
+	enum { width = 1 };
+	double v;
+	static inline BiquadBankVector load(const double* source) { BiquadBankVector r; r.v = *source; return r; }
+	static inline BiquadBankVector set1(double value) { BiquadBankVector r; r.v = value; return r; }
+	inline void store(double* destination) const { *destination = v; }
+	inline BiquadBankVector operator+(const BiquadBankVector& b) const { BiquadBankVector r; r.v = v + b.v; return r; }
+	inline BiquadBankVector operator-(const BiquadBankVector& b) const { BiquadBankVector r; r.v = v - b.v; return r; }
+	inline BiquadBankVector operator*(const BiquadBankVector& b) const { BiquadBankVector r; r.v = v * b.v; return r; }
+	inline BiquadBankVector operator-() const { BiquadBankVector r; r.v = -v; return r; }
+
+	/** zero the lane if it underflowed */
+	inline void flushUnderflow() { checkFloatUnderflow(v); }
+#endif
+};
+
+/** BiquadBankVector of floats: twice the lanes per register */
+template <>
+struct BiquadBankVector<float>
+{
+#if defined(BIQUAD_BANK_AVX)
+	enum { width = 8 };
+	__m256 v;
+	static inline BiquadBankVector load(const float* source) { BiquadBankVector r; r.v = _mm256_loadu_ps(source); return r; }
+	static inline BiquadBankVector set1(float value) { BiquadBankVector r; r.v = _mm256_set1_ps(value); return r; }
+	inline void store(float* destination) const { _mm256_storeu_ps(destination, v); }
+	inline BiquadBankVector operator+(const BiquadBankVector& b) const { BiquadBankVector r; r.v = _mm256_add_ps(v, b.v); return r; }
+	inline BiquadBankVector operator-(const BiquadBankVector& b) const { BiquadBankVector r; r.v = _mm256_sub_ps(v, b.v); return r; }
+	inline BiquadBankVector operator*(const BiquadBankVector& b) const { BiquadBankVector r; r.v = _mm256_mul_ps(v, b.v); return r; }
+	inline BiquadBankVector operator-() const { BiquadBankVector r; r.v = _mm256_xor_ps(v, _mm256_set1_ps(-0.f)); return r; }
+
+	/** zero the lanes that underflowed (magnitude below the smallest float) */
+	inline void flushUnderflow()
+	{
+		__m256 magnitude = _mm256_andnot_ps(_mm256_set1_ps(-0.f), v);
+		v = _mm256_and_ps(v, _mm256_cmp_ps(magnitude, _mm256_set1_ps((float)kSmallestPositiveFloatValue), _CMP_GE_OQ));
+	}
+#elif defined(BIQUAD_BANK_SSE2)
+	enum { width = 4 };
+	__m128 v;
+	static inline BiquadBankVector load(const float* source) { BiquadBankVector r; r.v = _mm_loadu_ps(source); return r; }
+	static inline BiquadBankVector set1(float value) { BiquadBankVector r; r.v = _mm_set1_ps(value); return r; }
+	inline void store(float* destination) const { _mm_storeu_ps(destination, v); }
+	inline BiquadBankVector operator+(const BiquadBankVector& b) const { BiquadBankVector r; r.v = _mm_add_ps(v, b.v); return r; }
+	inline BiquadBankVector operator-(const BiquadBankVector& b) const { BiquadBankVector r; r.v = _mm_sub_ps(v, b.v); return r; }
+	inline BiquadBankVector operator*(const BiquadBankVector& b) const { BiquadBankVector r; r.v = _mm_mul_ps(v, b.v); return r; }
+	inline BiquadBankVector operator-() const { BiquadBankVector r; r.v = _mm_xor_ps(v, _mm_set1_ps(-0.f)); return r; }
+
+	/** zero the lanes that underflowed (magnitude below the smallest float) */
+	inline void flushUnderflow()
+	{
+		__m128 magnitude = _mm_andnot_ps(_mm_set1_ps(-0.f), v);
+		v = _mm_and_ps(v, _mm_cmpge_ps(magnitude, _mm_set1_ps((float)kSmallestPositiveFloatValue)));
+	}
+#else
+	enum { width = 1 };
+	float v;
+	static inline BiquadBankVector load(const float* source) { BiquadBankVector r; r.v = *source; return r; }
+	static inline BiquadBankVector set1(float value) { BiquadBankVector r; r.v = value; return r; }
+	inline void store(float* destination) const { *destination = v; }
+	inline BiquadBankVector operator+(const BiquadBankVector& b) const { BiquadBankVector r; r.v = v + b.v; return r; }
+	inline BiquadBankVector operator-(const BiquadBankVector& b) const { BiquadBankVector r; r.v = v - b.v; return r; }
+	inline BiquadBankVector operator*(const BiquadBankVector& b) const { BiquadBankVector r; r.v = v * b.v; return r; }
+	inline BiquadBankVector operator-() const { BiquadBankVector r; r.v = -v; return r; }
+
+	/** zero the lane if it underflowed */
+	inline void flushUnderflow() { checkFloatUnderflow(v); }
+#endif
+};
+
+/**
+\enum biquadBankInput
+\ingroup Constants-Enums
+\brief
+Use this strongly typed enum to set how the BiquadBank lanes get their input.
+
+- kPerLane: each lane has its own input (e.g. one lane per channel)
+- kFanOut: one input feeds every lane (e.g. the bands of a filter bank or crossover)
+
+- enum class biquadBankInput { kPerLane, kFanOut };
+
+\author Will Pirkle http://www.willpirkle.com
+\remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
+\version Revision : 1.0
+\date Date : 2018 / 09 / 7
+*/
+enum class biquadBankInput { kPerLane, kFanOut };
+
+/**
+\struct BiquadBankParameters
+\ingroup FX-Objects
+\brief
+Custom parameter structure for the BiquadBank object: the topology of the bank. Changing any of it clears the filter states.
+
+\author Will Pirkle http://www.willpirkle.com
+\remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
+\version Revision : 1.0
+\date Date : 2018 / 09 / 7
+*/
+struct BiquadBankParameters
+{
+	BiquadBankParameters() {}
+	/** all FXObjects parameter objects require overloaded= operator so remember to add new entries if you add new variables. */
+	BiquadBankParameters& operator=(const BiquadBankParameters& params)	// need this override for collections to work
+	{
+		if (this == &params)
+			return *this;
+
+		lanes = params.lanes;
+		stages = params.stages;
+		input = params.input;
+		biquadCalcType = params.biquadCalcType;
+		return *this;
+	}
+
+	// --- individual parameters
+	uint32_t lanes = 2;													///< independent filters side by side, 1 to BIQUAD_BANK_MAX_LANES
+	uint32_t stages = 1;												///< biquads in series in each lane, 1 to BIQUAD_BANK_MAX_STAGES
+	biquadBankInput input = biquadBankInput::kPerLane;					///< where the lanes get their input
+	biquadAlgorithm biquadCalcType = biquadAlgorithm::kTransposeCanonical;	///< structure of every biquad in the bank
+};
+
+/**
+\class BiquadBankT
+\ingroup FX-Objects
+\brief
+The BiquadBankT object runs up to 8 independent lanes of cascaded biquads in parallel SIMD lanes
+(AVX: 4 double or 8 float lanes per register, SSE2: 2 or 4, otherwise scalar).
+
+Sample type:
+- BiquadBank (BiquadBankT<double>) matches Biquad bit for bit
+- BiquadBankF (BiquadBankT<float>) runs twice the lanes per instruction; the same limits as BiquadF apply
+  (keep double for low cutoffs and high Q)
+
+Audio I/O:
+- kPerLane: processAudioBlock( ) channel n feeds lane n and lane n is output channel n (e.g. stereo or surround filters)
+- kFanOut: input channel 0 feeds every lane and lane n is output channel n (e.g. filter bank bands)
+- processAudioFrame( ) does the same for one frame; processAudioSample( ) feeds xn to every lane and returns lane 0
+
+Control I/F:
+- Use BiquadBankParameters to set the topology (lanes, stages, input, structure) once, at setup
+- setCoefficients( ) sets the coefficients of one biquad (lane, stage) in the Biquad/AudioFilter array
+  layout; c0 and d0 are the wet and dry gains, as in AudioFilter
+- setFilterParameters( ) calculates them from AudioFilterParameters with the AudioFilter equations
+
+Operation:
+- the structure is decoded once per block, not once per sample
+- the math is the same as Biquad (and AudioFilter when c0/d0 are used) lane by lane, including the
+  underflow check, which is a vector compare and mask and is compiled out with DENORMAL_GUARD_ACTIVE
+- a block is processed in FX_BLOCK_CHUNK_SIZE chunks: the lanes are interleaved into a local work
+  buffer, each stage runs over the chunk with its coefficients and states in registers, then the
+  lanes are written back out
+
+\author Will Pirkle http://www.willpirkle.com
+\remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
+\version Revision : 1.0
+\date Date : 2018 / 09 / 7
+*/
+template <typename T>
+class BiquadBankT : public IAudioSignalProcessor
+{
+public:
+	BiquadBankT() { clearCoefficients(); clearStates(); }	/* C-TOR */
+	~BiquadBankT() {}										/* D-TOR */
+
+	/** reset: clear out the state arrays (flush delays) and store the sample rate for setFilterParameters( ) */
+	virtual bool reset(double _sampleRate)
+	{
+		sampleRate = _sampleRate;
+		clearStates();
+		return true;
+	}
+
+	/** return true: this object processes frames */
+	virtual bool canProcessAudioFrame() { return true; }
+
+	/** process xn through every lane; returns the output of lane 0 */
+	/**
+	\param xn input
+	\return the lane 0 output
+	*/
+	virtual double processAudioSample(double xn);
+
+	/** process one frame; see the class notes for the channel mapping */
+	virtual bool processAudioFrame(const float* inputFrame,
+		float* outputFrame,
+		uint32_t inputChannels,
+		uint32_t outputChannels);
+
+	/** process a block; see the class notes for the channel mapping */
+	virtual bool processAudioBlock(const float* const* inputs, float* const* outputs, uint32_t channels, uint32_t frames);
+
+	/** get parameters: note use of custom structure for passing param data */
+	/**
+	\return BiquadBankParameters custom data structure
+	*/
+	BiquadBankParameters getParameters() { return parameters; }
+
+	/** set parameters: note use of custom structure for passing param data; a new topology clears the states */
+	/**
+	\param BiquadBankParameters custom data structure
+	*/
+	void setParameters(const BiquadBankParameters& _parameters);
+
+	/** set the coefficients of one biquad: a0, a1, a2, b1, b2, c0 (wet), d0 (dry) as in AudioFilter */
+	void setCoefficients(uint32_t lane, uint32_t stage, const double* coeffs);
+
+	/** set the coefficients of one biquad with the AudioFilter equations; call reset( ) first for the sample rate */
+	void setFilterParameters(uint32_t lane, uint32_t stage, const AudioFilterParameters& filterParameters);
+
+protected:
+	BiquadBankParameters parameters;	///< the topology
+	double sampleRate = 44100.0;		///< fs for setFilterParameters( )
+	AudioFilter coeffCalculator;		///< calculates the setFilterParameters( ) coefficients
+
+	// --- lane-minor arrays so one vector load picks up the same value for adjacent lanes
+	T coeffArray[BIQUAD_BANK_MAX_STAGES][numCoeffs][BIQUAD_BANK_MAX_LANES];	///< coefficients
+	T stateArray[BIQUAD_BANK_MAX_STAGES][numStates][BIQUAD_BANK_MAX_LANES];	///< z^-1 registers
+
+	bool stageWetDry[BIQUAD_BANK_MAX_STAGES];	///< true if any lane of the stage has a wet/dry mix (c0 != 1 or d0 != 0)
+
+	void clearCoefficients();
+	void clearStates();
+
+	/** run the stages over an interleaved chunk: work[frame * BIQUAD_BANK_MAX_LANES + lane] */
+	void processWork(T* work, uint32_t frames);
+
+	/** run one stage of one vector of lanes over an interleaved chunk */
+	template <biquadAlgorithm algorithm, bool wetDry>
+	void processStageVector(uint32_t stage, uint32_t lane, T* work, uint32_t frames);
+
+	/** lanes rounded up to whole vector registers */
+	uint32_t getVectorCount() { return (parameters.lanes + BiquadBankVector<T>::width - 1) / BiquadBankVector<T>::width; }
+};
+
+typedef BiquadBankT<double> BiquadBank;	///< double lanes, the same results as Biquad
+typedef BiquadBankT<float> BiquadBankF;	///< float lanes, twice as many per register
+
 /**
 \struct FilterBankOutput
 \ingroup FX-Objects
@@ -2401,6 +2836,10 @@ Audio I/O:
 Control I/F:
 - none.
 
+Operation:
+- time domain convolution, O(N) per sample; for IRs longer than a few hundred taps use the
+  PartitionedConvolver (FFTW-Objects) instead
+
 \author Will Pirkle http://www.willpirkle.com
 \remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
 \version Revision : 1.0
@@ -2705,10 +3144,10 @@ struct AudioDelayParameters
 };
 
 /**
-\class AudioDelay
+\class AudioDelayT
 \ingroup FX-Objects
 \brief
-The AudioDelay object implements a stereo audio delay with multiple delay algorithms.
+The AudioDelayT object implements a stereo audio delay with multiple delay algorithms.
 
 Audio I/O:
 - Processes mono input to mono output OR stereo output.
@@ -2716,16 +3155,23 @@ Audio I/O:
 Control I/F:
 - Use AudioDelayParameters structure to get/set object params.
 
+Sample type:
+- T is the type stored in the delay buffers; the feedback and mix math is double
+- AudioDelay is AudioDelayT<double>; there is no float typedef: the delays work one sample at a time in
+  double (processAudioSample( ), and the frame path converts to double), so a float buffer only adds
+  conversions and measured slower than double (floatbench: 0.67x to 0.84x) even though it halves the memory
+
 \author Will Pirkle http://www.willpirkle.com
 \remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
 \version Revision : 1.0
 \date Date : 2018 / 09 / 7
 */
-class AudioDelay : public IAudioSignalProcessor
+template <typename T>
+class AudioDelayT : public IAudioSignalProcessor
 {
 public:
-	AudioDelay() {}		/* C-TOR */
-	~AudioDelay() {}	/* D-TOR */
+	AudioDelayT() {}	/* C-TOR */
+	~AudioDelayT() {}	/* D-TOR */
 
 public:
 	/** reset members to initialized state */
@@ -2925,11 +3371,13 @@ private:
 	double wetMix = 0.707; ///< wet output default = -3dB
 	double dryMix = 0.707; ///< dry output default = -3dB
 
-	// --- delay buffer of doubles
-	CircularBuffer<double> delayBuffer_L;	///< LEFT delay buffer of doubles
-	CircularBuffer<double> delayBuffer_R;	///< RIGHT delay buffer of doubles
+	// --- delay buffers of T
+	CircularBuffer<T> delayBuffer_L;	///< LEFT delay buffer
+	CircularBuffer<T> delayBuffer_R;	///< RIGHT delay buffer
 };
 
+typedef AudioDelayT<double> AudioDelay;	///< double delay buffers
+
 
 /**
 \enum generatorWaveform
@@ -3673,6 +4121,14 @@ public:
 		return output;
 	}
 
+	/** process a block in place; the LFO retunes the APFs and the feedback closes around them every
+	    sample, so the stages cannot run block by block, but the per-sample calls are no longer virtual */
+	virtual void processBlockInPlace(double* block, uint32_t frames)
+	{
+		for (uint32_t i = 0; i < frames; i++)
+			block[i] = PhaseShifter::processAudioSample(block[i]);
+	}
+
 	/** return false: this object only processes samples */
 	virtual bool canProcessAudioFrame() { return false; }
 
@@ -3838,10 +4294,10 @@ struct SimpleDelayParameters
 };
 
 /**
-\class SimpleDelay
+\class SimpleDelayT
 \ingroup FX-Objects
 \brief
-The SimpleDelay object implements a basic delay line without feedback.
+The SimpleDelayT object implements a basic delay line without feedback.
 
 Audio I/O:
 - Processes mono input to mono output.
@@ -3849,16 +4305,21 @@ Audio I/O:
 Control I/F:
 - Use SimpleDelayParameters structure to get/set object params.
 
+Sample type:
+- T is the type stored in the delay buffer; reads and writes are double
+- SimpleDelay is SimpleDelayT<double>; no float typedef, see AudioDelayT
+
 \author Will Pirkle http://www.willpirkle.com
 \remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
 \version Revision : 1.0
 \date Date : 2018 / 09 / 7
 */
-class SimpleDelay : public IAudioSignalProcessor
+template <typename T>
+class SimpleDelayT : public IAudioSignalProcessor
 {
 public:
-	SimpleDelay(void) {}	/* C-TOR */
-	~SimpleDelay(void) {}	/* D-TOR */
+	SimpleDelayT(void) {}	/* C-TOR */
+	~SimpleDelayT(void) {}	/* D-TOR */
 
 public:
 	/** reset members to initialized state */
@@ -3975,10 +4436,12 @@ private:
 	double bufferLength_mSec = 0.0; ///< total buffer lenth in mSec
 	unsigned int bufferLength = 0;	///< buffer length in samples
 
-	// --- delay buffer of doubles
-	CircularBuffer<double> delayBuffer; ///< circular buffer for delay
+	// --- delay buffer of T
+	CircularBuffer<T> delayBuffer; ///< circular buffer for delay
 };
 
+typedef SimpleDelayT<double> SimpleDelay;	///< double delay buffer
+
 
 /**
 \struct CombFilterParameters
@@ -4018,10 +4481,10 @@ struct CombFilterParameters
 
 
 /**
-\class CombFilter
+\class CombFilterT
 \ingroup FX-Objects
 \brief
-The CombFilter object implements a comb filter with optional LPF in feedback loop. Used for reverb algorithms in book.
+The CombFilterT object implements a comb filter with optional LPF in feedback loop. Used for reverb algorithms in book.
 
 Audio I/O:
 - Processes mono input to mono output.
@@ -4029,16 +4492,21 @@ Audio I/O:
 Control I/F:
 - Use CombFilterParameters structure to get/set object params.
 
+Sample type:
+- T is the type stored in the delay line; the feedback gain and the LPF state stay double
+- CombFilter is CombFilterT<double>; no float typedef, see AudioDelayT
+
 \author Will Pirkle http://www.willpirkle.com
 \remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
 \version Revision : 1.0
 \date Date : 2018 / 09 / 7
 */
-class CombFilter : public IAudioSignalProcessor
+template <typename T>
+class CombFilterT : public IAudioSignalProcessor
 {
 public:
-	CombFilter(void) {}		/* C-TOR */
-	~CombFilter(void) {}	/* D-TOR */
+	CombFilterT(void) {}	/* C-TOR */
+	~CombFilterT(void) {}	/* D-TOR */
 
 public:
 	/** reset members to initialized state */
@@ -4138,10 +4606,12 @@ private:
 	double lpf_g = 0.0;		///< LPF g value
 	double lpf_state = 0.0; ///< state register for LPF (z^-1)
 
-	// --- delay buffer of doubles
-	SimpleDelay delay;		///< delay for comb filter
+	// --- delay buffer of T
+	SimpleDelayT<T> delay;	///< delay for comb filter
 };
 
+typedef CombFilterT<double> CombFilter;	///< double delay line
+
 /**
 \struct DelayAPFParameters
 \ingroup FX-Objects
@@ -4188,10 +4658,10 @@ struct DelayAPFParameters
 };
 
 /**
-\class DelayAPF
+\class DelayAPFT
 \ingroup FX-Objects
 \brief
-The DelayAPF object implements a delaying APF with optional LPF and optional modulated delay time with LFO.
+The DelayAPFT object implements a delaying APF with optional LPF and optional modulated delay time with LFO.
 
 Audio I/O:
 - Processes mono input to mono output.
@@ -4199,16 +4669,21 @@ Audio I/O:
 Control I/F:
 - Use DelayAPFParameters structure to get/set object params.
 
+Sample type:
+- T is the type stored in the delay line; the APF and LPF math and the LPF state stay double
+- DelayAPF is DelayAPFT<double>; no float typedef, see AudioDelayT
+
 \author Will Pirkle http://www.willpirkle.com
 \remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
 \version Revision : 1.0
 \date Date : 2018 / 09 / 7
 */
-class DelayAPF : public IAudioSignalProcessor
+template <typename T>
+class DelayAPFT : public IAudioSignalProcessor
 {
 public:
-	DelayAPF(void) {}	/* C-TOR */
-	~DelayAPF(void) {}	/* D-TOR */
+	DelayAPFT(void) {}	/* C-TOR */
+	~DelayAPFT(void) {}	/* D-TOR */
 
 public:
 	/** reset members to initialized state */
@@ -4327,8 +4802,8 @@ protected:
 	double sampleRate = 0.0;				///< current sample rate
 	double bufferLength_mSec = 0.0;			///< total buffer length in mSec
 
-	// --- delay buffer of doubles
-	SimpleDelay delay;						///< delay
+	// --- delay buffer of T
+	SimpleDelayT<T> delay;					///< delay
 
 	// --- optional LFO
 	LFO modLFO;								///< LFO
@@ -4337,6 +4812,8 @@ protected:
 	double lpf_state = 0.0;					///< LPF state register (z^-1)
 };
 
+typedef DelayAPFT<double> DelayAPF;	///< double delay line
+
 
 /**
 \struct NestedDelayAPFParameters
@@ -4387,10 +4864,10 @@ struct NestedDelayAPFParameters
 };
 
 /**
-\class NestedDelayAPF
+\class NestedDelayAPFT
 \ingroup FX-Objects
 \brief
-The NestedDelayAPF object implements a pair of nested Delaying APF structures. These are labled the
+The NestedDelayAPFT object implements a pair of nested Delaying APF structures. These are labled the
 outer and inner APFs. The outer APF's LPF and LFO may be optionally enabled. You might want
 to extend this object to enable and use the inner LPF and LFO as well.
 
@@ -4400,23 +4877,35 @@ Audio I/O:
 Control I/F:
 - Use BiquadParameters structure to get/set object params.
 
+Sample type:
+- T is the type stored in both delay lines, as in DelayAPFT
+- NestedDelayAPF is NestedDelayAPFT<double>; no float typedef, see AudioDelayT
+
 \author Will Pirkle http://www.willpirkle.com
 \remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
 \version Revision : 1.0
 \date Date : 2018 / 09 / 7
 */
-class NestedDelayAPF : public DelayAPF
+template <typename T>
+class NestedDelayAPFT : public DelayAPFT<T>
 {
 public:
-	NestedDelayAPF(void) { }	/* C-TOR */
-	~NestedDelayAPF(void) { }	/* D-TOR */
+	NestedDelayAPFT(void) { }	/* C-TOR */
+	~NestedDelayAPFT(void) { }	/* D-TOR */
+
+protected:
+	// --- base class members (dependent names)
+	using DelayAPFT<T>::delayAPFParameters;
+	using DelayAPFT<T>::delay;
+	using DelayAPFT<T>::modLFO;
+	using DelayAPFT<T>::lpf_state;
 
 public:
 	/** reset members to initialized state */
 	virtual bool reset(double _sampleRate)
 	{
 		// --- call base class reset first
-		DelayAPF::reset(_sampleRate);
+		DelayAPFT<T>::reset(_sampleRate);
 
 		// --- then do our stuff
 		nestedAPF.reset(_sampleRate);
@@ -4501,7 +4990,7 @@ public:
 	{
 		nestedAPFParameters = params;
 
-		DelayAPFParameters outerAPFParameters = DelayAPF::getParameters();
+		DelayAPFParameters outerAPFParameters = DelayAPFT<T>::getParameters();
 		DelayAPFParameters innerAPFParameters = nestedAPF.getParameters();
 
 		// --- outer APF
@@ -4518,7 +5007,7 @@ public:
 		innerAPFParameters.apf_g = nestedAPFParameters.innerAPF_g;
 		innerAPFParameters.delayTime_mSec = nestedAPFParameters.innerAPFdelayTime_mSec;
 
-		DelayAPF::setParameters(outerAPFParameters);
+		DelayAPFT<T>::setParameters(outerAPFParameters);
 		nestedAPF.setParameters(innerAPFParameters);
 	}
 
@@ -4526,7 +5015,7 @@ public:
 	void createDelayBuffers(double _sampleRate, double delay_mSec, double nestedAPFDelay_mSec)
 	{
 		// --- base class
-		DelayAPF::createDelayBuffer(_sampleRate, delay_mSec);
+		DelayAPFT<T>::createDelayBuffer(_sampleRate, delay_mSec);
 
 		// --- then our stuff
 		nestedAPF.createDelayBuffer(_sampleRate, nestedAPFDelay_mSec);
@@ -4534,9 +5023,11 @@ public:
 
 private:
 	NestedDelayAPFParameters nestedAPFParameters; ///< object parameters
-	DelayAPF nestedAPF;	///< nested APF object
+	DelayAPFT<T> nestedAPF;	///< nested APF object
 };
 
+typedef NestedDelayAPFT<double> NestedDelayAPF;	///< double delay lines
+
 /**
 \struct TwoBandShelvingFilterParameters
 \ingroup FX-Objects
@@ -4629,6 +5120,13 @@ public:
 		return filteredSignal;
 	}
 
+	/** process a block in place: the whole block through the low shelf, then through the high shelf */
+	virtual void processBlockInPlace(double* block, uint32_t frames)
+	{
+		lowShelfFilter.processBlockInPlace(block, frames);
+		highShelfFilter.processBlockInPlace(block, frames);
+	}
+
 	/** get parameters: note use of custom structure for passing param data */
 	/**
 	\return TwoBandShelvingFilterParameters custom data structure
@@ -4749,10 +5247,10 @@ const unsigned int NUM_BRANCHES = 4;
 const unsigned int NUM_CHANNELS = 2; // stereo
 
 /**
-\class ReverbTank
+\class ReverbTankT
 \ingroup FX-Objects
 \brief
-The ReverbTank object implements the cyclic reverb tank in the FX book listed below.
+The ReverbTankT object implements the cyclic reverb tank in the FX book listed below.
 
 Audio I/O:
 - Processes mono input to mono OR stereo output.
@@ -4760,16 +5258,24 @@ Audio I/O:
 Control I/F:
 - Use ReverbTankParameters structure to get/set object params.
 
+Sample type:
+- T is the type stored in the pre-delay, branch delay and nested APF delay lines, which are most of
+  the tank's memory traffic
+- the tank's feedback math, the branch LPFs and the output shelving filters stay double: they recirculate
+  (or, for the shelves, sit at low cutoffs) and are where float rounding would build up
+- ReverbTank is ReverbTankT<double>; no float typedef, see AudioDelayT
+
 \author Will Pirkle http://www.willpirkle.com
 \remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
 \version Revision : 1.0
 \date Date : 2018 / 09 / 7
 */
-class ReverbTank : public IAudioSignalProcessor
+template <typename T>
+class ReverbTankT : public IAudioSignalProcessor
 {
 public:
-	ReverbTank() {}		/* C-TOR */
-	~ReverbTank() {}	/* D-TOR */
+	ReverbTankT() {}	/* C-TOR */
+	~ReverbTankT() {}	/* D-TOR */
 
 	/** reset members to initialized state */
 	virtual bool reset(double _sampleRate)
@@ -4820,6 +5326,103 @@ public:
 		float* outputFrame,
 		uint32_t inputChannels,
 		uint32_t outputChannels)
+	{
+		// --- mono-ized input signal
+		double xnL = inputFrame[0];
+		double xnR = inputChannels > 1 ? inputFrame[1] : 0.0;
+		double monoXn = double(1.0 / inputChannels)*xnL + double(1.0 / inputChannels)*xnR;
+
+		// --- run the tank
+		double outL = 0.0;
+		double outR = 0.0;
+		processTank(monoXn, outL, outR);
+
+		// ---  filter
+		double tankOutL = shelvingFilters[0].processAudioSample(outL);
+		double tankOutR = shelvingFilters[1].processAudioSample(outR);
+
+		// --- sum with dry
+		double dry = pow(10.0, parameters.dryLevel_dB / 20.0);
+		double wet = pow(10.0, parameters.wetLevel_dB / 20.0);
+
+		if (outputChannels == 1)
+			outputFrame[0] = dry*xnL + wet*(0.5*tankOutL + 0.5*tankOutR);
+		else
+		{
+			outputFrame[0] = dry*xnL + wet*tankOutL;
+			outputFrame[1] = dry*xnR + wet*tankOutR;
+		}
+
+		return true;
+	}
+
+	/** process a block of mono or stereo audio; see processTank( ) */
+	/**
+	Operation:
+	- the tank runs one frame at a time (its feedback closes every sample) into local chunks of the
+	  left and right tank outputs
+	- the shelving filters then run over each chunk and the wet/dry mix is done with gains that are
+	  calculated once per block instead of once per sample
+	- the results are the same as processAudioFrame( ) with inputChannels = outputChannels = channels
+	*/
+	virtual bool processAudioBlock(const float* const* inputs, float* const* outputs, uint32_t channels, uint32_t frames)
+	{
+		if (channels == 0)
+			return false;
+
+		uint32_t blockChannels = channels < NUM_CHANNELS ? channels : NUM_CHANNELS;
+		double dry = pow(10.0, parameters.dryLevel_dB / 20.0);
+		double wet = pow(10.0, parameters.wetLevel_dB / 20.0);
+
+		double tankOutL[FX_BLOCK_CHUNK_SIZE];
+		double tankOutR[FX_BLOCK_CHUNK_SIZE];
+		double dryL[FX_BLOCK_CHUNK_SIZE];
+		double dryR[FX_BLOCK_CHUNK_SIZE];
+		for (uint32_t start = 0; start < frames; start += FX_BLOCK_CHUNK_SIZE)
+		{
+			uint32_t length = frames - start < FX_BLOCK_CHUNK_SIZE ? frames - start : FX_BLOCK_CHUNK_SIZE;
+
+			// --- the tank, one frame at a time; the inputs are copied first so in-place blocks work
+			for (uint32_t i = 0; i < length; i++)
+			{
+				double xnL = inputs[0][start + i];
+				double xnR = blockChannels > 1 ? inputs[1][start + i] : 0.0;
+				double monoXn = double(1.0 / blockChannels)*xnL + double(1.0 / blockChannels)*xnR;
+				dryL[i] = xnL;
+				dryR[i] = xnR;
+				processTank(monoXn, tankOutL[i], tankOutR[i]);
+			}
+
+			// ---  filter
+			shelvingFilters[0].processBlockInPlace(tankOutL, length);
+			shelvingFilters[1].processBlockInPlace(tankOutR, length);
+
+			// --- sum with dry
+			if (blockChannels == 1)
+			{
+				for (uint32_t i = 0; i < length; i++)
+					outputs[0][start + i] = (float)(dry*dryL[i] + wet*(0.5*tankOutL[i] + 0.5*tankOutR[i]));
+			}
+			else
+			{
+				for (uint32_t i = 0; i < length; i++)
+				{
+					outputs[0][start + i] = (float)(dry*dryL[i] + wet*tankOutL[i]);
+					outputs[1][start + i] = (float)(dry*dryR[i] + wet*tankOutR[i]);
+				}
+			}
+		}
+
+		return true;
+	}
+
+	/** run one mono input sample through the tank and read the (unfiltered) left and right tank outputs */
+	/**
+	\param monoXn mono-ized input
+	\param outL left tank output
+	\param outR right tank output
+	*/
+	void processTank(double monoXn, double& outL, double& outR)
 	{
 		// --- global feedback from delay in last branch
 		double globFB = branchDelays[NUM_BRANCHES-1].readDelay();
@@ -4827,11 +5430,6 @@ public:
 		// --- feedback value
 		double fb = parameters.kRT*(globFB);
 
-		// --- mono-ized input signal
-		double xnL = inputFrame[0];
-		double xnR = inputChannels > 1 ? inputFrame[1] : 0.0;
-		double monoXn = double(1.0 / inputChannels)*xnL + double(1.0 / inputChannels)*xnR;
-
 		// --- pre delay output
 		double preDelayOut = preDelay.processAudioSample(monoXn);
 
@@ -4856,13 +5454,13 @@ public:
 
 		double weight = 0.707;
 
-		double outL= 0.0;
+		outL = 0.0;
 		outL += weight*branchDelays[0].readDelayAtPercentage(23.0);
 		outL -= weight*branchDelays[1].readDelayAtPercentage(41.0);
 		outL += weight*branchDelays[2].readDelayAtPercentage(59.0);
 		outL -= weight*branchDelays[3].readDelayAtPercentage(73.0);
 
-		double outR = 0.0;
+		outR = 0.0;
 		outR -= weight*branchDelays[0].readDelayAtPercentage(29.0);
 		outR += weight*branchDelays[1].readDelayAtPercentage(43.0);
 		outR -= weight*branchDelays[2].readDelayAtPercentage(61.0);
@@ -4880,24 +5478,6 @@ public:
 			outR -= weight*branchDelays[2].readDelayAtPercentage(71.0);
 			outR += weight*branchDelays[3].readDelayAtPercentage(89.0);
 		}
-
-		// ---  filter
-		double tankOutL = shelvingFilters[0].processAudioSample(outL);
-		double tankOutR = shelvingFilters[1].processAudioSample(outR);
-
-		// --- sum with dry
-		double dry = pow(10.0, parameters.dryLevel_dB / 20.0);
-		double wet = pow(10.0, parameters.wetLevel_dB / 20.0);
-
-		if (outputChannels == 1)
-			outputFrame[0] = dry*xnL + wet*(0.5*tankOutL + 0.5*tankOutR);
-		else
-		{
-			outputFrame[0] = dry*xnL + wet*tankOutL;
-			outputFrame[1] = dry*xnR + wet*tankOutR;
-		}
-
-		return true;
 	}
 
 	/** get parameters: note use of custom structure for passing param data */
@@ -4982,9 +5562,9 @@ public:
 private:
 	ReverbTankParameters parameters;				///< object parameters
 
-	SimpleDelay  preDelay;							///< pre delay object
-	SimpleDelay  branchDelays[NUM_BRANCHES];		///< branch delay objects
-	NestedDelayAPF branchNestedAPFs[NUM_BRANCHES];	///< nested APFs for each branch
+	SimpleDelayT<T> preDelay;						///< pre delay object
+	SimpleDelayT<T> branchDelays[NUM_BRANCHES];		///< branch delay objects
+	NestedDelayAPFT<T> branchNestedAPFs[NUM_BRANCHES];	///< nested APFs for each branch
 	SimpleLPF  branchLPFs[NUM_BRANCHES];			///< LPFs in each branch
 
 	TwoBandShelvingFilter shelvingFilters[NUM_CHANNELS]; ///< shelving filters 0 = left; 1 = right
@@ -4995,6 +5575,8 @@ private:
 	double sampleRate = 0.0;	///< current sample rate
 };
 
+typedef ReverbTankT<double> ReverbTank;	///< double delay lines
+
 
 /**
 \class PeakLimiter
@@ -5735,6 +6317,39 @@ public:
 		return output;
 	}
 
+	/** process a block in place, one stage at a time: waveshaper (+ inversion), HPF, LSF, output gain */
+	virtual void processBlockInPlace(double* block, uint32_t frames)
+	{
+		// --- perform waveshaping; the inversion is folded into the same pass
+		double sign = parameters.invertOutput ? -1.0 : 1.0;
+		if (parameters.waveshaper == distortionModel::kSoftClip)
+		{
+			for (uint32_t i = 0; i < frames; i++)
+				block[i] = sign * softClipWaveShaper(block[i], parameters.saturation);
+		}
+		else if (parameters.waveshaper == distortionModel::kArcTan)
+		{
+			for (uint32_t i = 0; i < frames; i++)
+				block[i] = sign * atanWaveShaper(block[i], parameters.saturation);
+		}
+		else if (parameters.waveshaper == distortionModel::kFuzzAsym)
+		{
+			for (uint32_t i = 0; i < frames; i++)
+				block[i] = sign * fuzzExp1WaveShaper(block[i], parameters.saturation, parameters.asymmetry);
+		}
+		else
+			memset(block, 0, sizeof(double)*frames);
+
+		if (parameters.enableHPF)
+			outputHPF.processBlockInPlace(block, frames);
+
+		if (parameters.enableLSF)
+			outputLSF.processBlockInPlace(block, frames);
+
+		for (uint32_t i = 0; i < frames; i++)
+			block[i] *= parameters.outputGain;
+	}
+
 protected:
 	TriodeClassAParameters parameters;	///< object parameters
 	AudioFilter outputHPF;				///< HPF to simulate output DC blocking cap
@@ -5897,6 +6512,24 @@ public:
 		return output4*outputLevel;
 	}
 
+	/** process a block in place, one stage at a time through the same chain as processAudioSample( ) */
+	virtual void processBlockInPlace(double* block, uint32_t frames)
+	{
+		for (uint32_t i = 0; i < frames; i++)
+			block[i] *= inputLevel;
+
+		triodes[0].processBlockInPlace(block, frames);
+		triodes[1].processBlockInPlace(block, frames);
+		triodes[2].processBlockInPlace(block, frames);
+
+		// --- filter stage is between 3 and 4
+		shelvingFilter.processBlockInPlace(block, frames);
+		triodes[3].processBlockInPlace(block, frames);
+
+		for (uint32_t i = 0; i < frames; i++)
+			block[i] *= outputLevel;
+	}
+
 protected:
 	ClassATubePreParameters parameters;		///< object parameters
 	TriodeClassA triodes[NUM_TUBES];		///< array of triode tube objects
@@ -8668,7 +9301,7 @@ protected:
 
 
 // ------------------------------------------------------------------ //
-// --- OBJECTS REQUIRING FFTW --------------------------------------- //
+// --- FFT OBJECTS: FFTW or the built-in FFT, see fftbackend.h ------ //
 // ------------------------------------------------------------------ //
 
 /**
@@ -8742,9 +9375,10 @@ inline std::unique_ptr<double[]> makeWindow(unsigned int windowLength, unsigned
 	return windowBuffer;
 }
 
-// --- FFTW --- to enable, add the statement #define HAVE_FFTW 1 to the top of the file
-#ifdef HAVE_FFTW
-#include "fftw3.h"
+// --- FFT backend: FFTW if the build defines HAVE_FFTW 1 (LINK_FFTW), otherwise the built-in FFT
+#include "fftbackend.h"
+#include <atomic>
+#include <thread>
 
 /**
 \class FastFFT
@@ -8758,6 +9392,13 @@ Audio I/O:
 Control I/F:
 - none.
 
+Operation:
+- doFFT( ) and doInverseFFT( ) are complex FFTs of the full frame length N
+- doRealFFT( ) and doInverseRealFFT( ) are real FFTs: audio is real valued, so its spectrum is conjugate
+  symmetric and only bins 0 to N/2 are computed and taken; this is about half the work of the complex FFT
+- the inverse transforms are unnormalized (scaled by N), the same as FFTW
+- the FFT comes from fftbackend.h: FFTW, or the built-in FFT in builds without it
+
 \author Will Pirkle http://www.willpirkle.com
 \remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
 \version Revision : 1.0
@@ -8784,9 +9425,21 @@ public:
 	/** do the IFFT and return real and imaginary arrays */
 	fftw_complex* doInverseFFT(double* inputReal, double* inputImag);
 
+	/** do the real FFT of N samples and return the half spectrum, bins 0 to N/2 */
+	fftw_complex* doRealFFT(const double* input);
+
+	/** get the input array of the inverse real FFT: fill in bins 0 to N/2, then call doInverseRealFFT( ) */
+	fftw_complex* getRealIFFTInput() { return real_ifft_input; }
+
+	/** do the inverse real FFT of the bins in getRealIFFTInput( ) and return the N samples; FFTW overwrites the input bins */
+	double* doInverseRealFFT();
+
 	/** get the current FFT length */
 	unsigned int getFrameLength() { return frameLength; }
 
+	/** get the number of bins in a half spectrum, N/2 + 1 */
+	unsigned int getBinCount() { return frameLength / 2 + 1; }
+
 protected:
 	// --- setup FFTW
 	fftw_complex*	fft_input = nullptr;		///< array for FFT input
@@ -8796,6 +9449,13 @@ protected:
 	fftw_plan       plan_forward = nullptr;		///< FFTW plan for FFT
 	fftw_plan		plan_backward = nullptr;	///< FFTW plan for IFFT
 
+	double*			real_fft_input = nullptr;		///< array for real FFT input, N
+	fftw_complex*	real_fft_result = nullptr;		///< array for real FFT output, N/2 + 1
+	fftw_complex*	real_ifft_input = nullptr;		///< array for inverse real FFT input, N/2 + 1
+	double*			real_ifft_result = nullptr;		///< array for inverse real FFT output, N
+	fftw_plan       plan_real_forward = nullptr;	///< FFTW plan for real FFT
+	fftw_plan		plan_real_backward = nullptr;	///< FFTW plan for inverse real FFT
+
 	double* windowBuffer = nullptr;				///< buffer for window (naked)
 	double windowGainCorrection = 1.0;			///< window gain correction
 	windowType window = windowType::kHannWindow; ///< window type
@@ -8817,6 +9477,10 @@ Audio I/O:
 Control I/F:
 - none.
 
+Operation:
+- the frames are real valued, so the vocoder uses real FFTs: getFFTData( ) holds the half spectrum,
+  getBinCount( ) = N/2 + 1 bins, and the inverse FFT makes N real samples from it
+
 \author Will Pirkle http://www.willpirkle.com
 \remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
 \version Revision : 1.0
@@ -8848,13 +9512,16 @@ public:
 	/** increment the FFT counter and do the FFT if it is ready */
 	bool advanceAndCheckFFT();
 
-	/** get FFT data for manipulation (yes, naked pointer so you can manipulate) */
+	/** get FFT data for manipulation (yes, naked pointer so you can manipulate); bins 0 to N/2 */
 	fftw_complex* getFFTData() { return fft_result; }
 
-	/** get IFFT data for manipulation (yes, naked pointer so you can manipulate) */
-	fftw_complex* getIFFTData() { return ifft_result; }
+	/** get IFFT data for manipulation (yes, naked pointer so you can manipulate); N real samples */
+	double* getIFFTData() { return ifft_result; }
 
-	/** do the inverse FFT (optional; will be called automatically if not used) */
+	/** get the number of bins in getFFTData( ), N/2 + 1 */
+	unsigned int getBinCount() { return frameLength / 2 + 1; }
+
+	/** do the inverse FFT (optional; will be called automatically if not used); FFTW overwrites the FFT data */
 	void doInverseFFT();
 
 	/** do the overlap-add operation */
@@ -8872,13 +9539,13 @@ public:
 	/** set the vocoder for overlap add only without hop-size */
 	// --- for fast convolution and other overlap-add algorithms
 	//     that are not hop-size dependent
-	void setOverlapAddOnly(bool b){ bool overlapAddOnly = b; }
+	void setOverlapAddOnly(bool b){ overlapAddOnly = b; }
 
 protected:
-	// --- setup FFTW
-	fftw_complex*	fft_input = nullptr;		///< array for FFT input
-	fftw_complex*	fft_result = nullptr;		///< array for FFT output
-	fftw_complex*	ifft_result = nullptr;		///< array for IFFT output
+	// --- setup FFTW: real FFTs
+	double*			fft_input = nullptr;		///< array for FFT input, N
+	fftw_complex*	fft_result = nullptr;		///< array for FFT output, N/2 + 1
+	double*			ifft_result = nullptr;		///< array for IFFT output, N
 	fftw_plan       plan_forward = nullptr;		///< FFTW plan for FFT
 	fftw_plan		plan_backward = nullptr;	///< FFTW plan for IFFT
 
@@ -8928,7 +9595,8 @@ protected:
 \brief
 The FastConvolver provides a fast convolver - the user supplies the filter IR and the object
 snapshots the FFT of that filter IR. Input audio is fast-convovled with the filter FFT using
-complex multiplication and zero-padding.
+complex multiplication and zero-padding. Both are real, so only the half spectra (bins 0 to N/2) are
+taken and multiplied.
 
 Audio I/O:
 - processes mono input into mono output.
@@ -8981,7 +9649,7 @@ public:
 		if(filterFFT)
 			fftw_free(filterFFT);
 
-		 filterFFT = (fftw_complex*)fftw_malloc(sizeof(fftw_complex) * filterImpulseLength * 2);
+		 filterFFT = (fftw_complex*)fftw_malloc(sizeof(fftw_complex) * (filterImpulseLength + 1));
 
 		 // --- reset
 		 inputCount = 0;
@@ -8995,14 +9663,13 @@ public:
 		memset(&filterIR[0], 0, filterImpulseLength * 2 * sizeof(double));
 
 		// --- copy over first half; filterIR len = filterImpulseLength * 2
-		int m = 0;
 		for (unsigned int i = 0; i < filterImpulseLength; i++)
 		{
 			filterIR[i] = irBuffer[i];
 		}
 
-		// --- take FFT of the h(n)
-		fftw_complex* fftOfFilter = filterFastFFT.doFFT(&filterIR[0]);
+		// --- take FFT of the h(n); half spectrum, filterImpulseLength + 1 bins
+		fftw_complex* fftOfFilter = filterFastFFT.doRealFFT(&filterIR[0]);
 
 		// --- copy the FFT into our local buffer for storage; also
 		//     we never want to hold a pointer to a FFT output
@@ -9010,7 +9677,7 @@ public:
 		//     could replace with memcpy( )
 		for (int i = 0; i < 2; i++)
 		{
-			for (unsigned int j = 0; j < filterImpulseLength * 2; j++)
+			for (unsigned int j = 0; j < filterImpulseLength + 1; j++)
 			{
 				filterFFT[j][i] = fftOfFilter[j][i];
 			}
@@ -9033,10 +9700,10 @@ public:
 				fftw_complex* signalFFT = vocoder.getFFTData();
 				if (signalFFT)
 				{
-					unsigned int fff = vocoder.getFrameLength();
+					unsigned int bins = vocoder.getBinCount();
 
 					// --- complex multiply with FFT of IR
-					for (unsigned int i = 0; i < filterImpulseLength * 2; i++)
+					for (unsigned int i = 0; i < bins; i++)
 					{
 						// --- get real/imag parts of each FFT
 						ComplexNumber signal(signalFFT[i][0], signalFFT[i][1]);
@@ -9072,14 +9739,268 @@ public:
 protected:
 	PhaseVocoder vocoder;				///< vocoder object
 	FastFFT filterFastFFT;				///< FastFFT object
-	fftw_complex* filterFFT = nullptr;	///< filterFFT output arrays
+	fftw_complex* filterFFT = nullptr;	///< filterFFT output arrays, half spectrum
 	double* filterIR = nullptr;			///< filter IR
 	unsigned int inputCount = 0;		///< input sample counter
 	unsigned int filterImpulseLength = 0;///< IR length
 };
 
+// --- PartitionedConvolver limits
+const uint32_t CONVOLVER_MAX_PATHS = 4;				// --- true stereo: LL, LR, RL, RR
+const uint32_t CONVOLVER_MAX_SEGMENTS = 16;			// --- enough for every size from the min to the max block size, plus a split
+const uint32_t CONVOLVER_MIN_BLOCK_SIZE = 16;
+const uint32_t CONVOLVER_MAX_BLOCK_SIZE = 32768;
+const uint32_t CONVOLVER_PARTITIONS_PER_SIZE = 4;	// --- non-uniform: partitions of each size before the size doubles
+
+/**
+\enum convolverChannels
+\ingroup FFTW-Objects
+\brief
+Use this strongly typed enum to set the IR routing of the PartitionedConvolver.
+
+- kMono: one IR, input 0 to output 0
+- kStereo: two IRs (L, R), input 0 to output 0 and input 1 to output 1
+- kTrueStereo: four IRs (LL, LR, RL, RR), every input to every output: outL = inL*LL + inR*RL, outR = inL*LR + inR*RR
+
+\author Will Pirkle http://www.willpirkle.com
+\remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
+\version Revision : 1.0
+\date Date : 2018 / 09 / 7
+*/
+enum class convolverChannels { kMono, kStereo, kTrueStereo };
+
+/**
+\struct PartitionedConvolverParameters
+\ingroup FFTW-Objects
+\brief
+Custom parameter structure for the PartitionedConvolver object: the partitioning and latency. These are
+applied by the next setImpulseResponses( ) call.
+
+\author Will Pirkle http://www.willpirkle.com
+\remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
+\version Revision : 1.0
+\date Date : 2018 / 09 / 7
+*/
+struct PartitionedConvolverParameters
+{
+	PartitionedConvolverParameters() {}
+	/** all FXObjects parameter objects require overloaded= operator so remember to add new entries if you add new variables. */
+	PartitionedConvolverParameters& operator=(const PartitionedConvolverParameters& params)	// need this override for collections to work
+	{
+		if (this == &params)
+			return *this;
+
+		channels = params.channels;
+		blockSize = params.blockSize;
+		maxBlockSize = params.maxBlockSize;
+		latency = params.latency;
+		backgroundTail = params.backgroundTail;
+		return *this;
+	}
+
+	// --- individual parameters
+	convolverChannels channels = convolverChannels::kMono;	///< IR routing
+	uint32_t blockSize = 64;		///< first (smallest) partition, power of 2, CONVOLVER_MIN_BLOCK_SIZE to CONVOLVER_MAX_BLOCK_SIZE
+	uint32_t maxBlockSize = 4096;	///< largest partition, power of 2; set it to blockSize for uniform partitioning
+	uint32_t latency = 0;			///< output delay in samples; the IR taps before blockSize - latency are convolved in the time domain
+	bool backgroundTail = false;	///< convolve the largest partitions on a worker thread
+};
+
+/**
+\struct ConvolverSegment
+\ingroup FFTW-Objects
+\brief
+One run of equal sized IR partitions of the PartitionedConvolver and its frequency domain delay line.
+
+- the spectra are half spectra (bins 0 to P) in split real/imaginary arrays, from and for the real FFTs
+- the IR spectra carry the 1/2P scaling of the inverse FFT
+
+\author Will Pirkle http://www.willpirkle.com
+\remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
+\version Revision : 1.0
+\date Date : 2018 / 09 / 7
+*/
+struct ConvolverSegment
+{
+	uint32_t blockSize = 0;		///< partition length P; the FFT is 2P long
+	uint32_t partitions = 0;	///< partitions in this segment
+	uint32_t irOffset = 0;		///< first IR tap of the segment
+	uint32_t outputOffset = 0;	///< irOffset + latency: the delay of the segment's output
+	bool background = false;	///< processed on the worker thread
+	uint32_t fdlIndex = 0;		///< newest input spectrum in the delay line
+	uint64_t blockEnd = 0;		///< sample count at the end of the block being convolved
+
+	FastFFT fastFFT;								///< 2P point real FFT/IFFT
+	std::unique_ptr<double[]> irReal = nullptr;		///< IR spectra [path][partition][bin]
+	std::unique_ptr<double[]> irImag = nullptr;		///< IR spectra [path][partition][bin]
+	std::unique_ptr<double[]> fdlReal = nullptr;	///< input spectra [input][partition][bin]
+	std::unique_ptr<double[]> fdlImag = nullptr;	///< input spectra [input][partition][bin]
+	std::unique_ptr<double[]> spectrumReal = nullptr;	///< output spectrum accumulator [bin]
+	std::unique_ptr<double[]> spectrumImag = nullptr;	///< output spectrum accumulator [bin]
+	std::unique_ptr<double[]> blockOutput = nullptr;	///< [output][P]: the last convolved block
+
+	/** bins in a half spectrum */
+	uint32_t getBins() { return blockSize + 1; }
+};
+
+/**
+\class PartitionedConvolver
+\ingroup FFTW-Objects
+\brief
+The PartitionedConvolver object convolves one or two channels with long impulse responses (several seconds)
+at low or zero latency; it replaces the ImpulseConvolver (O(N) per sample) and the FastConvolver (latency = IR length)
+for anything but very short IRs.
+
+Audio I/O:
+- kMono: processAudioSample( ), or channel 0 of processAudioFrame( ) and processAudioBlock( )
+- kStereo and kTrueStereo: processAudioFrame( ) and processAudioBlock( ) process two channels; a mono input feeds
+  both inputs and a mono output gets the left channel; processAudioSample( ) does the same
+
+Control I/F:
+- Use PartitionedConvolverParameters to set the channels, partition sizes, latency and the background tail,
+  then call setImpulseResponses( ); both are NOT realtime safe
+
+Operation:
+- uniformly partitioned overlap-save convolution: each block of P samples is transformed once (2P point
+  FFT), kept in a frequency domain delay line and multiplied with the spectra of all partitions, so a
+  partition costs one complex multiply-add per bin instead of P multiply-adds per sample
+- non-uniform partitioning: CONVOLVER_PARTITIONS_PER_SIZE partitions of blockSize, then of twice the size and so on up
+  to maxBlockSize; the small early partitions keep the latency low and the large late ones keep the CPU
+  cost per sample low, even for multi-second IRs
+- latency 0: the first blockSize taps are convolved in the time domain (direct form FIR), so there is no delay
+- latency L > 0: the output is delayed by L samples and only the first blockSize - L taps are convolved in the time domain;
+  at L >= blockSize there is no time domain part at all
+- background tail: the segment of the largest partitions is convolved on a worker thread; its block is handed
+  over lock-free when it is complete and collected one block later, when its output is first needed; if the
+  worker has not started on it by then the audio thread convolves it itself, so the result never changes
+- each segment uses the real FFTs of a FastFFT, so only the half spectrum is transformed and multiplied
+
+\author Will Pirkle http://www.willpirkle.com
+\remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
+\version Revision : 1.0
+\date Date : 2018 / 09 / 7
+*/
+class PartitionedConvolver : public IAudioSignalProcessor
+{
+public:
+	PartitionedConvolver();		/* C-TOR */
+	~PartitionedConvolver();	/* D-TOR */
+
+	/** reset: flush the input history, delay lines and output; the IRs are kept */
+	virtual bool reset(double _sampleRate);
+
+	/** process one sample; see the class notes for the channels */
+	/**
+	\param xn input
+	\return the processed sample
+	*/
+	virtual double processAudioSample(double xn);
+
+	/** return true: this object processes frames */
+	virtual bool canProcessAudioFrame() { return true; }
+
+	/** process one frame; see the class notes for the channels */
+	virtual bool processAudioFrame(const float* inputFrame,
+		float* outputFrame,
+		uint32_t inputChannels,
+		uint32_t outputChannels);
+
+	/** process a block; see the class notes for the channels */
+	virtual bool processAudioBlock(const float* const* inputs, float* const* outputs, uint32_t channels, uint32_t frames);
+
+	/** get parameters: note use of custom structure for passing param data */
+	/**
+	\return PartitionedConvolverParameters custom data structure
+	*/
+	PartitionedConvolverParameters getParameters() { return parameters; }
+
+	/** set parameters: note use of custom structure for passing param data; applied by the next setImpulseResponses( ) */
+	/**
+	\param PartitionedConvolverParameters custom data structure
+	*/
+	void setParameters(const PartitionedConvolverParameters& _parameters) { parameters = _parameters; }
+
+	/** partition the IRs and take their FFTs; one IR for kMono, two (L, R) for kStereo, four (LL, LR, RL, RR)
+	    for kTrueStereo, all irLength long; NOT realtime safe */
+	bool setImpulseResponses(const double* const* irs, uint32_t irLength);
+
+	/** output delay in samples */
+	uint32_t getLatency_Samples() { return latency; }
+
+	/** IR taps convolved in the time domain */
+	uint32_t getHeadLength() { return headLength; }
+
+	/** number of partition segments */
+	uint32_t getSegmentCount() { return numSegments; }
+
+	/** get one partition segment, for inspection only */
+	const ConvolverSegment& getSegment(uint32_t index) { return segments[index]; }
+
+protected:
+	PartitionedConvolverParameters parameters;	///< the settings for the next setImpulseResponses( )
+
+	// --- routing
+	uint32_t numInputs = 1;						///< input channels
+	uint32_t numOutputs = 1;					///< output channels
+	uint32_t numPaths = 0;						///< IRs
+	uint32_t pathInput[CONVOLVER_MAX_PATHS];	///< input channel of each IR
+	uint32_t pathOutput[CONVOLVER_MAX_PATHS];	///< output channel of each IR
+
+	// --- layout
+	uint32_t blockSize = 0;		///< first partition size; segments are processed on its block boundaries
+	uint32_t latency = 0;		///< output delay
+	uint32_t headLength = 0;	///< IR taps convolved in the time domain
+	std::unique_ptr<double[]> headTaps = nullptr;	///< [path][headLength], time reversed
+	ConvolverSegment segments[CONVOLVER_MAX_SEGMENTS];	///< the partitions
+	uint32_t numSegments = 0;	///< segments in use
+
+	// --- signal: the input history is mirrored (every sample is written twice) so any window of it is contiguous
+	std::unique_ptr<double[]> inputHistory = nullptr;	///< [input][2 * historyLength]
+	uint32_t historyLength = 0;	///< power of 2
+	std::unique_ptr<double[]> outputRing = nullptr;		///< [output][ringLength]: segment outputs, summed ahead of time
+	uint32_t ringLength = 0;	///< power of 2
+	uint64_t sampleCount = 0;	///< samples processed since reset( )
+
+	// --- background tail
+	enum { kTailIdle, kTailPending, kTailClaimed, kTailDone };
+	std::thread worker;					///< convolves the background segment
+	std::atomic<bool> running;			///< worker loop flag
+	std::atomic<uint32_t> tailState;	///< handoff of the background block
+	bool tailInFlight = false;			///< audio thread: a background block has been handed over
+	uint32_t tailSegment = 0;			///< index of the background segment
+
+	/** add a segment to the layout */
+	void addSegment(uint32_t partitionSize, uint32_t partitions, uint32_t irOffset, bool background);
+
+	/** process frames, split on block boundaries */
+	void processFrames(double* const* inputs, double* const* outputs, uint32_t frames);
+
+	/** process frames that do not cross a block boundary, then run the segments whose blocks are complete */
+	void processChunk(double* const* inputs, double* const* outputs, uint32_t offset, uint32_t frames);
+
+	/** convolve the block that ends at segment.blockEnd into segment.blockOutput */
+	void convolveSegmentBlock(ConvolverSegment& segment);
+
+	/** add segment.blockOutput to the output ring */
+	void addSegmentOutput(ConvolverSegment& segment);
+
+	/** audio thread: wait for (or take over) the background block in flight */
+	void collectTail();
+
+	// --- worker thread
+	void startWorker();
+	void stopWorker();
+	void workerLoop();
+
+private:
+	PartitionedConvolver(const PartitionedConvolver&);
+	PartitionedConvolver& operator=(const PartitionedConvolver&);
+};
+
 // --- PSM Vocoder
 const unsigned int PSM_FFT_LEN = 4096;
+const unsigned int PSM_FFT_BINS = PSM_FFT_LEN / 2 + 1; // --- real FFT: bins 0 to N/2
+const unsigned int PSM_RESERVED_OUTPUT_LEN = 2 * PSM_FFT_LEN; // --- resample buffers allocated up front: shifts down to -12 semitones
 
 /**
 \struct BinData
@@ -9182,6 +10103,8 @@ Audio I/O:
 
 Control I/F:
 - Use PSMVocoderParameters structure to get/set object params.
+- the resample buffers are allocated in the constructor for shifts down to -12 semitones, so
+  setParameters( ) only allocates for larger downward shifts
 
 \author Will Pirkle http://www.willpirkle.com
 \remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
@@ -9193,6 +10116,7 @@ class PSMVocoder : public IAudioSignalProcessor
 public:
 	PSMVocoder() {
 		vocoder.initialize(PSM_FFT_LEN, PSM_FFT_LEN/4, windowType::kHannWindow);  // 75% overlap
+		reserveBuffers(PSM_RESERVED_OUTPUT_LEN);
 	}		/* C-TOR */
 	~PSMVocoder() {
 		if (windowBuff) delete[] windowBuff;
@@ -9203,12 +10127,12 @@ public:
 	/** reset members to initialized state */
 	virtual bool reset(double _sampleRate)
 	{
-		memset(&phi[0], 0, sizeof(double)*PSM_FFT_LEN);
-		memset(&psi[0], 0, sizeof(double)* PSM_FFT_LEN);
+		memset(&phi[0], 0, sizeof(double)*PSM_FFT_BINS);
+		memset(&psi[0], 0, sizeof(double)* PSM_FFT_BINS);
 		if(outputBuff)
 			memset(outputBuff, 0, sizeof(double)*outputBufferLength);
 
-		for (int i = 0; i < PSM_FFT_LEN; i++)
+		for (unsigned int i = 0; i < PSM_FFT_BINS; i++)
 		{
 			binData[i].reset();
 			binDataPrevious[i].reset();
@@ -9242,8 +10166,7 @@ public:
 		outputBufferLength = newOutputBufferLength;
 
 		// --- create Hann window
-		if (windowBuff) delete[] windowBuff;
-		windowBuff = new double[outputBufferLength];
+		reserveBuffers(outputBufferLength);
 		windowCorrection = 0.0;
 		for (unsigned int i = 0; i < outputBufferLength; i++)
 		{
@@ -9252,12 +10175,25 @@ public:
 		}
 		windowCorrection = 1.0 / windowCorrection;
 
-		// --- create output buffer
-		if (outputBuff) delete[] outputBuff;
-		outputBuff = new double[outputBufferLength];
+		// --- clear output buffer
 		memset(outputBuff, 0, sizeof(double)*outputBufferLength);
 	}
 
+	/** grow the window and resample buffers to hold at least length samples; allocates only when growing */
+	void reserveBuffers(unsigned int length)
+	{
+		if (length <= bufferCapacity)
+			return;
+
+		if (windowBuff) delete[] windowBuff;
+		if (outputBuff) delete[] outputBuff;
+		windowBuff = new double[length];
+		outputBuff = new double[length];
+		memset(windowBuff, 0, sizeof(double)*length);
+		memset(outputBuff, 0, sizeof(double)*length);
+		bufferCapacity = length;
+	}
+
 	/** find bin index of nearest peak bin in previous FFT frame */
 	int findPreviousNearestPeak(int peakIndex)
 	{
@@ -9266,13 +10202,13 @@ public:
 
 		int delta = -1;
 		int previousPeak = -1;
-		for (int i = 0; i < PSM_FFT_LEN; i++)
+		for (unsigned int i = 0; i < PSM_FFT_BINS; i++)
 		{
 			if (peakBinsPrevious[i] < 0)
 				break;
 
 			int dist = abs(peakIndex - peakBinsPrevious[i]);
-			if (dist > PSM_FFT_LEN/4)
+			if (dist > (int)PSM_FFT_LEN/4)
 				break;
 
 			if (i == 0)
@@ -9298,7 +10234,7 @@ public:
 		// --- find local maxima in 4-sample window
 		double localWindow[4] = { 0.0, 0.0, 0.0, 0.0 };
 		int m = 0;
-		for (int i = 0; i < PSM_FFT_LEN; i++)
+		for (unsigned int i = 0; i < PSM_FFT_BINS; i++)
 		{
 			if (i == 0)
 			{
@@ -9314,14 +10250,14 @@ public:
 				localWindow[2] = binData[i + 1].magnitude;
 				localWindow[3] = binData[i + 2].magnitude;
 			}
-			else  if (i == PSM_FFT_LEN - 1)
+			else  if (i == PSM_FFT_BINS - 1)
 			{
 				localWindow[0] = binData[i - 2].magnitude;
 				localWindow[1] = binData[i - 1].magnitude;
 				localWindow[2] = 0.0;
 				localWindow[3] = 0.0;
 			}
-			else  if (i == PSM_FFT_LEN - 2)
+			else  if (i == PSM_FFT_BINS - 2)
 			{
 				localWindow[0] = binData[i - 2].magnitude;
 				localWindow[1] = binData[i - 1].magnitude;
@@ -9364,7 +10300,8 @@ public:
 
 			if (nextPeak >= 0)
 			{
-				for (int i = 0; i < PSM_FFT_LEN; i++)
+				// --- signed index: compared with the peak bins, which use -1 for none
+				for (int i = 0; i < (int)PSM_FFT_BINS; i++)
 				{
 					if (i <= bossPeakBin)
 					{
@@ -9381,7 +10318,7 @@ public:
 						if (nextPeak > bossPeakBin)
 							midBoundary = (nextPeak - (double)bossPeakBin) / 2.0 + bossPeakBin;
 						else // nextPeak == -1
-							midBoundary = PSM_FFT_LEN;
+							midBoundary = PSM_FFT_BINS;
 
 						binData[i].localPeakBin = bossPeakBin;
 					}
@@ -9406,13 +10343,13 @@ public:
 			// --- if FFT is here, GO!
 			if (fftReady)
 			{
-			// --- get the FFT data
+			// --- get the FFT data: half spectrum, PSM_FFT_BINS bins
 			fftw_complex* fftData = vocoder.getFFTData();
 
 			if (parameters.enablePeakPhaseLocking)
 			{
 				// --- get the magnitudes for searching
-				for (int i = 0; i < PSM_FFT_LEN; i++)
+				for (unsigned int i = 0; i < PSM_FFT_BINS; i++)
 				{
 					binData[i].reset();
 					peakBins[i] = -1;
@@ -9429,9 +10366,8 @@ public:
 				// --- now propagate phases accordingly
 				//
 				//     FIRST: set PSI angles of bosses
-				for (int i = 0; i < PSM_FFT_LEN; i++)
+				for (unsigned int i = 0; i < PSM_FFT_BINS; i++)
 				{
-					double mag_k = binData[i].magnitude;
 					double phi_k = binData[i].phi;
 
 					// --- horizontal phase propagation
@@ -9467,7 +10403,7 @@ public:
 				}
 
 				// --- now set non-peaks
-				for (int i = 0; i < PSM_FFT_LEN; i++)
+				for (unsigned int i = 0; i < PSM_FFT_BINS; i++)
 				{
 					if (!binData[i].isPeak)
 					{
@@ -9485,7 +10421,7 @@ public:
 					}
 				}
 
-				for (int i = 0; i < PSM_FFT_LEN; i++)
+				for (unsigned int i = 0; i < PSM_FFT_BINS; i++)
 				{
 					double mag_k = binData[i].magnitude;
 
@@ -9502,7 +10438,7 @@ public:
 
 			else // ---> old school
 			{
-				for (int i = 0; i < PSM_FFT_LEN; i++)
+				for (unsigned int i = 0; i < PSM_FFT_BINS; i++)
 				{
 					double mag_k = getMagnitude(fftData[i][0], fftData[i][1]);
 					double phi_k = getPhase(fftData[i][0], fftData[i][1]);
@@ -9535,13 +10471,8 @@ public:
 			// --- manually so the IFFT (OPTIONAL)
 			vocoder.doInverseFFT();
 
-			// --- can get the iFFT buffers
-			fftw_complex* inv_fftData = vocoder.getIFFTData();
-
-			// --- make copy (can speed this up)
-			double ifft[PSM_FFT_LEN] = { 0.0 };
-			for (int i = 0; i < PSM_FFT_LEN; i++)
-				ifft[i] = inv_fftData[i][0];
+			// --- can get the iFFT buffers: the real FFT output needs no copy
+			double* ifft = vocoder.getIFFTData();
 
 			// --- resample the audio as if it were stretched
 			resample(&ifft[0], outputBuff, PSM_FFT_LEN, outputBufferLength, interpolation::kLinear, windowCorrection, windowBuff);
@@ -9585,20 +10516,21 @@ protected:
 	// --- FFT is 4096 with 75% overlap
 	const double hs = PSM_FFT_LEN / 4;	///< hs = N/4 --- 75% overlap
 	double ha = PSM_FFT_LEN / 4;		///< ha = N/4 --- 75% overlap
-	double phi[PSM_FFT_LEN] = { 0.0 };	///< array of phase values for classic algorithm
-	double psi[PSM_FFT_LEN] = { 0.0 };	///< array of phase correction values for classic algorithm
+	double phi[PSM_FFT_BINS] = { 0.0 };	///< array of phase values for classic algorithm
+	double psi[PSM_FFT_BINS] = { 0.0 };	///< array of phase correction values for classic algorithm
 
 	// --- for peak-locking
-	BinData binData[PSM_FFT_LEN];			///< array of BinData structures for current FFT frame
-	BinData binDataPrevious[PSM_FFT_LEN];	///< array of BinData structures for previous FFT frame
+	BinData binData[PSM_FFT_BINS];			///< array of BinData structures for current FFT frame
+	BinData binDataPrevious[PSM_FFT_BINS];	///< array of BinData structures for previous FFT frame
 
-	int peakBins[PSM_FFT_LEN] = { -1 };		///< array of current peak bin index values (-1 = not peak)
-	int peakBinsPrevious[PSM_FFT_LEN] = { -1 }; ///< array of previous peak bin index values (-1 = not peak)
+	int peakBins[PSM_FFT_BINS] = { -1 };		///< array of current peak bin index values (-1 = not peak)
+	int peakBinsPrevious[PSM_FFT_BINS] = { -1 }; ///< array of previous peak bin index values (-1 = not peak)
 
 	double* windowBuff = nullptr;			///< buffer for window
 	double* outputBuff = nullptr;			///< buffer for resampled output
 	double windowCorrection = 0.0;			///< window correction value
 	unsigned int outputBufferLength = 0;	///< lenght of resampled output array
+	unsigned int bufferCapacity = 0;		///< allocated length of windowBuff and outputBuff
 };
 
 // --- sample rate conversion
@@ -9735,7 +10667,7 @@ inline double** decomposeFilter(double* filterIR, unsigned int FIRLength, unsign
 	}
 
 	int m = 0;
-	for (int i = 0; i < subBandLength; i++)
+	for (unsigned int i = 0; i < subBandLength; i++)
 	{
 		for (int j = ratio - 1; j >= 0; j--)
 		{
@@ -9991,5 +10923,3 @@ protected:
 	bool polyphase = true;									///< enable polyphase decomposition
 	FastConvolver polyPhaseConvolvers[maxSamplingRatio];	///< a set of sub-band convolvers for polyphase operation
 };
-
-#endif
@@ -0,0 +1,187 @@
+// -----------------------------------------------------------------------------
+//    ASPiK Bench File:  fftbench.cpp
+//
+/**
+    \file   fftbench.cpp
+    \author Will Pirkle
+    \date   17-September-2018
+    \brief  FastFFT throughput and accuracy with the FFT backend of the build (fftbackend.h):
+    		FFTW with HAVE_FFTW, otherwise the built-in FFT
+    		- complex FFT + IFFT (doFFT, doInverseFFT) against real FFT + IFFT
+    		  (doRealFFT, doInverseRealFFT) of the same noise frame, 64 to 16384 points
+    		- maxError is the largest difference between the FFT bins and a direct DFT
+    		  (every length is checked), scaled by 1/N;
+    		  roundTripError is the largest difference after the IFFT
+    		- prints one JSON object per (length, transform) run to stdout
+    		- http://www.aspikplugins.com
+    		- http://www.willpirkle.com
+*/
+// -----------------------------------------------------------------------------
+#include "fxobjects.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#ifdef HAVE_FFTW
+const char* kBenchBackend = "fftw";
+#else
+const char* kBenchBackend = "builtIn";
+#endif
+
+/**
+\brief fill a frame with noise
+*/
+void fillNoise(std::vector<double>& frame, uint32_t& seed)
+{
+	for (size_t i = 0; i < frame.size(); i++)
+	{
+		seed = seed * 1664525 + 1013904223;
+		frame[i] = ((double)seed / 4294967295.0) * 2.0 - 1.0;
+	}
+}
+
+/**
+\brief largest difference between bins 0 to binCount - 1 and a direct DFT of the frame, scaled by 1/N
+
+NOTES:
+- O(N^2) multiply-adds over a twiddle table, so the 16384 point check still runs in well under a second
+*/
+double getDFTError(const std::vector<double>& frame, fftw_complex* bins, uint32_t binCount)
+{
+	uint32_t length = (uint32_t)frame.size();
+	std::vector<double> twiddleCos(length);
+	std::vector<double> twiddleSin(length);
+	for (uint32_t n = 0; n < length; n++)
+	{
+		double angle = -2.0 * kPi * (double)n / (double)length;
+		twiddleCos[n] = cos(angle);
+		twiddleSin[n] = sin(angle);
+	}
+
+	double maxError = 0.0;
+	for (uint32_t k = 0; k < binCount; k++)
+	{
+		double real = 0.0;
+		double imag = 0.0;
+
+		// --- twiddle index is (k * n) mod N
+		uint32_t index = 0;
+		for (uint32_t n = 0; n < length; n++)
+		{
+			real += frame[n] * twiddleCos[index];
+			imag += frame[n] * twiddleSin[index];
+			index += k;
+			if (index >= length)
+				index -= length;
+		}
+		double error = fmax(fabs(bins[k][0] - real), fabs(bins[k][1] - imag)) / (double)length;
+		maxError = error > maxError ? error : maxError;
+	}
+	return maxError;
+}
+
+enum benchTransform { kBenchComplex, kBenchReal, kNumBenchTransforms };
+
+/**
+\brief bench entry point: [iterations] (scaled down for the longer FFTs, 20000 at 64 points)
+*/
+int main(int argc, char* argv[])
+{
+	uint32_t iterations = argc > 1 ? (uint32_t)atoi(argv[1]) : 20000;
+	if (iterations == 0)
+		iterations = 1;
+
+	const char* transformNames[kNumBenchTransforms] = { "complex", "real" };
+
+	for (uint32_t length = 64; length <= 16384; length *= 2)
+	{
+		FastFFT fastFFT;
+		fastFFT.initialize(length, windowType::kNoWindow);
+
+		std::vector<double> frame(length);
+		std::vector<double> zeros(length, 0.0);
+		uint32_t seed = 12345;
+		fillNoise(frame, seed);
+
+		uint32_t runs = iterations * 64 / length;
+		if (runs < 10)
+			runs = 10;
+
+		double nsPerTransform[kNumBenchTransforms];
+		for (uint32_t transform = 0; transform < kNumBenchTransforms; transform++)
+		{
+			// --- accuracy
+			double maxError = 0.0;
+			double roundTripError = 0.0;
+			const double* output = nullptr;
+			std::vector<double> complexOutput(length);
+			if (transform == kBenchComplex)
+			{
+				fftw_complex* bins = fastFFT.doFFT(&frame[0]);
+				maxError = getDFTError(frame, bins, length);
+
+				std::vector<double> real(length), imag(length);
+				for (uint32_t i = 0; i < length; i++)
+				{
+					real[i] = bins[i][0];
+					imag[i] = bins[i][1];
+				}
+				fftw_complex* samples = fastFFT.doInverseFFT(&real[0], &imag[0]);
+				for (uint32_t i = 0; i < length; i++)
+					complexOutput[i] = samples[i][0];
+				output = &complexOutput[0];
+			}
+			else
+			{
+				fftw_complex* bins = fastFFT.doRealFFT(&frame[0]);
+				maxError = getDFTError(frame, bins, fastFFT.getBinCount());
+
+				memcpy(fastFFT.getRealIFFTInput(), bins, fastFFT.getBinCount() * sizeof(fftw_complex));
+				output = fastFFT.doInverseRealFFT();
+			}
+			for (uint32_t i = 0; i < length; i++)
+			{
+				double error = fabs(output[i] / (double)length - frame[i]);
+				roundTripError = error > roundTripError ? error : roundTripError;
+			}
+
+			// --- throughput: one forward and one inverse transform per run
+			double sink = 0.0;
+			std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+			for (uint32_t run = 0; run < runs; run++)
+			{
+				if (transform == kBenchComplex)
+				{
+					fftw_complex* bins = fastFFT.doFFT(&frame[0]);
+					sink += bins[1][0];
+					sink += fastFFT.doInverseFFT(&frame[0], &zeros[0])[1][0];
+				}
+				else
+				{
+					fftw_complex* bins = fastFFT.doRealFFT(&frame[0]);
+					sink += bins[1][0];
+					memcpy(fastFFT.getRealIFFTInput(), bins, fastFFT.getBinCount() * sizeof(fftw_complex));
+					sink += fastFFT.doInverseRealFFT()[1];
+				}
+			}
+			std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+			// --- keep the output alive
+			if (sink == 1.2345)
+				printf("%f\n", sink);
+
+			nsPerTransform[transform] = std::chrono::duration<double>(end - start).count() * 1.0e9 / ((double)runs * 2.0);
+
+			printf("{\"backend\":\"%s\",\"length\":%u,\"transform\":\"%s\",\"nsPerTransform\":%.1f,\"speedup\":%.2f,\"maxError\":%g,\"roundTripError\":%g}\n",
+				   kBenchBackend, length, transformNames[transform], nsPerTransform[transform],
+				   nsPerTransform[transform] > 0.0 ? nsPerTransform[kBenchComplex] / nsPerTransform[transform] : 0.0,
+				   maxError, roundTripError);
+			fflush(stdout);
+		}
+	}
+
+	return 0;
+}
@@ -19,8 +19,53 @@ namespace Vst {
 namespace ASPiK {
 
 // --- for versioning in serialization
-static uint64 VSTPluginVersion = 0;		///< VST versioning for serialization
+//     0: one double per parameter in parameter index order, then the bypass flag
+//     1: one PluginStateChunk (uint32 size + data), the bypass flag is in the chunk flags
+static uint64 VSTPluginVersion = 1;		///< VST versioning for serialization
 static FUID* VST3PluginCID = nullptr;	///< the FUID
+
+// --- a larger size means the stream is damaged
+static const uint32 kMaxStateChunkSize = 1 << 24;
+
+/**
+\brief serialization helper: read a version 0 state, one double per parameter in parameter index order
+
+\return true if every value was read
+*/
+static bool readLegacyState(IBStreamer& s, PluginCore* pluginCore, std::vector<PresetParameter>& values)
+{
+	double data = 0;
+	values.clear();
+
+	for (unsigned int i = 0; i < pluginCore->getPluginParameterCount(); i++)
+	{
+		PluginParameter* piParam = pluginCore->getPluginParameterByIndex(i);
+		if(!piParam)
+			continue;
+
+		if(!s.readDouble(data))
+			return false;
+
+		values.push_back(PresetParameter(piParam->getControlID(), data));
+	}
+
+	return true;
+}
+
+/**
+\brief serialization helper: read a version 1 state chunk (uint32 size, then the chunk)
+
+\return true if the whole chunk was read
+*/
+static bool readStateChunk(IBStreamer& s, std::vector<uint8_t>& chunk)
+{
+	uint32 size = 0;
+	if(!s.readInt32u(size) || size < STATE_CHUNK_HEADER_SIZE || size > kMaxStateChunkSize)
+		return false;
+
+	chunk.resize(size);
+	return s.readRaw(&chunk[0], (TSize)size) == (TSize)size;
+}
     
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 //	VST3Plugin::VST3Plugin
@@ -388,6 +433,12 @@ tresult PLUGIN_API VST3Plugin::terminate()
     if(guiPluginConnector) delete guiPluginConnector;
     if(midiEventQueue) delete midiEventQueue;
     if(pluginHostConnector) delete pluginHostConnector;
+
+#if SYNTHLAB_RT_AUDIT
+    // --- debug/test builds: report anything process( ) should not have done
+    if (RTAuditor::getViolationCount() > 0)
+        RTAuditor::writeReport(stderr);
+#endif
     
     return SingleComponentEffect::terminate();
 }
@@ -481,8 +532,8 @@ NOTES:
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 tresult PLUGIN_API VST3Plugin::canProcessSampleSize(int32 symbolicSampleSize)
 {
-	// --- we support 32 bit audio
-	if (symbolicSampleSize == kSample32)
+	// --- we support 32 and 64 bit audio
+	if (symbolicSampleSize == kSample32 || symbolicSampleSize == kSample64)
 	{
 		return kResultTrue;
 	}
@@ -562,6 +613,9 @@ tresult PLUGIN_API VST3Plugin::setActive(TBool state)
         // --- reset
         if(pluginCore)
         {
+            // --- process( ) has not started yet: swap in a preset posted while processing was off
+            pluginCore->applyParameterSnapshot();
+
             ResetInfo info;
             info.sampleRate = processSetup.sampleRate;
             info.bitDepth = processSetup.symbolicSampleSize;
@@ -571,6 +625,9 @@ tresult PLUGIN_API VST3Plugin::setActive(TBool state)
 	else
 	{
  		// --- do OFF stuff;
+        // --- process( ) will not run again: swap in a preset posted after its last block
+        if(pluginCore)
+            pluginCore->applyParameterSnapshot();
 	}
 
 	// --- base class method call is last
@@ -586,6 +643,8 @@ tresult PLUGIN_API VST3Plugin::setActive(TBool state)
 
 NOTES:
 - The datatypes/read order must EXACTLY match the getState() version or crashes may happen or variables not initialized properly.
+- version 0 states (one double per parameter in index order) are still read
+- the values are restored in one bulk pass with PluginCore::setPIParamValues( ); no smoothing
 - see Designing Audio Effects in C++ 2nd Ed. by Will Pirkle for more information and a VST3 Programming Guide
 - see VST3 SDK Documentation for more information on this function and its parameters
 */
@@ -594,47 +653,31 @@ tresult PLUGIN_API VST3Plugin::setState(IBStream* fileStream)
 {
 	IBStreamer s(fileStream, kLittleEndian);
 	uint64 version = 0;
-	double data = 0;
 
 	// --- read the version
 	if(!s.readInt64u(version)) return kResultFalse;
 
-    // --- serialize
-	for (unsigned int i = 0; i < pluginCore->getPluginParameterCount(); i++)
-    {
-        PluginParameter* piParam = pluginCore->getPluginParameterByIndex(i);
-        
-        if(piParam)
-        {
-            if(!s.readDouble(data))
-                return kResultFalse;
-            else
-            {
-                // --- temp disable smoothing
-                bool smooth = piParam->getParameterSmoothing();
-                piParam->setParameterSmoothing(false);
+	if(version == 0)
+	{
+		// --- v0: index ordered values; a missing value means the file is damaged, so nothing is applied
+		if(!readLegacyState(s, pluginCore, stateValues)) return kResultFalse;
+		if(!s.readBool(plugInSideBypass)) return kResultFalse;
+
+		pluginCore->setPIParamValues(stateValues, false);
+	}
+	else
+	{
+		// --- v1 and later: the ID-keyed chunk
+		uint16_t flags = 0;
+		if(!readStateChunk(s, stateChunk)) return kResultFalse;
+		if(!pluginCore->setStateChunk(&stateChunk[0], stateChunk.size(), flags)) return kResultFalse;
+
+		plugInSideBypass = (flags & STATE_CHUNK_FLAG_BYPASS) != 0;
+	}
 
-                // --- init actual, no smooth
-                piParam->setControlValue(data);
-                
-                // --- reset
-                piParam->setParameterSmoothing(smooth);
-            }
-        }
-    }
-    
-    // --- add plugin side bypassing
-    if(!s.readBool(plugInSideBypass)) return kResultFalse;
-    
     // --- set the bypass state
     setParamNormalized (PLUGIN_SIDE_BYPASS, plugInSideBypass);
 
-    // --- do next version...
-    if(version >= 1)
-    {
-        // --- for future versioning
-    }
-
     return kResultTrue;
 }
 
@@ -661,24 +704,11 @@ tresult PLUGIN_API VST3Plugin::getState(IBStream* fileStream)
     //     your plugin without breaking older version saved states
 	if(!s.writeInt64u(VSTPluginVersion)) return kResultFalse;
 
-	// --- write out all of the params
-    // --- serialize
-	for (unsigned int i = 0; i < pluginCore->getPluginParameterCount(); i++)
-    {
-        PluginParameter* piParam = pluginCore->getPluginParameterByIndex(i);
-        
-        if(piParam)
-        {
-           if(!s.writeDouble(piParam->getControlValue()))
-               return kResultFalse;
-        }
-    }
-
-	// --- add plugin side bypassing
-	if(!s.writeBool(plugInSideBypass)) return kResultFalse;
+	// --- v1: the non-default values keyed by control ID, plus plugin side bypassing
+	pluginCore->getStateChunk(stateChunk, plugInSideBypass ? STATE_CHUNK_FLAG_BYPASS : 0);
 
-	// --- v1: for future use
-	//
+	if(!s.writeInt32u((uint32)stateChunk.size())) return kResultFalse;
+	if(s.writeRaw(&stateChunk[0], (TSize)stateChunk.size()) != (TSize)stateChunk.size()) return kResultFalse;
 
     return kResultTrue;
 }
@@ -854,6 +884,13 @@ NOTES:
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 tresult PLUGIN_API VST3Plugin::process(ProcessData& data)
 {
+    // --- flush denormals to zero for this process call (replaces the per-sample underflow
+    //     checks in fxobjects); the previous FPU mode is restored on return
+    ScopedDenormalGuard denormalGuard(DENORMAL_GUARD_ACTIVE != 0);
+
+    // --- debug/test builds: flag this thread as the audio thread (see rtauditor.h)
+    RT_AUDIT_SCOPE("VST3Plugin::process");
+
     // --- check for control chages and update if needed
     //     Changed for 3.6.14: this is moved to top of function for bypass persistence
     //     during testing
@@ -870,11 +907,21 @@ tresult PLUGIN_API VST3Plugin::process(ProcessData& data)
     else if (pluginCore->getPluginType() == kFXPlugin && (!data.inputs || !data.outputs))
         return kResultTrue;
 
-    // --- setup buffer processing
+    // --- setup buffer processing; 64-bit buffers are passed through unconverted
     ProcessBufferInfo info;
+    bool doublePrecision = data.symbolicSampleSize == kSample64;
  
-    info.inputs = isSynth ? nullptr : &data.inputs[0].channelBuffers32[0];
-    info.outputs = &data.outputs[0].channelBuffers32[0];
+    info.doublePrecision = doublePrecision;
+    if (doublePrecision)
+    {
+        info.inputs64 = isSynth ? nullptr : &data.inputs[0].channelBuffers64[0];
+        info.outputs64 = &data.outputs[0].channelBuffers64[0];
+    }
+    else
+    {
+        info.inputs = isSynth ? nullptr : &data.inputs[0].channelBuffers32[0];
+        info.outputs = &data.outputs[0].channelBuffers32[0];
+    }
     
     // --- setup channel formats
     SpeakerArrangement inputArr;
@@ -904,7 +951,10 @@ tresult PLUGIN_API VST3Plugin::process(ProcessData& data)
             // --- output = input
 			for (unsigned int i = 0; i<info.numAuxAudioOutChannels; i++)
             {
-                (data.outputs[0].channelBuffers32[i])[sample] = (data.inputs[0].channelBuffers32[i])[sample];
+                if (doublePrecision)
+                    (data.outputs[0].channelBuffers64[i])[sample] = (data.inputs[0].channelBuffers64[i])[sample];
+                else
+                    (data.outputs[0].channelBuffers32[i])[sample] = (data.inputs[0].channelBuffers32[i])[sample];
             }
         }
 
@@ -922,7 +972,10 @@ tresult PLUGIN_API VST3Plugin::process(ProcessData& data)
         if (bus && bus->isActive())
         {
             info.numAuxAudioInChannels = data.inputs[1].numChannels;
-            info.auxInputs = &data.inputs[1].channelBuffers32[0]; //** to sidechain
+            if (doublePrecision)
+                info.auxInputs64 = &data.inputs[1].channelBuffers64[0]; //** to sidechain
+            else
+                info.auxInputs = &data.inputs[1].channelBuffers32[0]; //** to sidechain
         }
     }
     
@@ -949,6 +1002,13 @@ tresult PLUGIN_API VST3Plugin::process(ProcessData& data)
     
     // --- process the buffers
     pluginCore->processAudioBuffers(info);
+
+    // --- tell the host when the whole buffer is silent
+    if (data.numOutputs > 0)
+    {
+        int32 numChannels = data.outputs[0].numChannels;
+        data.outputs[0].silenceFlags = info.outputSilent ? (numChannels >= 64 ? ~(uint64)0 : ((uint64)1 << numChannels) - 1) : 0;
+    }
    
     // --- update the meters
     updateMeters(data);
@@ -1121,33 +1181,27 @@ tresult PLUGIN_API VST3Plugin::setComponentState(IBStream* fileStream)
 {
     IBStreamer s(fileStream, kLittleEndian);
     uint64 version = 0;
-    double data = 0;
     
     // --- read the version
     if(!s.readInt64u(version)) return kResultFalse;
-    
-    // --- serialize
-	for (unsigned int i = 0; i < pluginCore->getPluginParameterCount(); i++)
-    {
-        PluginParameter* piParam = pluginCore->getPluginParameterByIndex(i);
-        
-        if(piParam)
-        {
-            if(!s.readDouble(data))
-                return kResultFalse;
-            else
-                setParamNormalizedFromFile(piParam->getControlID(), data);
-        }
-    }
-    
-    // --- add plugin side bypassing
-    if(!s.readBool(plugInSideBypass)) return kResultFalse;
-    
-    // --- do next version...
-    if(version >= 1)
-    {
-        // --- for future versioning
-    }
+
+	if(version == 0)
+	{
+		if(!readLegacyState(s, pluginCore, stateValues)) return kResultFalse;
+		if(!s.readBool(plugInSideBypass)) return kResultFalse;
+	}
+	else
+	{
+		// --- every parameter is set, including those left at their defaults in the chunk
+		uint16_t flags = 0;
+		if(!readStateChunk(s, stateChunk)) return kResultFalse;
+		if(!pluginCore->getStateChunkValues(&stateChunk[0], stateChunk.size(), stateValues, flags)) return kResultFalse;
+
+		plugInSideBypass = (flags & STATE_CHUNK_FLAG_BYPASS) != 0;
+	}
+
+	for (size_t i = 0; i < stateValues.size(); i++)
+		setParamNormalizedFromFile(stateValues[i].controlID, stateValues[i].actualValue);
 
 	return kResultTrue;
 }
@@ -1186,6 +1240,9 @@ tresult PLUGIN_API VST3Plugin::setParamNormalizedFromFile(ParamID tag, ParamValu
 \brief This is overridden for selecting a preset, this is also called when automating parameters
 
 NOTES:
+- a preset is posted to the core as one parameter snapshot, which the audio thread swaps in
+  at a block boundary; while processing is off it is swapped in by setActive(true), never on
+  this (controller) thread
 - see Designing Audio Effects in C++ 2nd Ed. by Will Pirkle for more information and a VST3 Programming Guide
 - see VST3 SDK Documentation for more information on this function and its parameters
 */
@@ -1200,15 +1257,16 @@ tresult PLUGIN_API VST3Plugin::setParamNormalized(ParamID tag, ParamValue value)
 	{
 		int32 program = parameters.getParameter(tag)->toPlain(value);
 
-        PresetInfo* preset = pluginCore->getPreset(program);
+        // --- the core: one snapshot, applied all at once by the audio side
+        if(pluginCore)
+            pluginCore->postPresetSnapshot(program);
+
+        const PresetInfo* preset = pluginCore ? pluginCore->getPreset(program) : nullptr;
         if(preset)
         {
 			for (unsigned int j = 0; j<preset->presetParameters.size(); j++)
             {
                 PresetParameter preParam = preset->presetParameters[j];
-                
-                if(pluginCore)
-                    pluginCore->setPIParamValue(preParam.controlID, preParam.actualValue);
 
                 ParamValue normalizedValue = plainParamToNormalized(preParam.controlID, preParam.actualValue);
                
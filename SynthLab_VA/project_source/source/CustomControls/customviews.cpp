@@ -168,7 +168,6 @@ void WaveView::draw(CDrawContext* pContext)
     }
 }
 
-#ifdef HAVE_FFTW
 /**
 \brief SpectrumView constructor
 
@@ -194,13 +193,11 @@ SpectrumView::SpectrumView(const VSTGUI::CRect& size, IControlListener* listener
     // --- buffer being drawn, only ever used by draw code
     currentFFTMagBuffer = nullptr;
 
-    // --- FFTW inits
-    data        = (fftw_complex*) fftw_malloc(sizeof(fftw_complex) * FFT_LEN);
-    fft_result  = (fftw_complex*) fftw_malloc(sizeof(fftw_complex) * FFT_LEN);
-    ifft_result = (fftw_complex*) fftw_malloc(sizeof(fftw_complex) * FFT_LEN);
+    // --- FFTW inits: real FFT, FFT_LEN samples in, FFT_LEN/2 + 1 bins out
+    data        = (double*) fftw_malloc(sizeof(double) * FFT_LEN);
+    fft_result  = (fftw_complex*) fftw_malloc(sizeof(fftw_complex) * (FFT_LEN/2 + 1));
 
-    plan_forward  = fftw_plan_dft_1d(FFT_LEN, data, fft_result, FFTW_FORWARD, FFTW_ESTIMATE);
-    plan_backward = fftw_plan_dft_1d(FFT_LEN, fft_result, ifft_result, FFTW_BACKWARD, FFTW_ESTIMATE);
+    plan_forward  = fftw_plan_dft_r2c_1d(FFT_LEN, data, fft_result, FFTW_ESTIMATE);
 
     // --- window
     setWindow(spectrumViewWindowType::kBlackmanHarrisWindow);
@@ -209,11 +206,9 @@ SpectrumView::SpectrumView(const VSTGUI::CRect& size, IControlListener* listener
 SpectrumView::~SpectrumView()
 {
     fftw_destroy_plan( plan_forward );
-    fftw_destroy_plan( plan_backward );
 
     fftw_free( data );
     fftw_free( fft_result );
-    fftw_free( ifft_result );
 
 	if (dataQueue)
 		delete dataQueue;
@@ -258,8 +253,7 @@ bool SpectrumView::addFFTInputData(double inputSample)
     if(fftInputCounter >= FFT_LEN)
         return false;
 
-    data[fftInputCounter][0] = inputSample*fftWindow[fftInputCounter]; // stick your audio samples in here
-    data[fftInputCounter][1] = 0.0; // use this if your data is complex valued
+    data[fftInputCounter] = inputSample*fftWindow[fftInputCounter]; // stick your audio samples in here
 
     fftInputCounter++;
     if(fftInputCounter == FFT_LEN)
@@ -312,14 +306,15 @@ void SpectrumView::updateView()
             return;
         }
 
+        // --- half spectrum: the upper bins of a real signal are the mirror image
         int maxIndex = 0;
-        for(int i=0; i<FFT_LEN; i++)
+        for(int i=0; i<FFT_LEN/2 + 1; i++)
         {
             bufferToFill[i] = (getMagnitude(fft_result[i][0], fft_result[i][1]));
         }
 
         // --- normalize the FFT buffer for max = 1.0 (note this is NOT dB!!)
-        normalizeBufferGetFMax(bufferToFill, 512, &maxIndex);
+        normalizeBufferGetFMax(bufferToFill, FFT_LEN/2 + 1, &maxIndex);
 
         // 1) homework = do plot in dB
         // 2) homework = add other windows
@@ -423,8 +418,6 @@ void SpectrumView::draw(CDrawContext* pContext)
     }
 }
 
-#endif
-
 /**
 \brief CustomKnobView constructor
 
@@ -303,6 +303,9 @@ Use this strongly typed enum to easily set the control's linked variable datatyp
 */
 enum class boundVariableType { kFloat, kDouble, kInt, kUInt };
 
+// --- smoothers snap to their target once they are this close to it, as a fraction of the control range
+const double kSmoothingSettleEpsilon = 1.0e-4;
+
 /**
 \class ParamSmoother
 \ingroup ASPiK-GUI
@@ -310,6 +313,10 @@ enum class boundVariableType { kFloat, kDouble, kInt, kUInt };
 \brief
 The ParamSmoother object performs parameter smoothing on GUI control information. You can choose linear or exponential smoothing.
 
+- the exponential (LPF) smoother never quite reaches its target, so it snaps to it once it is within
+  the settle epsilon (a fraction of the control range, see setSettleEpsilon( )); smoothParameter( )
+  then returns false until the target moves again
+
 \author Will Pirkle http://www.willpirkle.com
 \remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
 \version Revision : 1.0
@@ -336,6 +343,15 @@ public:
 		linInc = (maxVal - minVal) / (smoothingTimeInMSec * 0.001 * sampleRate);
 	}
 
+	/** set the settle epsilon
+	\param relativeEpsilon the LPF smoother snaps to its target within this fraction of the control range
+	*/
+	void setSettleEpsilon(T relativeEpsilon)
+	{
+		settleEpsilon = relativeEpsilon;
+		settleThreshold = fabs(maxVal - minVal) * settleEpsilon;
+	}
+
 	/** initialize the smoother; this recalculates internal coefficients
 	\param smoothingTimeInMs the smoothing time in mSec to move from the two control extrema (min and max values)
 	\param samplingRate the new sampling rate
@@ -343,20 +359,24 @@ public:
 	\param minControlValue minimum numerical value control takes
 	\param maxControlValue maximum numerical value control takes
 	\param smoother type of smoothing
+	\param relativeEpsilon settle epsilon, as a fraction of the control range
 	*/
 	void initParamSmoother(T smoothingTimeInMs,
 		T samplingRate,
 		T initValue,
 		T minControlValue,
 		T maxControlValue,
-		smoothingMethod smoother = smoothingMethod::kLPFSmoother)
+		smoothingMethod smoother = smoothingMethod::kLPFSmoother,
+		T relativeEpsilon = kSmoothingSettleEpsilon)
 	{
 		minVal = minControlValue;
 		maxVal = maxControlValue;
 		sampleRate = samplingRate;
 		smoothingTimeInMSec = smoothingTimeInMs;
+		smootherType = smoother;
 
 		setSampleRate(samplingRate);
+		setSettleEpsilon(relativeEpsilon);
 
 		// --- storage
 		z = initValue;
@@ -372,14 +392,18 @@ public:
 	{
 		if (smootherType == smoothingMethod::kLPFSmoother)
 		{
-			z = (in * b) + (z * a);
-			if (z == z2)
+			if (z == in)
 			{
 				out = in;
 				return false;
 			}
+
+			// --- the last step lands exactly on the target so the caller gets the final value
+			z = (in * b) + (z * a);
+			if (fabs(in - z) <= settleThreshold)
+				z = in;
 			z2 = z;
-			out = z2;
+			out = z;
 			return true;
 		}
 		else // if (smootherType == smoothingMethod::kLinearSmoother)
@@ -404,6 +428,15 @@ public:
 		}
 	}
 
+	/** jump to a value without smoothing (e.g. after a state restore)
+	\param value the new settled value
+	*/
+	void snapTo(T value)
+	{
+		z = value;
+		z2 = value;
+	}
+
 private:
 	T a = 0.0;		///< a coefficient for smoothing
 	T b = 0.0;		///< b coefficient for smoothing
@@ -412,6 +445,9 @@ private:
 
 	T linInc = 0.0;	///< linear stepping value
 
+	T settleEpsilon = kSmoothingSettleEpsilon;	///< settle distance as a fraction of the range
+	T settleThreshold = kSmoothingSettleEpsilon;	///< settle distance in control units
+
 	T minVal = 0.0;	///< min extrema
 	T maxVal = 1.0;	///< max exrema
 
@@ -0,0 +1,125 @@
+// -----------------------------------------------------------------------------
+//    ASPiK Plugin Kernel File:  parametersnapshot.h
+//
+/**
+    \file   parametersnapshot.h
+    \author Will Pirkle
+    \date   17-September-2018
+    \brief  interface file for the lock-free parameter snapshot exchange (preset changes)
+    		- http://www.aspikplugins.com
+    		- http://www.willpirkle.com
+*/
+// -----------------------------------------------------------------------------
+#ifndef _ParameterSnapshot_H_
+#define _ParameterSnapshot_H_
+
+#include <algorithm>
+#include <atomic>
+#include <stdint.h>
+#include <vector>
+
+/**
+\struct ParameterSnapshot
+\ingroup ASPiK-Core
+\brief
+A complete parameter state (one value per parameter, in parameter array order) and the parameters
+whose values differ from the state it was built against, so a swap only touches those.
+*/
+struct ParameterSnapshot
+{
+	std::vector<double> values;		///< one value per parameter
+	std::vector<uint64_t> changed;	///< one bit per parameter: the value differs, so the swap writes it
+	uint32_t numChanged = 0;		///< set bits in changed
+
+	/** allocate and clear; NOT realtime safe */
+	void create(uint32_t numValues)
+	{
+		values.assign(numValues, 0.0);
+		changed.assign((numValues + 63) / 64, 0);
+		numChanged = 0;
+	}
+
+	/** clear the changed bits before a new snapshot is built */
+	void clearChanged()
+	{
+		std::fill(changed.begin(), changed.end(), 0);
+		numChanged = 0;
+	}
+
+	/** flag a value that the swap must write */
+	void setChanged(uint32_t index)
+	{
+		changed[index >> 6] |= (uint64_t)1 << (index & 63);
+		numChanged++;
+	}
+};
+
+/**
+\class ParameterSnapshotExchange
+\ingroup ASPiK-Core
+\brief
+Hands complete parameter snapshots (ParameterSnapshot) from a non-realtime thread to the audio thread.
+
+ParameterSnapshotExchange Operations:
+- triple buffer: the writer fills its own snapshot and publish( ) swaps it with the middle one;
+  the reader's acquire( ) swaps its own snapshot with the middle one; both are a single atomic
+  exchange of an index, so neither side ever waits, allocates or frees
+- a snapshot that is published before the previous one was read replaces it (newest wins)
+- one writer at a time: the caller serializes the writer side (see PluginBase::postParameterSnapshot( ))
+- create( ) is NOT realtime safe and must not run while either side is in use
+
+\author Will Pirkle http://www.willpirkle.com
+\remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
+\version Revision : 1.0
+\date Date : 2018 / 09 / 7
+*/
+class ParameterSnapshotExchange
+{
+public:
+	ParameterSnapshotExchange() : middle(2) {}
+
+	/** allocate the three snapshots; NOT realtime safe */
+	void create(uint32_t numValues)
+	{
+		for (uint32_t i = 0; i < 3; i++)
+			snapshots[i].create(numValues);
+
+		writeIndex = 0;
+		readIndex = 1;
+		middle.store(2);
+	}
+
+	/** writer: the snapshot to fill before publish( ) */
+	ParameterSnapshot& getWriteSnapshot() { return snapshots[writeIndex]; }
+
+	/** writer: hand the filled snapshot to the reader */
+	void publish() { writeIndex = middle.exchange(writeIndex | kFreshFlag) & kIndexMask; }
+
+	/** reader: true if a snapshot was published since the last acquire( ) */
+	bool isPending() { return (middle.load() & kFreshFlag) != 0; }
+
+	/** reader: take the newest snapshot; nullptr if there is nothing new */
+	const ParameterSnapshot* acquire()
+	{
+		if (!isPending())
+			return nullptr;
+
+		readIndex = middle.exchange(readIndex) & kIndexMask;
+		return &snapshots[readIndex];
+	}
+
+protected:
+	static const uint32_t kIndexMask = 0x03;	///< snapshot index bits
+	static const uint32_t kFreshFlag = 0x04;	///< the middle snapshot has not been read
+
+	ParameterSnapshot snapshots[3];		///< writer, middle and reader snapshots
+	uint32_t writeIndex = 0;			///< writer side only
+	uint32_t readIndex = 1;				///< reader side only
+	std::atomic<uint32_t> middle;		///< middle index | kFreshFlag
+
+private:
+	ParameterSnapshotExchange(const ParameterSnapshotExchange&);
+	ParameterSnapshotExchange& operator=(const ParameterSnapshotExchange&);
+};
+
+#endif /* defined(_ParameterSnapshot_H_) */
@@ -193,6 +193,11 @@ The AAX plugin shell consists of the following files:
 #define __PluginBase__
 
 #include "pluginparameter.h"
+#include "blocksmoother.h"
+#include "presetcatalog.h"
+#include "pluginstate.h"
+#include "parametersnapshot.h"
+#include "parameterchangeset.h"
 
 #include <map>
 
@@ -210,6 +215,7 @@ PluginBase Operations:
 	- AudioProcDescriptor audioProcDescriptor - describes the currently loaded DAW session's audio (WAV) file param; is always available to any plugin function
 	- APISpecificInfo apiSpecificInfo - contains api-specific description strings, code numbers, and other details.
 - implements the buffer processing function; this method breaks the incoming and outgoing buffers into frames, and then calls your plugin core frame processing function.
+- shares one factory PresetCatalog among all instances; it is built by the first instance that asks for a preset
 - you should not need to edit this object - all work should be done in the PluginCore object
 
 
@@ -253,6 +259,12 @@ public:
 	/** Buffer Proc Cycle: I connects GUI control changes to bound variables (part of ASPiK input variable binding option) */
 	void syncInBoundVariables();
 
+	/** parameters visited by the last syncInBoundVariables( ) */
+	uint32_t getInBoundUpdateCount() { return inBoundUpdateCount; }
+
+	/** parameters visited by all syncInBoundVariables( ) calls so far */
+	uint64_t getTotalInBoundUpdates() { return totalInBoundUpdates; }
+
 	/** Buffer Proc Cycle: II PluginCore overrides this method to process frames */
 	virtual bool processAudioBuffers(ProcessBufferInfo& processInfo);
 
@@ -271,9 +283,48 @@ public:
 	/** perform parameter smoothing or VST3 sample accurate upates */
 	void doSampleAccurateParameterUpdates();
 
+	/** smoothable parameters doSampleAccurateParameterUpdates( ) is still visiting */
+	uint32_t getActiveSmoothingCount() { return numActiveSmoothingSlots; }
+
+	/** perform parameter smoothing or VST3 sample accurate upates once for a whole block */
+	void doBlockParameterUpdates(uint32_t numSamples);
+
+	/** set up the block smoother slots for the smoothable parameters */
+	void initBlockParamSmoother(double sampleRate);
+
+	/** add a bound variable to a change tracking group; call after initPluginParameterArray( ) */
+	void addBoundVariableGroup(uint32_t controlID, uint32_t group);
+
+	/**
+	\brief query whether any bound variable in a group changed since the last clearBoundVariableChanges( )
+
+	\param group the group index (0 to MAX_BOUND_VARIABLE_GROUPS - 1)
+
+	\return true if the group needs updating
+	*/
+	bool boundVariableGroupChanged(uint32_t group) { return (changedBoundVariableGroups & ((uint64_t)1 << group)) != 0; }
+
+	/** true if any group changed */
+	bool anyBoundVariableGroupChanged() { return changedBoundVariableGroups != 0; }
+
+	/** clear the changed groups; call after the changed groups have been consumed */
+	void clearBoundVariableChanges() { changedBoundVariableGroups = 0; }
+
+	/** flag every group as changed, e.g. after a reset or state change */
+	void setAllBoundVariablesChanged() { changedBoundVariableGroups = ~(uint64_t)0; }
+
+	/** flag one group as changed, e.g. when a setting outside the parameters changes what it pushes */
+	void setBoundVariableGroupChanged(uint32_t group) { if (group < MAX_BOUND_VARIABLE_GROUPS) changedBoundVariableGroups |= ((uint64_t)1 << group); }
+
+	/** number of bound variables added to a group */
+	uint32_t getBoundVariableGroupSize(uint32_t group) { return group < MAX_BOUND_VARIABLE_GROUPS ? boundVariableGroupSize[group] : 0; }
+
 	/** only for a vector joystick control from DAW that implements it (reserved for future use): base class implementation is empty */
 	virtual bool setVectorJoystickParameters(const VectorJoystickData& vectorJoysickData) { return true; }
 
+	/** fill the shared factory preset catalog; called once per process: base class implementation is empty */
+	virtual bool initPluginPresets(PresetCatalog& presetCatalog) { return false; }
+
 	/** helper function to add a new plugin parameter to the variety of lists */
 	int32_t addPluginParameter(PluginParameter* piParam, double sampleRate = 44100);
 
@@ -293,13 +344,38 @@ public:
 	PluginParameter* getPluginParameterByIndex(int32_t index) { return pluginParameters[index]; }
 
 	/**
-	\brief get a parameter by control ID - uses map (slowest)
+	\brief get a parameter by control ID
+
+	Operation:
+	- O(1) and realtime safe once initPluginParameterArray( ) has built the parameter index
+	- before that (i.e. during construction) the map is searched; unknown IDs are never inserted
 
 	\param controlID the control ID of the parameter
 
-	\return a naked pointer to the PluginParameter object
+	\return a naked pointer to the PluginParameter object, or nullptr if there is none
 	*/
-	PluginParameter* getPluginParameterByControlID(int32_t controlID) { return pluginParameterMap[controlID]; }
+	PluginParameter* getPluginParameterByControlID(int32_t controlID)
+	{
+		uint32_t id = (uint32_t)controlID;
+		if (!parameterIndexValid)
+		{
+			pluginParameterControlIDMap::iterator it = pluginParameterMap.find(id);
+			return it != pluginParameterMap.end() ? it->second : nullptr;
+		}
+
+		// --- regular IDs: two-level table, pages are only allocated where IDs exist
+		if (id < numParameterIndexPages << PARAMETER_INDEX_PAGE_BITS)
+		{
+			PluginParameter** page = parameterIndexPages[id >> PARAMETER_INDEX_PAGE_BITS];
+			return page ? page[id & (PARAMETER_INDEX_PAGE_SIZE - 1)] : nullptr;
+		}
+
+		// --- reserved IDs (PLUGIN_SIDE_BYPASS, SCALE_GUI_SIZE, etc...)
+		if (id >= PLUGIN_SIDE_BYPASS && id < CUSTOM_VIEW_BASE)
+			return reservedParameterIndex[id - PLUGIN_SIDE_BYPASS];
+
+		return nullptr;
+	}
 
 	/** get a parameter by type - used to find all meter variables for writing to GUI */
 	PluginParameter* getNextParameterOfType(int32_t& startIndex, controlVariableType controlType);
@@ -400,22 +476,40 @@ public:
 
 	\return preset count
 	*/
-	size_t getPresetCount(){return presets.size();}
+	size_t getPresetCount(){return getPresetCatalog()->getPresetCount();}
 
 	/** get preset name	*/
 	const char* getPresetName(uint32_t index);
 
-	/** add preset	*/
-	size_t addPreset(PresetInfo* preset);
+	/** get a preset pointer; the preset is owned by the shared catalog	*/
+	const PresetInfo* getPreset(uint32_t index);
+
+	/** get the shared preset catalog, building it on first use */
+	PresetCatalog* getPresetCatalog();
+
+	/** write the parameter state as a compact, controlID keyed chunk (non-default values only) */
+	void getStateChunk(std::vector<uint8_t>& chunk, uint16_t flags = 0);
+
+	/** restore the parameter state from a chunk; false if it is not a valid chunk (nothing is changed) */
+	bool setStateChunk(const uint8_t* chunk, size_t size, uint16_t& flags);
+
+	/** decode a chunk into the full value list (defaults filled in), in parameter order */
+	bool getStateChunkValues(const uint8_t* chunk, size_t size, std::vector<PresetParameter>& values, uint16_t& flags);
+
+	/** bulk restore: set many parameter values in one pass without smoothing */
+	void setPIParamValues(const std::vector<PresetParameter>& values, bool resetToDefaults = true);
 
-	/** remove preset	*/
-	void removePreset(uint32_t index);
+	/** post a complete parameter snapshot for the audio thread; NOT realtime safe */
+	bool postParameterSnapshot(const std::vector<PresetParameter>& values, bool resetToDefaults = true);
 
-	/** remove all presets	*/
-	void removeAllPresets();
+	/** post a factory preset as a parameter snapshot; NOT realtime safe */
+	bool postPresetSnapshot(uint32_t presetIndex);
 
-	/** get a preset pointner	*/
-	PresetInfo* getPreset(uint32_t index);
+	/** audio thread: true if a posted snapshot is waiting */
+	bool isParameterSnapshotPending() { return parameterSnapshots.isPending(); }
+
+	/** audio thread: swap in the newest posted snapshot */
+	bool applyParameterSnapshot();
 
 	/** prepare all parameter lists	*/
 	void initPluginParameterArray();
@@ -601,9 +695,41 @@ protected:
 	uint32_t numPluginParameters = 0;							///< total number of parameters
 	PluginParameter** smoothablePluginParameters = nullptr;		///< old-fashioned C-arrays of pointers for smoothable parameters
 	uint32_t numSmoothablePluginParameters = 0;					///< number of smoothable parameters only
+	BlockParamSmoother blockParamSmoother;						///< block smoother; slot i belongs to smoothablePluginParameters[i]
+	uint32_t* smoothableSlotOfParameter = nullptr;				///< pluginParameterArray index -> smoothablePluginParameters index, numSmoothablePluginParameters = none
+	uint32_t* activeSmoothingSlots = nullptr;					///< smoothablePluginParameters indexes of the per-sample smoothers that are moving
+	int32_t* activeSmoothingIndex = nullptr;					///< smoothablePluginParameters index -> activeSmoothingSlots index, -1 = idle
+	uint32_t numActiveSmoothingSlots = 0;						///< number of moving per-sample smoothers
+	void activateSmoothingSlot(uint32_t slot);
+	void deactivateSmoothingSlot(uint32_t index);
+	ParameterChangeSet parameterQueueChanges;					///< one flag per pluginParameterArray entry; set when a VST3 update queue is attached
+	uint32_t* queuedSmoothingSlots = nullptr;					///< smoothablePluginParameters indexes with a VST3 update queue for the current buffer
+	uint32_t numQueuedSmoothingSlots = 0;						///< number of queued parameters
 	PluginParameter** outboundPluginParameters = nullptr;		///< old-fashioned C-arrays of pointers for outbound (meter) parameters
 	uint32_t numOutboundPluginParameters = 0;					///< total number of outbound (meter) parameters
 
+	// --- bulk state restore
+	void snapParameterSmoothing();
+	std::vector<PresetParameter> stateChunkValues;				///< decoded chunk values; kept to reuse the memory
+	std::atomic<bool> smoothingSnapPending;						///< set by setPIParamValues( ), consumed by syncInBoundVariables( )
+
+	// --- preset snapshots: built off the audio thread, swapped in at a block boundary
+	ParameterSnapshotExchange parameterSnapshots;				///< one value per pluginParameterArray entry and the changed flags
+	std::unordered_map<uint32_t, uint32_t> parameterArrayIndex;	///< controlID -> pluginParameterArray index; snapshot writer only
+	std::mutex parameterSnapshotMutex;							///< one snapshot writer at a time
+
+	// --- inbound sync: only the parameters flagged since the last sync are visited
+	ParameterChangeSet parameterChanges;						///< one flag per pluginParameterArray entry; set by the parameter setters
+	uint32_t inBoundUpdateCount = 0;							///< parameters visited by the last sync
+	uint64_t totalInBoundUpdates = 0;							///< parameters visited by all syncs
+
+	// --- bound variable change tracking
+	void setBoundVariableChanged(uint32_t controlID);
+	uint64_t* boundVariableGroupMasks = nullptr;				///< old-fashioned C-array of group masks, indexed by control ID
+	uint32_t numBoundVariableGroupMasks = 0;					///< control IDs at or above this belong to every group
+	uint32_t boundVariableGroupSize[MAX_BOUND_VARIABLE_GROUPS] = { 0 };	///< number of bound variables in each group
+	uint64_t changedBoundVariableGroups = ~(uint64_t)0;		///< one bit per changed group; all set at startup
+
     // --- vectorized version of pluginParameterMap for fast iteration when key not needed
     std::vector<PluginParameter*> pluginParameters;				///< vector version of parameter list
 
@@ -611,11 +737,16 @@ protected:
     typedef std::map<uint32_t, PluginParameter*> pluginParameterControlIDMap;	///< map version of parameter list
     pluginParameterControlIDMap pluginParameterMap;								///< member map of parameter list
 
+	// --- immutable controlID -> parameter index for realtime lookups; built in initPluginParameterArray( )
+	void buildParameterIndex();
+	void destroyParameterIndex();
+	PluginParameter*** parameterIndexPages = nullptr;			///< controlID >> PARAMETER_INDEX_PAGE_BITS -> page (nullptr if the page has no parameters)
+	uint32_t numParameterIndexPages = 0;						///< number of pages; regular IDs at or above numParameterIndexPages * page size are unknown
+	PluginParameter* reservedParameterIndex[CUSTOM_VIEW_BASE - PLUGIN_SIDE_BYPASS] = { nullptr }; ///< reserved IDs, offset by PLUGIN_SIDE_BYPASS
+	bool parameterIndexValid = false;							///< false until built and after parameters are added
+
     // --- plugin core -> host (wrap) connector
     IPluginHostConnector* pluginHostConnector = nullptr;						///< created and destroyed on host
-
-    // --- PRESETS
-    std::vector<PresetInfo*> presets;	///< preset list
 };
 
 #endif /* defined(__PluginBase__) */
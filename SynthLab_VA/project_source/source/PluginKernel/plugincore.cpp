@@ -21,7 +21,7 @@ Operations:
 - initialize the plugin description (strings, codes, numbers, see initPluginDescriptors())
 - setup the plugin's audio I/O channel support
 - create the PluginParameter objects that represent the plugin parameters (see FX book if needed)
-- create the presets
+- NOTE: the presets are not created here; the first instance that asks for one builds the shared catalog
 */
 PluginCore::PluginCore()
 {
@@ -49,8 +49,8 @@ PluginCore::PluginCore()
 	// --- create the parameters
     initPluginParameters();
 
-    // --- create the presets
-    initPluginPresets();
+	// --- tag the bound variables with the parameter structures they feed
+	initParameterGroups();
 
 	// --- setup dynamic module types
 	dynModuleManager.addLoadableModule(SynthLab::LFO_MODULE);
@@ -1316,6 +1316,53 @@ bool PluginCore::initPluginParameters()
 	piParam = new PluginParameter(controlID::MAIN_SWITCHER, "MAIN_SWITCHER");
 	addPluginParameter(piParam);
 
+	// --- meter control: Gov Load
+	piParam = new PluginParameter(controlID::governorLoad, "Gov Load", 10.00, 500.00, ENVELOPE_DETECT_MODE_PEAK, meterCal::kLinearMeter);
+	piParam->setBoundVariable(&governorLoad, boundVariableType::kFloat);
+	addPluginParameter(piParam);
+
+	// --- meter control: Gov Level
+	piParam = new PluginParameter(controlID::governorLevel, "Gov Level", 10.00, 500.00, ENVELOPE_DETECT_MODE_PEAK, meterCal::kLinearMeter);
+	piParam->setBoundVariable(&governorLevel, boundVariableType::kFloat);
+	addPluginParameter(piParam);
+
+	// --- meter control: Gov Voices
+	piParam = new PluginParameter(controlID::governorVoices, "Gov Voices", 10.00, 500.00, ENVELOPE_DETECT_MODE_PEAK, meterCal::kLinearMeter);
+	piParam->setBoundVariable(&governorVoices, boundVariableType::kFloat);
+	addPluginParameter(piParam);
+
+#if SYNTHLAB_PROFILER
+	// --- meter control: Prof Params
+	piParam = new PluginParameter(controlID::profileParameters, "Prof Params", 10.00, 500.00, ENVELOPE_DETECT_MODE_PEAK, meterCal::kLinearMeter);
+	piParam->setBoundVariable(&profileParameters, boundVariableType::kFloat);
+	addPluginParameter(piParam);
+
+	// --- meter control: Prof MIDI
+	piParam = new PluginParameter(controlID::profileMidi, "Prof MIDI", 10.00, 500.00, ENVELOPE_DETECT_MODE_PEAK, meterCal::kLinearMeter);
+	piParam->setBoundVariable(&profileMidi, boundVariableType::kFloat);
+	addPluginParameter(piParam);
+
+	// --- meter control: Prof Update
+	piParam = new PluginParameter(controlID::profileUpdateParameters, "Prof Update", 10.00, 500.00, ENVELOPE_DETECT_MODE_PEAK, meterCal::kLinearMeter);
+	piParam->setBoundVariable(&profileUpdateParameters, boundVariableType::kFloat);
+	addPluginParameter(piParam);
+
+	// --- meter control: Prof Render
+	piParam = new PluginParameter(controlID::profileRender, "Prof Render", 10.00, 500.00, ENVELOPE_DETECT_MODE_PEAK, meterCal::kLinearMeter);
+	piParam->setBoundVariable(&profileRender, boundVariableType::kFloat);
+	addPluginParameter(piParam);
+
+	// --- meter control: Prof Output
+	piParam = new PluginParameter(controlID::profileOutputCopy, "Prof Output", 10.00, 500.00, ENVELOPE_DETECT_MODE_PEAK, meterCal::kLinearMeter);
+	piParam->setBoundVariable(&profileOutputCopy, boundVariableType::kFloat);
+	addPluginParameter(piParam);
+
+	// --- meter control: Prof Meters
+	piParam = new PluginParameter(controlID::profileOutBound, "Prof Meters", 10.00, 500.00, ENVELOPE_DETECT_MODE_PEAK, meterCal::kLinearMeter);
+	piParam->setBoundVariable(&profileOutBound, boundVariableType::kFloat);
+	addPluginParameter(piParam);
+#endif
+
 	// --- Aux Attributes
 	AuxParameterAttribute auxAttribute;
 
@@ -2970,6 +3017,19 @@ bool PluginCore::reset(ResetInfo& resetInfo)
 
    	// --- reset engine
 	synthEngine->reset(resetInfo.sampleRate);
+	for (uint32_t shard = 1; shard < renderShardCount; shard++)
+		renderShards[shard].engine->reset(resetInfo.sampleRate);
+	shardNoteRouter.reset(renderShardCount);
+	silenceDetector.reset(resetInfo.sampleRate);
+	presetFader.reset(resetInfo.sampleRate);
+#if SYNTHLAB_PROFILER
+	stageProfiler.reset();
+#endif
+	voiceGovernor.reset(resetInfo.sampleRate, synthEngine->getVoiceCount() * renderShardCount);
+	idleBlockCount.store(0, std::memory_order_relaxed);
+
+	// --- the engines start over; push every parameter structure on the next block
+	setAllBoundVariablesChanged();
 
 	// --- other reset inits
     return PluginBase::reset(resetInfo);
@@ -2988,6 +3048,24 @@ void PluginCore::enableParamSmoothing(bool enable)
 	}
 }
 
+/**
+\brief load the dynamic modules into every voice of an engine (DM builds only)
+
+\param engine the main synth engine or a render shard's engine
+\param modulePath path to the SynthLabModules folder
+*/
+void PluginCore::loadDynamicModules(SynthLab::SynthEngine* engine, const std::string& modulePath)
+{
+	uint32_t voiceCount = engine->getVoiceCount();
+	for (uint32_t i = 0; i < voiceCount; i++)
+	{
+		uint32_t count = dynModuleManager.loadAllDynamicModulesInFolder(modulePath);
+		// --- load if existing
+		if (count > 0 && dynModuleManager.haveDynamicModules())
+			engine->setDynamicModules(dynModuleManager.getDynamicModules(), i);
+	}
+}
+
 /**
 \brief one-time initialize function called after object creation and before the first reset( ) call
 
@@ -2998,7 +3076,6 @@ bool PluginCore::initialize(PluginInfo& pluginInfo)
 {
 	SynthLab::DMConfig config;
 	std::string path = pluginInfo.pathToDLL;
-	uint32_t count = 0;
 	std::string basePath;
 
 	// --- if something is horribly wrong, the synth will revert to normal mode
@@ -3021,24 +3098,18 @@ bool PluginCore::initialize(PluginInfo& pluginInfo)
 
 	// --- SYNTH ENGINE CREATION --- //
 	//
-	// --- prepare output buffers/block size 
-	processBlockInfo.blockSize = 64;
+	// --- prepare output buffers/block size; allocated for the largest quantum
+	//     so the render quantum can change without re-creating the engine
+	processBlockInfo.blockSize = MAX_RENDER_QUANTUM;
+	setRenderQuantum(kRenderQuantum);
+	setEnableAdaptiveRenderQuantum(kAdaptiveRenderQuantum);
 
 	// --- creation mechanism
 	synthEngine.reset(new SynthLab::SynthEngine(processBlockInfo.blockSize, &config));
 
 	// --- now try to load the DM modules
 	if (pluginInfo.pathToDLL && config.dm_build)
-	{
-		uint32_t voiceCount = synthEngine->getVoiceCount();
-		for (uint32_t i = 0; i < voiceCount; i++)
-		{
-			count = dynModuleManager.loadAllDynamicModulesInFolder(basePath + "/SynthLabModules");
-			// --- load if existing
-			if (count > 0 && dynModuleManager.haveDynamicModules())
-				synthEngine->setDynamicModules(dynModuleManager.getDynamicModules(), i);
-		}
-	}
+		loadDynamicModules(synthEngine.get(), basePath + "/SynthLabModules");
 
 	// --- dynamic string supporting object (this is OPTIONAL and can be omitted for non DM synths)
 	dynStringManager.reset(new DynamicStringManager(synthEngine, this));
@@ -3050,11 +3121,53 @@ bool PluginCore::initialize(PluginInfo& pluginInfo)
 	// --- setup audio buffers
 	synthBlockProcInfo.init(SynthLab::NO_CHANNELS,			/* num input channels = 0 */
 							SynthLab::STEREO_CHANNELS,		/* num output channels = 2 */
-							processBlockInfo.blockSize);	/* audio block process size = 64 */
+							processBlockInfo.blockSize);	/* audio block capacity = MAX_RENDER_QUANTUM */
 
 	// --- initializer
 	synthEngine->initialize(path.c_str());
 
+	// --- optional parallel render shards: each is a complete engine with its own voices
+	renderShardCount = kRenderShardCount;
+	if (renderShardCount < 1) renderShardCount = 1;
+	if (renderShardCount > MAX_RENDER_JOBS) renderShardCount = MAX_RENDER_JOBS;
+
+	for (uint32_t shard = 1; shard < renderShardCount; shard++)
+	{
+		renderShards[shard].engine.reset(new SynthLab::SynthEngine(processBlockInfo.blockSize, &config));
+		if (pluginInfo.pathToDLL && config.dm_build)
+			loadDynamicModules(renderShards[shard].engine.get(), basePath + "/SynthLabModules");
+		renderShards[shard].engine->getParameters(renderShards[shard].engineParameters);
+		renderShards[shard].voiceParameters = renderShards[shard].engineParameters->voiceParameters;
+		renderShards[shard].synthProcInfo.init(SynthLab::NO_CHANNELS, SynthLab::STEREO_CHANNELS, processBlockInfo.blockSize);
+		renderShards[shard].engine->initialize(path.c_str());
+	}
+	shardNoteRouter.reset(renderShardCount);
+
+	// --- sample accurate MIDI resolution
+	midiSubBlockScheduler.setMinSubBlockSize(kMinMidiSubBlockSize);
+
+	// --- zero-copy output; remember the synth's own buffers so they can be put back
+	enableZeroCopyRender = kZeroCopyRender;
+	float** synthOutputs = synthBlockProcInfo.getOutputBuffers();
+	for (uint32_t channel = 0; channel < SynthLab::STEREO_CHANNELS; channel++)
+		ownedSynthOutputs[channel] = synthOutputs[channel];
+
+	// --- skip rendering while nothing can sound
+	enableIdleRenderSkip = kIdleRenderSkip;
+
+	// --- fade around preset swaps
+	presetFader.setFadeTime_mSec(kPresetFadeTime_mSec);
+
+	// --- step quality down instead of missing block deadlines
+	voiceGovernor.setEnabled(kVoiceGovernor);
+
+	// --- grow the synth MIDI queues now rather than on the audio thread
+	reserveSynthMidiEvents();
+
+	// --- the audio thread is the last worker
+	if (renderShardCount > 1)
+		renderWorkerPool.start(renderShardCount - 1);
+
 	return true;
 }
 
@@ -3081,12 +3194,226 @@ bool PluginCore::preProcessAudioBuffers(ProcessBufferInfo& processInfo)
     return true;
 }
 
+/**
+\brief tag each bound variable with the parameter structures it is copied into
+
+Operation:
+- the update functions only rewrite (and hand to the engine) the structures whose groups changed
+- a bound variable that is not listed here flags every group, so nothing can be missed
+*/
+void PluginCore::initParameterGroups()
+{
+	const uint32_t groupTable[][2] =
+	{
+		{ controlID::globalPitchBendSens, kEngineGroup },
+		{ controlID::globalTuning, kEngineGroup },
+		{ controlID::globalUnisonDetune_Cents, kEngineGroup },
+		{ controlID::globalVolume_dB, kEngineGroup },
+		{ controlID::synthMode, kEngineGroup },
+		{ controlID::enableDelayFX, kEngineGroup },
+		{ controlID::leftDelay_mSec, kEngineGroup },
+		{ controlID::rightDelay_mSec, kEngineGroup },
+		{ controlID::dryLevel_dB, kEngineGroup },
+		{ controlID::wetLevel_dB, kEngineGroup },
+		{ controlID::feedback_Pct, kEngineGroup },
+		{ controlID::glideTime_mSec, kVoiceGroup },
+		{ controlID::filterModeIndex, kVoiceGroup },
+		{ controlID::lfo1Core, kLFO1Group },
+		{ controlID::lfo2Core, kLFO2Group },
+		{ controlID::ampEGCore, kAmpEGGroup },
+		{ controlID::filterEGCore, kFilterEGGroup },
+		{ controlID::auxEGCore, kAuxEGGroup },
+		{ controlID::filter1Core, kFilter1Group },
+		{ controlID::filter2Core, kFilter2Group },
+		{ controlID::osc1Core, kOsc1Group },
+		{ controlID::osc2Core, kOsc2Group },
+		{ controlID::osc3Core, kOsc3Group },
+		{ controlID::osc4Core, kOsc4Group },
+		{ controlID::osc1_waveform, kOsc1Group },
+		{ controlID::osc2_waveform, kOsc2Group },
+		{ controlID::osc3_waveform, kOsc3Group },
+		{ controlID::osc4_waveform, kOsc4Group },
+		{ controlID::osc1CoarseDetune, kOsc1Group },
+		{ controlID::osc2CoarseDetune, kOsc2Group },
+		{ controlID::osc3CoarseDetune, kOsc3Group },
+		{ controlID::osc4CoarseDetune, kOsc4Group },
+		{ controlID::osc1FineDetune, kOsc1Group },
+		{ controlID::osc2FineDetune, kOsc2Group },
+		{ controlID::osc3FineDetune, kOsc3Group },
+		{ controlID::osc4FineDetune, kOsc4Group },
+		{ controlID::osc1_panValue, kOsc1Group },
+		{ controlID::osc2_panValue, kOsc2Group },
+		{ controlID::osc3_panValue, kOsc3Group },
+		{ controlID::osc4_panValue, kOsc4Group },
+		{ controlID::osc1OutputAmplitude_dB, kOsc1Group },
+		{ controlID::osc2OutputAmplitude_dB, kOsc2Group },
+		{ controlID::osc3OutputAmplitude_dB, kOsc3Group },
+		{ controlID::osc4OutputAmplitude_dB, kOsc4Group },
+		{ controlID::osc1_ModKnobA, kOsc1Group },
+		{ controlID::osc1_ModKnobB, kOsc1Group },
+		{ controlID::osc1_ModKnobC, kOsc1Group },
+		{ controlID::osc1_ModKnobD, kOsc1Group },
+		{ controlID::osc2_ModKnobA, kOsc2Group },
+		{ controlID::osc2_ModKnobB, kOsc2Group },
+		{ controlID::osc2_ModKnobC, kOsc2Group },
+		{ controlID::osc2_ModKnobD, kOsc2Group },
+		{ controlID::osc3_ModKnobA, kOsc3Group },
+		{ controlID::osc3_ModKnobB, kOsc3Group },
+		{ controlID::osc3_ModKnobC, kOsc3Group },
+		{ controlID::osc3_ModKnobD, kOsc3Group },
+		{ controlID::osc4_ModKnobA, kOsc4Group },
+		{ controlID::osc4_ModKnobB, kOsc4Group },
+		{ controlID::osc4_ModKnobC, kOsc4Group },
+		{ controlID::osc4_ModKnobD, kOsc4Group },
+		{ controlID::lfo1_waveform, kLFO1Group },
+		{ controlID::lfo1_mode, kLFO1Group },
+		{ controlID::lfo1_frequency_Hz, kLFO1Group },
+		{ controlID::lfo1_outputAmplitude, kLFO1Group },
+		{ controlID::lfo1_quantize, kLFO1Group },
+		{ controlID::lfo1_ModKnobA, kLFO1Group },
+		{ controlID::lfo1_ModKnobB, kLFO1Group },
+		{ controlID::lfo1_ModKnobC, kLFO1Group },
+		{ controlID::lfo1_ModKnobD, kLFO1Group },
+		{ controlID::lfo2_waveform, kLFO2Group },
+		{ controlID::lfo2_mode, kLFO2Group },
+		{ controlID::lfo2_frequency_Hz, kLFO2Group },
+		{ controlID::lfo2_outputAmplitude, kLFO2Group },
+		{ controlID::lfo2_quantize, kLFO2Group },
+		{ controlID::lfo2_ModKnobA, kLFO2Group },
+		{ controlID::lfo2_ModKnobB, kLFO2Group },
+		{ controlID::lfo2_ModKnobC, kLFO2Group },
+		{ controlID::lfo2_ModKnobD, kLFO2Group },
+		{ controlID::ampEGMode, kAmpEGGroup },
+		{ controlID::ampEG_attackTime_mSec, kAmpEGGroup },
+		{ controlID::ampEG_decayTime_mSec, kAmpEGGroup },
+		{ controlID::ampEG_sustainLevel, kAmpEGGroup },
+		{ controlID::ampEG_releaseTime_mSec, kAmpEGGroup },
+		{ controlID::ampEG_ModKnobA, kAmpEGGroup },
+		{ controlID::ampEG_ModKnobB, kAmpEGGroup },
+		{ controlID::ampEG_ModKnobC, kAmpEGGroup },
+		{ controlID::ampEG_ModKnobD, kAmpEGGroup },
+		{ controlID::filterEGMode, kFilterEGGroup },
+		{ controlID::filterEG_attackTime_mSec, kFilterEGGroup },
+		{ controlID::filterEG_decayTime_mSec, kFilterEGGroup },
+		{ controlID::filterEG_sustainLevel, kFilterEGGroup },
+		{ controlID::filterEG_releaseTime_mSec, kFilterEGGroup },
+		{ controlID::filterEG_ModKnobA, kFilterEGGroup },
+		{ controlID::filterEG_ModKnobB, kFilterEGGroup },
+		{ controlID::filterEG_ModKnobC, kFilterEGGroup },
+		{ controlID::filterEG_ModKnobD, kFilterEGGroup },
+		{ controlID::auxEGMode, kAuxEGGroup },
+		{ controlID::auxEG_attackTime_mSec, kAuxEGGroup },
+		{ controlID::auxEG_decayTime_mSec, kAuxEGGroup },
+		{ controlID::auxEG_sustainLevel, kAuxEGGroup },
+		{ controlID::auxEG_releaseTime_mSec, kAuxEGGroup },
+		{ controlID::auxEG_ModKnobA, kAuxEGGroup },
+		{ controlID::auxEG_ModKnobB, kAuxEGGroup },
+		{ controlID::auxEG_ModKnobC, kAuxEGGroup },
+		{ controlID::auxEG_ModKnobD, kAuxEGGroup },
+		{ controlID::filter1Algorithm, kFilter1Group },
+		{ controlID::filter1_fc, kFilter1Group },
+		{ controlID::filter1_Q, kFilter1Group },
+		{ controlID::enableFilter1KeyTrack, kFilter1Group },
+		{ controlID::filter1Output_dB, kFilter1Group },
+		{ controlID::filter1_ModKnobA, kFilter1Group },
+		{ controlID::filter1_ModKnobB, kFilter1Group },
+		{ controlID::filter1_ModKnobC, kFilter1Group },
+		{ controlID::filter1_ModKnobD, kFilter1Group },
+		{ controlID::filter2Algorithm, kFilter2Group },
+		{ controlID::filter2_fc, kFilter2Group },
+		{ controlID::filter2_Q, kFilter2Group },
+		{ controlID::enableFilter2KeyTrack, kFilter2Group },
+		{ controlID::filter2Output_dB, kFilter2Group },
+		{ controlID::filter2_ModKnobA, kFilter2Group },
+		{ controlID::filter2_ModKnobB, kFilter2Group },
+		{ controlID::filter2_ModKnobC, kFilter2Group },
+		{ controlID::filter2_ModKnobD, kFilter2Group },
+		{ controlID::ampEGIntensity, kDCAGroup },
+		{ controlID::lfo1SourceInt, kModMatrixGroup },
+		{ controlID::lfo2SourceInt, kModMatrixGroup },
+		{ controlID::filterEGSourceInt, kModMatrixGroup },
+		{ controlID::auxEGSourceInt, kModMatrixGroup },
+		{ controlID::auxEGBiasedSourceInt, kModMatrixGroup },
+		{ controlID::lfo2_fo_Int, kModMatrixGroup },
+		{ controlID::osc123_fo_Int, kModMatrixGroup },
+		{ controlID::osc4_fo_Int, kModMatrixGroup },
+		{ controlID::osc123_Mod_Int, kModMatrixGroup },
+		{ controlID::osc4_Mod_Int, kModMatrixGroup },
+		{ controlID::filter1_fc_Int, kModMatrixGroup },
+		{ controlID::filter2_fc_Int, kModMatrixGroup },
+		{ controlID::ampEGTrigInt, kModMatrixGroup },
+		{ controlID::dcaPanInt, kModMatrixGroup },
+		{ controlID::lfo1_lfo2_fc, kModMatrixGroup },
+		{ controlID::lfo1_osc123_fc, kModMatrixGroup },
+		{ controlID::lfo1_osc04_fc, kModMatrixGroup },
+		{ controlID::lfo1_ampEGTrig, kModMatrixGroup },
+		{ controlID::lfo1_dcaPan, kModMatrixGroup },
+		{ controlID::lfo1_osc123_Mod, kModMatrixGroup },
+		{ controlID::lfo1_osc04_Mod, kModMatrixGroup },
+		{ controlID::lfo1_filter1_fc, kModMatrixGroup },
+		{ controlID::lfo1_filter2_fc, kModMatrixGroup },
+		{ controlID::lfo2_lfo2_fc, kModMatrixGroup },
+		{ controlID::lfo2_osc123_fc, kModMatrixGroup },
+		{ controlID::lfo2_osc04_fc, kModMatrixGroup },
+		{ controlID::lfo2_ampEGTrig, kModMatrixGroup },
+		{ controlID::lfo2_dcaPan, kModMatrixGroup },
+		{ controlID::lfo2_osc123_Mod, kModMatrixGroup },
+		{ controlID::lfo2_osc04_Mod, kModMatrixGroup },
+		{ controlID::lfo2_filter1_fc, kModMatrixGroup },
+		{ controlID::lfo2_filter2_fc, kModMatrixGroup },
+		{ controlID::filterEG_lfo2_fc, kModMatrixGroup },
+		{ controlID::filterEG_osc123_fc, kModMatrixGroup },
+		{ controlID::filterEG_osc04_fc, kModMatrixGroup },
+		{ controlID::filterEG_dcaPan, kModMatrixGroup },
+		{ controlID::filterEG_ampEGTrig, kModMatrixGroup },
+		{ controlID::filterEG_osc123_Mod, kModMatrixGroup },
+		{ controlID::filterEG_osc04_Mod, kModMatrixGroup },
+		{ controlID::filterEG_filter1_fc, kModMatrixGroup },
+		{ controlID::filterEG_filter2_fc, kModMatrixGroup },
+		{ controlID::auxEG_lfo2_fc, kModMatrixGroup },
+		{ controlID::auxEG_osc123_fc, kModMatrixGroup },
+		{ controlID::auxEG_osc04_fc, kModMatrixGroup },
+		{ controlID::auxEG_dcaPan, kModMatrixGroup },
+		{ controlID::auxEG_ampEGTrig, kModMatrixGroup },
+		{ controlID::auxEG_osc123_Mod, kModMatrixGroup },
+		{ controlID::auxEG_osc04_Mod, kModMatrixGroup },
+		{ controlID::auxEG_filter1_fc, kModMatrixGroup },
+		{ controlID::auxEG_filter2_fc, kModMatrixGroup },
+		{ controlID::auxEGB_lfo2_fc, kModMatrixGroup },
+		{ controlID::auxEGB_osc123_fc, kModMatrixGroup },
+		{ controlID::auxEGB_osc04_fc, kModMatrixGroup },
+		{ controlID::auxEGB_ampEGTrig, kModMatrixGroup },
+		{ controlID::auxEGB_dcaPan, kModMatrixGroup },
+		{ controlID::auxEGB_osc123_Mod, kModMatrixGroup },
+		{ controlID::auxEGB_osc04_Mod, kModMatrixGroup },
+		{ controlID::auxEGB_filter1_fc, kModMatrixGroup },
+		{ controlID::auxEGB_filter2_fc, kModMatrixGroup }
+	};
+
+	for (uint32_t i = 0; i < sizeof(groupTable) / sizeof(groupTable[0]); i++)
+		addBoundVariableGroup(groupTable[i][0], groupTable[i][1]);
+}
+
 void PluginCore::updateParameters()
 {
 	// --- check for new custom waveform strings & mod-knobs
 	dynStringManager->setCustomUpdateCodes(voiceParameters->updateCodeDroplists, 
 										   voiceParameters->updateCodeKnobs);
 
+	// --- nothing changed since the last block; the engine structures are up to date
+	parameterFieldsPushed.store(0, std::memory_order_relaxed);
+	if (!anyBoundVariableGroupChanged())
+		return;
+
+	// --- telemetry: bound variables copied into the engine structures for this block
+	uint32_t fieldsPushed = 0;
+	for (uint32_t group = 0; group < kNumParameterGroups; group++)
+	{
+		if (boundVariableGroupChanged(group))
+			fieldsPushed += getBoundVariableGroupSize(group);
+	}
+	parameterFieldsPushed.store(fieldsPushed, std::memory_order_relaxed);
+
 	// --- engine
 	updateEngineParameters();
 
@@ -3100,8 +3427,39 @@ void PluginCore::updateParameters()
 	synthEngine->setParameters(engineParameters);
 }
 
+/**
+\brief mirror the current GUI parameters into each render shard
+
+Operation:
+- the update functions write to engineParameters/voiceParameters, so swap in each shard's
+  own structures and run them again; swap() keeps this free of allocation and refcounting
+*/
+void PluginCore::updateShardParameters()
+{
+	if (!anyBoundVariableGroupChanged())
+		return;
+
+	for (uint32_t shard = 1; shard < renderShardCount; shard++)
+	{
+		engineParameters.swap(renderShards[shard].engineParameters);
+		voiceParameters.swap(renderShards[shard].voiceParameters);
+
+		updateEngineParameters();
+		updateVoiceParameters();
+		updateModMatrixParameters();
+		renderShards[shard].engine->setParameters(engineParameters);
+
+		engineParameters.swap(renderShards[shard].engineParameters);
+		voiceParameters.swap(renderShards[shard].voiceParameters);
+	}
+}
+
 void PluginCore::updateEngineParameters()
 {
+	// --- engine level parameters only change with their controls
+	if (!boundVariableGroupChanged(kEngineGroup))
+		return;
+
 	// --- engine level
 	engineParameters->globalPitchBendSensCoarse = (unsigned int)globalPitchBendSens; // --- this is pitch bend max range in semitones
 	engineParameters->globalPitchBendSensFine = (unsigned int)(100.0*(globalPitchBendSens - engineParameters->globalPitchBendSensCoarse)); // this is pitch bend max range in semitones
@@ -3112,171 +3470,226 @@ void PluginCore::updateEngineParameters()
 	engineParameters->globalUnisonDetune_Cents = globalUnisonDetune_Cents;
 	engineParameters->globalVolume_dB = globalVolume_dB;
 
-	// --- mono/poly, etc...
+	// --- mono/poly, etc...; under load the governor plays the unison modes without unison
 	engineParameters->synthModeIndex = synthMode;
-
-	// --- delay FX
-	engineParameters->enableDelayFX = enableDelayFX == 1;
+	if (!voiceGovernor.allowUnison() && compareEnumToInt(synthModeEnum::Unison, synthMode))
+		engineParameters->synthModeIndex = (int)synthModeEnum::Mono;
+	else if (!voiceGovernor.allowUnison() && compareEnumToInt(synthModeEnum::UniLegato, synthMode))
+		engineParameters->synthModeIndex = (int)synthModeEnum::Legato;
+
+	// --- delay FX; the governor may bypass it under load
+	bool delayFXOn = enableDelayFX == 1 && voiceGovernor.allowDelayFX();
+	engineParameters->enableDelayFX = delayFXOn;
 	engineParameters->audioDelayParameters->leftDelay_mSec = leftDelay_mSec;
 	engineParameters->audioDelayParameters->rightDelay_mSec = rightDelay_mSec;
 	engineParameters->audioDelayParameters->dryLevel_dB = dryLevel_dB;
 	engineParameters->audioDelayParameters->wetLevel_dB = wetLevel_dB;
 	engineParameters->audioDelayParameters->feedback_Pct = feedback_Pct;
+
+	// --- the delay line must be flushed before the synth can go idle
+	silenceDetector.setTailTime_mSec(delayFXOn ? fmax(leftDelay_mSec, rightDelay_mSec) : 0.0);
 }
 
 void PluginCore::updateVoiceParameters()
 {
-	voiceParameters->glideTime_mSec = glideTime_mSec;
-	voiceParameters->filterModeIndex = filterModeIndex;
-
-	// --- DM STUFF 
-	voiceParameters->lfo1Parameters->moduleIndex = lfo1Core;
-	voiceParameters->lfo2Parameters->moduleIndex = lfo2Core;
-
-	voiceParameters->ampEGParameters->moduleIndex = ampEGCore;
-	voiceParameters->filterEGParameters->moduleIndex = filterEGCore;
-	voiceParameters->auxEGParameters->moduleIndex = auxEGCore;
-
-	voiceParameters->filter1Parameters->moduleIndex = filter1Core;
-	voiceParameters->filter2Parameters->moduleIndex = filter2Core;
-	
-	// --- OSC BLOCK
-	voiceParameters->osc1Parameters->moduleIndex = osc1Core;
-	voiceParameters->osc2Parameters->moduleIndex = osc2Core;
-	voiceParameters->osc3Parameters->moduleIndex = osc3Core;
-	voiceParameters->osc4Parameters->moduleIndex = osc4Core;
-
-	// --- osc wveform index
-	voiceParameters->osc1Parameters->waveIndex = osc1_waveform;
-	voiceParameters->osc2Parameters->waveIndex = osc2_waveform;
-	voiceParameters->osc3Parameters->waveIndex = osc3_waveform;
-	voiceParameters->osc4Parameters->waveIndex = osc4_waveform;
-
-	voiceParameters->osc1Parameters->coarseDetune = osc1CoarseDetune;
-	voiceParameters->osc2Parameters->coarseDetune = osc2CoarseDetune;
-	voiceParameters->osc3Parameters->coarseDetune = osc3CoarseDetune;
-	voiceParameters->osc4Parameters->coarseDetune = osc4CoarseDetune;
-
-	voiceParameters->osc1Parameters->fineDetune = osc1FineDetune;
-	voiceParameters->osc2Parameters->fineDetune = osc2FineDetune;
-	voiceParameters->osc3Parameters->fineDetune = osc3FineDetune;
-	voiceParameters->osc4Parameters->fineDetune = osc4FineDetune;
-
-	voiceParameters->osc1Parameters->panValue = osc1_panValue;
-	voiceParameters->osc2Parameters->panValue = osc2_panValue;
-	voiceParameters->osc3Parameters->panValue = osc3_panValue;
-	voiceParameters->osc4Parameters->panValue = osc4_panValue;
-
-	voiceParameters->osc1Parameters->outputAmplitude_dB = osc1OutputAmplitude_dB;
-	voiceParameters->osc2Parameters->outputAmplitude_dB = osc2OutputAmplitude_dB;
-	voiceParameters->osc3Parameters->outputAmplitude_dB = osc3OutputAmplitude_dB;
-	voiceParameters->osc4Parameters->outputAmplitude_dB = osc4OutputAmplitude_dB;
-
-	voiceParameters->osc1Parameters->modKnobValue[0] = osc1_ModKnobA;
-	voiceParameters->osc1Parameters->modKnobValue[1] = osc1_ModKnobB;
-	voiceParameters->osc1Parameters->modKnobValue[2] = osc1_ModKnobC;
-	voiceParameters->osc1Parameters->modKnobValue[3] = osc1_ModKnobD;
-
-	voiceParameters->osc2Parameters->modKnobValue[0] = osc2_ModKnobA;
-	voiceParameters->osc2Parameters->modKnobValue[1] = osc2_ModKnobB;
-	voiceParameters->osc2Parameters->modKnobValue[2] = osc2_ModKnobC;
-	voiceParameters->osc2Parameters->modKnobValue[3] = osc2_ModKnobD;
-
-	voiceParameters->osc3Parameters->modKnobValue[0] = osc3_ModKnobA;
-	voiceParameters->osc3Parameters->modKnobValue[1] = osc3_ModKnobB;
-	voiceParameters->osc3Parameters->modKnobValue[2] = osc3_ModKnobC;
-	voiceParameters->osc3Parameters->modKnobValue[3] = osc3_ModKnobD;
-
-	voiceParameters->osc4Parameters->modKnobValue[0] = osc4_ModKnobA;
-	voiceParameters->osc4Parameters->modKnobValue[1] = osc4_ModKnobB;
-	voiceParameters->osc4Parameters->modKnobValue[2] = osc4_ModKnobC;
-	voiceParameters->osc4Parameters->modKnobValue[3] = osc4_ModKnobD;
+	// --- voice level
+	if (boundVariableGroupChanged(kVoiceGroup))
+	{
+		voiceParameters->glideTime_mSec = glideTime_mSec;
+		voiceParameters->filterModeIndex = filterModeIndex;
+	}
 
 	// --- LFO1
-	voiceParameters->lfo1Parameters->waveformIndex = lfo1_waveform;
-	voiceParameters->lfo1Parameters->modeIndex = lfo1_mode;
-	voiceParameters->lfo1Parameters->frequency_Hz = lfo1_frequency_Hz;
-	voiceParameters->lfo1Parameters->outputAmplitude = lfo1_outputAmplitude;
-	voiceParameters->lfo1Parameters->quantize = lfo1_quantize;
-	voiceParameters->lfo1Parameters->modKnobValue[0] = lfo1_ModKnobA;
-	voiceParameters->lfo1Parameters->modKnobValue[1] = lfo1_ModKnobB;
-	voiceParameters->lfo1Parameters->modKnobValue[2] = lfo1_ModKnobC;
-	voiceParameters->lfo1Parameters->modKnobValue[3] = lfo1_ModKnobD;
+	if (boundVariableGroupChanged(kLFO1Group))
+	{
+		voiceParameters->lfo1Parameters->moduleIndex = lfo1Core;
+
+		voiceParameters->lfo1Parameters->waveformIndex = lfo1_waveform;
+		voiceParameters->lfo1Parameters->modeIndex = lfo1_mode;
+		voiceParameters->lfo1Parameters->frequency_Hz = lfo1_frequency_Hz;
+		voiceParameters->lfo1Parameters->outputAmplitude = lfo1_outputAmplitude;
+		voiceParameters->lfo1Parameters->quantize = lfo1_quantize;
+		voiceParameters->lfo1Parameters->modKnobValue[0] = lfo1_ModKnobA;
+		voiceParameters->lfo1Parameters->modKnobValue[1] = lfo1_ModKnobB;
+		voiceParameters->lfo1Parameters->modKnobValue[2] = lfo1_ModKnobC;
+		voiceParameters->lfo1Parameters->modKnobValue[3] = lfo1_ModKnobD;
+	}
 
 	// --- LFO2
-	voiceParameters->lfo2Parameters->waveformIndex = lfo2_waveform;
-	voiceParameters->lfo2Parameters->modeIndex = lfo2_mode;
-	voiceParameters->lfo2Parameters->frequency_Hz = lfo2_frequency_Hz;
-	voiceParameters->lfo2Parameters->outputAmplitude = lfo2_outputAmplitude;
-	voiceParameters->lfo2Parameters->quantize = lfo2_quantize;
-	voiceParameters->lfo2Parameters->modKnobValue[0] = lfo2_ModKnobA;
-	voiceParameters->lfo2Parameters->modKnobValue[1] = lfo2_ModKnobB;
-	voiceParameters->lfo2Parameters->modKnobValue[2] = lfo2_ModKnobC;
-	voiceParameters->lfo2Parameters->modKnobValue[3] = lfo2_ModKnobD;
+	if (boundVariableGroupChanged(kLFO2Group))
+	{
+		voiceParameters->lfo2Parameters->moduleIndex = lfo2Core;
+
+		voiceParameters->lfo2Parameters->waveformIndex = lfo2_waveform;
+		voiceParameters->lfo2Parameters->modeIndex = lfo2_mode;
+		voiceParameters->lfo2Parameters->frequency_Hz = lfo2_frequency_Hz;
+		voiceParameters->lfo2Parameters->outputAmplitude = lfo2_outputAmplitude;
+		voiceParameters->lfo2Parameters->quantize = lfo2_quantize;
+		voiceParameters->lfo2Parameters->modKnobValue[0] = lfo2_ModKnobA;
+		voiceParameters->lfo2Parameters->modKnobValue[1] = lfo2_ModKnobB;
+		voiceParameters->lfo2Parameters->modKnobValue[2] = lfo2_ModKnobC;
+		voiceParameters->lfo2Parameters->modKnobValue[3] = lfo2_ModKnobD;
+	}
 
 	// --- AMP EG
-	voiceParameters->ampEGParameters->egContourIndex = ampEGMode;
-	voiceParameters->ampEGParameters->attackTime_mSec = ampEG_attackTime_mSec;
-	voiceParameters->ampEGParameters->decayTime_mSec = ampEG_decayTime_mSec;
-	voiceParameters->ampEGParameters->sustainLevel = ampEG_sustainLevel;
-	voiceParameters->ampEGParameters->releaseTime_mSec = ampEG_releaseTime_mSec;
-	voiceParameters->ampEGParameters->modKnobValue[0] = ampEG_ModKnobA;
-	voiceParameters->ampEGParameters->modKnobValue[1] = ampEG_ModKnobB;
-	voiceParameters->ampEGParameters->modKnobValue[2] = ampEG_ModKnobC;
-	voiceParameters->ampEGParameters->modKnobValue[3] = ampEG_ModKnobD;
+	if (boundVariableGroupChanged(kAmpEGGroup))
+	{
+		voiceParameters->ampEGParameters->moduleIndex = ampEGCore;
+
+		voiceParameters->ampEGParameters->egContourIndex = ampEGMode;
+		voiceParameters->ampEGParameters->attackTime_mSec = ampEG_attackTime_mSec;
+		voiceParameters->ampEGParameters->decayTime_mSec = ampEG_decayTime_mSec;
+		voiceParameters->ampEGParameters->sustainLevel = ampEG_sustainLevel;
+		voiceParameters->ampEGParameters->releaseTime_mSec = voiceGovernor.limitReleaseTime_mSec(ampEG_releaseTime_mSec);
+		voiceParameters->ampEGParameters->modKnobValue[0] = ampEG_ModKnobA;
+		voiceParameters->ampEGParameters->modKnobValue[1] = ampEG_ModKnobB;
+		voiceParameters->ampEGParameters->modKnobValue[2] = ampEG_ModKnobC;
+		voiceParameters->ampEGParameters->modKnobValue[3] = ampEG_ModKnobD;
+	}
 
 	// --- FILTER EG
-	voiceParameters->filterEGParameters->egContourIndex = filterEGMode;
-	voiceParameters->filterEGParameters->attackTime_mSec = filterEG_attackTime_mSec;
-	voiceParameters->filterEGParameters->decayTime_mSec = filterEG_decayTime_mSec;
-	voiceParameters->filterEGParameters->sustainLevel = filterEG_sustainLevel;
-	voiceParameters->filterEGParameters->releaseTime_mSec = filterEG_releaseTime_mSec;
-	voiceParameters->filterEGParameters->modKnobValue[0] = filterEG_ModKnobA;
-	voiceParameters->filterEGParameters->modKnobValue[1] = filterEG_ModKnobB;
-	voiceParameters->filterEGParameters->modKnobValue[2] = filterEG_ModKnobC;
-	voiceParameters->filterEGParameters->modKnobValue[3] = filterEG_ModKnobD;
+	if (boundVariableGroupChanged(kFilterEGGroup))
+	{
+		voiceParameters->filterEGParameters->moduleIndex = filterEGCore;
+
+		voiceParameters->filterEGParameters->egContourIndex = filterEGMode;
+		voiceParameters->filterEGParameters->attackTime_mSec = filterEG_attackTime_mSec;
+		voiceParameters->filterEGParameters->decayTime_mSec = filterEG_decayTime_mSec;
+		voiceParameters->filterEGParameters->sustainLevel = filterEG_sustainLevel;
+		voiceParameters->filterEGParameters->releaseTime_mSec = filterEG_releaseTime_mSec;
+		voiceParameters->filterEGParameters->modKnobValue[0] = filterEG_ModKnobA;
+		voiceParameters->filterEGParameters->modKnobValue[1] = filterEG_ModKnobB;
+		voiceParameters->filterEGParameters->modKnobValue[2] = filterEG_ModKnobC;
+		voiceParameters->filterEGParameters->modKnobValue[3] = filterEG_ModKnobD;
+	}
 
 	// --- AUX EG
-	voiceParameters->auxEGParameters->egContourIndex = auxEGMode;
-	voiceParameters->auxEGParameters->attackTime_mSec = auxEG_attackTime_mSec;
-	voiceParameters->auxEGParameters->decayTime_mSec = auxEG_decayTime_mSec;
-	voiceParameters->auxEGParameters->sustainLevel = auxEG_sustainLevel;
-	voiceParameters->auxEGParameters->releaseTime_mSec = auxEG_releaseTime_mSec;
-	voiceParameters->auxEGParameters->modKnobValue[0] = auxEG_ModKnobA;
-	voiceParameters->auxEGParameters->modKnobValue[1] = auxEG_ModKnobB;
-	voiceParameters->auxEGParameters->modKnobValue[2] = auxEG_ModKnobC;
-	voiceParameters->auxEGParameters->modKnobValue[3] = auxEG_ModKnobD;
+	if (boundVariableGroupChanged(kAuxEGGroup))
+	{
+		voiceParameters->auxEGParameters->moduleIndex = auxEGCore;
+
+		voiceParameters->auxEGParameters->egContourIndex = auxEGMode;
+		voiceParameters->auxEGParameters->attackTime_mSec = auxEG_attackTime_mSec;
+		voiceParameters->auxEGParameters->decayTime_mSec = auxEG_decayTime_mSec;
+		voiceParameters->auxEGParameters->sustainLevel = auxEG_sustainLevel;
+		voiceParameters->auxEGParameters->releaseTime_mSec = auxEG_releaseTime_mSec;
+		voiceParameters->auxEGParameters->modKnobValue[0] = auxEG_ModKnobA;
+		voiceParameters->auxEGParameters->modKnobValue[1] = auxEG_ModKnobB;
+		voiceParameters->auxEGParameters->modKnobValue[2] = auxEG_ModKnobC;
+		voiceParameters->auxEGParameters->modKnobValue[3] = auxEG_ModKnobD;
+	}
 
 	// --- FILTER 1
-	voiceParameters->filter1Parameters->filterIndex = filter1Algorithm;
-	voiceParameters->filter1Parameters->fc = filter1_fc;
-	voiceParameters->filter1Parameters->Q = filter1_Q;
-	voiceParameters->filter1Parameters->enableKeyTrack = enableFilter1KeyTrack == 1;
-	voiceParameters->filter1Parameters->filterOutputGain_dB = filter1Output_dB;
-
-	voiceParameters->filter1Parameters->modKnobValue[0] = filter1_ModKnobA;
-	voiceParameters->filter1Parameters->modKnobValue[1] = filter1_ModKnobB;
-	voiceParameters->filter1Parameters->modKnobValue[2] = filter1_ModKnobC;
-	voiceParameters->filter1Parameters->modKnobValue[3] = filter1_ModKnobD;
+	if (boundVariableGroupChanged(kFilter1Group))
+	{
+		voiceParameters->filter1Parameters->moduleIndex = filter1Core;
+
+		voiceParameters->filter1Parameters->filterIndex = filter1Algorithm;
+		voiceParameters->filter1Parameters->fc = filter1_fc;
+		voiceParameters->filter1Parameters->Q = filter1_Q;
+		voiceParameters->filter1Parameters->enableKeyTrack = enableFilter1KeyTrack == 1;
+		voiceParameters->filter1Parameters->filterOutputGain_dB = filter1Output_dB;
+
+		voiceParameters->filter1Parameters->modKnobValue[0] = filter1_ModKnobA;
+		voiceParameters->filter1Parameters->modKnobValue[1] = filter1_ModKnobB;
+		voiceParameters->filter1Parameters->modKnobValue[2] = filter1_ModKnobC;
+		voiceParameters->filter1Parameters->modKnobValue[3] = filter1_ModKnobD;
+	}
 
 	// --- FILTER 2
-	voiceParameters->filter2Parameters->filterIndex = filter2Algorithm;
-	voiceParameters->filter2Parameters->fc = filter2_fc;
-	voiceParameters->filter2Parameters->Q = filter2_Q;
-	voiceParameters->filter2Parameters->enableKeyTrack = enableFilter2KeyTrack == 1;
-	voiceParameters->filter2Parameters->filterOutputGain_dB = filter2Output_dB;
+	if (boundVariableGroupChanged(kFilter2Group))
+	{
+		voiceParameters->filter2Parameters->moduleIndex = filter2Core;
+
+		voiceParameters->filter2Parameters->filterIndex = filter2Algorithm;
+		voiceParameters->filter2Parameters->fc = filter2_fc;
+		voiceParameters->filter2Parameters->Q = filter2_Q;
+		voiceParameters->filter2Parameters->enableKeyTrack = enableFilter2KeyTrack == 1;
+		voiceParameters->filter2Parameters->filterOutputGain_dB = filter2Output_dB;
+
+		voiceParameters->filter2Parameters->modKnobValue[0] = filter2_ModKnobA;
+		voiceParameters->filter2Parameters->modKnobValue[1] = filter2_ModKnobB;
+		voiceParameters->filter2Parameters->modKnobValue[2] = filter2_ModKnobC;
+		voiceParameters->filter2Parameters->modKnobValue[3] = filter2_ModKnobD;
+	}
+
+	// --- OSC 1
+	if (boundVariableGroupChanged(kOsc1Group))
+	{
+		voiceParameters->osc1Parameters->moduleIndex = osc1Core;
+
+		voiceParameters->osc1Parameters->waveIndex = osc1_waveform;
+		voiceParameters->osc1Parameters->coarseDetune = osc1CoarseDetune;
+		voiceParameters->osc1Parameters->fineDetune = osc1FineDetune;
+		voiceParameters->osc1Parameters->panValue = osc1_panValue;
+		voiceParameters->osc1Parameters->outputAmplitude_dB = osc1OutputAmplitude_dB;
+		voiceParameters->osc1Parameters->modKnobValue[0] = osc1_ModKnobA;
+		voiceParameters->osc1Parameters->modKnobValue[1] = osc1_ModKnobB;
+		voiceParameters->osc1Parameters->modKnobValue[2] = osc1_ModKnobC;
+		voiceParameters->osc1Parameters->modKnobValue[3] = osc1_ModKnobD;
+	}
+
+	// --- OSC 2
+	if (boundVariableGroupChanged(kOsc2Group))
+	{
+		voiceParameters->osc2Parameters->moduleIndex = osc2Core;
+
+		voiceParameters->osc2Parameters->waveIndex = osc2_waveform;
+		voiceParameters->osc2Parameters->coarseDetune = osc2CoarseDetune;
+		voiceParameters->osc2Parameters->fineDetune = osc2FineDetune;
+		voiceParameters->osc2Parameters->panValue = osc2_panValue;
+		voiceParameters->osc2Parameters->outputAmplitude_dB = osc2OutputAmplitude_dB;
+		voiceParameters->osc2Parameters->modKnobValue[0] = osc2_ModKnobA;
+		voiceParameters->osc2Parameters->modKnobValue[1] = osc2_ModKnobB;
+		voiceParameters->osc2Parameters->modKnobValue[2] = osc2_ModKnobC;
+		voiceParameters->osc2Parameters->modKnobValue[3] = osc2_ModKnobD;
+	}
+
+	// --- OSC 3
+	if (boundVariableGroupChanged(kOsc3Group))
+	{
+		voiceParameters->osc3Parameters->moduleIndex = osc3Core;
+
+		voiceParameters->osc3Parameters->waveIndex = osc3_waveform;
+		voiceParameters->osc3Parameters->coarseDetune = osc3CoarseDetune;
+		voiceParameters->osc3Parameters->fineDetune = osc3FineDetune;
+		voiceParameters->osc3Parameters->panValue = osc3_panValue;
+		voiceParameters->osc3Parameters->outputAmplitude_dB = osc3OutputAmplitude_dB;
+		voiceParameters->osc3Parameters->modKnobValue[0] = osc3_ModKnobA;
+		voiceParameters->osc3Parameters->modKnobValue[1] = osc3_ModKnobB;
+		voiceParameters->osc3Parameters->modKnobValue[2] = osc3_ModKnobC;
+		voiceParameters->osc3Parameters->modKnobValue[3] = osc3_ModKnobD;
+	}
 
-	voiceParameters->filter2Parameters->modKnobValue[0] = filter2_ModKnobA;
-	voiceParameters->filter2Parameters->modKnobValue[1] = filter2_ModKnobB;
-	voiceParameters->filter2Parameters->modKnobValue[2] = filter2_ModKnobC;
-	voiceParameters->filter2Parameters->modKnobValue[3] = filter2_ModKnobD;
+	// --- OSC 4
+	if (boundVariableGroupChanged(kOsc4Group))
+	{
+		voiceParameters->osc4Parameters->moduleIndex = osc4Core;
+
+		voiceParameters->osc4Parameters->waveIndex = osc4_waveform;
+		voiceParameters->osc4Parameters->coarseDetune = osc4CoarseDetune;
+		voiceParameters->osc4Parameters->fineDetune = osc4FineDetune;
+		voiceParameters->osc4Parameters->panValue = osc4_panValue;
+		voiceParameters->osc4Parameters->outputAmplitude_dB = osc4OutputAmplitude_dB;
+		voiceParameters->osc4Parameters->modKnobValue[0] = osc4_ModKnobA;
+		voiceParameters->osc4Parameters->modKnobValue[1] = osc4_ModKnobB;
+		voiceParameters->osc4Parameters->modKnobValue[2] = osc4_ModKnobC;
+		voiceParameters->osc4Parameters->modKnobValue[3] = osc4_ModKnobD;
+	}
 
 	// --- DCA
-	voiceParameters->dcaParameters->ampEGIntensity = ampEGIntensity;
+	if (boundVariableGroupChanged(kDCAGroup))
+	{
+		voiceParameters->dcaParameters->ampEGIntensity = ampEGIntensity;
+	}
 }
 
 void PluginCore::updateModMatrixParameters()
 {
+	// --- the mod matrix only changes with its controls
+	if (!boundVariableGroupChanged(kModMatrixGroup))
+		return;
+
 	// --- MOD MATRIX
 	//
 	// --- Source Intensities
@@ -3512,6 +3925,52 @@ void PluginCore::updateModMatrixParameters()
 	// ----------------------------------------------------------------------------------------
 }
 
+/**
+\brief set the render quantum (block size) of the synth
+
+Operation:
+- valid sizes are powers of 2 from MIN_RENDER_QUANTUM to MAX_RENDER_QUANTUM (32, 64, 128, 256)
+- the engines are allocated for MAX_RENDER_QUANTUM so this may be called at any time
+- takes effect at the next host buffer
+
+\param quantum the new render quantum in samples
+
+\return true if the size is valid, false otherwise (the quantum is unchanged)
+*/
+bool PluginCore::setRenderQuantum(uint32_t quantum)
+{
+	if (quantum < MIN_RENDER_QUANTUM || quantum > MAX_RENDER_QUANTUM || (quantum & (quantum - 1)) != 0)
+		return false;
+
+	renderQuantum.store(quantum, std::memory_order_relaxed);
+	return true;
+}
+
+/**
+\brief find the render quantum for a host buffer
+
+Operation:
+- with the adaptive quantum enabled, a buffer size that is a multiple of the quantum is rendered
+  with the largest power-of-2 multiple (up to MAX_RENDER_QUANTUM) that divides it evenly, so
+  a 512 sample buffer renders two 256 sample blocks instead of eight 64 sample blocks
+- otherwise the base quantum is used and the remainder becomes a partial block
+
+\param numFrames host buffer size
+
+\return the render quantum for this buffer
+*/
+uint32_t PluginCore::getRenderQuantumForBuffer(uint32_t numFrames)
+{
+	uint32_t quantum = renderQuantum.load(std::memory_order_relaxed);
+	if (!enableAdaptiveRenderQuantum.load(std::memory_order_relaxed) || numFrames % quantum != 0)
+		return quantum;
+
+	while (quantum * 2 <= MAX_RENDER_QUANTUM && numFrames % (quantum * 2) == 0)
+		quantum *= 2;
+
+	return quantum;
+}
+
 // --------------------------------------------
 /**
 \brief buffer-processing method
@@ -3531,11 +3990,23 @@ bool PluginCore::processAudioBuffers(ProcessBufferInfo& processBufferInfo)
 {
 	double sampleInterval = 1.0 / audioProcDescriptor.sampleRate;
 
+#if SYNTHLAB_PROFILER
+	stageProfiler.beginBuffer();
+#endif
+
 	// --- sync internal bound variables
-	preProcessAudioBuffers(processBufferInfo);
+	{
+		PROFILE_STAGE(stageProfiler, kProfileParameters);
+		preProcessAudioBuffers(processBufferInfo);
+	}
+
+	// --- the quantum is set per buffer, so a partial block can never leak into the next buffer
+	uint32_t quantum = getRenderQuantumForBuffer(processBufferInfo.numFramesToProcess);
+	effectiveRenderQuantum.store(quantum, std::memory_order_relaxed);
+	processBlockInfo.blockSize = quantum;
 
 	// --- calculate blocks & partial blocks
-	div_t blockDiv = div((int)processBufferInfo.numFramesToProcess, processBlockInfo.blockSize);
+	div_t blockDiv = div((int)processBufferInfo.numFramesToProcess, (int)quantum);
 	int blocksPerBuffer = blockDiv.quot;
 	int partialBlockSize = blockDiv.rem;
 
@@ -3543,6 +4014,7 @@ bool PluginCore::processAudioBuffers(ProcessBufferInfo& processBufferInfo)
 	processBlockInfo.outputs = processBufferInfo.outputs;
 	processBlockInfo.auxInputs = processBufferInfo.auxInputs;
 	processBlockInfo.auxOutputs = processBufferInfo.auxOutputs;
+	processBlockInfo.outputs64 = processBufferInfo.doublePrecision ? processBufferInfo.outputs64 : nullptr;
 
 	processBlockInfo.numAudioInChannels = processBufferInfo.numAudioInChannels;
 	processBlockInfo.numAudioOutChannels = processBufferInfo.numAudioOutChannels;
@@ -3552,6 +4024,9 @@ bool PluginCore::processAudioBuffers(ProcessBufferInfo& processBufferInfo)
 	processBlockInfo.hostInfo = processBufferInfo.hostInfo;
 	processBlockInfo.midiEventQueue = processBufferInfo.midiEventQueue;
 
+	// --- the buffer is silent only if every block was skipped
+	bool bufferSilent = enableIdleRenderSkip && processBufferInfo.numFramesToProcess > 0;
+
 	// --- build blocks one block for each channel
 	for (uint32_t block = 0; block < blocksPerBuffer; block++)
 	{
@@ -3560,6 +4035,7 @@ bool PluginCore::processAudioBuffers(ProcessBufferInfo& processBufferInfo)
 
 		// --- do the block
 		processAudioBlock(processBlockInfo);
+		bufferSilent = bufferSilent && blockRenderSkipped;
 
 		// --- update per-frame
 		processBlockInfo.hostInfo->uAbsoluteFrameBufferIndex += processBlockInfo.blockSize;
@@ -3575,20 +4051,48 @@ bool PluginCore::processAudioBuffers(ProcessBufferInfo& processBufferInfo)
 
 		// --- do the block
 		processAudioBlock(processBlockInfo);
+		bufferSilent = bufferSilent && blockRenderSkipped;
+
+		processBlockInfo.hostInfo->uAbsoluteFrameBufferIndex += processBlockInfo.blockSize;
+		processBlockInfo.hostInfo->dAbsoluteFrameBufferTime += (processBlockInfo.blockSize * sampleInterval);
+		processBlockInfo.blockSize = quantum;
 	}
 
+	processBufferInfo.outputSilent = bufferSilent;
+
 	// --- generally not used
 	postProcessAudioBuffers(processBufferInfo);
 
+#if SYNTHLAB_PROFILER
+	stageProfiler.endBuffer();
+	updateProfilerMeters();
+#endif
+
 	return false; /// processed
 }
 
+#if SYNTHLAB_PROFILER
+/**
+\brief copy the stage shares of the last buffer to the profiler meters; they go out with the next
+       buffer's updateOutBoundVariables( )
+*/
+void PluginCore::updateProfilerMeters()
+{
+	profileParameters = stageProfiler.getStageShare(kProfileParameters);
+	profileMidi = stageProfiler.getStageShare(kProfileMidi);
+	profileUpdateParameters = stageProfiler.getStageShare(kProfileUpdateParameters);
+	profileRender = stageProfiler.getStageShare(kProfileRender);
+	profileOutputCopy = stageProfiler.getStageShare(kProfileOutputCopy);
+	profileOutBound = stageProfiler.getStageShare(kProfileOutBound);
+}
+#endif
+
 /**
 \brief block-processing method
 
 Operation:
 - fire all MIDI events for the block
-- do parameter smoothing 
+- do parameter smoothing for the whole block
 - perform block processing (FX or render synth)
 
 \param processBlockInfo structure of information about *block* processing
@@ -3597,6 +4101,9 @@ Operation:
 */
 bool PluginCore::processAudioBlock(ProcessBlockInfo& processBlockInfo)
 {
+	// --- the whole block counts against its deadline
+	voiceGovernor.beginBlock();
+
 	// --- clear MIDI events at top of buffer
 	synthBlockProcInfo.clearMidiEvents();
 	synthBlockProcInfo.absoluteBufferTime_Sec = processBlockInfo.hostInfo->dAbsoluteFrameBufferTime;
@@ -3604,45 +4111,211 @@ bool PluginCore::processAudioBlock(ProcessBlockInfo& processBlockInfo)
 	synthBlockProcInfo.timeSigNumerator = processBlockInfo.hostInfo->fTimeSigNumerator;
 	synthBlockProcInfo.timeSigDenomintor = processBlockInfo.hostInfo->uTimeSigDenomintor;
 
-	// --- fire ALL MIDI events for this block
-	for (uint32_t sample = processBlockInfo.blockStartIndex;
-		sample < processBlockInfo.blockStartIndex + processBlockInfo.blockSize;
-		sample++)
+	for (uint32_t shard = 1; shard < renderShardCount; shard++)
 	{
-		// --- this is for non-sample accurate MIDI
-		processBlockInfo.midiEventQueue->fireMidiEvents(sample);
+		SynthLab::SynthProcessInfo& shardProcInfo = renderShards[shard].synthProcInfo;
+		shardProcInfo.clearMidiEvents();
+		shardProcInfo.absoluteBufferTime_Sec = synthBlockProcInfo.absoluteBufferTime_Sec;
+		shardProcInfo.BPM = synthBlockProcInfo.BPM;
+		shardProcInfo.timeSigNumerator = synthBlockProcInfo.timeSigNumerator;
+		shardProcInfo.timeSigDenomintor = synthBlockProcInfo.timeSigDenomintor;
+	}
 
-		// --- do per-frame updates; VST automation and parameter smoothing
-		doSampleAccurateParameterUpdates();
+	// --- fire ALL MIDI events for this block; processMIDIEvent( ) queues them on the
+	//     sub-block scheduler along with their offset into the block
+	midiSubBlockScheduler.clear();
+	{
+		PROFILE_STAGE(stageProfiler, kProfileMidi);
+		for (uint32_t sample = processBlockInfo.blockStartIndex;
+			sample < processBlockInfo.blockStartIndex + processBlockInfo.blockSize;
+			sample++)
+		{
+			// --- this is for non-sample accurate MIDI
+			midiFireOffset = sample - processBlockInfo.blockStartIndex;
+			processBlockInfo.midiEventQueue->fireMidiEvents(sample);
+		}
 	}
 
-	// --- update parameters
-	updateParameters();
-	
-	// --- in case of partial block
-	synthBlockProcInfo.setSamplesInBlock(processBlockInfo.blockSize);
+	// --- preset change: the parameter snapshot was built off the audio thread; swap it in at
+	//     this block boundary (after the fade out, if anything is sounding) and push it through
+	//     the bound variables once, so nothing morphs in over the following blocks; only the
+	//     parameters that differ from the current preset (and their groups) are visited
+	{
+		PROFILE_STAGE(stageProfiler, kProfileParameters);
+		if (isParameterSnapshotPending() && presetFader.readyToSwap(enableIdleRenderSkip && silenceDetector.isIdle()))
+		{
+			applyParameterSnapshot();
+			syncInBoundVariables();
+		}
 
-	// --- render it
-	synthEngine->render(synthBlockProcInfo);
+		// --- VST automation and parameter smoothing; the engine reads the parameters once
+		//     per block, so the smoothers only need to produce the end-of-block values
+		doBlockParameterUpdates(processBlockInfo.blockSize);
+	}
 
-	// --- output 
-	float** synthOutputs = synthBlockProcInfo.getOutputBuffers();
+	// --- update parameters; only the structures of changed groups are rewritten
+	{
+		PROFILE_STAGE(stageProfiler, kProfileUpdateParameters);
+		updateParameters();
+		updateShardParameters();
+		clearBoundVariableChanges();
+	}
 
-	// --- block processing -- write to outputs
-	for (uint32_t sample = processBlockInfo.blockStartIndex, i = 0; 
-		 sample < processBlockInfo.blockStartIndex + processBlockInfo.blockSize; 
-		 sample++, i++)
+	// --- idle: nothing held, the tail has settled and no MIDI arrived in this block (any
+	//     event wakes the detector when it is fired above); clear the outputs instead of rendering
+	blockRenderSkipped = enableIdleRenderSkip && silenceDetector.isIdle();
+	if (blockRenderSkipped)
 	{
-		// --- copy to outputs
-		for (uint32_t channel = 0; channel < processBlockInfo.numAudioOutChannels; channel++)
 		{
-			processBlockInfo.outputs[channel][sample] = synthOutputs[channel][i];
+			PROFILE_STAGE(stageProfiler, kProfileOutputCopy);
+			if (processBlockInfo.outputs64)
+				clearOutputs(processBlockInfo.outputs64, processBlockInfo.numAudioOutChannels, processBlockInfo.blockStartIndex, processBlockInfo.blockSize);
+			else
+				clearOutputs(processBlockInfo.outputs, processBlockInfo.numAudioOutChannels, processBlockInfo.blockStartIndex, processBlockInfo.blockSize);
 		}
+
+		idleBlockCount.fetch_add(1, std::memory_order_relaxed);
+		updateVoiceGovernor(processBlockInfo.blockSize);
+		return true;
 	}
-	
+
+	// --- render sub-blocks that start on MIDI event offsets; events closer together than
+	//     the minimum sub-block size share a sub-block
+	uint32_t subBlockStart = 0;
+	uint32_t subBlockLength = 0;
+	uint32_t firstEvent = 0;
+	uint32_t numEvents = 0;
+	bool firstSubBlock = true;
+	while (midiSubBlockScheduler.getNextSubBlock(processBlockInfo.blockSize, subBlockStart, subBlockLength, firstEvent, numEvents))
+	{
+		// --- the first sub-block keeps anything pushed directly (scheduler overflow)
+		if (!firstSubBlock)
+			clearSynthMidiEvents();
+		firstSubBlock = false;
+
+		{
+			PROFILE_STAGE(stageProfiler, kProfileMidi);
+			for (uint32_t i = firstEvent; i < firstEvent + numEvents; i++)
+				dispatchSynthMidiEvent(midiSubBlockScheduler.getEvent(i));
+		}
+
+		renderSynthSubBlock(processBlockInfo, subBlockStart, subBlockLength);
+	}
+
+	// --- nothing held: measure the tail until it settles
+	if (enableIdleRenderSkip && silenceDetector.wantsOutput())
+	{
+		if (processBlockInfo.outputs64)
+			silenceDetector.addOutputBlock(processBlockInfo.outputs64, processBlockInfo.numAudioOutChannels, processBlockInfo.blockStartIndex, processBlockInfo.blockSize);
+		else
+			silenceDetector.addOutputBlock(processBlockInfo.outputs, processBlockInfo.numAudioOutChannels, processBlockInfo.blockStartIndex, processBlockInfo.blockSize);
+	}
+
+	// --- fade around a preset swap
+	if (presetFader.isActive())
+	{
+		if (processBlockInfo.outputs64)
+			presetFader.applyGain(processBlockInfo.outputs64, processBlockInfo.numAudioOutChannels, processBlockInfo.blockStartIndex, processBlockInfo.blockSize);
+		else
+			presetFader.applyGain(processBlockInfo.outputs, processBlockInfo.numAudioOutChannels, processBlockInfo.blockStartIndex, processBlockInfo.blockSize);
+	}
+
+	// --- deadline governor and its meters
+	updateVoiceGovernor(processBlockInfo.blockSize);
+
 	return true;
 }
 
+/**
+\brief end the governor's block timing; push a level change to the engine(s) and update the governor meters
+
+Operation:
+- a new level changes the delay FX switch, the synth mode and the amp EG release; their groups are flagged
+  so the next block's updateParameters( ) pushes them
+- the meters are normalized: load (1.0 = the block deadline), level (0 to the last level) and
+  voice limit (fraction of all voices)
+
+\param blockSize the block length in samples
+*/
+void PluginCore::updateVoiceGovernor(uint32_t blockSize)
+{
+	if (voiceGovernor.endBlock(blockSize))
+	{
+		setBoundVariableGroupChanged(kEngineGroup);
+		setBoundVariableGroupChanged(kAmpEGGroup);
+	}
+
+	governorLoad = (float)voiceGovernor.getLoad();
+	governorLevel = (float)voiceGovernor.getLevel() / (float)voiceGovernor.getMaxLevel();
+	governorVoices = (float)voiceGovernor.getVoiceLimit() / (float)voiceGovernor.getMaxVoices();
+}
+
+/**
+\brief render one sub-block of synth output and write it to the host buffers
+
+Operation:
+- render subBlockLength samples into the synth's own buffers (all shards, then mix)
+- copy them to the outputs at blockStartIndex + subBlockStart
+
+\param blockInfo structure of information about *block* processing
+\param subBlockStart offset of the sub-block within the block
+\param subBlockLength number of samples to render
+*/
+void PluginCore::renderSynthSubBlock(ProcessBlockInfo& blockInfo, uint32_t subBlockStart, uint32_t subBlockLength)
+{
+	// --- zero-copy: render straight into the host's buffers when they are safe to use
+	float** synthOutputs = synthBlockProcInfo.getOutputBuffers();
+	bool zeroCopy = enableZeroCopyRender && canRenderToHostBuffers(blockInfo, subBlockStart, subBlockLength);
+	if (zeroCopy)
+	{
+		for (uint32_t channel = 0; channel < SynthLab::STEREO_CHANNELS; channel++)
+			synthOutputs[channel] = blockInfo.outputs[channel] + blockInfo.blockStartIndex + subBlockStart;
+	}
+
+	// --- in case of partial block
+	synthBlockProcInfo.setSamplesInBlock(subBlockLength);
+
+	// --- render it
+	{
+		PROFILE_STAGE(stageProfiler, kProfileRender);
+		if (renderShardCount > 1)
+		{
+			// --- shards render in parallel, then mix into shard 0
+			for (uint32_t shard = 1; shard < renderShardCount; shard++)
+				renderShards[shard].synthProcInfo.setSamplesInBlock(subBlockLength);
+
+			renderWorkerPool.runJobs(this, renderShardCount);
+
+			for (uint32_t shard = 1; shard < renderShardCount; shard++)
+			{
+				float** shardOutputs = renderShards[shard].synthProcInfo.getOutputBuffers();
+				for (uint32_t channel = 0; channel < SynthLab::STEREO_CHANNELS; channel++)
+				{
+					for (uint32_t i = 0; i < subBlockLength; i++)
+						synthOutputs[channel][i] += shardOutputs[channel][i];
+				}
+			}
+		}
+		else
+			synthEngine->render(synthBlockProcInfo);
+	}
+
+	// --- output is already in place; give the synth its own buffers back
+	if (zeroCopy)
+	{
+		for (uint32_t channel = 0; channel < SynthLab::STEREO_CHANNELS; channel++)
+			synthOutputs[channel] = ownedSynthOutputs[channel];
+		return;
+	}
+
+	// --- block processing -- write to outputs
+	PROFILE_STAGE(stageProfiler, kProfileOutputCopy);
+	if (blockInfo.outputs64)
+		writeSynthOutputs(blockInfo.outputs64, blockInfo.numAudioOutChannels, blockInfo.blockStartIndex + subBlockStart, synthOutputs, subBlockLength);
+	else
+		writeSynthOutputs(blockInfo.outputs, blockInfo.numAudioOutChannels, blockInfo.blockStartIndex + subBlockStart, synthOutputs, subBlockLength);
+}
+
 
 /**
 \brief frame-processing method
@@ -3728,6 +4401,7 @@ bool PluginCore::postProcessAudioBuffers(ProcessBufferInfo& processInfo)
 {
 	// --- update outbound variables; currently this is meter data only, but could be extended
 	//     in the future
+	PROFILE_STAGE(stageProfiler, kProfileOutBound);
 	updateOutBoundVariables();
 
     return true;
@@ -4066,19 +4740,171 @@ NOTES:
 \return true if operation succeeds, false otherwise
 */
 bool PluginCore::processMIDIEvent(midiEvent& event)
-{	// --- push to queue for block processing
+{
+	// --- voice limit: the oldest notes are released ahead of a note-on that goes over it (Poly mode only);
+	//     getNoteToSteal( ) updates its tracking for the note it names, so only ask when the note-off is really sent
+	voiceGovernor.addMidiEvent(event);
+	if (compareEnumToInt(synthModeEnum::Poly, synthMode))
+	{
+		uint32_t stealChannel = 0;
+		uint32_t stealNote = 0;
+		while (voiceGovernor.getNoteToSteal(stealChannel, stealNote))
+		{
+			const uint32_t NOTE_OFF = 0x80;
+			midiEvent noteOff(NOTE_OFF, stealChannel, stealNote, 0, event.midiSampleOffset);
+			scheduleSynthMidiEvent(noteOff);
+		}
+	}
+
+	scheduleSynthMidiEvent(event);
+	return true;
+}
+
+/**
+\brief send a MIDI event (from the host or a voice steal) towards the synth engine(s)
+
+Operation:
+- the idle detector tracks it first, so it wakes an idle synth before this block is rendered
+- then it is scheduled for its sub-block; if the scheduler is full it goes out at the block start
+
+\param event the MIDI event
+*/
+void PluginCore::scheduleSynthMidiEvent(midiEvent& event)
+{
+	// --- track held notes
+	silenceDetector.addMidiEvent(event);
+
+	if (!midiSubBlockScheduler.addEvent(event, midiFireOffset))
+		dispatchSynthMidiEvent(event);
+}
+
+/**
+\brief push a MIDI event to the synth engine(s) for the next render
+
+\param event the MIDI event
+*/
+void PluginCore::dispatchSynthMidiEvent(midiEvent& event)
+{
+	// --- push to queue for block processing
 	SynthLab::midiEvent synthEvent(event.midiMessage,
 		event.midiChannel, event.midiData1, event.midiData2,
 		event.midiSampleOffset);
 
-	// --- push into vector
-	synthBlockProcInfo.pushMidiEvent(synthEvent);
+	// --- push into vector, or the owning shard's vector
+	if (renderShardCount > 1)
+		routeShardMidiEvent(synthEvent);
+	else
+		synthBlockProcInfo.pushMidiEvent(synthEvent);
+}
+
+/**
+\brief clear the MIDI queues of the synth engine(s) between sub-blocks
+*/
+void PluginCore::clearSynthMidiEvents()
+{
+	synthBlockProcInfo.clearMidiEvents();
+	for (uint32_t shard = 1; shard < renderShardCount; shard++)
+		renderShards[shard].synthProcInfo.clearMidiEvents();
+}
+
+/**
+\brief grow the MIDI queues of the synth engine(s) to SYNTH_MIDI_EVENT_RESERVE events
+
+NOTES:
+- the queues are vectors that keep their capacity when cleared, so filling and clearing them
+  once here means pushMidiEvent( ) does not allocate on the audio thread
+- NOT realtime safe; call from initialize( )
+*/
+void PluginCore::reserveSynthMidiEvents()
+{
+	SynthLab::midiEvent reserveEvent(0, 0, 0, 0, 0);
+	for (uint32_t i = 0; i < SYNTH_MIDI_EVENT_RESERVE; i++)
+	{
+		synthBlockProcInfo.pushMidiEvent(reserveEvent);
+		for (uint32_t shard = 1; shard < renderShardCount; shard++)
+			renderShards[shard].synthProcInfo.pushMidiEvent(reserveEvent);
+	}
+	clearSynthMidiEvents();
+}
+
+/**
+\brief check that the host output buffers can be used as the synth's render target
+
+NOTES:
+- the synth always renders stereo, so mono (or surround) outputs use the copy path
+- the synth renders float, so 64-bit host buffers use the (converting) copy path
+- unaligned sub-blocks use the copy path (16-byte, SSE alignment)
+- aliased channels (one buffer for both, or overlapping ranges) use the copy path
+
+\param blockInfo structure of information about *block* processing
+\param subBlockStart offset of the sub-block within the block
+\param subBlockLength number of samples to render
+
+\return true if the synth may render directly into the host buffers
+*/
+bool PluginCore::canRenderToHostBuffers(ProcessBlockInfo& blockInfo, uint32_t subBlockStart, uint32_t subBlockLength)
+{
+	if (blockInfo.numAudioOutChannels != SynthLab::STEREO_CHANNELS || !blockInfo.outputs)
+		return false;
+
+	if (!blockInfo.outputs[0] || !blockInfo.outputs[1])
+		return false;
+
+	float* left = blockInfo.outputs[0] + blockInfo.blockStartIndex + subBlockStart;
+	float* right = blockInfo.outputs[1] + blockInfo.blockStartIndex + subBlockStart;
 
+	// --- alignment
+	const uintptr_t alignmentMask = 15;
+	if ((((uintptr_t)left) | ((uintptr_t)right)) & alignmentMask)
+		return false;
 
+	// --- aliasing
+	if (left < right + subBlockLength && right < left + subBlockLength)
+		return false;
 
 	return true;
 }
 
+/**
+\brief send a MIDI event to the render shard that owns its note
+
+NOTES:
+- notes are only spread across shards in Poly mode; Mono, Legato and Unison modes need a single voice allocator
+- channel messages (CC, pitch bend, etc...) go to every shard
+
+\param event the SynthLab MIDI event to route
+*/
+void PluginCore::routeShardMidiEvent(SynthLab::midiEvent& event)
+{
+	bool allowSpread = compareEnumToInt(synthModeEnum::Poly, synthMode);
+
+	int32_t shard = shardNoteRouter.getShardForMessage(event.midiMessage, event.midiChannel,
+													   event.midiData1, event.midiData2, allowSpread);
+	if (shard == 0)
+		synthBlockProcInfo.pushMidiEvent(event);
+	else if (shard > 0)
+		renderShards[shard].synthProcInfo.pushMidiEvent(event);
+	else
+	{
+		synthBlockProcInfo.pushMidiEvent(event);
+		for (uint32_t i = 1; i < renderShardCount; i++)
+			renderShards[i].synthProcInfo.pushMidiEvent(event);
+	}
+}
+
+/**
+\brief IRenderJob: render one shard; called from RenderWorkerPool threads
+
+\param jobIndex the shard index
+*/
+void PluginCore::renderJob(uint32_t jobIndex)
+{
+	if (jobIndex == 0)
+		synthEngine->render(synthBlockProcInfo);
+	else if (jobIndex < renderShardCount)
+		renderShards[jobIndex].engine->render(renderShards[jobIndex].synthProcInfo);
+}
+
 /**
 \brief (for future use)
 
@@ -4096,987 +4922,980 @@ bool PluginCore::setVectorJoystickParameters(const VectorJoystickData& vectorJoy
 }
 
 /**
-\brief use this method to add new presets to the list
+\brief use this method to add new presets to the shared preset catalog
 
 NOTES:
 - see the SDK for examples of use
+- this is called once per process, by the first instance that needs a preset; do not touch
+  any per-instance state here
+- only the values set with setPresetParameter( ) are stored; a preset's full parameter list is
+  created from the defaults the first time it is applied
 - for non RackAFX users that have large paramter counts, there is a secret GUI control you
   can enable to write C++ code into text files, one per preset. See the SDK or http://www.willpirkle.com for details
 
 \return true if operation succeeds, false otherwise
 */
-bool PluginCore::initPluginPresets()
+bool PluginCore::initPluginPresets(PresetCatalog& presetCatalog)
 {
 	// **--0xFF7A--**
 
 	// --- Plugin Presets 
-	int index = 0;
-	PresetInfo* preset = nullptr;
+	uint32_t preset = 0;
 
 	// --- Preset: Init Patch
-	preset = new PresetInfo(index++, "Init Patch");
-	initPresetParameters(preset->presetParameters);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_waveform, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_mode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_frequency_Hz, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_outputAmplitude, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_quantize, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_attackTime_mSec, 25.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_decayTime_mSec, 300.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_sustainLevel, 0.707000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_releaseTime_mSec, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc1_waveform, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc1CoarseDetune, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc1FineDetune, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc1_panValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc1OutputAmplitude_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc1_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::osc1_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc1_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc1_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1Algorithm, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_fc, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_Q, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1Output_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::enableFilter1KeyTrack, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_attackTime_mSec, 25.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_decayTime_mSec, 300.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_sustainLevel, 0.707000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_releaseTime_mSec, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_waveform, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_mode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_frequency_Hz, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_outputAmplitude, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_quantize, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_attackTime_mSec, 25.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_decayTime_mSec, 300.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_sustainLevel, 0.707000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_releaseTime_mSec, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2Algorithm, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_fc, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_Q, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::enableFilter2KeyTrack, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2Output_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::globalVolume_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::globalTuning, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::globalUnisonDetune_Cents, 5.000000);
-	setPresetParameter(preset->presetParameters, controlID::globalPitchBendSens, 12.000000);
-	setPresetParameter(preset->presetParameters, controlID::synthMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc2_waveform, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc2CoarseDetune, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc2FineDetune, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc2_panValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc2OutputAmplitude_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc2_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::osc2_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc2_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc2_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc3_waveform, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc3CoarseDetune, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc3FineDetune, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc3_panValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc3OutputAmplitude_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc3_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::osc3_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc3_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc3_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc4_waveform, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc4CoarseDetune, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc4FineDetune, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc4_panValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc4OutputAmplitude_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc4_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::osc4_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc4_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc4_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::glideTime_mSec, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc123_fo_Int, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc4_fo_Int, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc123_Mod_Int, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc4_Mod_Int, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_fc_Int, 0.750000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_fc_Int, 0.750000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_fo_Int, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1SourceInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2SourceInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGSourceInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGBiasedSourceInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_osc123_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_osc04_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_osc123_Mod, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_osc04_Mod, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_osc123_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_osc04_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_osc123_Mod, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_osc04_Mod, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_osc123_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_osc04_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_osc123_Mod, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_osc04_Mod, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_osc123_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_osc04_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_osc123_Mod, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_osc04_Mod, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterModeIndex, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::enableDelayFX, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::leftDelay_mSec, 500.000000);
-	setPresetParameter(preset->presetParameters, controlID::rightDelay_mSec, 500.000000);
-	setPresetParameter(preset->presetParameters, controlID::feedback_Pct, 20.000000);
-	setPresetParameter(preset->presetParameters, controlID::dryLevel_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wetLevel_dB, -6.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGIntensity, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGTrigInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::dcaPanInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGSourceInt, 0.750000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_osc123_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_osc04_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_osc123_Mod, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_osc04_Mod, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_filter1_fc, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_filter2_fc, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2Core, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGCore, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGCore, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGCore, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1Core, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2Core, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc1Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc2Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc3Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc4Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::OSC_SWITCHER, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::LFO_SWITCHER, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::EG_SWITCHER, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::FILTER_SWITCHER, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::MAIN_SWITCHER, 0.000000);
-	addPreset(preset);
+	preset = presetCatalog.addPreset("Init Patch");
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_waveform, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_mode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_frequency_Hz, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_outputAmplitude, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_quantize, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_attackTime_mSec, 25.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_decayTime_mSec, 300.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_sustainLevel, 0.707000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_releaseTime_mSec, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc1_waveform, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc1CoarseDetune, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc1FineDetune, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc1_panValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc1OutputAmplitude_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc1_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::osc1_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc1_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc1_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1Algorithm, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_fc, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_Q, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1Output_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::enableFilter1KeyTrack, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_attackTime_mSec, 25.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_decayTime_mSec, 300.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_sustainLevel, 0.707000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_releaseTime_mSec, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_waveform, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_mode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_frequency_Hz, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_outputAmplitude, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_quantize, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_attackTime_mSec, 25.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_decayTime_mSec, 300.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_sustainLevel, 0.707000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_releaseTime_mSec, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2Algorithm, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_fc, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_Q, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::enableFilter2KeyTrack, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2Output_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::globalVolume_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::globalTuning, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::globalUnisonDetune_Cents, 5.000000);
+	presetCatalog.setPresetParameter(preset, controlID::globalPitchBendSens, 12.000000);
+	presetCatalog.setPresetParameter(preset, controlID::synthMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc2_waveform, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc2CoarseDetune, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc2FineDetune, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc2_panValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc2OutputAmplitude_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc2_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::osc2_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc2_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc2_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc3_waveform, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc3CoarseDetune, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc3FineDetune, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc3_panValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc3OutputAmplitude_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc3_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::osc3_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc3_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc3_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc4_waveform, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc4CoarseDetune, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc4FineDetune, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc4_panValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc4OutputAmplitude_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc4_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::osc4_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc4_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc4_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::glideTime_mSec, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc123_fo_Int, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc4_fo_Int, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc123_Mod_Int, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc4_Mod_Int, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_fc_Int, 0.750000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_fc_Int, 0.750000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_fo_Int, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1SourceInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2SourceInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGSourceInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGBiasedSourceInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_osc123_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_osc04_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_osc123_Mod, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_osc04_Mod, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_osc123_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_osc04_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_osc123_Mod, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_osc04_Mod, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_osc123_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_osc04_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_osc123_Mod, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_osc04_Mod, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_osc123_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_osc04_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_osc123_Mod, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_osc04_Mod, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterModeIndex, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::enableDelayFX, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::leftDelay_mSec, 500.000000);
+	presetCatalog.setPresetParameter(preset, controlID::rightDelay_mSec, 500.000000);
+	presetCatalog.setPresetParameter(preset, controlID::feedback_Pct, 20.000000);
+	presetCatalog.setPresetParameter(preset, controlID::dryLevel_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wetLevel_dB, -6.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGIntensity, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGTrigInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::dcaPanInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGSourceInt, 0.750000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_osc123_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_osc04_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_osc123_Mod, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_osc04_Mod, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_filter1_fc, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_filter2_fc, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2Core, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGCore, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGCore, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGCore, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1Core, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2Core, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc1Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc2Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc3Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc4Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::OSC_SWITCHER, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::LFO_SWITCHER, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::EG_SWITCHER, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::FILTER_SWITCHER, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::MAIN_SWITCHER, 0.000000);
 
 	// --- Preset: SooperSaw
-	preset = new PresetInfo(index++, "SooperSaw");
-	initPresetParameters(preset->presetParameters);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_waveform, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_mode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_frequency_Hz, 0.058745);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_outputAmplitude, 0.700000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobB, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobC, 0.840000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_quantize, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_attackTime_mSec, 25.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_decayTime_mSec, 300.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_sustainLevel, 0.707000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_releaseTime_mSec, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc1_waveform, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc1CoarseDetune, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc1FineDetune, -4.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc1_panValue, -1.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc1OutputAmplitude_dB, 12.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc1_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::osc1_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc1_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc1_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1Algorithm, 13.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobC, 0.410000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobD, 0.510000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_fc, 872.801453);
-	setPresetParameter(preset->presetParameters, controlID::filter1_Q, 6.264999);
-	setPresetParameter(preset->presetParameters, controlID::filter1Output_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::enableFilter1KeyTrack, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_attackTime_mSec, 775.022461);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_decayTime_mSec, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_sustainLevel, 0.707000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_releaseTime_mSec, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_waveform, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_mode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_frequency_Hz, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_outputAmplitude, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_quantize, 9.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobB, 0.795000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobC, 0.335000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_attackTime_mSec, 25.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_decayTime_mSec, 300.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_sustainLevel, 0.707000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_releaseTime_mSec, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2Algorithm, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_fc, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_Q, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::enableFilter2KeyTrack, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2Output_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::globalVolume_dB, 3.000000);
-	setPresetParameter(preset->presetParameters, controlID::globalTuning, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::globalUnisonDetune_Cents, 5.625000);
-	setPresetParameter(preset->presetParameters, controlID::globalPitchBendSens, 12.000000);
-	setPresetParameter(preset->presetParameters, controlID::synthMode, 4.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc2_waveform, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc2CoarseDetune, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc2FineDetune, 8.000004);
-	setPresetParameter(preset->presetParameters, controlID::osc2_panValue, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc2OutputAmplitude_dB, 12.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc2_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::osc2_ModKnobB, 0.030000);
-	setPresetParameter(preset->presetParameters, controlID::osc2_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc2_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc3_waveform, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc3CoarseDetune, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc3FineDetune, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc3_panValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc3OutputAmplitude_dB, 12.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc3_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::osc3_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc3_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc3_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc4_waveform, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc4CoarseDetune, -12.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc4FineDetune, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc4_panValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc4OutputAmplitude_dB, 12.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc4_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::osc4_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc4_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc4_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::glideTime_mSec, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc123_fo_Int, 0.630000);
-	setPresetParameter(preset->presetParameters, controlID::osc4_fo_Int, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc123_Mod_Int, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc4_Mod_Int, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_fc_Int, 0.800000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_fc_Int, 0.440000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_fo_Int, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1SourceInt, 0.660000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2SourceInt, 0.750000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGSourceInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGBiasedSourceInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_osc123_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_osc04_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_osc123_Mod, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_osc04_Mod, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_filter1_fc, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_filter2_fc, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_osc123_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_osc04_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_osc123_Mod, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_osc04_Mod, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_osc123_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_osc04_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_osc123_Mod, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_osc04_Mod, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_osc123_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_osc04_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_osc123_Mod, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_osc04_Mod, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterModeIndex, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::enableDelayFX, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::leftDelay_mSec, 110.000015);
-	setPresetParameter(preset->presetParameters, controlID::rightDelay_mSec, 160.000015);
-	setPresetParameter(preset->presetParameters, controlID::feedback_Pct, 30.000002);
-	setPresetParameter(preset->presetParameters, controlID::dryLevel_dB, 0.719997);
-	setPresetParameter(preset->presetParameters, controlID::wetLevel_dB, -6.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGIntensity, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGTrigInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::dcaPanInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGSourceInt, 0.750000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_osc123_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_osc04_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_osc123_Mod, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_osc04_Mod, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_filter1_fc, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_filter2_fc, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGCore, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGCore, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGCore, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc1Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc2Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc3Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc4Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::OSC_SWITCHER, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::LFO_SWITCHER, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::EG_SWITCHER, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::FILTER_SWITCHER, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::MAIN_SWITCHER, 0.000000);
-	addPreset(preset);
+	preset = presetCatalog.addPreset("SooperSaw");
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_waveform, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_mode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_frequency_Hz, 0.058745);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_outputAmplitude, 0.700000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobB, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobC, 0.840000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_quantize, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_attackTime_mSec, 25.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_decayTime_mSec, 300.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_sustainLevel, 0.707000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_releaseTime_mSec, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc1_waveform, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc1CoarseDetune, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc1FineDetune, -4.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc1_panValue, -1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc1OutputAmplitude_dB, 12.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc1_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::osc1_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc1_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc1_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1Algorithm, 13.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobC, 0.410000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobD, 0.510000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_fc, 872.801453);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_Q, 6.264999);
+	presetCatalog.setPresetParameter(preset, controlID::filter1Output_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::enableFilter1KeyTrack, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_attackTime_mSec, 775.022461);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_decayTime_mSec, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_sustainLevel, 0.707000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_releaseTime_mSec, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_waveform, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_mode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_frequency_Hz, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_outputAmplitude, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_quantize, 9.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobB, 0.795000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobC, 0.335000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_attackTime_mSec, 25.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_decayTime_mSec, 300.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_sustainLevel, 0.707000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_releaseTime_mSec, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2Algorithm, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_fc, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_Q, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::enableFilter2KeyTrack, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2Output_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::globalVolume_dB, 3.000000);
+	presetCatalog.setPresetParameter(preset, controlID::globalTuning, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::globalUnisonDetune_Cents, 5.625000);
+	presetCatalog.setPresetParameter(preset, controlID::globalPitchBendSens, 12.000000);
+	presetCatalog.setPresetParameter(preset, controlID::synthMode, 4.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc2_waveform, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc2CoarseDetune, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc2FineDetune, 8.000004);
+	presetCatalog.setPresetParameter(preset, controlID::osc2_panValue, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc2OutputAmplitude_dB, 12.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc2_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::osc2_ModKnobB, 0.030000);
+	presetCatalog.setPresetParameter(preset, controlID::osc2_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc2_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc3_waveform, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc3CoarseDetune, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc3FineDetune, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc3_panValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc3OutputAmplitude_dB, 12.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc3_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::osc3_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc3_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc3_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc4_waveform, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc4CoarseDetune, -12.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc4FineDetune, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc4_panValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc4OutputAmplitude_dB, 12.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc4_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::osc4_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc4_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc4_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::glideTime_mSec, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc123_fo_Int, 0.630000);
+	presetCatalog.setPresetParameter(preset, controlID::osc4_fo_Int, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc123_Mod_Int, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc4_Mod_Int, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_fc_Int, 0.800000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_fc_Int, 0.440000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_fo_Int, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1SourceInt, 0.660000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2SourceInt, 0.750000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGSourceInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGBiasedSourceInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_osc123_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_osc04_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_osc123_Mod, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_osc04_Mod, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_filter1_fc, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_filter2_fc, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_osc123_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_osc04_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_osc123_Mod, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_osc04_Mod, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_osc123_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_osc04_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_osc123_Mod, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_osc04_Mod, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_osc123_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_osc04_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_osc123_Mod, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_osc04_Mod, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterModeIndex, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::enableDelayFX, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::leftDelay_mSec, 110.000015);
+	presetCatalog.setPresetParameter(preset, controlID::rightDelay_mSec, 160.000015);
+	presetCatalog.setPresetParameter(preset, controlID::feedback_Pct, 30.000002);
+	presetCatalog.setPresetParameter(preset, controlID::dryLevel_dB, 0.719997);
+	presetCatalog.setPresetParameter(preset, controlID::wetLevel_dB, -6.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGIntensity, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGTrigInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::dcaPanInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGSourceInt, 0.750000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_osc123_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_osc04_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_osc123_Mod, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_osc04_Mod, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_filter1_fc, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_filter2_fc, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGCore, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGCore, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGCore, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc1Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc2Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc3Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc4Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::OSC_SWITCHER, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::LFO_SWITCHER, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::EG_SWITCHER, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::FILTER_SWITCHER, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::MAIN_SWITCHER, 0.000000);
 
 	// --- Preset: SooperSquare
-	preset = new PresetInfo(index++, "SooperSquare");
-	initPresetParameters(preset->presetParameters);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_waveform, 9.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_mode, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_frequency_Hz, 20.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_outputAmplitude, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobA, 0.525000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_quantize, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_attackTime_mSec, 0.100000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_decayTime_mSec, 3500.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_sustainLevel, 0.707000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_releaseTime_mSec, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc1_waveform, 2.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc1CoarseDetune, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc1FineDetune, 8.999996);
-	setPresetParameter(preset->presetParameters, controlID::osc1_panValue, -1.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc1OutputAmplitude_dB, 7.320000);
-	setPresetParameter(preset->presetParameters, controlID::osc1_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::osc1_ModKnobB, 0.265000);
-	setPresetParameter(preset->presetParameters, controlID::osc1_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc1_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1Algorithm, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_fc, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_Q, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1Output_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::enableFilter1KeyTrack, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_attackTime_mSec, 25.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_decayTime_mSec, 300.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_sustainLevel, 0.707000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_releaseTime_mSec, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_waveform, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_mode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_frequency_Hz, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_outputAmplitude, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_quantize, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_attackTime_mSec, 25.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_decayTime_mSec, 300.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_sustainLevel, 0.707000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_releaseTime_mSec, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2Algorithm, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_fc, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_Q, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::enableFilter2KeyTrack, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2Output_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::globalVolume_dB, 2.000000);
-	setPresetParameter(preset->presetParameters, controlID::globalTuning, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::globalUnisonDetune_Cents, 5.625000);
-	setPresetParameter(preset->presetParameters, controlID::globalPitchBendSens, 12.000000);
-	setPresetParameter(preset->presetParameters, controlID::synthMode, 4.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc2_waveform, 2.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc2CoarseDetune, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc2FineDetune, -3.500000);
-	setPresetParameter(preset->presetParameters, controlID::osc2_panValue, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc2OutputAmplitude_dB, 2.459995);
-	setPresetParameter(preset->presetParameters, controlID::osc2_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::osc2_ModKnobB, 0.530000);
-	setPresetParameter(preset->presetParameters, controlID::osc2_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc2_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc3_waveform, 2.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc3CoarseDetune, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc3FineDetune, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc3_panValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc3OutputAmplitude_dB, 4.799995);
-	setPresetParameter(preset->presetParameters, controlID::osc3_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::osc3_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc3_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc3_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc4_waveform, 2.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc4CoarseDetune, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc4FineDetune, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc4_panValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc4OutputAmplitude_dB, 4.799995);
-	setPresetParameter(preset->presetParameters, controlID::osc4_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::osc4_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc4_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc4_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::glideTime_mSec, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc123_fo_Int, 0.870000);
-	setPresetParameter(preset->presetParameters, controlID::osc4_fo_Int, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc123_Mod_Int, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc4_Mod_Int, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_fc_Int, 0.750000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_fc_Int, 0.750000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_fo_Int, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1SourceInt, 0.650000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2SourceInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGSourceInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGBiasedSourceInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_osc123_fc, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_osc04_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_osc123_Mod, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_osc04_Mod, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_osc123_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_osc04_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_osc123_Mod, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_osc04_Mod, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_osc123_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_osc04_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_osc123_Mod, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_osc04_Mod, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_osc123_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_osc04_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_osc123_Mod, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_osc04_Mod, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterModeIndex, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::enableDelayFX, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::leftDelay_mSec, 50.000011);
-	setPresetParameter(preset->presetParameters, controlID::rightDelay_mSec, 50.000011);
-	setPresetParameter(preset->presetParameters, controlID::feedback_Pct, 30.000002);
-	setPresetParameter(preset->presetParameters, controlID::dryLevel_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wetLevel_dB, -6.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGIntensity, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGTrigInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::dcaPanInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGSourceInt, 0.750000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_osc123_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_osc04_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_osc123_Mod, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_osc04_Mod, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_filter1_fc, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_filter2_fc, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGCore, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGCore, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGCore, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc1Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc2Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc3Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc4Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::OSC_SWITCHER, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::LFO_SWITCHER, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::EG_SWITCHER, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::FILTER_SWITCHER, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::MAIN_SWITCHER, 0.000000);
-	addPreset(preset);
+	preset = presetCatalog.addPreset("SooperSquare");
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_waveform, 9.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_mode, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_frequency_Hz, 20.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_outputAmplitude, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobA, 0.525000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_quantize, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_attackTime_mSec, 0.100000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_decayTime_mSec, 3500.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_sustainLevel, 0.707000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_releaseTime_mSec, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc1_waveform, 2.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc1CoarseDetune, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc1FineDetune, 8.999996);
+	presetCatalog.setPresetParameter(preset, controlID::osc1_panValue, -1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc1OutputAmplitude_dB, 7.320000);
+	presetCatalog.setPresetParameter(preset, controlID::osc1_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::osc1_ModKnobB, 0.265000);
+	presetCatalog.setPresetParameter(preset, controlID::osc1_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc1_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1Algorithm, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_fc, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_Q, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1Output_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::enableFilter1KeyTrack, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_attackTime_mSec, 25.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_decayTime_mSec, 300.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_sustainLevel, 0.707000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_releaseTime_mSec, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_waveform, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_mode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_frequency_Hz, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_outputAmplitude, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_quantize, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_attackTime_mSec, 25.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_decayTime_mSec, 300.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_sustainLevel, 0.707000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_releaseTime_mSec, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2Algorithm, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_fc, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_Q, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::enableFilter2KeyTrack, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2Output_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::globalVolume_dB, 2.000000);
+	presetCatalog.setPresetParameter(preset, controlID::globalTuning, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::globalUnisonDetune_Cents, 5.625000);
+	presetCatalog.setPresetParameter(preset, controlID::globalPitchBendSens, 12.000000);
+	presetCatalog.setPresetParameter(preset, controlID::synthMode, 4.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc2_waveform, 2.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc2CoarseDetune, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc2FineDetune, -3.500000);
+	presetCatalog.setPresetParameter(preset, controlID::osc2_panValue, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc2OutputAmplitude_dB, 2.459995);
+	presetCatalog.setPresetParameter(preset, controlID::osc2_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::osc2_ModKnobB, 0.530000);
+	presetCatalog.setPresetParameter(preset, controlID::osc2_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc2_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc3_waveform, 2.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc3CoarseDetune, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc3FineDetune, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc3_panValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc3OutputAmplitude_dB, 4.799995);
+	presetCatalog.setPresetParameter(preset, controlID::osc3_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::osc3_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc3_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc3_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc4_waveform, 2.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc4CoarseDetune, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc4FineDetune, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc4_panValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc4OutputAmplitude_dB, 4.799995);
+	presetCatalog.setPresetParameter(preset, controlID::osc4_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::osc4_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc4_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc4_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::glideTime_mSec, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc123_fo_Int, 0.870000);
+	presetCatalog.setPresetParameter(preset, controlID::osc4_fo_Int, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc123_Mod_Int, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc4_Mod_Int, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_fc_Int, 0.750000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_fc_Int, 0.750000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_fo_Int, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1SourceInt, 0.650000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2SourceInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGSourceInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGBiasedSourceInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_osc123_fc, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_osc04_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_osc123_Mod, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_osc04_Mod, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_osc123_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_osc04_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_osc123_Mod, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_osc04_Mod, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_osc123_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_osc04_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_osc123_Mod, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_osc04_Mod, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_osc123_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_osc04_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_osc123_Mod, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_osc04_Mod, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterModeIndex, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::enableDelayFX, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::leftDelay_mSec, 50.000011);
+	presetCatalog.setPresetParameter(preset, controlID::rightDelay_mSec, 50.000011);
+	presetCatalog.setPresetParameter(preset, controlID::feedback_Pct, 30.000002);
+	presetCatalog.setPresetParameter(preset, controlID::dryLevel_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wetLevel_dB, -6.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGIntensity, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGTrigInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::dcaPanInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGSourceInt, 0.750000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_osc123_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_osc04_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_osc123_Mod, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_osc04_Mod, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_filter1_fc, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_filter2_fc, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGCore, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGCore, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGCore, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc1Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc2Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc3Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc4Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::OSC_SWITCHER, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::LFO_SWITCHER, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::EG_SWITCHER, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::FILTER_SWITCHER, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::MAIN_SWITCHER, 0.000000);
 
 	// --- Preset: SquareDutyMod
-	preset = new PresetInfo(index++, "SquareDutyMod");
-	initPresetParameters(preset->presetParameters);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_waveform, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_mode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_frequency_Hz, 0.208435);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_outputAmplitude, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_quantize, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_attackTime_mSec, 0.100000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_decayTime_mSec, 2250.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_sustainLevel, 0.707000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_releaseTime_mSec, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc1_waveform, 2.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc1CoarseDetune, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc1FineDetune, 13.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc1_panValue, -0.680000);
-	setPresetParameter(preset->presetParameters, controlID::osc1OutputAmplitude_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc1_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::osc1_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc1_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc1_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1Algorithm, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_fc, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_Q, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1Output_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::enableFilter1KeyTrack, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_attackTime_mSec, 25.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_decayTime_mSec, 300.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_sustainLevel, 0.707000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_releaseTime_mSec, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_waveform, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_mode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_frequency_Hz, 0.153472);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_outputAmplitude, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_quantize, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobA, 0.570000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobB, 0.340000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobC, 0.360000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_attackTime_mSec, 2074.979492);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_decayTime_mSec, 2000.000122);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_sustainLevel, 0.267000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_releaseTime_mSec, 3200.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobA, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2Algorithm, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_fc, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_Q, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::enableFilter2KeyTrack, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2Output_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::globalVolume_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::globalTuning, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::globalUnisonDetune_Cents, 5.625000);
-	setPresetParameter(preset->presetParameters, controlID::globalPitchBendSens, 12.000000);
-	setPresetParameter(preset->presetParameters, controlID::synthMode, 4.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc2_waveform, 2.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc2CoarseDetune, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc2FineDetune, -10.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc2_panValue, 0.540000);
-	setPresetParameter(preset->presetParameters, controlID::osc2OutputAmplitude_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc2_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::osc2_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc2_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc2_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc3_waveform, 2.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc3CoarseDetune, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc3FineDetune, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc3_panValue, 0.050000);
-	setPresetParameter(preset->presetParameters, controlID::osc3OutputAmplitude_dB, 12.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc3_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::osc3_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc3_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc3_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc4_waveform, 2.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc4CoarseDetune, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc4FineDetune, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc4_panValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc4OutputAmplitude_dB, 12.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc4_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::osc4_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc4_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc4_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::glideTime_mSec, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc123_fo_Int, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc4_fo_Int, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc123_Mod_Int, 0.820000);
-	setPresetParameter(preset->presetParameters, controlID::osc4_Mod_Int, 0.010000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_fc_Int, 0.750000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_fc_Int, 0.750000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_fo_Int, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1SourceInt, 0.680000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2SourceInt, 0.750000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGSourceInt, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGBiasedSourceInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_osc123_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_osc04_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_osc123_Mod, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_osc04_Mod, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_osc123_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_osc04_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_osc123_Mod, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_osc04_Mod, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_osc123_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_osc04_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_osc123_Mod, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_osc04_Mod, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_osc123_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_osc04_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_osc123_Mod, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_osc04_Mod, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterModeIndex, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::enableDelayFX, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::leftDelay_mSec, 240.000015);
-	setPresetParameter(preset->presetParameters, controlID::rightDelay_mSec, 279.999969);
-	setPresetParameter(preset->presetParameters, controlID::feedback_Pct, 30.000002);
-	setPresetParameter(preset->presetParameters, controlID::dryLevel_dB, -1.080002);
-	setPresetParameter(preset->presetParameters, controlID::wetLevel_dB, -6.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGIntensity, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGTrigInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::dcaPanInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGSourceInt, 0.750000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_osc123_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_osc04_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_osc123_Mod, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_osc04_Mod, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_filter1_fc, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_filter2_fc, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGCore, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGCore, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGCore, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc1Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc2Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc3Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc4Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::OSC_SWITCHER, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::LFO_SWITCHER, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::EG_SWITCHER, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::FILTER_SWITCHER, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::MAIN_SWITCHER, 0.000000);
-	addPreset(preset);
+	preset = presetCatalog.addPreset("SquareDutyMod");
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_waveform, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_mode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_frequency_Hz, 0.208435);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_outputAmplitude, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_quantize, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_attackTime_mSec, 0.100000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_decayTime_mSec, 2250.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_sustainLevel, 0.707000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_releaseTime_mSec, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc1_waveform, 2.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc1CoarseDetune, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc1FineDetune, 13.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc1_panValue, -0.680000);
+	presetCatalog.setPresetParameter(preset, controlID::osc1OutputAmplitude_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc1_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::osc1_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc1_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc1_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1Algorithm, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_fc, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_Q, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1Output_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::enableFilter1KeyTrack, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_attackTime_mSec, 25.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_decayTime_mSec, 300.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_sustainLevel, 0.707000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_releaseTime_mSec, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_waveform, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_mode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_frequency_Hz, 0.153472);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_outputAmplitude, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_quantize, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobA, 0.570000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobB, 0.340000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobC, 0.360000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_attackTime_mSec, 2074.979492);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_decayTime_mSec, 2000.000122);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_sustainLevel, 0.267000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_releaseTime_mSec, 3200.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobA, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2Algorithm, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_fc, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_Q, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::enableFilter2KeyTrack, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2Output_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::globalVolume_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::globalTuning, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::globalUnisonDetune_Cents, 5.625000);
+	presetCatalog.setPresetParameter(preset, controlID::globalPitchBendSens, 12.000000);
+	presetCatalog.setPresetParameter(preset, controlID::synthMode, 4.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc2_waveform, 2.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc2CoarseDetune, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc2FineDetune, -10.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc2_panValue, 0.540000);
+	presetCatalog.setPresetParameter(preset, controlID::osc2OutputAmplitude_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc2_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::osc2_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc2_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc2_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc3_waveform, 2.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc3CoarseDetune, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc3FineDetune, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc3_panValue, 0.050000);
+	presetCatalog.setPresetParameter(preset, controlID::osc3OutputAmplitude_dB, 12.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc3_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::osc3_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc3_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc3_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc4_waveform, 2.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc4CoarseDetune, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc4FineDetune, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc4_panValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc4OutputAmplitude_dB, 12.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc4_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::osc4_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc4_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc4_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::glideTime_mSec, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc123_fo_Int, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc4_fo_Int, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc123_Mod_Int, 0.820000);
+	presetCatalog.setPresetParameter(preset, controlID::osc4_Mod_Int, 0.010000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_fc_Int, 0.750000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_fc_Int, 0.750000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_fo_Int, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1SourceInt, 0.680000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2SourceInt, 0.750000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGSourceInt, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGBiasedSourceInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_osc123_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_osc04_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_osc123_Mod, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_osc04_Mod, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_osc123_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_osc04_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_osc123_Mod, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_osc04_Mod, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_osc123_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_osc04_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_osc123_Mod, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_osc04_Mod, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_osc123_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_osc04_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_osc123_Mod, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_osc04_Mod, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterModeIndex, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::enableDelayFX, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::leftDelay_mSec, 240.000015);
+	presetCatalog.setPresetParameter(preset, controlID::rightDelay_mSec, 279.999969);
+	presetCatalog.setPresetParameter(preset, controlID::feedback_Pct, 30.000002);
+	presetCatalog.setPresetParameter(preset, controlID::dryLevel_dB, -1.080002);
+	presetCatalog.setPresetParameter(preset, controlID::wetLevel_dB, -6.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGIntensity, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGTrigInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::dcaPanInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGSourceInt, 0.750000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_osc123_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_osc04_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_osc123_Mod, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_osc04_Mod, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_filter1_fc, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_filter2_fc, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGCore, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGCore, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGCore, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc1Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc2Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc3Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc4Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::OSC_SWITCHER, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::LFO_SWITCHER, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::EG_SWITCHER, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::FILTER_SWITCHER, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::MAIN_SWITCHER, 0.000000);
 
 	// --- Preset: EyeOfRSH
-	preset = new PresetInfo(index++, "EyeOfRSH");
-	initPresetParameters(preset->presetParameters);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_waveform, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_mode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_frequency_Hz, 5.357595);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_outputAmplitude, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobB, 0.705000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobC, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_quantize, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_attackTime_mSec, 500.049988);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_decayTime_mSec, 4625.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_sustainLevel, 0.707000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_releaseTime_mSec, 5250.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc1_waveform, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc1CoarseDetune, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc1FineDetune, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc1_panValue, -1.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc1OutputAmplitude_dB, -6.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc1_ModKnobA, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc1_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc1_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc1_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1Algorithm, 13.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobB, 0.810000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobC, 0.645000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobD, 0.540000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_fc, 195.425827);
-	setPresetParameter(preset->presetParameters, controlID::filter1_Q, 7.030000);
-	setPresetParameter(preset->presetParameters, controlID::filter1Output_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::enableFilter1KeyTrack, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_attackTime_mSec, 575.042480);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_decayTime_mSec, 4000.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_sustainLevel, 0.707000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_releaseTime_mSec, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_waveform, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_mode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_frequency_Hz, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_outputAmplitude, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_quantize, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_attackTime_mSec, 2074.979492);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_decayTime_mSec, 2000.000122);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_sustainLevel, 0.267000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_releaseTime_mSec, 3200.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobA, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2Algorithm, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_fc, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_Q, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::enableFilter2KeyTrack, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2Output_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::globalVolume_dB, 1.360001);
-	setPresetParameter(preset->presetParameters, controlID::globalTuning, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::globalUnisonDetune_Cents, 5.625000);
-	setPresetParameter(preset->presetParameters, controlID::globalPitchBendSens, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::synthMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc2_waveform, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc2CoarseDetune, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc2FineDetune, -10.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc2_panValue, 0.680000);
-	setPresetParameter(preset->presetParameters, controlID::osc2OutputAmplitude_dB, -9.599998);
-	setPresetParameter(preset->presetParameters, controlID::osc2_ModKnobA, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc2_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc2_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc2_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc3_waveform, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc3CoarseDetune, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc3FineDetune, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::osc3_panValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc3OutputAmplitude_dB, 12.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc3_ModKnobA, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc3_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc3_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc3_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc4_waveform, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc4CoarseDetune, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc4FineDetune, 2.999996);
-	setPresetParameter(preset->presetParameters, controlID::osc4_panValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc4OutputAmplitude_dB, 12.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc4_ModKnobA, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc4_ModKnobB, 0.385000);
-	setPresetParameter(preset->presetParameters, controlID::osc4_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc4_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::glideTime_mSec, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc123_fo_Int, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc4_fo_Int, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc123_Mod_Int, -0.080000);
-	setPresetParameter(preset->presetParameters, controlID::osc4_Mod_Int, 0.020000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_fc_Int, 0.750000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_fc_Int, 0.750000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_fo_Int, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1SourceInt, 0.890000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2SourceInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGSourceInt, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGBiasedSourceInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_osc123_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_osc04_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_osc123_Mod, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_osc04_Mod, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_filter1_fc, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_osc123_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_osc04_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_osc123_Mod, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_osc04_Mod, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_osc123_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_osc04_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_osc123_Mod, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_osc04_Mod, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_osc123_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_osc04_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_osc123_Mod, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_osc04_Mod, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterModeIndex, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::enableDelayFX, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::leftDelay_mSec, 300.000000);
-	setPresetParameter(preset->presetParameters, controlID::rightDelay_mSec, 260.000031);
-	setPresetParameter(preset->presetParameters, controlID::feedback_Pct, 76.000000);
-	setPresetParameter(preset->presetParameters, controlID::dryLevel_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wetLevel_dB, -11.040001);
-	setPresetParameter(preset->presetParameters, controlID::ampEGIntensity, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGTrigInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::dcaPanInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGSourceInt, 0.750000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_osc123_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_osc04_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_osc123_Mod, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_osc04_Mod, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_filter1_fc, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_filter2_fc, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGCore, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGCore, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGCore, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc1Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc2Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc3Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc4Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::OSC_SWITCHER, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::LFO_SWITCHER, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::EG_SWITCHER, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::FILTER_SWITCHER, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::MAIN_SWITCHER, 0.000000);
-	addPreset(preset);
+	preset = presetCatalog.addPreset("EyeOfRSH");
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_waveform, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_mode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_frequency_Hz, 5.357595);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_outputAmplitude, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobB, 0.705000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobC, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_quantize, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_attackTime_mSec, 500.049988);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_decayTime_mSec, 4625.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_sustainLevel, 0.707000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_releaseTime_mSec, 5250.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc1_waveform, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc1CoarseDetune, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc1FineDetune, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc1_panValue, -1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc1OutputAmplitude_dB, -6.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc1_ModKnobA, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc1_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc1_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc1_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1Algorithm, 13.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobB, 0.810000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobC, 0.645000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobD, 0.540000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_fc, 195.425827);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_Q, 7.030000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1Output_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::enableFilter1KeyTrack, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_attackTime_mSec, 575.042480);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_decayTime_mSec, 4000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_sustainLevel, 0.707000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_releaseTime_mSec, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_waveform, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_mode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_frequency_Hz, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_outputAmplitude, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_quantize, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_attackTime_mSec, 2074.979492);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_decayTime_mSec, 2000.000122);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_sustainLevel, 0.267000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_releaseTime_mSec, 3200.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobA, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2Algorithm, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_fc, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_Q, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::enableFilter2KeyTrack, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2Output_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::globalVolume_dB, 1.360001);
+	presetCatalog.setPresetParameter(preset, controlID::globalTuning, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::globalUnisonDetune_Cents, 5.625000);
+	presetCatalog.setPresetParameter(preset, controlID::globalPitchBendSens, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::synthMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc2_waveform, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc2CoarseDetune, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc2FineDetune, -10.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc2_panValue, 0.680000);
+	presetCatalog.setPresetParameter(preset, controlID::osc2OutputAmplitude_dB, -9.599998);
+	presetCatalog.setPresetParameter(preset, controlID::osc2_ModKnobA, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc2_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc2_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc2_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc3_waveform, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc3CoarseDetune, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc3FineDetune, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::osc3_panValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc3OutputAmplitude_dB, 12.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc3_ModKnobA, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc3_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc3_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc3_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc4_waveform, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc4CoarseDetune, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc4FineDetune, 2.999996);
+	presetCatalog.setPresetParameter(preset, controlID::osc4_panValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc4OutputAmplitude_dB, 12.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc4_ModKnobA, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc4_ModKnobB, 0.385000);
+	presetCatalog.setPresetParameter(preset, controlID::osc4_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc4_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::glideTime_mSec, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc123_fo_Int, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc4_fo_Int, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc123_Mod_Int, -0.080000);
+	presetCatalog.setPresetParameter(preset, controlID::osc4_Mod_Int, 0.020000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_fc_Int, 0.750000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_fc_Int, 0.750000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_fo_Int, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1SourceInt, 0.890000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2SourceInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGSourceInt, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGBiasedSourceInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_osc123_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_osc04_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_osc123_Mod, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_osc04_Mod, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_filter1_fc, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_osc123_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_osc04_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_osc123_Mod, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_osc04_Mod, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_osc123_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_osc04_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_osc123_Mod, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_osc04_Mod, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_osc123_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_osc04_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_osc123_Mod, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_osc04_Mod, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterModeIndex, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::enableDelayFX, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::leftDelay_mSec, 300.000000);
+	presetCatalog.setPresetParameter(preset, controlID::rightDelay_mSec, 260.000031);
+	presetCatalog.setPresetParameter(preset, controlID::feedback_Pct, 76.000000);
+	presetCatalog.setPresetParameter(preset, controlID::dryLevel_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wetLevel_dB, -11.040001);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGIntensity, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGTrigInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::dcaPanInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGSourceInt, 0.750000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_osc123_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_osc04_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_osc123_Mod, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_osc04_Mod, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_filter1_fc, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_filter2_fc, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGCore, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGCore, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGCore, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc1Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc2Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc3Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc4Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::OSC_SWITCHER, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::LFO_SWITCHER, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::EG_SWITCHER, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::FILTER_SWITCHER, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::MAIN_SWITCHER, 0.000000);
 
 
 	// **--0xA7FF--**
@@ -18,14 +18,110 @@
 #include <sstream>
 #include <atomic>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <iomanip>
 #include <iostream>
 
 #include <math.h>
 #include "pluginstructures.h"
 #include "guiconstants.h"
+#include "parameterchangeset.h"
 
 
+/**
+\struct ParameterDescriptor
+\ingroup ASPiK-Core
+\brief
+The part of a PluginParameter that describes it: names, units, limits, taper, string list,
+meter and smoothing settings and the aux attributes. It is the same for every instance of the
+plugin, so PluginParameters share it; see ParameterDescriptorTable.
+
+\author Will Pirkle http://www.willpirkle.com
+\remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
+\version Revision : 1.0
+\date Date : 2018 / 09 / 7
+*/
+struct ParameterDescriptor
+{
+    int controlID = -1;							///< the ID value for the parameter
+    std::string controlName = "ControlName";	///< the name string for the parameter
+    std::string controlUnits = "Units";			///< the units string for the parameter
+    controlVariableType controlType = controlVariableType::kDouble; ///< the control type
+
+    // --- min/max/def
+    double minValue = 0.0;			///< the min for the parameter
+    double maxValue = 1.0;			///< the max for the parameter
+    double defaultValue = 0.0;		///< the default value for the parameter
+
+    // --- control tweakers
+    taper controlTaper = taper::kLinearTaper;	///< the taper
+    uint32_t displayPrecision = 2;				///< sig digits for display
+
+    // --- for enumerated string list
+    std::vector<std::string> stringList;		///< string list
+    std::string commaSeparatedStringList;		///< string list a somma separated string
+
+    // --- gui specific
+    bool appendUnits = true;					///< flag to append units in GUI controls (use with several built-in custom views)
+    bool isWritable = false;					///< flag for meter variables
+	bool isDiscreteSwitch = false;				///< flag for switches (not currently used in ASPiK)
+
+    // --- for VU meters
+    double meterAttack_ms = 10.0;				///< meter attack time in milliseconds
+    double meterRelease_ms = 500.0;				///< meter release time in milliseconds
+    uint32_t detectorMode = ENVELOPE_DETECT_MODE_RMS;///< meter detector mode
+	bool logMeter = false;						///< meter is log
+	bool invertedMeter = false;					///< meter is inverted
+	bool protoolsGRMeter = false;				///< meter is a Pro Tools gain reduction meter
+
+    // --- parameter smoothing settings (the on/off switch and the smoother are per instance)
+    smoothingMethod smoothingType = smoothingMethod::kLPFSmoother;	///< param smoothing type
+    double smoothingTimeMsec = 100.0;			///< param smoothing time
+    double smoothingEpsilon = kSmoothingSettleEpsilon;	///< smoothing snaps to the target within this fraction of the range
+
+    // --- default is enabled; you can disable this for controls that have a long postUpdate cooking time
+    bool enableVSTSampleAccurateAutomation = true;							///< VST3 sample accurate flag
+
+	// --- Aux attributes that can be stored on this object (similar to VSTGUI4) makes it easy to add extra data in the future
+	std::map<uint32_t, AuxParameterAttribute> auxAttributes;	///< map of aux attributes
+};
+
+/**
+\class ParameterDescriptorTable
+\ingroup ASPiK-Core
+\brief
+Process-wide table of published ParameterDescriptors, keyed by control ID.
+
+ParameterDescriptorTable Operations:
+- the first plugin instance publishes the descriptors of its parameters once they are complete
+  (PluginBase::initPluginParameterArray( ))
+- PluginParameter constructors look up their control ID; when the published descriptor matches the
+  constructor arguments it is shared, so later instances do not copy the strings or split the
+  comma separated string lists again
+- published descriptors are never modified; a PluginParameter that changes a shared descriptor
+  gets its own copy first (copy on write)
+- NOT realtime safe; construction only
+
+\author Will Pirkle http://www.willpirkle.com
+\remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
+\version Revision : 1.0
+\date Date : 2018 / 09 / 7
+*/
+class ParameterDescriptorTable
+{
+public:
+	/** the published descriptor for a control ID, or nullptr */
+	static std::shared_ptr<ParameterDescriptor> find(int controlID);
+
+	/** publish a descriptor; the first one published for a control ID is kept */
+	static void publish(const std::shared_ptr<ParameterDescriptor>& descriptor);
+
+protected:
+	static std::mutex& getMutex();
+	static std::map<int, std::shared_ptr<ParameterDescriptor>>& getTable();
+};
+
 /**
 \class PluginParameter
 \ingroup ASPiK-Core
@@ -36,8 +132,10 @@ It is a large object, but it is not complex as it really just stores LOTS of inf
 plugin parameters.
 
 PluginParameter Operations:
-- store attributes of plugin parameters (numerous)
+- store attributes of plugin parameters (numerous) in a ParameterDescriptor that is shared among
+  plugin instances; the setters copy a shared descriptor before changing it
 - store the actual parameter value as an atomic double
+- flag each new value in the owner's ParameterChangeSet, so only changed parameters are synced
 - provide access to the atomic double value as needed (and safely)
 - hold the parameter smoother object
 - store infinite amount of auxilliary data in numerous formats (you can easily add your own)
@@ -78,85 +176,94 @@ public:
 	/** D-TOR */
     virtual ~PluginParameter();
 
-    uint32_t getControlID() { return controlID; }			///< get ID value
-    void setControlID(uint32_t cid) { controlID = cid; }	///< set ID value
+    uint32_t getControlID() { return descriptor->controlID; }			///< get ID value
+    void setControlID(uint32_t cid) { setDescriptorValue(&ParameterDescriptor::controlID, (int)cid); }	///< set ID value
 
-    const char* getControlName() { return controlName.c_str(); }			///< get name as const char*
-    void setControlName(const char* name) { controlName.assign(name); }		///< set name as const char*
+    const char* getControlName() { return descriptor->controlName.c_str(); }	///< get name as const char*
+    void setControlName(const char* name) { if (descriptor->controlName != name) editDescriptor()->controlName.assign(name); }		///< set name as const char*
 
-    const char* getControlUnits() { return controlUnits.c_str(); }			///< get units as const char*
-    void setControlUnits(const char* units) { controlUnits.assign(units); }	///< set units as const char*
+    const char* getControlUnits() { return descriptor->controlUnits.c_str(); }	///< get units as const char*
+    void setControlUnits(const char* units) { if (descriptor->controlUnits != units) editDescriptor()->controlUnits.assign(units); }	///< set units as const char*
 
-    controlVariableType getControlVariableType() { return controlType; }						///< get variable type associated with parameter
-    void setControlVariableType(controlVariableType ctrlVarType) { controlType = ctrlVarType; }	///< set variable type associated with parameter
+    controlVariableType getControlVariableType() { return descriptor->controlType; }								///< get variable type associated with parameter
+    void setControlVariableType(controlVariableType ctrlVarType) { setDescriptorValue(&ParameterDescriptor::controlType, ctrlVarType); }	///< set variable type associated with parameter
 
-    double getMinValue() { return minValue; }				///< get minimum value
-    void setMinValue(double value) { minValue = value; }	///< set minimum value
+    double getMinValue() { return descriptor->minValue; }										///< get minimum value
+    void setMinValue(double value) { setDescriptorValue(&ParameterDescriptor::minValue, value); }	///< set minimum value
 
-    double getMaxValue() { return maxValue; }				///< get maximum value
-    void setMaxValue(double value) { maxValue = value; }	///< set maximum value
+    double getMaxValue() { return descriptor->maxValue; }										///< get maximum value
+    void setMaxValue(double value) { setDescriptorValue(&ParameterDescriptor::maxValue, value); }	///< set maximum value
 
-    double getDefaultValue() { return defaultValue; }				///< get default value
-    void setDefaultValue(double value) { defaultValue = value; }	///< set default value
+    double getDefaultValue() { return descriptor->defaultValue; }										///< get default value
+    void setDefaultValue(double value) { setDescriptorValue(&ParameterDescriptor::defaultValue, value); }	///< set default value
 
-	bool getIsDiscreteSwitch() { return isDiscreteSwitch; }										///< set is switch (not used)
-	void setIsDiscreteSwitch(bool _isDiscreteSwitch) { isDiscreteSwitch = _isDiscreteSwitch; }	///< get is switch (not used)
+	bool getIsDiscreteSwitch() { return descriptor->isDiscreteSwitch; }																///< set is switch (not used)
+	void setIsDiscreteSwitch(bool _isDiscreteSwitch) { setDescriptorValue(&ParameterDescriptor::isDiscreteSwitch, _isDiscreteSwitch); }	///< get is switch (not used)
 
-	taper getControlTaper() { return controlTaper; }					///< get taper
-	void setControlTaper(taper ctrlTaper) { controlTaper = ctrlTaper; }	///< set taper
+	taper getControlTaper() { return descriptor->controlTaper; }										///< get taper
+	void setControlTaper(taper ctrlTaper) { setDescriptorValue(&ParameterDescriptor::controlTaper, ctrlTaper); }	///< set taper
 
     // -- taper getters
-    bool isLinearTaper() { return controlTaper == taper::kLinearTaper ? true : false; }		///< query: linear taper
-    bool isLogTaper() { return controlTaper == taper::kLogTaper ? true : false; }			///< query: log taper
-    bool isAntiLogTaper() { return controlTaper == taper::kAntiLogTaper ? true : false; }		///< query: antilog taper
-    bool isVoltOctaveTaper() { return controlTaper == taper::kVoltOctaveTaper ? true : false; }	///< query: volt/octave taper
+    bool isLinearTaper() { return descriptor->controlTaper == taper::kLinearTaper ? true : false; }		///< query: linear taper
+    bool isLogTaper() { return descriptor->controlTaper == taper::kLogTaper ? true : false; }			///< query: log taper
+    bool isAntiLogTaper() { return descriptor->controlTaper == taper::kAntiLogTaper ? true : false; }	///< query: antilog taper
+    bool isVoltOctaveTaper() { return descriptor->controlTaper == taper::kVoltOctaveTaper ? true : false; }	///< query: volt/octave taper
 
     // --- control type getters
-    bool isMeterParam() { return controlType == controlVariableType::kMeter ? true : false; }					///< query: meter param?
-    bool isStringListParam() { return controlType == controlVariableType::kTypedEnumStringList ? true : false; }///< query: string list para,?
-    bool isFloatParam() { return controlType == controlVariableType::kFloat ? true : false; }					///< query: float param?
-    bool isDoubleParam() { return controlType == controlVariableType::kDouble ? true : false; }					///< query: double param?
-    bool isIntParam() { return controlType == controlVariableType::kInt ? true : false; }						///< query: int param?
-    bool isNonVariableBoundParam() { return controlType == controlVariableType::kNonVariableBoundControl ? true : false; }///< query: non-bound param?
+    bool isMeterParam() { return descriptor->controlType == controlVariableType::kMeter ? true : false; }					///< query: meter param?
+    bool isStringListParam() { return descriptor->controlType == controlVariableType::kTypedEnumStringList ? true : false; }///< query: string list para,?
+    bool isFloatParam() { return descriptor->controlType == controlVariableType::kFloat ? true : false; }					///< query: float param?
+    bool isDoubleParam() { return descriptor->controlType == controlVariableType::kDouble ? true : false; }					///< query: double param?
+    bool isIntParam() { return descriptor->controlType == controlVariableType::kInt ? true : false; }						///< query: int param?
+    bool isNonVariableBoundParam() { return descriptor->controlType == controlVariableType::kNonVariableBoundControl ? true : false; }///< query: non-bound param?
 
-    uint32_t getDisplayPrecision() { return displayPrecision; }						///< get sig digits
-    void setDisplayPrecision(uint32_t precision) { displayPrecision = precision; }	///< set sig digits
+    uint32_t getDisplayPrecision() { return descriptor->displayPrecision; }											///< get sig digits
+    void setDisplayPrecision(uint32_t precision) { setDescriptorValue(&ParameterDescriptor::displayPrecision, precision); }	///< set sig digits
 
-    double getMeterAttack_ms() { return meterAttack_ms;}				///< get meter attack time (ballistics)
-    void setMeterAttack_ms(double value) { meterAttack_ms = value; }	///< set meter attack time (ballistics)
+    double getMeterAttack_ms() { return descriptor->meterAttack_ms;}										///< get meter attack time (ballistics)
+    void setMeterAttack_ms(double value) { setDescriptorValue(&ParameterDescriptor::meterAttack_ms, value); }	///< set meter attack time (ballistics)
 
-    double getMeterRelease_ms() { return meterRelease_ms; }				///< get meter release time (ballistics)
-    void setMeterRelease_ms(double value) { meterRelease_ms = value; }	///< set meter release time (ballistics)
+    double getMeterRelease_ms() { return descriptor->meterRelease_ms; }										///< get meter release time (ballistics)
+    void setMeterRelease_ms(double value) { setDescriptorValue(&ParameterDescriptor::meterRelease_ms, value); }	///< set meter release time (ballistics)
 
-    uint32_t getDetectorMode() { return detectorMode; }					///< get meter detect mode
-    void setMeterDetectorMode(uint32_t value) { detectorMode = value; }	///< set meter detect mode
+    uint32_t getDetectorMode() { return descriptor->detectorMode; }										///< get meter detect mode
+    void setMeterDetectorMode(uint32_t value) { setDescriptorValue(&ParameterDescriptor::detectorMode, value); }	///< set meter detect mode
 
-	bool getLogMeter() { return logMeter; }				///< query log meter flag
-	void setLogMeter(bool value) { logMeter = value; }	///< set log meter flag
+	bool getLogMeter() { return descriptor->logMeter; }										///< query log meter flag
+	void setLogMeter(bool value) { setDescriptorValue(&ParameterDescriptor::logMeter, value); }	///< set log meter flag
 
-	bool getInvertedMeter() { return invertedMeter; }				///< query inverted meter flag
-	void setInvertedMeter(bool value) { invertedMeter = value; }	///< set inverted meter flag
+	bool getInvertedMeter() { return descriptor->invertedMeter; }										///< query inverted meter flag
+	void setInvertedMeter(bool value) { setDescriptorValue(&ParameterDescriptor::invertedMeter, value); }	///< set inverted meter flag
 
-	bool isProtoolsGRMeter() { return protoolsGRMeter; }				///< query pro tools GR meter flag
-	void setIsProtoolsGRMeter(bool value) { protoolsGRMeter = value; }	///< set inverted meter flag
+	bool isProtoolsGRMeter() { return descriptor->protoolsGRMeter; }											///< query pro tools GR meter flag
+	void setIsProtoolsGRMeter(bool value) { setDescriptorValue(&ParameterDescriptor::protoolsGRMeter, value); }	///< set inverted meter flag
 
 	bool getParameterSmoothing() { return useParameterSmoothing; }				///< query parameter smoothing flag
     void setParameterSmoothing(bool value) { useParameterSmoothing = value; }	///< set inverted meter flag
 
-    double getSmoothingTimeMsec() { return smoothingTimeMsec;}					///< query smoothing time
-    void setSmoothingTimeMsec(double value) { smoothingTimeMsec = value; }		///< set inverted meter flag
+    double getSmoothingTimeMsec() { return descriptor->smoothingTimeMsec;}										///< query smoothing time
+    void setSmoothingTimeMsec(double value) { setDescriptorValue(&ParameterDescriptor::smoothingTimeMsec, value); }	///< set inverted meter flag
 
-    smoothingMethod getSmoothingMethod() { return smoothingType; }									///< query smoothing method
-    void setSmoothingMethod(smoothingMethod smoothingMethod) { smoothingType = smoothingMethod; }	///< set smoothing method
+    smoothingMethod getSmoothingMethod() { return descriptor->smoothingType; }													///< query smoothing method
+    void setSmoothingMethod(smoothingMethod smoothingMethod) { setDescriptorValue(&ParameterDescriptor::smoothingType, smoothingMethod); }	///< set smoothing method
 
-    bool getIsWritable() { return isWritable; }				///< query writable control (meter)
-    void setIsWritable(bool value) { isWritable = value; }	///< set writable control (meter)
+    double getSmoothingEpsilon() { return descriptor->smoothingEpsilon; }											///< query smoothing settle epsilon (fraction of the range)
+    void setSmoothingEpsilon(double value) { setDescriptorValue(&ParameterDescriptor::smoothingEpsilon, value); }	///< set smoothing settle epsilon (fraction of the range)
 
-    bool getEnableVSTSampleAccurateAutomation() { return enableVSTSampleAccurateAutomation; }			///< query VST3 sample accurate automation
-    void setEnableVSTSampleAccurateAutomation(bool value) { enableVSTSampleAccurateAutomation = value; }///< set VST3 sample accurate automation
+    bool getIsWritable() { return descriptor->isWritable; }										///< query writable control (meter)
+    void setIsWritable(bool value) { setDescriptorValue(&ParameterDescriptor::isWritable, value); }	///< set writable control (meter)
+
+    bool getEnableVSTSampleAccurateAutomation() { return descriptor->enableVSTSampleAccurateAutomation; }										///< query VST3 sample accurate automation
+    void setEnableVSTSampleAccurateAutomation(bool value) { setDescriptorValue(&ParameterDescriptor::enableVSTSampleAccurateAutomation, value); }///< set VST3 sample accurate automation
+
+	/** the descriptor, shared with other instances; read only */
+	const ParameterDescriptor* getDescriptor() { return descriptor.get(); }
+
+	/** publish the descriptor so instances constructed later can share it; NOT realtime safe */
+	void publishDescriptor() { ParameterDescriptorTable::publish(descriptor); }
 
 	// --- for aux attributes
-	AuxParameterAttribute* getAuxAttribute(uint32_t attributeID);										///< get aux data
+	const AuxParameterAttribute* getAuxAttribute(uint32_t attributeID);								///< get aux data
 	uint32_t setAuxAttribute(uint32_t attributeID, const AuxParameterAttribute& auxParameterAtribute);	///< set aux data
 
 	/**
@@ -174,8 +281,8 @@ public:
 	*/
 	inline void setControlValue(double actualParamValue, bool ignoreSmoothing = false)
 	{
-		if (controlType == controlVariableType::kDouble ||
-			controlType == controlVariableType::kFloat)
+		if (descriptor->controlType == controlVariableType::kDouble ||
+			descriptor->controlType == controlVariableType::kFloat)
 		{
 			if (useParameterSmoothing && !ignoreSmoothing)
 				setSmoothedTargetValue(actualParamValue);
@@ -184,6 +291,33 @@ public:
 		}
 		else
 			setAtomicControlValueDouble(actualParamValue);
+
+		markChanged();
+	}
+
+	/**
+	\brief set the value and the smoothing target together so the value does not glide; used for bulk state restores
+
+	\param actualParamValue parameter value as a regular double
+	*/
+	inline void snapControlValue(double actualParamValue)
+	{
+		setAtomicControlValueDouble(actualParamValue);
+		setSmoothedTargetValue(actualParamValue);
+		markChanged();
+	}
+
+	/**
+	\brief write a smoothing or VST3 sample accurate automation result; audio thread only
+
+	NOTES:
+	- the caller updates the bound variable itself, so the change is not flagged for the next sync
+
+	\param actualParamValue parameter value as a regular double
+	*/
+	inline void applySmoothedControlValue(double actualParamValue)
+	{
+		setAtomicControlValueDouble(actualParamValue);
 	}
 
 	/**
@@ -198,8 +332,8 @@ public:
 		// --- set according to smoothing option
 		double actualParamValue = getControlValueWithNormalizedValue(normalizedValue, applyTaper);
 
-		if (controlType == controlVariableType::kDouble ||
-			controlType == controlVariableType::kFloat)
+		if (descriptor->controlType == controlVariableType::kDouble ||
+			descriptor->controlType == controlVariableType::kFloat)
 		{
 			if (useParameterSmoothing && !ignoreParameterSmoothing)
 				setSmoothedTargetValue(actualParamValue);
@@ -209,6 +343,7 @@ public:
 		else
 			setAtomicControlValueDouble(actualParamValue);
 
+		markChanged();
 		return actualParamValue;
 	}
 
@@ -224,14 +359,14 @@ public:
 
 	\return number of strings
 	*/
-	size_t getStringCount(){return stringList.size();}
+	size_t getStringCount(){return descriptor->stringList.size();}
 
 	/**
 	\brief get the strings in a string-list control as a comma separated list
 
 	\return comma separated list as a const char*
 	*/
-	const char* getCommaSeparatedStringList() {return commaSeparatedStringList.c_str();}
+	const char* getCommaSeparatedStringList() {return descriptor->commaSeparatedStringList.c_str();}
 
 	/**
 	\brief convert the string-list into a comma-separated list (during construction)
@@ -241,7 +376,7 @@ public:
 	/**
 	\brief set the string-list using a vector of strings
 	*/
-	void setStringList(std::vector<std::string> _stringList) {stringList = _stringList;}
+	void setStringList(std::vector<std::string> _stringList) { if (descriptor->stringList != _stringList) editDescriptor()->stringList = _stringList; }
 
 	/** get a string-list string using the index */
 	std::string getStringByIndex(uint32_t index);
@@ -253,7 +388,7 @@ public:
 	inline double getDefaultValueNormalized()
     {
         // --- apply taper as needed
-        switch (controlTaper)
+        switch (descriptor->controlTaper)
         {
             case taper::kLinearTaper:
                 return getNormalizedDefaultValue();
@@ -283,7 +418,7 @@ public:
 			return getNormalizedControlValue();
 
         // --- apply taper as needed
-        switch (controlTaper)
+        switch (descriptor->controlTaper)
         {
             case taper::kLinearTaper:
                 return getNormalizedControlValue();
@@ -314,7 +449,7 @@ public:
         double newValue = 0;
 
         // --- apply taper as needed
-        switch (controlTaper)
+        switch (descriptor->controlTaper)
         {
             case taper::kLinearTaper:
                 newValue = getControlValueFromNormalizedValue(normalizedValue);
@@ -351,7 +486,7 @@ public:
 	/** get the maximum GUI value for string-list params */
 	double getGUIMax()
     {
-        if(controlType == controlVariableType::kTypedEnumStringList)
+        if(descriptor->controlType == controlVariableType::kTypedEnumStringList)
             return (double)getStringCount() - 1;
 
         return 1.0;
@@ -364,6 +499,7 @@ public:
 	*/
 	int findStringIndex(std::string searchString)
     {
+        const std::vector<std::string>& stringList = descriptor->stringList;
         auto it = std::find(stringList.begin (), stringList.end (), searchString);
 
         if (it == stringList.end())
@@ -419,12 +555,13 @@ public:
 	*/
 	void initParamSmoother(double sampleRate)
     {
-        paramSmoother.initParamSmoother(smoothingTimeMsec,
+        paramSmoother.initParamSmoother(descriptor->smoothingTimeMsec,
                                         sampleRate,
                                         getAtomicControlValueDouble(),
-                                        minValue,
-                                        maxValue,
-                                        smoothingType);
+                                        descriptor->minValue,
+                                        descriptor->maxValue,
+                                        descriptor->smoothingType,
+                                        descriptor->smoothingEpsilon);
     }
 
 	/**
@@ -435,12 +572,14 @@ public:
 	void updateSampleRate(double sampleRate)
     {
         paramSmoother.setSampleRate(sampleRate);
+        paramSmoother.setSettleEpsilon(descriptor->smoothingEpsilon);
     }
 
 	/**
 	\brief perform smoothing operation on data
 
-	\return true if data was actually smoothed, false otherwise (data that has reached its terminal value will not be smoothed any further)
+	\return true if data was actually smoothed, false otherwise (data that has reached its terminal value will not be smoothed any further);
+	        the call that settles on the target still returns true, so the final value is always applied
 	*/
 	bool smoothParameterValue()
     {
@@ -452,6 +591,24 @@ public:
         return smoothed;
     }
 
+	/**
+	\brief end any glide: the value and the smoother jump to the smoothing target
+	*/
+	void snapParamSmoother()
+	{
+		if (!useParameterSmoothing) return;
+		double target = getSmoothedTargetValue();
+		setAtomicControlValueDouble(target);
+		paramSmoother.snapTo(target);
+	}
+
+	/**
+	\brief get the value the smoother is moving towards (for block smoothing)
+
+	\return the smoothing target
+	*/
+	double getSmoothingTargetValue() { return getSmoothedTargetValue(); }
+
 	/**
 	\brief save the variable for binding operation
 
@@ -489,29 +646,41 @@ public:
 	*/
 	bool updateInBoundVariable()
 	{
+		// --- remember if this is a new value (for change tracking)
+		double value = getControlValue();
+		inBoundVariableChanged = value != inBoundVariableValue;
+		inBoundVariableValue = value;
+
 		if (boundVariableUInt)
 		{
-			*boundVariableUInt = (uint32_t)getControlValue();
+			*boundVariableUInt = (uint32_t)value;
 			return true;
 		}
 		else if (boundVariableInt)
 		{
-			*boundVariableInt = (int)getControlValue();
+			*boundVariableInt = (int)value;
 			return true;
 		}
 		else if (boundVariableFloat)
 		{
-			*boundVariableFloat = (float)getControlValue();
+			*boundVariableFloat = (float)value;
 			return true;
 		}
 		else if (boundVariableDouble)
 		{
-			*boundVariableDouble = getControlValue();
+			*boundVariableDouble = value;
 			return true;
 		}
 		return false;
 	}
 
+	/**
+	\brief query whether the last updateInBoundVariable( ) wrote a new value
+
+	\return true if the bound variable changed
+	*/
+	bool getInBoundVariableChanged() { return inBoundVariableChanged; }
+
 	/**
 	\brief perform the variable binding update on meter data
 
@@ -519,35 +688,58 @@ public:
 	*/
 	bool updateOutBoundVariable()
 	{
+		// --- meter values flow out, so they are not flagged for the inbound sync
 		if (boundVariableUInt)
 		{
-			setControlValue((double)*boundVariableUInt);
+			setAtomicControlValueDouble((double)*boundVariableUInt);
 			return true;
 		}
 		else if (boundVariableInt)
 		{
-			setControlValue((double)*boundVariableInt);
+			setAtomicControlValueDouble((double)*boundVariableInt);
 			return true;
 		}
 		else if (boundVariableFloat)
 		{
-			setControlValue((double)*boundVariableFloat);
+			setAtomicControlValueDouble((double)*boundVariableFloat);
 			return true;
 		}
 		else if (boundVariableDouble)
 		{
-			setControlValue(*boundVariableDouble);
+			setAtomicControlValueDouble(*boundVariableDouble);
 			return true;
 		}
 		return false;
 	}
 
+	/**
+	\brief set where new values are flagged for the inbound sync; called from initPluginParameterArray( )
+
+	\param _changeSet the owner's change set
+	\param _changeIndex this parameter's index in the parameter array
+	\param _queueChangeSet the owner's set of parameters handed a VST3 update queue (optional)
+	*/
+	void setChangeSet(ParameterChangeSet* _changeSet, uint32_t _changeIndex, ParameterChangeSet* _queueChangeSet = nullptr)
+	{
+		changeSet = _changeSet;
+		changeIndex = _changeIndex;
+		queueChangeSet = _queueChangeSet;
+	}
+
 	/**
 	\brief stores the update queue for VST3 sample accuate automation; note this is only used during actual DAW runs with automation engaged
 
-	\param _parameterUpdateQueue the update queue to store
+	\param _parameterUpdateQueue the update queue to store; the parameter is flagged as changed so the
+	       next inbound sync puts it back on the active smoothing list, and flagged in the queue set so
+	       the block updates drain its queue
 	*/
-    void setParameterUpdateQueue(IParameterUpdateQueue* _parameterUpdateQueue) { parameterUpdateQueue = _parameterUpdateQueue; }
+    void setParameterUpdateQueue(IParameterUpdateQueue* _parameterUpdateQueue)
+	{
+		parameterUpdateQueue = _parameterUpdateQueue;
+		markChanged();
+		if (queueChangeSet)
+			queueChangeSet->markChanged(changeIndex);
+	}
 
 	/**
 	\brief retrieves the update queue for VST3 sample accuate automation; note this is only used during actual DAW runs with automation engaged
@@ -562,42 +754,17 @@ public:
 		if (this == &aPluginParameter)
 			return *this;
 
-		controlID = aPluginParameter.controlID;
-		controlName = aPluginParameter.controlName;
-		controlUnits = aPluginParameter.controlUnits;
-		commaSeparatedStringList = aPluginParameter.commaSeparatedStringList;
-		controlType = aPluginParameter.controlType;
-		minValue = aPluginParameter.minValue;
-		maxValue = aPluginParameter.maxValue;
-		defaultValue = aPluginParameter.defaultValue;
-		controlTaper = aPluginParameter.controlTaper;
+		descriptor = aPluginParameter.descriptor;
 		controlValueAtomic = aPluginParameter.getAtomicControlValueFloat();
-		displayPrecision = aPluginParameter.displayPrecision;
-		stringList = aPluginParameter.stringList;
+		smoothedTargetValueAtomic = aPluginParameter.getAtomicControlValueFloat();
 		useParameterSmoothing = aPluginParameter.useParameterSmoothing;
-		smoothingType = aPluginParameter.smoothingType;
-		smoothingTimeMsec = aPluginParameter.smoothingTimeMsec;
-		meterAttack_ms = aPluginParameter.meterAttack_ms;
-		meterRelease_ms = aPluginParameter.meterRelease_ms;
-		detectorMode = aPluginParameter.detectorMode;
-		logMeter = aPluginParameter.logMeter;
-		isWritable = aPluginParameter.isWritable;
-		isDiscreteSwitch = aPluginParameter.isDiscreteSwitch;
-		invertedMeter = aPluginParameter.invertedMeter;
 
 		return *this;
 	}
 
 protected:
-    int controlID = -1;							///< the ID value for the parameter
-    std::string controlName = "ControlName";	///< the name string for the parameter
-    std::string controlUnits = "Units";			///< the units string for the parameter
-    controlVariableType controlType = controlVariableType::kDouble; ///< the control type
-
-    // --- min/max/def
-    double minValue = 0.0;			///< the min for the parameter
-    double maxValue = 1.0;			///< the max for the parameter
-    double defaultValue = 0.0;		///< the default value for the parameter
+    // --- names, limits, taper, string list, meter and smoothing settings; shared, copy on write
+    std::shared_ptr<ParameterDescriptor> descriptor;	///< the descriptor (never nullptr)
 
     // --- *the* control value
     // --- atomic float as control value
@@ -614,31 +781,8 @@ protected:
     void setSmoothedTargetValue(double value){ smoothedTargetValueAtomic.store((float)value); }	///< set atomic TARGET smoothing variable with double
     double getSmoothedTargetValue() const { return (double)smoothedTargetValueAtomic.load(); }	///< set atomic TARGET smoothing variable with double
 
-    // --- control tweakers
-    taper controlTaper = taper::kLinearTaper;	///< the taper
-    uint32_t displayPrecision = 2;				///< sig digits for display
-
-    // --- for enumerated string list
-    std::vector<std::string> stringList;		///< string list
-    std::string commaSeparatedStringList;		///< string list a somma separated string
-
-    // --- gui specific
-    bool appendUnits = true;					///< flag to append units in GUI controls (use with several built-in custom views)
-    bool isWritable = false;					///< flag for meter variables
-	bool isDiscreteSwitch = false;				///< flag for switches (not currently used in ASPiK)
-
-    // --- for VU meters
-    double meterAttack_ms = 10.0;				///< meter attack time in milliseconds
-    double meterRelease_ms = 500.0;				///< meter release time in milliseconds
-    uint32_t detectorMode = ENVELOPE_DETECT_MODE_RMS;///< meter detector mode
-	bool logMeter = false;						///< meter is log
-	bool invertedMeter = false;					///< meter is inverted
-	bool protoolsGRMeter = false;				///< meter is a Pro Tools gain reduction meter
-
     // --- parameter smoothing
     bool useParameterSmoothing = false;			///< enable param smoothing
-    smoothingMethod smoothingType = smoothingMethod::kLPFSmoother;	///< param smoothing type
-    double smoothingTimeMsec = 100.0;			///< param smoothing time
     ParamSmoother<double> paramSmoother;		///< param smoothing object
 
 	// --- variable binding
@@ -647,8 +791,53 @@ protected:
     // --- our sample accurate interface for VST3
     IParameterUpdateQueue* parameterUpdateQueue = nullptr;					///< interface for VST3 sample accurate updates
 
-    // --- default is enabled; you can disable this for controls that have a long postUpdate cooking time
-    bool enableVSTSampleAccurateAutomation = true;							///< VST3 sample accurate flag
+	// --- change notification for the inbound sync
+	ParameterChangeSet* changeSet = nullptr;	///< the owner's change set (nullptr until the parameter array is built)
+	uint32_t changeIndex = 0;					///< index in the owner's parameter array
+	ParameterChangeSet* queueChangeSet = nullptr;	///< the owner's VST3 queue set (nullptr if unused)
+	void markChanged() { if (changeSet) changeSet->markChanged(changeIndex); }	///< flag a new value
+
+	/**
+	\brief get a descriptor that this parameter can change, copying it first if it is shared
+
+	\return the descriptor
+	*/
+	ParameterDescriptor* editDescriptor()
+	{
+		if (descriptor.use_count() > 1)
+			descriptor = std::make_shared<ParameterDescriptor>(*descriptor);
+		return descriptor.get();
+	}
+
+	/**
+	\brief set a descriptor member; a shared descriptor is only copied if the value changes
+
+	\param member the ParameterDescriptor member
+	\param value the new value
+	*/
+	template <typename T>
+	void setDescriptorValue(T ParameterDescriptor::* member, const T& value)
+	{
+		if ((*descriptor).*member == value)
+			return;
+		(*editDescriptor()).*member = value;
+	}
+
+	/** set the value of a string-list parameter to its default string (during construction) */
+	void initStringListValue(const std::string& _defaultString);
+
+	/** share the published descriptor for _controlID if it exists and passes the check, else create a new one */
+	template <typename Matches>
+	bool attachDescriptor(int _controlID, Matches matches)
+	{
+		descriptor = ParameterDescriptorTable::find(_controlID);
+		if (descriptor && matches(*descriptor))
+			return true;
+
+		descriptor = std::make_shared<ParameterDescriptor>();
+		descriptor->controlID = _controlID;
+		return false;
+	}
 
     /**
 	\brief get volt/octave control value from a normalized value
@@ -658,11 +847,11 @@ protected:
 	*/
     inline double getVoltOctaveControlValueFromNormValue(double normalizedValue)
     {
-        double octaves = log2(maxValue / minValue);
+        double octaves = log2(descriptor->maxValue / descriptor->minValue);
         if (normalizedValue == 0)
-            return minValue;
+            return descriptor->minValue;
 
-        return minValue*pow(2.0, normalizedValue*octaves);
+        return descriptor->minValue*pow(2.0, normalizedValue*octaves);
     }
 
 	/**
@@ -689,10 +878,10 @@ protected:
 	*/
     inline double getNormalizedVoltOctaveControlValue()
     {
-        if (minValue == 0)
+        if (descriptor->minValue == 0)
             return getAtomicControlValueDouble();
 
-        return log2(getAtomicControlValueDouble() / minValue) / (log2(maxValue / minValue));
+        return log2(getAtomicControlValueDouble() / descriptor->minValue) / (log2(descriptor->maxValue / descriptor->minValue));
     }
 
 	/**
@@ -704,7 +893,7 @@ protected:
 	inline double getNormalizedControlValueWithActual(double actualValue)
     {
         // --- calculate normalized value from actual
-		return (actualValue - minValue) / (maxValue - minValue);
+		return (actualValue - descriptor->minValue) / (descriptor->maxValue - descriptor->minValue);
 	}
 
 	/**
@@ -714,8 +903,8 @@ protected:
 	inline double getNormalizedControlValue()
     {
         // --- calculate normalized value from actual
-		//double d = (getAtomicControlValueDouble() - minValue) / (maxValue - minValue);
-		return (getAtomicControlValueDouble() - minValue) / (maxValue - minValue);
+		//double d = (getAtomicControlValueDouble() - descriptor->minValue) / (descriptor->maxValue - descriptor->minValue);
+		return (getAtomicControlValueDouble() - descriptor->minValue) / (descriptor->maxValue - descriptor->minValue);
 	}
 
 	/**
@@ -727,8 +916,8 @@ protected:
     inline double getControlValueFromNormalizedValue(double normalizedValue)
     {
         // --- calculate the control Value using normalized input
-		//double d = (maxValue - minValue)*normalizedValue + minValue;
-		return (maxValue - minValue)*normalizedValue + minValue;
+		//double d = (descriptor->maxValue - descriptor->minValue)*normalizedValue + descriptor->minValue;
+		return (descriptor->maxValue - descriptor->minValue)*normalizedValue + descriptor->minValue;
 	}
 
 	/**
@@ -739,8 +928,8 @@ protected:
 	inline double getNormalizedDefaultValue()
     {
         // --- calculate normalized value from actual
-		//double d = (defaultValue - minValue) / (maxValue - minValue);
-		return (defaultValue - minValue) / (maxValue - minValue);
+		//double d = (descriptor->defaultValue - descriptor->minValue) / (descriptor->maxValue - descriptor->minValue);
+		return (descriptor->defaultValue - descriptor->minValue) / (descriptor->maxValue - descriptor->minValue);
 	}
 
 	/**
@@ -770,10 +959,10 @@ protected:
 	*/
 	inline double getNormalizedVoltOctaveDefaultValue()
     {
-        if (minValue == 0)
-            return defaultValue;
+        if (descriptor->minValue == 0)
+            return descriptor->defaultValue;
 
-        return log2(defaultValue / minValue) / (log2(maxValue / minValue));
+        return log2(descriptor->defaultValue / descriptor->minValue) / (log2(descriptor->maxValue / descriptor->minValue));
     }
 
 private:
@@ -782,9 +971,8 @@ private:
     int* boundVariableInt = nullptr;				///< bound variable as int
     float* boundVariableFloat = nullptr;			///< bound variable as float
     double* boundVariableDouble = nullptr;			///< bound variable as double
-
-	typedef std::map<uint32_t, AuxParameterAttribute*> auxParameterAttributeMap; ///< Aux attributes that can be stored on this object (similar to VSTGUI4) makes it easy to add extra data in the future
-	auxParameterAttributeMap auxAttributeMap;		///< map of aux attributes
+	double inBoundVariableValue = 0.0;				///< last value written to the bound variable
+	bool inBoundVariableChanged = true;				///< last write changed the bound variable
 
 };
 
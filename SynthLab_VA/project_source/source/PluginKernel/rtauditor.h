@@ -0,0 +1,142 @@
+// -----------------------------------------------------------------------------
+//    ASPiK Plugin Kernel File:  rtauditor.h
+//
+/**
+    \file   rtauditor.h
+    \author Will Pirkle
+    \date   17-September-2018
+    \brief  interface file for the real-time safety auditor (debug/test builds)
+    		- compiled in only when the build defines SYNTHLAB_RT_AUDIT=1 (see SYNTHLAB_RT_AUDIT
+    		  in the top level CMakeLists.txt); otherwise RT_AUDIT_SCOPE( ) expands to nothing
+    		- http://www.aspikplugins.com
+    		- http://www.willpirkle.com
+*/
+// -----------------------------------------------------------------------------
+#ifndef _RTAuditor_H_
+#define _RTAuditor_H_
+
+#ifndef SYNTHLAB_RT_AUDIT
+	#define SYNTHLAB_RT_AUDIT 0
+#endif
+
+#if SYNTHLAB_RT_AUDIT
+
+#include <atomic>
+#include <stdint.h>
+#include <stdio.h>
+
+// --- violations kept in the log; later ones are only counted
+const uint32_t RT_AUDIT_LOG_SIZE = 1024;
+
+// --- call stack frames and audit scope tags kept per violation
+const uint32_t RT_AUDIT_STACK_FRAMES = 16;
+const uint32_t RT_AUDIT_TAG_DEPTH = 8;
+
+/**
+\enum rtViolation
+\ingroup ASPiK-Core
+\brief
+Operations that are not allowed on a thread inside an RT_AUDIT_SCOPE( )
+
+- kRTAllocate: operator new, malloc, calloc, realloc, etc...
+- kRTFree: operator delete, free
+- kRTMutexLock: a blocking mutex lock (try-locks never block and are allowed)
+*/
+enum rtViolation { kRTAllocate, kRTFree, kRTMutexLock, kNumRTViolations };
+
+/**
+\struct RTViolationRecord
+\ingroup ASPiK-Core
+\brief
+One logged violation: what it was, the audit scope tags that were open and the call stack
+*/
+struct RTViolationRecord
+{
+	std::atomic<bool> complete{ false };	///< the writer has filled in the record
+	uint32_t violation = 0;					///< rtViolation
+	uint64_t size = 0;						///< bytes allocated (0 if unknown or not an allocation)
+	uint32_t numTags = 0;					///< open audit scopes, outermost first
+	const char* tags[RT_AUDIT_TAG_DEPTH];	///< audit scope tags
+	uint32_t numFrames = 0;					///< call stack depth (0 where there is no backtrace( ))
+	void* frames[RT_AUDIT_STACK_FRAMES];	///< call stack, innermost first
+};
+
+/**
+\class RTAuditor
+\ingroup ASPiK-Core
+\brief
+Detects allocations, frees and mutex locks on threads that are flagged as audio threads.
+
+RTAuditor Operations:
+- RT_AUDIT_SCOPE("tag") flags the calling thread as an audio thread until the scope ends; scopes
+  nest and their tags are logged with each violation
+- rtauditor.cpp replaces the global operator new/delete; when the build also defines
+  RT_AUDIT_INTERPOSE_LIBC=1 (executables on glibc only) it interposes malloc/free and
+  pthread_mutex_lock as well
+- violations go into a fixed, lock-free log: recording one never allocates, locks or waits
+- the operations are still carried out; the auditor only reports them
+- getViolationCount( ) and writeReport( ) may be called from any thread; reset( ) must not run
+  while an audit scope is open
+
+\author Will Pirkle http://www.willpirkle.com
+\remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
+\version Revision : 1.0
+\date Date : 2018 / 09 / 7
+*/
+class RTAuditor
+{
+public:
+	/** flag the calling thread as an audio thread; use RT_AUDIT_SCOPE( ) */
+	static void enterScope(const char* tag);
+
+	/** leave the innermost audit scope */
+	static void leaveScope();
+
+	/** true if the calling thread is inside an audit scope */
+	static bool isAudioThread();
+
+	/** log a violation if the calling thread is an audio thread; called by the interposers */
+	static void checkViolation(uint32_t violation, uint64_t size);
+
+	/** violations since reset( ), all kinds or one rtViolation */
+	static uint64_t getViolationCount();
+	static uint64_t getViolationCount(uint32_t violation);
+
+	/** print the logged violations with their tags and (symbolized) call stacks; NOT realtime safe */
+	static void writeReport(FILE* file, uint32_t maxRecords = RT_AUDIT_LOG_SIZE);
+
+	/** clear the log and the counts */
+	static void reset();
+
+	/** violation name, as used in the report */
+	static const char* getViolationName(uint32_t violation);
+};
+
+/**
+\class RTAuditScope
+\ingroup ASPiK-Core
+\brief
+Flags the calling thread as an audio thread for the rest of the enclosing scope; use RT_AUDIT_SCOPE( )
+*/
+class RTAuditScope
+{
+public:
+	RTAuditScope(const char* tag) { RTAuditor::enterScope(tag); }
+	~RTAuditScope() { RTAuditor::leaveScope(); }
+
+private:
+	RTAuditScope(const RTAuditScope&);
+	RTAuditScope& operator=(const RTAuditScope&);
+};
+
+#define RT_AUDIT_SCOPE_NAME(line) rtAuditScope##line
+#define RT_AUDIT_SCOPE_LINE(tag, line) RTAuditScope RT_AUDIT_SCOPE_NAME(line)(tag)
+#define RT_AUDIT_SCOPE(tag) RT_AUDIT_SCOPE_LINE(tag, __LINE__)
+
+#else
+
+#define RT_AUDIT_SCOPE(tag)
+
+#endif // SYNTHLAB_RT_AUDIT
+
+#endif /* defined(_RTAuditor_H_) */
@@ -0,0 +1,213 @@
+// -----------------------------------------------------------------------------
+//    ASPiK Plugin Kernel File:  silencedetector.h
+//
+/**
+    \file   silencedetector.h
+    \author Will Pirkle
+    \date   17-September-2018
+    \brief  interface file for the synth output silence detector (idle render skipping)
+    		- http://www.aspikplugins.com
+    		- http://www.willpirkle.com
+*/
+// -----------------------------------------------------------------------------
+#ifndef _SilenceDetector_H_
+#define _SilenceDetector_H_
+
+#include "pluginstructures.h"
+#include <math.h>
+#include <string.h>
+
+// --- output peak below this is silence (-120 dBFS)
+const double SILENCE_THRESHOLD = 1.0e-6;
+
+// --- minimum time the output must stay below the threshold before rendering stops
+const double MIN_SILENCE_HOLD_MSEC = 100.0;
+
+/**
+\enum silenceState
+\ingroup ASPiK-Core
+\brief
+Idle state machine states
+
+- kActive: notes (or the sustain pedal) are held; always render, the output is not measured
+- kReleasing: nothing held; render and measure the output until it has been silent for the hold time
+- kIdle: the tail has settled; skip rendering, the outputs are cleared
+*/
+enum class silenceState { kActive, kReleasing, kIdle };
+
+/**
+\class SynthSilenceDetector
+\ingroup ASPiK-Core
+\brief
+Decides when a synth can stop rendering because no voice can make sound.
+
+SynthSilenceDetector Operations:
+- addMidiEvent( ) tracks held notes and the sustain pedal; every event wakes an idle detector, so the
+  block that carries the event is rendered
+- addOutputBlock( ) measures the output peak of each rendered block while nothing is held
+- the hold time is the minimum hold plus the tail time (the delay FX delay time) so that a
+  delay line whose echoes are further apart than a few blocks is not cut off: once the output
+  has been silent for longer than the delay time, the delay line only holds silence too
+- no allocation, no locks; audio thread only
+
+\author Will Pirkle http://www.willpirkle.com
+\remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
+\version Revision : 1.0
+\date Date : 2018 / 09 / 7
+*/
+class SynthSilenceDetector
+{
+public:
+	SynthSilenceDetector() { clearNotes(); }
+
+	/** start over in the active state; call from reset( ) */
+	void reset(double _sampleRate)
+	{
+		sampleRate = _sampleRate;
+		clearNotes();
+		wake();
+		updateHoldSamples();
+	}
+
+	/** set the extra tail time (e.g. the longest delay FX delay) in mSec */
+	void setTailTime_mSec(double _tailTime_mSec)
+	{
+		if (tailTime_mSec == _tailTime_mSec)
+			return;
+		tailTime_mSec = _tailTime_mSec;
+		updateHoldSamples();
+	}
+
+	/** track a MIDI event; any event wakes the detector */
+	void addMidiEvent(const midiEvent& event)
+	{
+		uint32_t channel = event.midiChannel & 0x0F;
+		uint32_t note = event.midiData1 & 0x7F;
+
+		if (event.midiMessage == MIDI_NOTE_ON && event.midiData2 > 0)
+			setNote(channel, note, true);
+		else if (event.midiMessage == MIDI_NOTE_OFF || event.midiMessage == MIDI_NOTE_ON)
+			setNote(channel, note, false);
+		else if (event.midiMessage == MIDI_CONTROL_CHANGE)
+		{
+			if (event.midiData1 == MIDI_CC_SUSTAIN)
+				sustainPedal[channel] = event.midiData2 >= 64;
+			else if (event.midiData1 == MIDI_CC_ALL_SOUND_OFF || event.midiData1 == MIDI_CC_ALL_NOTES_OFF)
+				clearChannelNotes(channel);
+		}
+
+		wake();
+	}
+
+	/** true if the block can be skipped */
+	bool isIdle() { return state == silenceState::kIdle; }
+
+	/** true if the outputs should be measured with addOutputBlock( ) */
+	bool wantsOutput() { return state == silenceState::kReleasing; }
+
+	/** current state */
+	silenceState getState() { return state; }
+
+	/**
+	\brief measure a rendered block (float or double outputs)
+
+	\param outputs output channel arrays
+	\param numChannels channel count
+	\param start index of the first sample of the block
+	\param length block length
+	*/
+	template <typename SampleType>
+	void addOutputBlock(SampleType** outputs, uint32_t numChannels, uint32_t start, uint32_t length)
+	{
+		if (state != silenceState::kReleasing)
+			return;
+
+		double peak = 0.0;
+		for (uint32_t channel = 0; channel < numChannels; channel++)
+		{
+			if (!outputs[channel])
+				continue;
+
+			const SampleType* output = outputs[channel] + start;
+			for (uint32_t i = 0; i < length; i++)
+			{
+				double value = fabs((double)output[i]);
+				peak = value > peak ? value : peak;
+			}
+		}
+
+		if (peak > SILENCE_THRESHOLD)
+			silentSamples = 0;
+		else
+			silentSamples += length;
+
+		if (silentSamples >= holdSamples)
+			state = silenceState::kIdle;
+	}
+
+protected:
+	static const uint32_t MIDI_NOTE_OFF = 0x80;
+	static const uint32_t MIDI_NOTE_ON = 0x90;
+	static const uint32_t MIDI_CONTROL_CHANGE = 0xB0;
+	static const uint32_t MIDI_CC_SUSTAIN = 64;
+	static const uint32_t MIDI_CC_ALL_SOUND_OFF = 120;
+	static const uint32_t MIDI_CC_ALL_NOTES_OFF = 123;
+
+	silenceState state = silenceState::kActive;	///< idle state
+	double sampleRate = 44100.0;				///< fs
+	double tailTime_mSec = 0.0;					///< extra hold time (delay FX)
+	uint32_t holdSamples = 0;					///< silent samples needed to go idle
+	uint32_t silentSamples = 0;					///< silent samples so far
+
+	uint8_t heldNotes[16][128];		///< 1 if the key is down
+	uint32_t heldNoteCount = 0;		///< number of keys down
+	bool sustainPedal[16];			///< CC64 per channel
+
+	/** back to active or releasing, depending on what is held */
+	void wake()
+	{
+		silentSamples = 0;
+		state = heldNoteCount > 0 || anySustain() ? silenceState::kActive : silenceState::kReleasing;
+	}
+
+	void setNote(uint32_t channel, uint32_t note, bool down)
+	{
+		if (heldNotes[channel][note] == (down ? 1 : 0))
+			return;
+		heldNotes[channel][note] = down ? 1 : 0;
+		if (down)
+			heldNoteCount++;
+		else
+			heldNoteCount--;
+	}
+
+	void clearChannelNotes(uint32_t channel)
+	{
+		for (uint32_t note = 0; note < 128; note++)
+			setNote(channel, note, false);
+	}
+
+	void clearNotes()
+	{
+		memset(heldNotes, 0, sizeof(heldNotes));
+		memset(sustainPedal, 0, sizeof(sustainPedal));
+		heldNoteCount = 0;
+	}
+
+	bool anySustain()
+	{
+		for (uint32_t channel = 0; channel < 16; channel++)
+		{
+			if (sustainPedal[channel])
+				return true;
+		}
+		return false;
+	}
+
+	void updateHoldSamples()
+	{
+		holdSamples = (uint32_t)((MIN_SILENCE_HOLD_MSEC + tailTime_mSec) * 0.001 * sampleRate);
+	}
+};
+
+#endif
@@ -0,0 +1,272 @@
+// -----------------------------------------------------------------------------
+//    ASPiK Plugin Kernel File:  stageprofiler.cpp
+//
+/**
+    \file   stageprofiler.cpp
+    \author Will Pirkle
+    \date   17-September-2018
+    \brief  implementation file for the per-stage audio thread profiler
+    		- http://www.aspikplugins.com
+    		- http://www.willpirkle.com
+*/
+// -----------------------------------------------------------------------------
+#include "stageprofiler.h"
+
+#if SYNTHLAB_PROFILER
+
+#include <stdio.h>
+
+/**
+\brief StageProfiler constructor; allocates the trace ring
+*/
+StageProfiler::StageProfiler()
+	: traceEvents(PROFILER_TRACE_EVENTS)
+{
+	reset();
+}
+
+/**
+\brief clear the accumulators, histograms and trace; NOT realtime safe
+*/
+void StageProfiler::reset()
+{
+	for (uint32_t stage = 0; stage <= kNumProfilerStages; stage++)
+	{
+		totalTicks[stage].store(0, std::memory_order_relaxed);
+		maxTicks[stage].store(0, std::memory_order_relaxed);
+		for (uint32_t bucket = 0; bucket < PROFILER_HISTOGRAM_BUCKETS; bucket++)
+			histogram[stage][bucket].store(0, std::memory_order_relaxed);
+	}
+
+	for (uint32_t stage = 0; stage < kNumProfilerStages; stage++)
+	{
+		bufferStageTicks[stage] = 0;
+		stageShare[stage] = 0.f;
+	}
+
+	bufferCount.store(0, std::memory_order_relaxed);
+	traceWriteIndex.store(0, std::memory_order_relaxed);
+
+	originTicks = getTicks();
+	originTime = std::chrono::steady_clock::now();
+}
+
+/**
+\brief commit the stage totals of the buffer; audio thread only
+
+Operation:
+- the buffer itself is recorded as a kProfileBuffer trace event that holds the stage events
+- the stage shares are relative to the measured buffer time, so they need no tick calibration
+*/
+void StageProfiler::endBuffer()
+{
+	uint64_t bufferEnd = getTicks();
+	uint64_t bufferTicks = bufferEnd - bufferStart;
+	addTraceEvent(kProfileBuffer, bufferStart, bufferEnd);
+
+	for (uint32_t stage = 0; stage < kNumProfilerStages; stage++)
+	{
+		addBufferTicks(stage, bufferStageTicks[stage]);
+		stageShare[stage] = bufferTicks > 0 ? (float)((double)bufferStageTicks[stage] / (double)bufferTicks) : 0.f;
+	}
+	addBufferTicks(kProfileBuffer, bufferTicks);
+
+	bufferCount.store(bufferCount.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+/**
+\brief add one per-buffer total to a stage's accumulators; single writer, so no read-modify-write is needed
+*/
+void StageProfiler::addBufferTicks(uint32_t stage, uint64_t ticks)
+{
+	totalTicks[stage].store(totalTicks[stage].load(std::memory_order_relaxed) + ticks, std::memory_order_relaxed);
+	if (ticks > maxTicks[stage].load(std::memory_order_relaxed))
+		maxTicks[stage].store(ticks, std::memory_order_relaxed);
+
+	std::atomic<uint32_t>& count = histogram[stage][getHistogramBucket(ticks)];
+	count.store(count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
+/**
+\brief histogram bucket of a tick count: exact below 4, then 4 buckets per octave
+*/
+uint32_t StageProfiler::getHistogramBucket(uint64_t ticks)
+{
+	if (ticks < 4)
+		return (uint32_t)ticks;
+
+	uint32_t octave = 2;
+	while (octave < 63 && (ticks >> (octave + 1)) != 0)
+		octave++;
+
+	uint32_t bucket = octave * 4 + (uint32_t)((ticks >> (octave - 2)) & 3);
+	return bucket < PROFILER_HISTOGRAM_BUCKETS ? bucket : PROFILER_HISTOGRAM_BUCKETS - 1;
+}
+
+/**
+\brief middle of a histogram bucket, in ticks
+*/
+double StageProfiler::getHistogramBucketTicks(uint32_t bucket)
+{
+	if (bucket < 4)
+		return (double)bucket;
+
+	uint32_t octave = bucket / 4;
+	double low = (double)(4 + bucket % 4) * (double)((uint64_t)1 << (octave - 2));
+	return low + 0.5 * (double)((uint64_t)1 << (octave - 2));
+}
+
+/**
+\brief tick rate, measured against the steady clock since reset( )
+*/
+double StageProfiler::getTicksPerMicrosecond()
+{
+#if PROFILER_TSC
+	uint64_t ticks = getTicks();
+	std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - originTime;
+	if (elapsed.count() < 1000.0 || ticks <= originTicks)
+		return 1000.0; // --- not enough time to calibrate; assume a 1 GHz counter
+	return (double)(ticks - originTicks) / elapsed.count();
+#else
+	return 1000.0; // --- nanoseconds
+#endif
+}
+
+/**
+\brief stats of one stage since the last reset( ); any thread
+
+\param stage a profilerStage, including kProfileBuffer
+\param stats the stats, in microseconds
+
+\return true if at least one buffer was measured
+*/
+bool StageProfiler::getStageStats(uint32_t stage, ProfilerStageStats& stats)
+{
+	stats = ProfilerStageStats();
+	if (stage > kNumProfilerStages)
+		return false;
+
+	uint64_t buffers = bufferCount.load(std::memory_order_acquire);
+	if (buffers == 0)
+		return false;
+
+	double ticksPerMicrosecond = getTicksPerMicrosecond();
+
+	// --- the histogram may be a few buffers ahead of the count; use its own total
+	uint32_t counts[PROFILER_HISTOGRAM_BUCKETS];
+	uint64_t histogramCount = 0;
+	for (uint32_t bucket = 0; bucket < PROFILER_HISTOGRAM_BUCKETS; bucket++)
+	{
+		counts[bucket] = histogram[stage][bucket].load(std::memory_order_relaxed);
+		histogramCount += counts[bucket];
+	}
+
+	double percents[3] = { 50.0, 90.0, 99.0 };
+	double* results[3] = { &stats.p50_us, &stats.p90_us, &stats.p99_us };
+	for (uint32_t i = 0; i < 3; i++)
+	{
+		uint64_t target = (uint64_t)(percents[i] * 0.01 * (double)histogramCount + 0.5);
+		uint64_t cumulative = 0;
+		for (uint32_t bucket = 0; bucket < PROFILER_HISTOGRAM_BUCKETS; bucket++)
+		{
+			cumulative += counts[bucket];
+			if (cumulative >= target && cumulative > 0)
+			{
+				*results[i] = getHistogramBucketTicks(bucket) / ticksPerMicrosecond;
+				break;
+			}
+		}
+	}
+
+	stats.buffers = buffers;
+	stats.mean_us = (double)totalTicks[stage].load(std::memory_order_relaxed) / (double)buffers / ticksPerMicrosecond;
+	stats.max_us = (double)maxTicks[stage].load(std::memory_order_relaxed) / ticksPerMicrosecond;
+	return true;
+}
+
+/**
+\brief the recorded trace events as Chrome trace JSON; any thread
+
+Operation:
+- copies the newest events out of the ring, then drops any the audio thread may have overwritten
+  during the copy
+- one complete ("X") event per timed section, all on one thread track; the time base is reset( )
+
+\param json the output; NOT realtime safe
+*/
+void StageProfiler::writeChromeTrace(std::string& json)
+{
+	uint64_t endIndex = traceWriteIndex.load(std::memory_order_acquire);
+	uint64_t startIndex = endIndex > PROFILER_TRACE_EVENTS ? endIndex - PROFILER_TRACE_EVENTS : 0;
+
+	struct CopiedEvent { uint32_t stage; uint64_t start; uint64_t end; };
+	std::vector<CopiedEvent> events;
+	events.reserve((size_t)(endIndex - startIndex));
+	for (uint64_t index = startIndex; index < endIndex; index++)
+	{
+		TraceEvent& event = traceEvents[index & (PROFILER_TRACE_EVENTS - 1)];
+		CopiedEvent copy = { event.stage.load(std::memory_order_relaxed),
+							 event.start.load(std::memory_order_relaxed),
+							 event.end.load(std::memory_order_relaxed) };
+		events.push_back(copy);
+	}
+
+	// --- the slot being written next is the oldest one: anything at or below this index may be torn
+	uint64_t writtenIndex = traceWriteIndex.load(std::memory_order_acquire);
+	uint64_t firstValid = writtenIndex >= PROFILER_TRACE_EVENTS ? writtenIndex - PROFILER_TRACE_EVENTS + 1 : 0;
+	size_t skip = firstValid > startIndex ? (size_t)(firstValid - startIndex) : 0;
+
+	double ticksPerMicrosecond = getTicksPerMicrosecond();
+	char line[256];
+
+	json = "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+	bool first = true;
+	for (size_t i = skip; i < events.size(); i++)
+	{
+		const CopiedEvent& event = events[i];
+		if (event.stage > kNumProfilerStages || event.end < event.start || event.start < originTicks)
+			continue;
+
+		snprintf(line, sizeof(line), "%s\n{\"name\":\"%s\",\"cat\":\"audio\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":1}",
+				 first ? "" : ",",
+				 getStageName(event.stage),
+				 (double)(event.start - originTicks) / ticksPerMicrosecond,
+				 (double)(event.end - event.start) / ticksPerMicrosecond);
+		json += line;
+		first = false;
+	}
+	json += "\n]}\n";
+}
+
+/**
+\brief write the Chrome trace JSON to a file; any thread, NOT realtime safe
+
+\param path file path
+
+\return true if the file was written
+*/
+bool StageProfiler::dumpChromeTrace(const char* path)
+{
+	std::string json;
+	writeChromeTrace(json);
+
+	FILE* file = fopen(path, "wb");
+	if (!file)
+		return false;
+
+	bool written = fwrite(json.data(), 1, json.size(), file) == json.size();
+	fclose(file);
+	return written;
+}
+
+/**
+\brief stage name, as used in the trace
+*/
+const char* StageProfiler::getStageName(uint32_t stage)
+{
+	static const char* stageNames[kNumProfilerStages + 1] = {
+		"parameters", "midi", "updateParameters", "render", "outputCopy", "outBound", "processAudioBuffers" };
+	return stage <= kNumProfilerStages ? stageNames[stage] : "unknown";
+}
+
+#endif // SYNTHLAB_PROFILER
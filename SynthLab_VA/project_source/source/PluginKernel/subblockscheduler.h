@@ -0,0 +1,146 @@
+// -----------------------------------------------------------------------------
+//    ASPiK Plugin Kernel File:  subblockscheduler.h
+//
+/**
+    \file   subblockscheduler.h
+    \author Will Pirkle
+    \date   17-September-2018
+    \brief  interface file for the sample accurate MIDI sub-block scheduler
+    		- http://www.aspikplugins.com
+    		- http://www.willpirkle.com
+*/
+// -----------------------------------------------------------------------------
+#ifndef _SubBlockScheduler_H_
+#define _SubBlockScheduler_H_
+
+#include "pluginstructures.h"
+
+// --- MIDI events that can be scheduled per block; the rest are dispatched at the block start
+const uint32_t MAX_BLOCK_MIDI_EVENTS = 512;
+
+/**
+\class MidiSubBlockScheduler
+\ingroup ASPiK-Core
+\brief
+Splits a render block into sub-blocks that begin on MIDI event offsets so that block based
+synth engines respond with sample accurate timing.
+
+MidiSubBlockScheduler Operations:
+- addEvent( ) queues a MIDI event with its offset into the current block (no allocation)
+- getNextSubBlock( ) returns the next sub-block and the range of events to dispatch at its start
+- events closer than the minimum sub-block length to the current sub-block start are dispatched
+  early, at that start, so a dense burst of events never produces tiny (expensive) renders
+- a minimum length >= the block size reproduces the old behavior: all events at the block start
+- keeps running timing error statistics for metering and benchmarking
+
+\author Will Pirkle http://www.willpirkle.com
+\remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
+\version Revision : 1.0
+\date Date : 2018 / 09 / 7
+*/
+class MidiSubBlockScheduler
+{
+public:
+	MidiSubBlockScheduler() {}
+
+	/** minimum sub-block length in samples; 1 = fully sample accurate */
+	void setMinSubBlockSize(uint32_t _minSubBlockSize) { minSubBlockSize = _minSubBlockSize < 1 ? 1 : _minSubBlockSize; }
+	uint32_t getMinSubBlockSize() { return minSubBlockSize; }
+
+	/** start a new block */
+	void clear()
+	{
+		eventCount = 0;
+		nextEvent = 0;
+		nextStart = 0;
+	}
+
+	/** queue an event at a block offset; returns false if the queue is full */
+	bool addEvent(const midiEvent& event, uint32_t offset)
+	{
+		if (eventCount >= MAX_BLOCK_MIDI_EVENTS)
+			return false;
+
+		// --- keep the queue sorted; events are fired in sample order anyway
+		if (eventCount > 0 && offset < offsets[eventCount - 1])
+			offset = offsets[eventCount - 1];
+
+		events[eventCount] = event;
+		offsets[eventCount] = offset;
+		eventCount++;
+		return true;
+	}
+
+	/** get the next sub-block of a block
+
+	\param blockSize size of the whole block
+	\param start returns sub-block start offset
+	\param length returns sub-block length
+	\param firstEvent returns index of first event to dispatch at the start
+	\param numEvents returns number of events to dispatch at the start
+
+	\return false when the block is done
+	*/
+	bool getNextSubBlock(uint32_t blockSize, uint32_t& start, uint32_t& length, uint32_t& firstEvent, uint32_t& numEvents)
+	{
+		if (nextStart >= blockSize)
+			return false;
+
+		start = nextStart;
+		firstEvent = nextEvent;
+
+		// --- everything inside the minimum length, or in a too-short tail, goes now
+		uint32_t horizon = start + minSubBlockSize;
+		while (nextEvent < eventCount && (offsets[nextEvent] < horizon || horizon >= blockSize))
+		{
+			uint32_t error = offsets[nextEvent] > start ? offsets[nextEvent] - start : 0;
+			totalTimingError += error;
+			if (error > maxTimingError)
+				maxTimingError = error;
+			scheduledEventCount++;
+			nextEvent++;
+		}
+		numEvents = nextEvent - firstEvent;
+
+		uint32_t end = nextEvent < eventCount ? offsets[nextEvent] : blockSize;
+		if (end > blockSize)
+			end = blockSize;
+
+		length = end - start;
+		nextStart = end;
+		subBlockCount++;
+
+		return true;
+	}
+
+	/** get a queued event */
+	midiEvent& getEvent(uint32_t index) { return events[index]; }
+
+	/** timing statistics; error is the distance in samples from an event to its dispatch point */
+	uint64_t getSubBlockCount() { return subBlockCount; }
+	uint64_t getScheduledEventCount() { return scheduledEventCount; }
+	uint64_t getTotalTimingError() { return totalTimingError; }
+	uint32_t getMaxTimingError() { return maxTimingError; }
+	void resetStatistics()
+	{
+		subBlockCount = 0;
+		scheduledEventCount = 0;
+		totalTimingError = 0;
+		maxTimingError = 0;
+	}
+
+protected:
+	midiEvent events[MAX_BLOCK_MIDI_EVENTS];	///< queued events
+	uint32_t offsets[MAX_BLOCK_MIDI_EVENTS];	///< block offsets of queued events
+	uint32_t eventCount = 0;					///< number of queued events
+	uint32_t nextEvent = 0;						///< next event to dispatch
+	uint32_t nextStart = 0;						///< next sub-block start
+	uint32_t minSubBlockSize = 16;				///< minimum split distance
+
+	uint64_t subBlockCount = 0;					///< statistics
+	uint64_t scheduledEventCount = 0;			///< statistics
+	uint64_t totalTimingError = 0;				///< statistics
+	uint32_t maxTimingError = 0;				///< statistics
+};
+
+#endif
@@ -0,0 +1,203 @@
+// -----------------------------------------------------------------------------
+//    ASPiK Bench File:  filterbench.cpp
+//
+/**
+    \file   filterbench.cpp
+    \author Will Pirkle
+    \date   17-September-2018
+    \brief  filter throughput on decaying tails, with and without FTZ/DAZ
+    		- each fxobject is fed a short burst followed by silence, the case
+    		  where recursive filters decay into denormals
+    		- build with FLUSH_DENORMALS=1 to measure with the per-sample
+    		  underflow checks compiled out (bench_cmake builds both)
+    		- each object runs once per sample (processAudioSample) and once
+    		  per 512 sample block (processAudioBlock)
+    		- prints one JSON object per (object, FPU mode, call mode) run to stdout
+    		- http://www.aspikplugins.com
+    		- http://www.willpirkle.com
+*/
+// -----------------------------------------------------------------------------
+#include "fxobjects.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+const double kBenchSampleRate = 48000.0;
+const uint32_t kBenchBlockSize = 512;
+
+/**
+\brief set a biquad up as a resonant 2nd order LPF (fc = 1kHz, Q = 2)
+*/
+void setResonantLPF(Biquad& biquad, biquadAlgorithm algorithm)
+{
+	double theta = kTwoPi * 1000.0 / kBenchSampleRate;
+	double d = 1.0 / 2.0;
+	double beta = 0.5 * (1.0 - 0.5 * d * sin(theta)) / (1.0 + 0.5 * d * sin(theta));
+	double gamma = (0.5 + beta) * cos(theta);
+	double alpha = (0.5 + beta - gamma) / 2.0;
+
+	double coeffs[numCoeffs] = { 0.0 };
+	coeffs[a0] = alpha;
+	coeffs[a1] = 2.0 * alpha;
+	coeffs[a2] = alpha;
+	coeffs[b1] = -2.0 * gamma;
+	coeffs[b2] = 2.0 * beta;
+
+	BiquadParameters params;
+	params.biquadCalcType = algorithm;
+	biquad.setParameters(params);
+	biquad.setCoefficients(coeffs);
+	biquad.reset(kBenchSampleRate);
+}
+
+/**
+\brief run a processor over 10 msec bursts of noise, each followed by ~2 seconds of silence
+
+\return nanoseconds per sample
+*/
+double runDecayingTails(IAudioSignalProcessor& processor, uint32_t numBursts)
+{
+	const uint32_t burstLength = (uint32_t)(0.01 * kBenchSampleRate);
+	const uint32_t period = (uint32_t)(2.0 * kBenchSampleRate);
+
+	double sink = 0.0;
+	uint32_t seed = 12345;
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for (uint32_t burst = 0; burst < numBursts; burst++)
+	{
+		for (uint32_t n = 0; n < period; n++)
+		{
+			double xn = 0.0;
+			if (n < burstLength)
+			{
+				seed = seed * 1664525 + 1013904223;
+				xn = ((double)seed / 4294967295.0) * 2.0 - 1.0;
+			}
+			sink += processor.processAudioSample(xn);
+		}
+	}
+	std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+	// --- keep the output alive
+	if (sink == 1.2345)
+		printf("%f\n", sink);
+
+	double elapsed = std::chrono::duration<double>(end - start).count();
+	return elapsed * 1.0e9 / ((double)numBursts * period);
+}
+
+/**
+\brief runDecayingTails( ) through processAudioBlock( ), kBenchBlockSize samples per call
+
+\return nanoseconds per sample
+*/
+double runDecayingTailsBlock(IAudioSignalProcessor& processor, uint32_t numBursts)
+{
+	const uint32_t burstLength = (uint32_t)(0.01 * kBenchSampleRate);
+	const uint32_t period = (uint32_t)(2.0 * kBenchSampleRate);
+
+	float block[kBenchBlockSize];
+	float* channels[1] = { block };
+
+	double sink = 0.0;
+	uint32_t seed = 12345;
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for (uint32_t burst = 0; burst < numBursts; burst++)
+	{
+		for (uint32_t n = 0; n < period; n += kBenchBlockSize)
+		{
+			uint32_t frames = period - n < kBenchBlockSize ? period - n : kBenchBlockSize;
+			for (uint32_t i = 0; i < frames; i++)
+			{
+				block[i] = 0.f;
+				if (n + i < burstLength)
+				{
+					seed = seed * 1664525 + 1013904223;
+					block[i] = (float)(((double)seed / 4294967295.0) * 2.0 - 1.0);
+				}
+			}
+			processor.processAudioBlock(channels, channels, 1, frames);
+			sink += block[frames - 1];
+		}
+	}
+	std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+	// --- keep the output alive
+	if (sink == 1.2345)
+		printf("%f\n", sink);
+
+	double elapsed = std::chrono::duration<double>(end - start).count();
+	return elapsed * 1.0e9 / ((double)numBursts * period);
+}
+
+/**
+\brief print one result line
+*/
+void printResult(const char* object, bool ftz, bool block, double nsPerSample)
+{
+	printf("{\"object\":\"%s\",\"underflowChecks\":%s,\"ftz\":%s,\"mode\":\"%s\",\"nsPerSample\":%.3f,\"megaSamplesPerSec\":%.2f}\n",
+		   object,
+		   DENORMAL_GUARD_ACTIVE ? "false" : "true",
+		   ftz ? "true" : "false",
+		   block ? "block" : "sample",
+		   nsPerSample,
+		   nsPerSample > 0.0 ? 1.0e3 / nsPerSample : 0.0);
+	fflush(stdout);
+}
+
+/**
+\brief bench entry point: [numBursts] (10)
+*/
+int main(int argc, char* argv[])
+{
+	uint32_t numBursts = argc > 1 ? (uint32_t)atoi(argv[1]) : 10;
+	if (numBursts == 0)
+		numBursts = 1;
+
+	if (!DENORMAL_GUARD_SUPPORTED)
+		fprintf(stderr, "FTZ/DAZ is not supported on this CPU; the ftz runs are the same as the others\n");
+
+	const char* biquadNames[4] = { "Biquad(kDirect)", "Biquad(kCanonical)", "Biquad(kTransposeDirect)", "Biquad(kTransposeCanonical)" };
+	const biquadAlgorithm algorithms[4] = { biquadAlgorithm::kDirect, biquadAlgorithm::kCanonical,
+											biquadAlgorithm::kTransposeDirect, biquadAlgorithm::kTransposeCanonical };
+
+	for (uint32_t ftz = 0; ftz < 2; ftz++)
+	{
+		ScopedDenormalGuard denormalGuard(ftz == 1);
+
+		for (uint32_t block = 0; block < 2; block++)
+		{
+			for (uint32_t i = 0; i < 4; i++)
+			{
+				Biquad biquad;
+				setResonantLPF(biquad, algorithms[i]);
+				printResult(biquadNames[i], ftz == 1, block == 1,
+							block == 1 ? runDecayingTailsBlock(biquad, numBursts) : runDecayingTails(biquad, numBursts));
+			}
+
+			AudioDetector detector;
+			AudioDetectorParameters detectorParams;
+			detectorParams.attackTime_mSec = 1.0;
+			detectorParams.releaseTime_mSec = 2.0;
+			detectorParams.detectMode = TLD_AUDIO_DETECT_MODE_PEAK;
+			detector.reset(kBenchSampleRate);
+			detector.setParameters(detectorParams);
+			printResult("AudioDetector", ftz == 1, block == 1,
+						block == 1 ? runDecayingTailsBlock(detector, numBursts) : runDecayingTails(detector, numBursts));
+
+			// --- a composite object: four triodes and two shelving filters per sample
+			ClassATubePre tubePre;
+			ClassATubePreParameters tubeParams;
+			tubeParams.saturation = 2.0;
+			tubeParams.lowShelf_fc = 150.0;
+			tubeParams.highShelf_fc = 4000.0;
+			tubePre.reset(kBenchSampleRate);
+			tubePre.setParameters(tubeParams);
+			printResult("ClassATubePre", ftz == 1, block == 1,
+						block == 1 ? runDecayingTailsBlock(tubePre, numBursts) : runDecayingTails(tubePre, numBursts));
+		}
+	}
+
+	return 0;
+}
@@ -0,0 +1,551 @@
+// -----------------------------------------------------------------------------
+//    ASPiK Bench File:  synthbench.cpp
+//
+/**
+    \file   synthbench.cpp
+    \author Will Pirkle
+    \date   17-September-2018
+    \brief  headless offline benchmark for the SynthLab PluginCore
+    		- runs the PluginCore without any plugin API shell or GUI
+    		- renders scripted MIDI workloads for each factory preset
+    		- prints one JSON object per (preset, workload) run to stdout
+    		- --midi-sub-block compare runs each workload with the old 64 sample MIDI
+    		  quantization and with the default sample accurate sub-blocks
+    		- built with SYNTHLAB_RT_AUDIT=1 (the _rtaudit target) it also checks that
+    		  processAudioBuffers( ) never allocates, frees or locks, and fails if it does
+    		- http://www.aspikplugins.com
+    		- http://www.willpirkle.com
+*/
+// -----------------------------------------------------------------------------
+#include "plugincore.h"
+#include "denormalguard.h"
+#include "rtauditor.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <sys/resource.h>
+
+/**
+\enum benchWorkload
+\ingroup Bench
+\brief
+Scripted MIDI workloads.
+
+- kPolyWorkload: 8-note chords, re-struck every 2 seconds (sustained polyphony)
+- kArpWorkload: 16th note arpeggio at 180 BPM over two and a half octaves (voice start/stop churn)
+- kUnisonWorkload: synth mode forced to Unison, one note re-struck every second (unison stacks)
+- kAutomationWorkload: held chord with every continuous parameter swept on every buffer
+*/
+enum benchWorkload { kPolyWorkload, kArpWorkload, kUnisonWorkload, kAutomationWorkload, kNumBenchWorkloads };
+
+const char* benchWorkloadNames[kNumBenchWorkloads] = { "poly", "arp", "unison", "automation" };
+
+/** synthMode list index of "Unison" (Mono,Legato,Unison,UniLegato,Poly) */
+const uint32_t kUnisonSynthMode = 2;
+
+/** minimum MIDI sub-block size of the old path: all events at the top of each 64 sample render */
+const uint32_t kQuantizedMidiSubBlockSize = 64;
+
+const uint32_t MIDI_NOTE_ON = 0x90;
+const uint32_t MIDI_NOTE_OFF = 0x80;
+
+/**
+\struct BenchOptions
+\ingroup Bench
+\brief
+Command line options, see printUsage( )
+*/
+struct BenchOptions
+{
+	double sampleRate = 48000.0;	///< fs
+	uint32_t bufferSize = 256;		///< host buffer size in frames
+	double seconds = 10.0;			///< audio length of each run
+	int32_t workload = -1;			///< benchWorkload index, -1 = all
+	int32_t preset = -1;			///< preset index, -1 = all
+	std::string dllPath = ".";		///< folder that holds the SynthLabModules folder (DM plugins only)
+	std::string tracePath;			///< Chrome trace of the last run (SYNTHLAB_PROFILER builds only)
+	uint32_t minMidiSubBlockSize = kMinMidiSubBlockSize; ///< MIDI sub-block minimum of each run
+	bool compareMidiSubBlocks = false;	///< run each workload at kQuantizedMidiSubBlockSize, then minMidiSubBlockSize
+};
+
+/**
+\class BenchMidiQueue
+\ingroup Bench
+\brief
+IMidiEventQueue that fires a scripted list of events; the list is rebuilt for each buffer.
+
+Operation:
+- events must be added in sample offset order
+- fireMidiEvents( ) is called once for each sample in the buffer and sends the core every
+  event at that offset
+*/
+class BenchMidiQueue : public IMidiEventQueue
+{
+public:
+	BenchMidiQueue(PluginCore* _pluginCore) : pluginCore(_pluginCore) { events.reserve(64); }
+	virtual ~BenchMidiQueue() {}
+
+	/** start a new buffer */
+	void clear() { events.clear(); nextEvent = 0; }
+
+	/** add an event for the current buffer */
+	void addEvent(uint32_t message, uint32_t note, uint32_t velocity, uint32_t sampleOffset)
+	{
+		events.push_back(midiEvent(message, 0, note, velocity, sampleOffset));
+	}
+
+	virtual uint32_t getEventCount() { return (uint32_t)events.size(); }
+
+	virtual bool fireMidiEvents(uint32_t sampleOffset)
+	{
+		bool eventOccurred = false;
+		while (nextEvent < events.size() && events[nextEvent].midiSampleOffset == sampleOffset)
+		{
+			pluginCore->processMIDIEvent(events[nextEvent++]);
+			eventOccurred = true;
+		}
+		return eventOccurred;
+	}
+
+protected:
+	PluginCore* pluginCore = nullptr;	///< the core
+	std::vector<midiEvent> events;		///< events for the current buffer
+	size_t nextEvent = 0;				///< next event to fire
+};
+
+/**
+\brief print the command line options to stderr
+*/
+void printUsage(const char* name)
+{
+	fprintf(stderr, "usage: %s [options]\n", name);
+	fprintf(stderr, "  --sample-rate <Hz>     sample rate (48000)\n");
+	fprintf(stderr, "  --buffer <frames>      host buffer size (256)\n");
+	fprintf(stderr, "  --seconds <sec>        audio length of each run (10)\n");
+	fprintf(stderr, "  --workload <name>      poly, arp, unison, automation or all (all)\n");
+	fprintf(stderr, "  --preset <index>       factory preset index or -1 for all (-1)\n");
+	fprintf(stderr, "  --dll-path <folder>    folder that holds SynthLabModules (.)\n");
+	fprintf(stderr, "  --trace <file>         Chrome trace JSON of the last run (SYNTHLAB_PROFILER builds only)\n");
+	fprintf(stderr, "  --midi-sub-block <n>   minimum MIDI sub-block size, or compare for %u and %u (%u)\n",
+			kQuantizedMidiSubBlockSize, kMinMidiSubBlockSize, kMinMidiSubBlockSize);
+}
+
+/**
+\brief parse the command line
+
+\return true if the options are valid
+*/
+bool parseOptions(int argc, char* argv[], BenchOptions& options)
+{
+	for (int i = 1; i < argc; i++)
+	{
+		std::string arg = argv[i];
+		if (arg == "--help" || arg == "-h" || i + 1 >= argc)
+			return false;
+
+		const char* value = argv[++i];
+		if (arg == "--sample-rate")
+			options.sampleRate = atof(value);
+		else if (arg == "--buffer")
+			options.bufferSize = (uint32_t)atoi(value);
+		else if (arg == "--seconds")
+			options.seconds = atof(value);
+		else if (arg == "--preset")
+			options.preset = atoi(value);
+		else if (arg == "--dll-path")
+			options.dllPath = value;
+		else if (arg == "--trace")
+			options.tracePath = value;
+		else if (arg == "--midi-sub-block")
+		{
+			if (strcmp(value, "compare") == 0)
+				options.compareMidiSubBlocks = true;
+			else if (atoi(value) > 0)
+				options.minMidiSubBlockSize = (uint32_t)atoi(value);
+			else
+				return false;
+		}
+		else if (arg == "--workload")
+		{
+			options.workload = -2;
+			if (strcmp(value, "all") == 0)
+				options.workload = -1;
+			for (int32_t w = 0; w < kNumBenchWorkloads; w++)
+			{
+				if (strcmp(value, benchWorkloadNames[w]) == 0)
+					options.workload = w;
+			}
+			if (options.workload == -2)
+				return false;
+		}
+		else
+			return false;
+	}
+	return options.sampleRate > 0.0 && options.bufferSize > 0 && options.seconds > 0.0;
+}
+
+/**
+\brief add the note on/off events of a workload that fall inside one buffer
+
+Operation:
+- the scripts are functions of the absolute sample index, so the buffer size does not change the
+  note timing (only the position of the events inside the buffers)
+- each note-on is preceded by the note-offs of the previous chord/step at the same offset
+
+\param workload the benchWorkload
+\param queue the queue to fill
+\param bufferStart absolute sample index of the top of the buffer
+\param numFrames frames in the buffer
+\param sampleRate fs
+*/
+void scheduleWorkloadMidi(uint32_t workload, BenchMidiQueue& queue, uint64_t bufferStart, uint32_t numFrames, double sampleRate)
+{
+	static const uint32_t chords[4][8] = {
+		{ 36, 48, 55, 60, 64, 67, 72, 76 },
+		{ 33, 45, 52, 57, 60, 64, 69, 72 },
+		{ 29, 41, 48, 53, 57, 60, 65, 69 },
+		{ 31, 43, 50, 55, 59, 62, 67, 71 } };
+	static const uint32_t arpeggio[8] = { 48, 52, 55, 60, 64, 67, 72, 79 };
+
+	uint64_t period = 0;
+	switch (workload)
+	{
+		case kArpWorkload: period = (uint64_t)(sampleRate * 60.0 / (180.0 * 4.0)); break;
+		case kUnisonWorkload: period = (uint64_t)sampleRate; break;
+		case kPolyWorkload:	period = (uint64_t)(sampleRate * 2.0); break;
+		default: period = 0; break; // --- automation: one chord at the start, held
+	}
+
+	for (uint32_t frame = 0; frame < numFrames; frame++)
+	{
+		uint64_t sample = bufferStart + frame;
+		if (period > 0 ? sample % period != 0 : sample != 0)
+			continue;
+
+		uint64_t step = period > 0 ? sample / period : 0;
+		if (workload == kArpWorkload)
+		{
+			if (step > 0)
+				queue.addEvent(MIDI_NOTE_OFF, arpeggio[(step - 1) % 8], 0, frame);
+			queue.addEvent(MIDI_NOTE_ON, arpeggio[step % 8], 100, frame);
+		}
+		else if (workload == kUnisonWorkload)
+		{
+			if (step > 0)
+				queue.addEvent(MIDI_NOTE_OFF, 48 + (uint32_t)((step - 1) % 12), 0, frame);
+			queue.addEvent(MIDI_NOTE_ON, 48 + (uint32_t)(step % 12), 100, frame);
+		}
+		else
+		{
+			if (step > 0)
+			{
+				for (uint32_t n = 0; n < 8; n++)
+					queue.addEvent(MIDI_NOTE_OFF, chords[(step - 1) % 4][n], 0, frame);
+			}
+			for (uint32_t n = 0; n < 8; n++)
+				queue.addEvent(MIDI_NOTE_ON, chords[step % 4][n], 90, frame);
+		}
+	}
+}
+
+/**
+\brief sweep every continuous parameter the way a host automation lane does
+
+Operation:
+- each parameter follows its own 0.1 - 1.0 Hz sinusoid in normalized space
+- values are written with setControlValueNormalized( ), the same call the VST3 shell uses for
+  (non sample accurate) automation, so smoothing and bound variable updates are included
+*/
+void sweepParameters(PluginCore* pluginCore, std::vector<PluginParameter*>& sweepParams, double time)
+{
+	for (size_t i = 0; i < sweepParams.size(); i++)
+	{
+		double rate = 0.1 + 0.9 * (double)(i % 10) / 9.0;
+		double normalized = 0.5 + 0.5 * sin(kTwoPi * rate * time);
+		sweepParams[i]->setControlValueNormalized(normalized, true);
+	}
+}
+
+/**
+\brief print a string as a JSON string literal
+*/
+void printJSONString(const char* str)
+{
+	putchar('"');
+	for (const char* c = str; *c; c++)
+	{
+		if (*c == '"' || *c == '\\')
+			putchar('\\');
+		if ((unsigned char)*c >= 0x20)
+			putchar(*c);
+	}
+	putchar('"');
+}
+
+/**
+\brief value at a percentile of a sorted list
+*/
+double getPercentile(const std::vector<double>& sorted, double percent)
+{
+	if (sorted.empty())
+		return 0.0;
+	size_t index = (size_t)(percent * 0.01 * (double)(sorted.size() - 1) + 0.5);
+	return sorted[index];
+}
+
+#if SYNTHLAB_PROFILER
+/**
+\brief print the StageProfiler stats of the run as a "stages" JSON object (microseconds per buffer)
+*/
+void printProfilerStages(PluginCore* pluginCore)
+{
+	printf(",\"stages\":{");
+	for (uint32_t stage = 0; stage <= kNumProfilerStages; stage++)
+	{
+		ProfilerStageStats stats;
+		pluginCore->getProfilerStageStats(stage, stats);
+		printf("%s\"%s\":{\"mean_us\":%.2f,\"p50_us\":%.2f,\"p99_us\":%.2f,\"max_us\":%.2f}",
+			   stage == 0 ? "" : ",", StageProfiler::getStageName(stage),
+			   stats.mean_us, stats.p50_us, stats.p99_us, stats.max_us);
+	}
+	printf("}");
+}
+#endif
+
+/**
+\brief render one workload with one preset and print the result line
+
+Operation:
+- reset the core, apply the preset (and synth mode for unison), then render the script
+- only processAudioBuffers( ) is timed; MIDI scripting and automation happen outside the timer
+- realTimeFactor = processing time / audio time, so values below 1.0 are faster than real time
+- peakRSS_kB is the peak resident set size of the process so far (getrusage)
+- governorPeakLevel is the highest VoiceGovernor level of the run; anything above 0 means the
+  governor would have degraded the sound on this machine
+- inBoundUpdatesPerBuffer is the mean number of parameters syncInBoundVariables( ) visited per
+  buffer (only changed parameters are visited)
+- minMidiSubBlockSize is the MidiSubBlockScheduler minimum of the run; midiSubBlocks is the number
+  of sub-blocks it rendered and midiTotalTimingError/midiMaxTimingError are the summed and largest
+  distances in samples between a MIDI event and the sample it was dispatched at
+- SYNTHLAB_RT_AUDIT builds add rtViolations, the audio thread violations of the run
+- SYNTHLAB_PROFILER builds add the per-stage "stages" object and write --trace after each run,
+  so the file holds the last run
+
+\return true if the run completed
+*/
+bool runWorkload(PluginCore* pluginCore, const BenchOptions& options, uint32_t workload, int32_t presetIndex, uint32_t minMidiSubBlockSize)
+{
+	ResetInfo resetInfo(options.sampleRate, 32);
+	pluginCore->reset(resetInfo);
+	pluginCore->setMinMidiSubBlockSize(minMidiSubBlockSize);
+	pluginCore->midiSubBlockScheduler.resetStatistics();
+
+	std::string presetName = "(default)";
+	if (presetIndex >= 0)
+	{
+		const PresetInfo* preset = pluginCore->getPreset((uint32_t)presetIndex);
+		if (!preset)
+			return false;
+		presetName = preset->presetName;
+		for (size_t i = 0; i < preset->presetParameters.size(); i++)
+			pluginCore->setPIParamValue(preset->presetParameters[i].controlID, preset->presetParameters[i].actualValue);
+	}
+
+	if (workload == kUnisonWorkload)
+		pluginCore->setPIParamValue(controlID::synthMode, kUnisonSynthMode);
+
+	// --- continuous parameters for the automation workload
+	std::vector<PluginParameter*> sweepParams;
+	if (workload == kAutomationWorkload)
+	{
+		controlVariableType types[2] = { controlVariableType::kDouble, controlVariableType::kFloat };
+		for (uint32_t t = 0; t < 2; t++)
+		{
+			int32_t startIndex = 0;
+			while (startIndex >= 0)
+			{
+				PluginParameter* piParam = pluginCore->getNextParameterOfType(startIndex, types[t]);
+				if (piParam)
+					sweepParams.push_back(piParam);
+			}
+		}
+	}
+
+	// --- stereo output, no inputs
+	uint32_t numChannels = 2;
+	std::vector<float> left(options.bufferSize, 0.f);
+	std::vector<float> right(options.bufferSize, 0.f);
+	float* outputs[2] = { &left[0], &right[0] };
+
+	HostInfo hostInfo;
+	hostInfo.dBPM = 120.0;
+	hostInfo.fTimeSigNumerator = 4.f;
+	hostInfo.uTimeSigDenomintor = 4;
+
+	BenchMidiQueue midiQueue(pluginCore);
+
+	ProcessBufferInfo info;
+	info.outputs = outputs;
+	info.numAudioInChannels = 0;
+	info.numAudioOutChannels = numChannels;
+	info.channelIOConfig = ChannelIOConfig(kCFNone, kCFStereo);
+	info.hostInfo = &hostInfo;
+	info.midiEventQueue = &midiQueue;
+
+	uint64_t totalFrames = (uint64_t)(options.seconds * options.sampleRate);
+	uint64_t numBuffers = (totalFrames + options.bufferSize - 1) / options.bufferSize;
+	std::vector<double> bufferMicroseconds;
+	bufferMicroseconds.reserve((size_t)numBuffers);
+	double totalSeconds = 0.0;
+	uint64_t inBoundUpdatesBefore = pluginCore->getTotalInBoundUpdates();
+#if SYNTHLAB_RT_AUDIT
+	uint64_t violationsBefore = RTAuditor::getViolationCount();
+#endif
+
+	for (uint64_t buffer = 0; buffer < numBuffers; buffer++)
+	{
+		uint64_t bufferStart = buffer * options.bufferSize;
+		uint32_t numFrames = (uint32_t)std::min<uint64_t>(options.bufferSize, totalFrames - bufferStart);
+
+		midiQueue.clear();
+		scheduleWorkloadMidi(workload, midiQueue, bufferStart, numFrames, options.sampleRate);
+		if (!sweepParams.empty())
+			sweepParameters(pluginCore, sweepParams, (double)bufferStart / options.sampleRate);
+
+		// --- the core advances the host time by itself; set it for the top of the buffer
+		hostInfo.uAbsoluteFrameBufferIndex = bufferStart;
+		hostInfo.dAbsoluteFrameBufferTime = (double)bufferStart / options.sampleRate;
+		info.numFramesToProcess = numFrames;
+
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		{
+			// --- same FPU mode as VST3Plugin::process( )
+			ScopedDenormalGuard denormalGuard(DENORMAL_GUARD_ACTIVE != 0);
+
+			// --- and the same audio thread flag
+			RT_AUDIT_SCOPE("synthbench");
+			pluginCore->processAudioBuffers(info);
+		}
+		std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+		double elapsed = std::chrono::duration<double>(end - start).count();
+		totalSeconds += elapsed;
+		bufferMicroseconds.push_back(elapsed * 1.0e6);
+	}
+
+	std::sort(bufferMicroseconds.begin(), bufferMicroseconds.end());
+
+	struct rusage usage;
+	getrusage(RUSAGE_SELF, &usage);
+
+	double audioSeconds = (double)totalFrames / options.sampleRate;
+	printf("{\"plugin\":");
+	printJSONString(pluginCore->getPluginName());
+	printf(",\"presetIndex\":%d,\"preset\":", presetIndex);
+	printJSONString(presetName.c_str());
+	printf(",\"workload\":\"%s\",\"sampleRate\":%.0f,\"bufferSize\":%u,\"buffers\":%llu,\"audioSeconds\":%.3f",
+		   benchWorkloadNames[workload], options.sampleRate, options.bufferSize, (unsigned long long)numBuffers, audioSeconds);
+	printf(",\"realTimeFactor\":%.6f,\"p50_us\":%.2f,\"p90_us\":%.2f,\"p99_us\":%.2f,\"max_us\":%.2f,\"peakRSS_kB\":%ld,\"governorPeakLevel\":%u",
+		   totalSeconds / audioSeconds,
+		   getPercentile(bufferMicroseconds, 50.0),
+		   getPercentile(bufferMicroseconds, 90.0),
+		   getPercentile(bufferMicroseconds, 99.0),
+		   bufferMicroseconds.empty() ? 0.0 : bufferMicroseconds.back(),
+		   (long)usage.ru_maxrss,
+		   pluginCore->voiceGovernor.getPeakLevel());
+	printf(",\"inBoundUpdatesPerBuffer\":%.2f",
+		   numBuffers > 0 ? (double)(pluginCore->getTotalInBoundUpdates() - inBoundUpdatesBefore) / (double)numBuffers : 0.0);
+	printf(",\"minMidiSubBlockSize\":%u,\"midiSubBlocks\":%llu,\"midiEvents\":%llu,\"midiTotalTimingError\":%llu,\"midiMaxTimingError\":%u",
+		   pluginCore->midiSubBlockScheduler.getMinSubBlockSize(),
+		   (unsigned long long)pluginCore->midiSubBlockScheduler.getSubBlockCount(),
+		   (unsigned long long)pluginCore->midiSubBlockScheduler.getScheduledEventCount(),
+		   (unsigned long long)pluginCore->midiSubBlockScheduler.getTotalTimingError(),
+		   pluginCore->midiSubBlockScheduler.getMaxTimingError());
+#if SYNTHLAB_RT_AUDIT
+	printf(",\"rtViolations\":%llu", (unsigned long long)(RTAuditor::getViolationCount() - violationsBefore));
+#endif
+#if SYNTHLAB_PROFILER
+	printProfilerStages(pluginCore);
+	if (!options.tracePath.empty() && !pluginCore->dumpProfilerTrace(options.tracePath.c_str()))
+		fprintf(stderr, "could not write %s\n", options.tracePath.c_str());
+#endif
+	printf("}\n");
+	fflush(stdout);
+
+	return true;
+}
+
+/**
+\brief bench entry point
+
+Operation:
+- create and initialize the core as a plugin shell does
+- run the selected workloads for the selected presets; with no factory presets the default
+  parameter state is used
+- with --midi-sub-block compare each workload runs twice, quantized to 64 samples and then with
+  the default minimum MIDI sub-block size, printing one line per run
+
+\return 0 if all runs completed (and, in SYNTHLAB_RT_AUDIT builds, without audio thread violations)
+*/
+int main(int argc, char* argv[])
+{
+	BenchOptions options;
+	if (!parseOptions(argc, argv, options))
+	{
+		printUsage(argv[0]);
+		return 1;
+	}
+
+	PluginCore* pluginCore = new PluginCore;
+
+	PluginInfo pluginInfo;
+	pluginInfo.pathToDLL = options.dllPath.c_str();
+	pluginInfo.pathToPluginFolder = options.dllPath.c_str();
+	pluginCore->initialize(pluginInfo);
+
+	int32_t firstPreset = options.preset;
+	int32_t lastPreset = options.preset;
+	if (options.preset < 0)
+	{
+		firstPreset = pluginCore->getPresetCount() > 0 ? 0 : -1;
+		lastPreset = (int32_t)pluginCore->getPresetCount() - 1;
+	}
+
+	int result = 0;
+	for (int32_t preset = firstPreset; preset <= lastPreset; preset++)
+	{
+		for (uint32_t workload = 0; workload < kNumBenchWorkloads; workload++)
+		{
+			if (options.workload >= 0 && (uint32_t)options.workload != workload)
+				continue;
+
+			if (options.compareMidiSubBlocks && !runWorkload(pluginCore, options, workload, preset, kQuantizedMidiSubBlockSize))
+			{
+				fprintf(stderr, "preset %d not found\n", preset);
+				result = 1;
+				continue;
+			}
+
+			if (!runWorkload(pluginCore, options, workload, preset, options.minMidiSubBlockSize))
+			{
+				fprintf(stderr, "preset %d not found\n", preset);
+				result = 1;
+			}
+		}
+	}
+
+	delete pluginCore;
+
+#if SYNTHLAB_RT_AUDIT
+	if (RTAuditor::getViolationCount() > 0)
+	{
+		RTAuditor::writeReport(stderr, 32);
+		result = 1;
+	}
+#endif
+	return result;
+}
@@ -21,7 +21,7 @@ Operations:
 - initialize the plugin description (strings, codes, numbers, see initPluginDescriptors())
 - setup the plugin's audio I/O channel support
 - create the PluginParameter objects that represent the plugin parameters (see FX book if needed)
-- create the presets
+- NOTE: the presets are not created here; the first instance that asks for one builds the shared catalog
 */
 PluginCore::PluginCore()
 {
@@ -49,8 +49,8 @@ PluginCore::PluginCore()
 	// --- create the parameters
     initPluginParameters();
 
-    // --- create the presets
-    initPluginPresets();
+	// --- tag the bound variables with the parameter structures they feed
+	initParameterGroups();
 
 	// --- setup dynamic module types
 	dynModuleManager.addLoadableModule(SynthLab::LFO_MODULE);
@@ -2136,6 +2136,53 @@ bool PluginCore::initPluginParameters()
 	piParam->setIsDiscreteSwitch(true);
 	addPluginParameter(piParam);
 
+	// --- meter control: Gov Load
+	piParam = new PluginParameter(controlID::governorLoad, "Gov Load", 10.00, 500.00, ENVELOPE_DETECT_MODE_PEAK, meterCal::kLinearMeter);
+	piParam->setBoundVariable(&governorLoad, boundVariableType::kFloat);
+	addPluginParameter(piParam);
+
+	// --- meter control: Gov Level
+	piParam = new PluginParameter(controlID::governorLevel, "Gov Level", 10.00, 500.00, ENVELOPE_DETECT_MODE_PEAK, meterCal::kLinearMeter);
+	piParam->setBoundVariable(&governorLevel, boundVariableType::kFloat);
+	addPluginParameter(piParam);
+
+	// --- meter control: Gov Voices
+	piParam = new PluginParameter(controlID::governorVoices, "Gov Voices", 10.00, 500.00, ENVELOPE_DETECT_MODE_PEAK, meterCal::kLinearMeter);
+	piParam->setBoundVariable(&governorVoices, boundVariableType::kFloat);
+	addPluginParameter(piParam);
+
+#if SYNTHLAB_PROFILER
+	// --- meter control: Prof Params
+	piParam = new PluginParameter(controlID::profileParameters, "Prof Params", 10.00, 500.00, ENVELOPE_DETECT_MODE_PEAK, meterCal::kLinearMeter);
+	piParam->setBoundVariable(&profileParameters, boundVariableType::kFloat);
+	addPluginParameter(piParam);
+
+	// --- meter control: Prof MIDI
+	piParam = new PluginParameter(controlID::profileMidi, "Prof MIDI", 10.00, 500.00, ENVELOPE_DETECT_MODE_PEAK, meterCal::kLinearMeter);
+	piParam->setBoundVariable(&profileMidi, boundVariableType::kFloat);
+	addPluginParameter(piParam);
+
+	// --- meter control: Prof Update
+	piParam = new PluginParameter(controlID::profileUpdateParameters, "Prof Update", 10.00, 500.00, ENVELOPE_DETECT_MODE_PEAK, meterCal::kLinearMeter);
+	piParam->setBoundVariable(&profileUpdateParameters, boundVariableType::kFloat);
+	addPluginParameter(piParam);
+
+	// --- meter control: Prof Render
+	piParam = new PluginParameter(controlID::profileRender, "Prof Render", 10.00, 500.00, ENVELOPE_DETECT_MODE_PEAK, meterCal::kLinearMeter);
+	piParam->setBoundVariable(&profileRender, boundVariableType::kFloat);
+	addPluginParameter(piParam);
+
+	// --- meter control: Prof Output
+	piParam = new PluginParameter(controlID::profileOutputCopy, "Prof Output", 10.00, 500.00, ENVELOPE_DETECT_MODE_PEAK, meterCal::kLinearMeter);
+	piParam->setBoundVariable(&profileOutputCopy, boundVariableType::kFloat);
+	addPluginParameter(piParam);
+
+	// --- meter control: Prof Meters
+	piParam = new PluginParameter(controlID::profileOutBound, "Prof Meters", 10.00, 500.00, ENVELOPE_DETECT_MODE_PEAK, meterCal::kLinearMeter);
+	piParam->setBoundVariable(&profileOutBound, boundVariableType::kFloat);
+	addPluginParameter(piParam);
+#endif
+
 	// --- Aux Attributes
 	AuxParameterAttribute auxAttribute;
 
@@ -4312,6 +4359,19 @@ bool PluginCore::reset(ResetInfo& resetInfo)
 
    	// --- reset engine
 	synthEngine->reset(resetInfo.sampleRate);
+	for (uint32_t shard = 1; shard < renderShardCount; shard++)
+		renderShards[shard].engine->reset(resetInfo.sampleRate);
+	shardNoteRouter.reset(renderShardCount);
+	silenceDetector.reset(resetInfo.sampleRate);
+	presetFader.reset(resetInfo.sampleRate);
+#if SYNTHLAB_PROFILER
+	stageProfiler.reset();
+#endif
+	voiceGovernor.reset(resetInfo.sampleRate, synthEngine->getVoiceCount() * renderShardCount);
+	idleBlockCount.store(0, std::memory_order_relaxed);
+
+	// --- the engines start over; push every parameter structure on the next block
+	setAllBoundVariablesChanged();
 
 	// --- other reset inits
     return PluginBase::reset(resetInfo);
@@ -4323,6 +4383,24 @@ PluginCore::~PluginCore()
 	dynModuleManager.getDynamicModules();
 }
 
+/**
+\brief load the dynamic modules into every voice of an engine (DM builds only)
+
+\param engine the main synth engine or a render shard's engine
+\param modulePath path to the SynthLabModules folder
+*/
+void PluginCore::loadDynamicModules(SynthLab::SynthEngine* engine, const std::string& modulePath)
+{
+	uint32_t voiceCount = engine->getVoiceCount();
+	for (uint32_t i = 0; i < voiceCount; i++)
+	{
+		uint32_t count = dynModuleManager.loadAllDynamicModulesInFolder(modulePath);
+		// --- load if existing
+		if (count > 0 && dynModuleManager.haveDynamicModules())
+			engine->setDynamicModules(dynModuleManager.getDynamicModules(), i);
+	}
+}
+
 /**
 \brief one-time initialize function called after object creation and before the first reset( ) call
 
@@ -4333,7 +4411,6 @@ bool PluginCore::initialize(PluginInfo& pluginInfo)
 {
 	SynthLab::DMConfig config;
 	std::string path = pluginInfo.pathToDLL;
-	uint32_t count = 0;
 	std::string basePath;
 
 	// --- if something is horribly wrong, the synth will revert to normal mode
@@ -4352,24 +4429,18 @@ bool PluginCore::initialize(PluginInfo& pluginInfo)
 
 	// --- SYNTH ENGINE CREATION --- //
 	//
-	// --- prepare output buffers/block size 
-	processBlockInfo.blockSize = 64;
+	// --- prepare output buffers/block size; allocated for the largest quantum
+	//     so the render quantum can change without re-creating the engine
+	processBlockInfo.blockSize = MAX_RENDER_QUANTUM;
+	setRenderQuantum(kRenderQuantum);
+	setEnableAdaptiveRenderQuantum(kAdaptiveRenderQuantum);
 
 	// --- creation mechanism
 	synthEngine.reset(new SynthLab::SynthEngine(processBlockInfo.blockSize, &config));
 
 	// --- now try to load the DM modules
 	if (pluginInfo.pathToDLL && config.dm_build)
-	{
-		uint32_t voiceCount = synthEngine->getVoiceCount();
-		for (uint32_t i = 0; i < voiceCount; i++)
-		{
-			count = dynModuleManager.loadAllDynamicModulesInFolder(basePath + "/SynthLabModules");
-			// --- load if existing
-			if (count > 0 && dynModuleManager.haveDynamicModules())
-				synthEngine->setDynamicModules(dynModuleManager.getDynamicModules(), i);
-		}
-	}
+		loadDynamicModules(synthEngine.get(), basePath + "/SynthLabModules");
 
 	// --- dynamic string supporting object (this is OPTIONAL and can be omitted for non DM synths)
 	dynStringManager.reset(new DynamicStringManager(synthEngine, this));
@@ -4381,11 +4452,53 @@ bool PluginCore::initialize(PluginInfo& pluginInfo)
 	// --- setup audio buffers
 	synthBlockProcInfo.init(SynthLab::NO_CHANNELS,			/* num input channels = 0 */
 							SynthLab::STEREO_CHANNELS,		/* num output channels = 2 */
-							processBlockInfo.blockSize);	/* audio block process size = 64 */
+							processBlockInfo.blockSize);	/* audio block capacity = MAX_RENDER_QUANTUM */
 
 	// --- initializer
 	synthEngine->initialize(path.c_str());
 
+	// --- optional parallel render shards: each is a complete engine with its own voices
+	renderShardCount = kRenderShardCount;
+	if (renderShardCount < 1) renderShardCount = 1;
+	if (renderShardCount > MAX_RENDER_JOBS) renderShardCount = MAX_RENDER_JOBS;
+
+	for (uint32_t shard = 1; shard < renderShardCount; shard++)
+	{
+		renderShards[shard].engine.reset(new SynthLab::SynthEngine(processBlockInfo.blockSize, &config));
+		if (pluginInfo.pathToDLL && config.dm_build)
+			loadDynamicModules(renderShards[shard].engine.get(), basePath + "/SynthLabModules");
+		renderShards[shard].engine->getParameters(renderShards[shard].engineParameters);
+		renderShards[shard].voiceParameters = renderShards[shard].engineParameters->voiceParameters;
+		renderShards[shard].synthProcInfo.init(SynthLab::NO_CHANNELS, SynthLab::STEREO_CHANNELS, processBlockInfo.blockSize);
+		renderShards[shard].engine->initialize(path.c_str());
+	}
+	shardNoteRouter.reset(renderShardCount);
+
+	// --- sample accurate MIDI resolution
+	midiSubBlockScheduler.setMinSubBlockSize(kMinMidiSubBlockSize);
+
+	// --- zero-copy output; remember the synth's own buffers so they can be put back
+	enableZeroCopyRender = kZeroCopyRender;
+	float** synthOutputs = synthBlockProcInfo.getOutputBuffers();
+	for (uint32_t channel = 0; channel < SynthLab::STEREO_CHANNELS; channel++)
+		ownedSynthOutputs[channel] = synthOutputs[channel];
+
+	// --- skip rendering while nothing can sound
+	enableIdleRenderSkip = kIdleRenderSkip;
+
+	// --- fade around preset swaps
+	presetFader.setFadeTime_mSec(kPresetFadeTime_mSec);
+
+	// --- step quality down instead of missing block deadlines
+	voiceGovernor.setEnabled(kVoiceGovernor);
+
+	// --- grow the synth MIDI queues now rather than on the audio thread
+	reserveSynthMidiEvents();
+
+	// --- the audio thread is the last worker
+	if (renderShardCount > 1)
+		renderWorkerPool.start(renderShardCount - 1);
+
 	return true;
 }
 
@@ -4412,12 +4525,328 @@ bool PluginCore::preProcessAudioBuffers(ProcessBufferInfo& processInfo)
     return true;
 }
 
+/**
+\brief tag each bound variable with the parameter structures it is copied into
+
+Operation:
+- the update functions only rewrite (and hand to the engine) the structures whose groups changed
+- a bound variable that is not listed here flags every group, so nothing can be missed
+*/
+void PluginCore::initParameterGroups()
+{
+	const uint32_t groupTable[][2] =
+	{
+		{ controlID::globalPitchBendSens, kEngineGroup },
+		{ controlID::globalTuning, kEngineGroup },
+		{ controlID::globalUnisonDetune_Cents, kEngineGroup },
+		{ controlID::globalVolume_dB, kEngineGroup },
+		{ controlID::synthMode, kEngineGroup },
+		{ controlID::enableDelayFX, kEngineGroup },
+		{ controlID::leftDelay_mSec, kEngineGroup },
+		{ controlID::rightDelay_mSec, kEngineGroup },
+		{ controlID::dryLevel_dB, kEngineGroup },
+		{ controlID::wetLevel_dB, kEngineGroup },
+		{ controlID::feedback_Pct, kEngineGroup },
+		{ controlID::wseq1_panValue, kWSOscGroup },
+		{ controlID::wseq1HardSync, kWSOscGroup },
+		{ controlID::wseq1Morph, kWSOscGroup },
+		{ controlID::wseq1DetuneSemis, kWSOscGroup },
+		{ controlID::wseq1DetuneCents, kWSOscGroup },
+		{ controlID::wseq2_panValue, kWSOscGroup },
+		{ controlID::wseq2HardSync, kWSOscGroup },
+		{ controlID::wseq2Morph, kWSOscGroup },
+		{ controlID::wseq2DetuneSemis, kWSOscGroup },
+		{ controlID::wseq2DetuneCents, kWSOscGroup },
+		{ controlID::wseq3_panValue, kWSOscGroup },
+		{ controlID::wseq3HardSync, kWSOscGroup },
+		{ controlID::wseq3Morph, kWSOscGroup },
+		{ controlID::wseq3DetuneSemis, kWSOscGroup },
+		{ controlID::wseq3DetuneCents, kWSOscGroup },
+		{ controlID::wseq4_panValue, kWSOscGroup },
+		{ controlID::wseq4HardSync, kWSOscGroup },
+		{ controlID::wseq4Morph, kWSOscGroup },
+		{ controlID::wseq4DetuneSemis, kWSOscGroup },
+		{ controlID::wseq4DetuneCents, kWSOscGroup },
+		{ controlID::wseq5_panValue, kWSOscGroup },
+		{ controlID::wseq5HardSync, kWSOscGroup },
+		{ controlID::wseq5Morph, kWSOscGroup },
+		{ controlID::wseq5DetuneSemis, kWSOscGroup },
+		{ controlID::wseq5DetuneCents, kWSOscGroup },
+		{ controlID::wseq6_panValue, kWSOscGroup },
+		{ controlID::wseq6HardSync, kWSOscGroup },
+		{ controlID::wseq6Morph, kWSOscGroup },
+		{ controlID::wseq6DetuneSemis, kWSOscGroup },
+		{ controlID::wseq6DetuneCents, kWSOscGroup },
+		{ controlID::wseq7_panValue, kWSOscGroup },
+		{ controlID::wseq7HardSync, kWSOscGroup },
+		{ controlID::wseq7Morph, kWSOscGroup },
+		{ controlID::wseq7DetuneSemis, kWSOscGroup },
+		{ controlID::wseq7DetuneCents, kWSOscGroup },
+		{ controlID::wseq8_panValue, kWSOscGroup },
+		{ controlID::wseq8HardSync, kWSOscGroup },
+		{ controlID::wseq8Morph, kWSOscGroup },
+		{ controlID::wseq8DetuneSemis, kWSOscGroup },
+		{ controlID::wseq8DetuneCents, kWSOscGroup },
+		{ controlID::ws1StepLenIndex, kWaveSequencerGroup },
+		{ controlID::ws1XFadeLenIndex, kWaveSequencerGroup },
+		{ controlID::ws1WaveIndex, kWaveSequencerGroup },
+		{ controlID::ws1WaveAmp_dB, kWaveSequencerGroup },
+		{ controlID::ws1Pitch_semi, kWaveSequencerGroup },
+		{ controlID::ws1PitchProb_pct, kWaveSequencerGroup },
+		{ controlID::ws1ModValue, kWaveSequencerGroup },
+		{ controlID::ws1ModProb_pct, kWaveSequencerGroup },
+		{ controlID::ws2StepLenIndex, kWaveSequencerGroup },
+		{ controlID::ws2XFadeLenIndex, kWaveSequencerGroup },
+		{ controlID::ws2WaveIndex, kWaveSequencerGroup },
+		{ controlID::ws2WaveAmp_dB, kWaveSequencerGroup },
+		{ controlID::ws2Pitch_semi, kWaveSequencerGroup },
+		{ controlID::ws2PitchProb_pct, kWaveSequencerGroup },
+		{ controlID::ws2ModValue, kWaveSequencerGroup },
+		{ controlID::ws2ModProb_pct, kWaveSequencerGroup },
+		{ controlID::ws3StepLenIndex, kWaveSequencerGroup },
+		{ controlID::ws3XFadeLenIndex, kWaveSequencerGroup },
+		{ controlID::ws3WaveIndex, kWaveSequencerGroup },
+		{ controlID::ws3WaveAmp_dB, kWaveSequencerGroup },
+		{ controlID::ws3Pitch_semi, kWaveSequencerGroup },
+		{ controlID::ws3PitchProb_pct, kWaveSequencerGroup },
+		{ controlID::ws3ModValue, kWaveSequencerGroup },
+		{ controlID::ws3ModProb_pct, kWaveSequencerGroup },
+		{ controlID::ws4StepLenIndex, kWaveSequencerGroup },
+		{ controlID::ws4XFadeLenIndex, kWaveSequencerGroup },
+		{ controlID::ws4WaveIndex, kWaveSequencerGroup },
+		{ controlID::ws4WaveAmp_dB, kWaveSequencerGroup },
+		{ controlID::ws4Pitch_semi, kWaveSequencerGroup },
+		{ controlID::ws4PitchProb_pct, kWaveSequencerGroup },
+		{ controlID::ws4ModValue, kWaveSequencerGroup },
+		{ controlID::ws4ModProb_pct, kWaveSequencerGroup },
+		{ controlID::ws5StepLenIndex, kWaveSequencerGroup },
+		{ controlID::ws5XFadeLenIndex, kWaveSequencerGroup },
+		{ controlID::ws5WaveIndex, kWaveSequencerGroup },
+		{ controlID::ws5WaveAmp_dB, kWaveSequencerGroup },
+		{ controlID::ws5Pitch_semi, kWaveSequencerGroup },
+		{ controlID::ws5PitchProb_pct, kWaveSequencerGroup },
+		{ controlID::ws5ModValue, kWaveSequencerGroup },
+		{ controlID::ws5ModProb_pct, kWaveSequencerGroup },
+		{ controlID::ws6StepLenIndex, kWaveSequencerGroup },
+		{ controlID::ws6XFadeLenIndex, kWaveSequencerGroup },
+		{ controlID::ws6WaveIndex, kWaveSequencerGroup },
+		{ controlID::ws6WaveAmp_dB, kWaveSequencerGroup },
+		{ controlID::ws6Pitch_semi, kWaveSequencerGroup },
+		{ controlID::ws6PitchProb_pct, kWaveSequencerGroup },
+		{ controlID::ws6ModValue, kWaveSequencerGroup },
+		{ controlID::ws6ModProb_pct, kWaveSequencerGroup },
+		{ controlID::ws7StepLenIndex, kWaveSequencerGroup },
+		{ controlID::ws7XFadeLenIndex, kWaveSequencerGroup },
+		{ controlID::ws7WaveIndex, kWaveSequencerGroup },
+		{ controlID::ws7WaveAmp_dB, kWaveSequencerGroup },
+		{ controlID::ws7Pitch_semi, kWaveSequencerGroup },
+		{ controlID::ws7PitchProb_pct, kWaveSequencerGroup },
+		{ controlID::ws7ModValue, kWaveSequencerGroup },
+		{ controlID::ws7ModProb_pct, kWaveSequencerGroup },
+		{ controlID::ws8StepLenIndex, kWaveSequencerGroup },
+		{ controlID::ws8XFadeLenIndex, kWaveSequencerGroup },
+		{ controlID::ws8WaveIndex, kWaveSequencerGroup },
+		{ controlID::ws8WaveAmp_dB, kWaveSequencerGroup },
+		{ controlID::ws8Pitch_semi, kWaveSequencerGroup },
+		{ controlID::ws8PitchProb_pct, kWaveSequencerGroup },
+		{ controlID::ws8ModValue, kWaveSequencerGroup },
+		{ controlID::ws8ModProb_pct, kWaveSequencerGroup },
+		{ controlID::soloWaveLane, kWaveSequencerGroup },
+		{ controlID::runStopWS, kWaveSequencerGroup },
+		{ controlID::timingStartIndex, kWaveSequencerGroup },
+		{ controlID::timingEndIndex, kWaveSequencerGroup },
+		{ controlID::timingLoopDir, kWaveSequencerGroup },
+		{ controlID::waveStartIndex, kWaveSequencerGroup },
+		{ controlID::waveEndIndex, kWaveSequencerGroup },
+		{ controlID::waveLoopDir, kWaveSequencerGroup },
+		{ controlID::pitchStartIndex, kWaveSequencerGroup },
+		{ controlID::pitchEndIndex, kWaveSequencerGroup },
+		{ controlID::pitchLoopDir, kWaveSequencerGroup },
+		{ controlID::stepSeqModStartIndex, kWaveSequencerGroup },
+		{ controlID::stepSeqModEndIndex, kWaveSequencerGroup },
+		{ controlID::stepSeqModLoopDir, kWaveSequencerGroup },
+		{ controlID::step1Type, kWaveSequencerGroup },
+		{ controlID::step2Type, kWaveSequencerGroup },
+		{ controlID::step3Type, kWaveSequencerGroup },
+		{ controlID::step4Type, kWaveSequencerGroup },
+		{ controlID::step5Type, kWaveSequencerGroup },
+		{ controlID::step6Type, kWaveSequencerGroup },
+		{ controlID::step7Type, kWaveSequencerGroup },
+		{ controlID::step8Type, kWaveSequencerGroup },
+		{ controlID::timeStretch, kWaveSequencerGroup },
+		{ controlID::interpolateStepSeqMod, kWaveSequencerGroup },
+		{ controlID::randomizeStepOrder, kWaveSequencerGroup },
+		{ controlID::randomizePitchOrder, kWaveSequencerGroup },
+		{ controlID::randomizeWaveOrder, kWaveSequencerGroup },
+		{ controlID::randomizeSSModOrder, kWaveSequencerGroup },
+		{ controlID::glideTime_mSec, kVoiceGroup },
+		{ controlID::filterModeIndex, kVoiceGroup },
+		{ controlID::lfo1Core, kLFO1Group },
+		{ controlID::lfo2Core, kLFO2Group },
+		{ controlID::ampEGCore, kAmpEGGroup },
+		{ controlID::filterEGCore, kFilterEGGroup },
+		{ controlID::auxEGCore, kAuxEGGroup },
+		{ controlID::filter1Core, kFilter1Group },
+		{ controlID::filter2Core, kFilter2Group },
+		{ controlID::lfo1_waveform, kLFO1Group },
+		{ controlID::lfo1_mode, kLFO1Group },
+		{ controlID::lfo1_frequency_Hz, kLFO1Group },
+		{ controlID::lfo1_outputAmplitude, kLFO1Group },
+		{ controlID::lfo1_quantize, kLFO1Group },
+		{ controlID::lfo1_ModKnobA, kLFO1Group },
+		{ controlID::lfo1_ModKnobB, kLFO1Group },
+		{ controlID::lfo1_ModKnobC, kLFO1Group },
+		{ controlID::lfo1_ModKnobD, kLFO1Group },
+		{ controlID::lfo2_waveform, kLFO2Group },
+		{ controlID::lfo2_mode, kLFO2Group },
+		{ controlID::lfo2_frequency_Hz, kLFO2Group },
+		{ controlID::lfo2_outputAmplitude, kLFO2Group },
+		{ controlID::lfo2_quantize, kLFO2Group },
+		{ controlID::lfo2_ModKnobA, kLFO2Group },
+		{ controlID::lfo2_ModKnobB, kLFO2Group },
+		{ controlID::lfo2_ModKnobC, kLFO2Group },
+		{ controlID::lfo2_ModKnobD, kLFO2Group },
+		{ controlID::ampEGMode, kAmpEGGroup },
+		{ controlID::ampEG_attackTime_mSec, kAmpEGGroup },
+		{ controlID::ampEG_decayTime_mSec, kAmpEGGroup },
+		{ controlID::ampEG_sustainLevel, kAmpEGGroup },
+		{ controlID::ampEG_releaseTime_mSec, kAmpEGGroup },
+		{ controlID::ampEG_ModKnobA, kAmpEGGroup },
+		{ controlID::ampEG_ModKnobB, kAmpEGGroup },
+		{ controlID::ampEG_ModKnobC, kAmpEGGroup },
+		{ controlID::ampEG_ModKnobD, kAmpEGGroup },
+		{ controlID::filterEGMode, kFilterEGGroup },
+		{ controlID::filterEG_attackTime_mSec, kFilterEGGroup },
+		{ controlID::filterEG_decayTime_mSec, kFilterEGGroup },
+		{ controlID::filterEG_sustainLevel, kFilterEGGroup },
+		{ controlID::filterEG_releaseTime_mSec, kFilterEGGroup },
+		{ controlID::filterEG_ModKnobA, kFilterEGGroup },
+		{ controlID::filterEG_ModKnobB, kFilterEGGroup },
+		{ controlID::filterEG_ModKnobC, kFilterEGGroup },
+		{ controlID::filterEG_ModKnobD, kFilterEGGroup },
+		{ controlID::auxEGMode, kAuxEGGroup },
+		{ controlID::auxEG_attackTime_mSec, kAuxEGGroup },
+		{ controlID::auxEG_decayTime_mSec, kAuxEGGroup },
+		{ controlID::auxEG_sustainLevel, kAuxEGGroup },
+		{ controlID::auxEG_releaseTime_mSec, kAuxEGGroup },
+		{ controlID::auxEG_ModKnobA, kAuxEGGroup },
+		{ controlID::auxEG_ModKnobB, kAuxEGGroup },
+		{ controlID::auxEG_ModKnobC, kAuxEGGroup },
+		{ controlID::auxEG_ModKnobD, kAuxEGGroup },
+		{ controlID::filter1Algorithm, kFilter1Group },
+		{ controlID::filter1_fc, kFilter1Group },
+		{ controlID::filter1_Q, kFilter1Group },
+		{ controlID::enableFilter1KeyTrack, kFilter1Group },
+		{ controlID::filter1Output_dB, kFilter1Group },
+		{ controlID::filter1_ModKnobA, kFilter1Group },
+		{ controlID::filter1_ModKnobB, kFilter1Group },
+		{ controlID::filter1_ModKnobC, kFilter1Group },
+		{ controlID::filter1_ModKnobD, kFilter1Group },
+		{ controlID::filter2Algorithm, kFilter2Group },
+		{ controlID::filter2_fc, kFilter2Group },
+		{ controlID::filter2_Q, kFilter2Group },
+		{ controlID::enableFilter2KeyTrack, kFilter2Group },
+		{ controlID::filter2Output_dB, kFilter2Group },
+		{ controlID::filter2_ModKnobA, kFilter2Group },
+		{ controlID::filter2_ModKnobB, kFilter2Group },
+		{ controlID::filter2_ModKnobC, kFilter2Group },
+		{ controlID::filter2_ModKnobD, kFilter2Group },
+		{ controlID::ampEGIntensity, kDCAGroup },
+		{ controlID::lfo1SourceInt, kModMatrixGroup },
+		{ controlID::lfo2SourceInt, kModMatrixGroup },
+		{ controlID::filterEGSourceInt, kModMatrixGroup },
+		{ controlID::auxEGSourceInt, kModMatrixGroup },
+		{ controlID::auxEGBiasedSourceInt, kModMatrixGroup },
+		{ controlID::waveSeqModSourceInt, kModMatrixGroup },
+		{ controlID::lfo2_fo_Int, kModMatrixGroup },
+		{ controlID::osc_fo_Int, kModMatrixGroup },
+		{ controlID::osc_UniqueInt, kModMatrixGroup },
+		{ controlID::filterEGTrigInt, kModMatrixGroup },
+		{ controlID::auxEGTrigInt, kModMatrixGroup },
+		{ controlID::filter1_fc_Int, kModMatrixGroup },
+		{ controlID::filter2_fc_Int, kModMatrixGroup },
+		{ controlID::ampEGTrigInt, kModMatrixGroup },
+		{ controlID::dcaPanInt, kModMatrixGroup },
+		{ controlID::lfo1_lfo2_fc, kModMatrixGroup },
+		{ controlID::lfo1_osc_fc, kModMatrixGroup },
+		{ controlID::lfo1_oscUnique, kModMatrixGroup },
+		{ controlID::lfo1_ampEGTrig, kModMatrixGroup },
+		{ controlID::lfo1_dcaPan, kModMatrixGroup },
+		{ controlID::lfo1_filterEGTrig, kModMatrixGroup },
+		{ controlID::lfo1_auxEGTrig, kModMatrixGroup },
+		{ controlID::lfo1_filter1_fc, kModMatrixGroup },
+		{ controlID::lfo1_filter2_fc, kModMatrixGroup },
+		{ controlID::lfo2_lfo2_fc, kModMatrixGroup },
+		{ controlID::lfo2_osc_fc, kModMatrixGroup },
+		{ controlID::lfo2_oscUnique, kModMatrixGroup },
+		{ controlID::lfo2_ampEGTrig, kModMatrixGroup },
+		{ controlID::lfo2_dcaPan, kModMatrixGroup },
+		{ controlID::lfo2_filterEGTrig, kModMatrixGroup },
+		{ controlID::lfo2_auxEGTrig, kModMatrixGroup },
+		{ controlID::lfo2_filter1_fc, kModMatrixGroup },
+		{ controlID::lfo2_filter2_fc, kModMatrixGroup },
+		{ controlID::filterEG_lfo2_fc, kModMatrixGroup },
+		{ controlID::filterEG_osc_fc, kModMatrixGroup },
+		{ controlID::filterEG_oscUnique, kModMatrixGroup },
+		{ controlID::filterEG_dcaPan, kModMatrixGroup },
+		{ controlID::filterEG_ampEGTrig, kModMatrixGroup },
+		{ controlID::filterEG_filterEGTrig, kModMatrixGroup },
+		{ controlID::filterEG_auxEGTrig, kModMatrixGroup },
+		{ controlID::filterEG_filter1_fc, kModMatrixGroup },
+		{ controlID::filterEG_filter2_fc, kModMatrixGroup },
+		{ controlID::auxEG_lfo2_fc, kModMatrixGroup },
+		{ controlID::auxEG_osc_fc, kModMatrixGroup },
+		{ controlID::auxEG_oscUnique, kModMatrixGroup },
+		{ controlID::auxEG_dcaPan, kModMatrixGroup },
+		{ controlID::auxEG_ampEGTrig, kModMatrixGroup },
+		{ controlID::auxEG_filterEGTrig, kModMatrixGroup },
+		{ controlID::auxEG_auxEGTrig, kModMatrixGroup },
+		{ controlID::auxEG_filter1_fc, kModMatrixGroup },
+		{ controlID::auxEG_filter2_fc, kModMatrixGroup },
+		{ controlID::auxEGB_lfo2_fc, kModMatrixGroup },
+		{ controlID::auxEGB_osc_fc, kModMatrixGroup },
+		{ controlID::auxEGB_oscUnique, kModMatrixGroup },
+		{ controlID::auxEGB_ampEGTrig, kModMatrixGroup },
+		{ controlID::auxEGB_dcaPan, kModMatrixGroup },
+		{ controlID::auxEGB_filterEGTrig, kModMatrixGroup },
+		{ controlID::auxEGB_auxEGTrig, kModMatrixGroup },
+		{ controlID::auxEGB_filter1_fc, kModMatrixGroup },
+		{ controlID::auxEGB_filter2_fc, kModMatrixGroup },
+		{ controlID::waveSeqMod_lfo2_fc, kModMatrixGroup },
+		{ controlID::waveSeqMod_osc_fo, kModMatrixGroup },
+		{ controlID::waveSeqMod_oscUnique, kModMatrixGroup },
+		{ controlID::waveSeqMod_ampEGTrig, kModMatrixGroup },
+		{ controlID::waveSeqMod_dcaPan, kModMatrixGroup },
+		{ controlID::waveSeqMod_filterEGTrig, kModMatrixGroup },
+		{ controlID::waveSeqMod_auxEGTrig, kModMatrixGroup },
+		{ controlID::waveSeqMod_filter1_fc, kModMatrixGroup },
+		{ controlID::waveSeqMod_filter2_fc, kModMatrixGroup }
+	};
+
+	for (uint32_t i = 0; i < sizeof(groupTable) / sizeof(groupTable[0]); i++)
+		addBoundVariableGroup(groupTable[i][0], groupTable[i][1]);
+}
+
 void PluginCore::updateParameters()
 {
 	// --- check for new custom waveform strings & mod-knobs
 	dynStringManager->setCustomUpdateCodes(voiceParameters->updateCodeDroplists,
 										   voiceParameters->updateCodeKnobs);
 
+	// --- nothing changed since the last block; the engine structures are up to date
+	parameterFieldsPushed.store(0, std::memory_order_relaxed);
+	if (!anyBoundVariableGroupChanged())
+		return;
+
+	// --- telemetry: bound variables copied into the engine structures for this block
+	uint32_t fieldsPushed = 0;
+	for (uint32_t group = 0; group < kNumParameterGroups; group++)
+	{
+		if (boundVariableGroupChanged(group))
+			fieldsPushed += getBoundVariableGroupSize(group);
+	}
+	parameterFieldsPushed.store(fieldsPushed, std::memory_order_relaxed);
+
 	// --- engine
 	updateEngineParameters();
 
@@ -4431,8 +4860,39 @@ void PluginCore::updateParameters()
 	synthEngine->setParameters(engineParameters);
 }
 
+/**
+\brief mirror the current GUI parameters into each render shard
+
+Operation:
+- the update functions write to engineParameters/voiceParameters, so swap in each shard's
+  own structures and run them again; swap() keeps this free of allocation and refcounting
+*/
+void PluginCore::updateShardParameters()
+{
+	if (!anyBoundVariableGroupChanged())
+		return;
+
+	for (uint32_t shard = 1; shard < renderShardCount; shard++)
+	{
+		engineParameters.swap(renderShards[shard].engineParameters);
+		voiceParameters.swap(renderShards[shard].voiceParameters);
+
+		updateEngineParameters();
+		updateVoiceParameters();
+		updateModMatrixParameters();
+		renderShards[shard].engine->setParameters(engineParameters);
+
+		engineParameters.swap(renderShards[shard].engineParameters);
+		voiceParameters.swap(renderShards[shard].voiceParameters);
+	}
+}
+
 void PluginCore::updateEngineParameters()
 {
+	// --- engine level parameters only change with their controls
+	if (!boundVariableGroupChanged(kEngineGroup))
+		return;
+
 	// --- engine level
 	engineParameters->globalPitchBendSensCoarse = (unsigned int)globalPitchBendSens; // --- this is pitch bend max range in semitones
 	engineParameters->globalPitchBendSensFine = (unsigned int)(100.0*(globalPitchBendSens - engineParameters->globalPitchBendSensCoarse)); // this is pitch bend max range in semitones
@@ -4443,35 +4903,37 @@ void PluginCore::updateEngineParameters()
 	engineParameters->globalUnisonDetune_Cents = globalUnisonDetune_Cents;
 	engineParameters->globalVolume_dB = globalVolume_dB;
 
-	// --- mono/poly, etc...
+	// --- mono/poly, etc...; under load the governor plays the unison modes without unison
 	engineParameters->synthModeIndex = synthMode;
-
-	// --- delay FX
-	engineParameters->enableDelayFX = enableDelayFX == 1;
+	if (!voiceGovernor.allowUnison() && compareEnumToInt(synthModeEnum::Unison, synthMode))
+		engineParameters->synthModeIndex = (int)synthModeEnum::Mono;
+	else if (!voiceGovernor.allowUnison() && compareEnumToInt(synthModeEnum::UniLegato, synthMode))
+		engineParameters->synthModeIndex = (int)synthModeEnum::Legato;
+
+	// --- delay FX; the governor may bypass it under load
+	bool delayFXOn = enableDelayFX == 1 && voiceGovernor.allowDelayFX();
+	engineParameters->enableDelayFX = delayFXOn;
 	engineParameters->audioDelayParameters->leftDelay_mSec = leftDelay_mSec;
 	engineParameters->audioDelayParameters->rightDelay_mSec = rightDelay_mSec;
 	engineParameters->audioDelayParameters->dryLevel_dB = dryLevel_dB;
 	engineParameters->audioDelayParameters->wetLevel_dB = wetLevel_dB;
 	engineParameters->audioDelayParameters->feedback_Pct = feedback_Pct;
+
+	// --- the delay line must be flushed before the synth can go idle
+	silenceDetector.setTailTime_mSec(delayFXOn ? fmax(leftDelay_mSec, rightDelay_mSec) : 0.0);
 }
 
 void PluginCore::updateVoiceParameters()
 {
-	voiceParameters->glideTime_mSec = glideTime_mSec;
-	voiceParameters->filterModeIndex = filterModeIndex;
-
-	// --- DM STUFF 
-	voiceParameters->lfo1Parameters->moduleIndex = lfo1Core;
-	voiceParameters->lfo2Parameters->moduleIndex = lfo2Core;
-
-	voiceParameters->ampEGParameters->moduleIndex = ampEGCore;
-	voiceParameters->filterEGParameters->moduleIndex = filterEGCore;
-	voiceParameters->auxEGParameters->moduleIndex = auxEGCore;
+	// --- voice level
+	if (boundVariableGroupChanged(kVoiceGroup))
+	{
+		voiceParameters->glideTime_mSec = glideTime_mSec;
+		voiceParameters->filterModeIndex = filterModeIndex;
+	}
 
-	voiceParameters->filter1Parameters->moduleIndex = filter1Core;
-	voiceParameters->filter2Parameters->moduleIndex = filter2Core;
-	
-	if (true)
+	// --- wave sequencer oscillators
+	if (boundVariableGroupChanged(kWSOscGroup))
 	{
 		uint32_t index = 0;
 
@@ -4587,88 +5049,122 @@ void PluginCore::updateVoiceParameters()
 		voiceParameters->wsOsc2Parameters->detuneCents[index] = wseq8DetuneCents;
 	}
 
-
 	// --- LFO1
-	voiceParameters->lfo1Parameters->waveformIndex = lfo1_waveform;
-	voiceParameters->lfo1Parameters->modeIndex = lfo1_mode;
-	voiceParameters->lfo1Parameters->frequency_Hz = lfo1_frequency_Hz;
-	voiceParameters->lfo1Parameters->outputAmplitude = lfo1_outputAmplitude;
-	voiceParameters->lfo1Parameters->quantize = lfo1_quantize;
-	voiceParameters->lfo1Parameters->modKnobValue[0] = lfo1_ModKnobA;
-	voiceParameters->lfo1Parameters->modKnobValue[1] = lfo1_ModKnobB;
-	voiceParameters->lfo1Parameters->modKnobValue[2] = lfo1_ModKnobC;
-	voiceParameters->lfo1Parameters->modKnobValue[3] = lfo1_ModKnobD;
+	if (boundVariableGroupChanged(kLFO1Group))
+	{
+		voiceParameters->lfo1Parameters->moduleIndex = lfo1Core;
+
+		voiceParameters->lfo1Parameters->waveformIndex = lfo1_waveform;
+		voiceParameters->lfo1Parameters->modeIndex = lfo1_mode;
+		voiceParameters->lfo1Parameters->frequency_Hz = lfo1_frequency_Hz;
+		voiceParameters->lfo1Parameters->outputAmplitude = lfo1_outputAmplitude;
+		voiceParameters->lfo1Parameters->quantize = lfo1_quantize;
+		voiceParameters->lfo1Parameters->modKnobValue[0] = lfo1_ModKnobA;
+		voiceParameters->lfo1Parameters->modKnobValue[1] = lfo1_ModKnobB;
+		voiceParameters->lfo1Parameters->modKnobValue[2] = lfo1_ModKnobC;
+		voiceParameters->lfo1Parameters->modKnobValue[3] = lfo1_ModKnobD;
+	}
 
 	// --- LFO2
-	voiceParameters->lfo2Parameters->waveformIndex = lfo2_waveform;
-	voiceParameters->lfo2Parameters->modeIndex = lfo2_mode;
-	voiceParameters->lfo2Parameters->frequency_Hz = lfo2_frequency_Hz;
-	voiceParameters->lfo2Parameters->outputAmplitude = lfo2_outputAmplitude;
-	voiceParameters->lfo2Parameters->quantize = lfo2_quantize;
-	voiceParameters->lfo2Parameters->modKnobValue[0] = lfo2_ModKnobA;
-	voiceParameters->lfo2Parameters->modKnobValue[1] = lfo2_ModKnobB;
-	voiceParameters->lfo2Parameters->modKnobValue[2] = lfo2_ModKnobC;
-	voiceParameters->lfo2Parameters->modKnobValue[3] = lfo2_ModKnobD;
+	if (boundVariableGroupChanged(kLFO2Group))
+	{
+		voiceParameters->lfo2Parameters->moduleIndex = lfo2Core;
+
+		voiceParameters->lfo2Parameters->waveformIndex = lfo2_waveform;
+		voiceParameters->lfo2Parameters->modeIndex = lfo2_mode;
+		voiceParameters->lfo2Parameters->frequency_Hz = lfo2_frequency_Hz;
+		voiceParameters->lfo2Parameters->outputAmplitude = lfo2_outputAmplitude;
+		voiceParameters->lfo2Parameters->quantize = lfo2_quantize;
+		voiceParameters->lfo2Parameters->modKnobValue[0] = lfo2_ModKnobA;
+		voiceParameters->lfo2Parameters->modKnobValue[1] = lfo2_ModKnobB;
+		voiceParameters->lfo2Parameters->modKnobValue[2] = lfo2_ModKnobC;
+		voiceParameters->lfo2Parameters->modKnobValue[3] = lfo2_ModKnobD;
+	}
 
 	// --- AMP EG
-	voiceParameters->ampEGParameters->egContourIndex = ampEGMode;
-	voiceParameters->ampEGParameters->attackTime_mSec = ampEG_attackTime_mSec;
-	voiceParameters->ampEGParameters->decayTime_mSec = ampEG_decayTime_mSec;
-	voiceParameters->ampEGParameters->sustainLevel = ampEG_sustainLevel;
-	voiceParameters->ampEGParameters->releaseTime_mSec = ampEG_releaseTime_mSec;
-	voiceParameters->ampEGParameters->modKnobValue[0] = ampEG_ModKnobA;
-	voiceParameters->ampEGParameters->modKnobValue[1] = ampEG_ModKnobB;
-	voiceParameters->ampEGParameters->modKnobValue[2] = ampEG_ModKnobC;
-	voiceParameters->ampEGParameters->modKnobValue[3] = ampEG_ModKnobD;
+	if (boundVariableGroupChanged(kAmpEGGroup))
+	{
+		voiceParameters->ampEGParameters->moduleIndex = ampEGCore;
+
+		voiceParameters->ampEGParameters->egContourIndex = ampEGMode;
+		voiceParameters->ampEGParameters->attackTime_mSec = ampEG_attackTime_mSec;
+		voiceParameters->ampEGParameters->decayTime_mSec = ampEG_decayTime_mSec;
+		voiceParameters->ampEGParameters->sustainLevel = ampEG_sustainLevel;
+		voiceParameters->ampEGParameters->releaseTime_mSec = voiceGovernor.limitReleaseTime_mSec(ampEG_releaseTime_mSec);
+		voiceParameters->ampEGParameters->modKnobValue[0] = ampEG_ModKnobA;
+		voiceParameters->ampEGParameters->modKnobValue[1] = ampEG_ModKnobB;
+		voiceParameters->ampEGParameters->modKnobValue[2] = ampEG_ModKnobC;
+		voiceParameters->ampEGParameters->modKnobValue[3] = ampEG_ModKnobD;
+	}
 
 	// --- FILTER EG
-	voiceParameters->filterEGParameters->egContourIndex = filterEGMode;
-	voiceParameters->filterEGParameters->attackTime_mSec = filterEG_attackTime_mSec;
-	voiceParameters->filterEGParameters->decayTime_mSec = filterEG_decayTime_mSec;
-	voiceParameters->filterEGParameters->sustainLevel = filterEG_sustainLevel;
-	voiceParameters->filterEGParameters->releaseTime_mSec = filterEG_releaseTime_mSec;
-	voiceParameters->filterEGParameters->modKnobValue[0] = filterEG_ModKnobA;
-	voiceParameters->filterEGParameters->modKnobValue[1] = filterEG_ModKnobB;
-	voiceParameters->filterEGParameters->modKnobValue[2] = filterEG_ModKnobC;
-	voiceParameters->filterEGParameters->modKnobValue[3] = filterEG_ModKnobD;
+	if (boundVariableGroupChanged(kFilterEGGroup))
+	{
+		voiceParameters->filterEGParameters->moduleIndex = filterEGCore;
+
+		voiceParameters->filterEGParameters->egContourIndex = filterEGMode;
+		voiceParameters->filterEGParameters->attackTime_mSec = filterEG_attackTime_mSec;
+		voiceParameters->filterEGParameters->decayTime_mSec = filterEG_decayTime_mSec;
+		voiceParameters->filterEGParameters->sustainLevel = filterEG_sustainLevel;
+		voiceParameters->filterEGParameters->releaseTime_mSec = filterEG_releaseTime_mSec;
+		voiceParameters->filterEGParameters->modKnobValue[0] = filterEG_ModKnobA;
+		voiceParameters->filterEGParameters->modKnobValue[1] = filterEG_ModKnobB;
+		voiceParameters->filterEGParameters->modKnobValue[2] = filterEG_ModKnobC;
+		voiceParameters->filterEGParameters->modKnobValue[3] = filterEG_ModKnobD;
+	}
 
 	// --- AUX EG
-	voiceParameters->auxEGParameters->egContourIndex = auxEGMode;
-	voiceParameters->auxEGParameters->attackTime_mSec = auxEG_attackTime_mSec;
-	voiceParameters->auxEGParameters->decayTime_mSec = auxEG_decayTime_mSec;
-	voiceParameters->auxEGParameters->sustainLevel = auxEG_sustainLevel;
-	voiceParameters->auxEGParameters->releaseTime_mSec = auxEG_releaseTime_mSec;
-	voiceParameters->auxEGParameters->modKnobValue[0] = auxEG_ModKnobA;
-	voiceParameters->auxEGParameters->modKnobValue[1] = auxEG_ModKnobB;
-	voiceParameters->auxEGParameters->modKnobValue[2] = auxEG_ModKnobC;
-	voiceParameters->auxEGParameters->modKnobValue[3] = auxEG_ModKnobD;
+	if (boundVariableGroupChanged(kAuxEGGroup))
+	{
+		voiceParameters->auxEGParameters->moduleIndex = auxEGCore;
+
+		voiceParameters->auxEGParameters->egContourIndex = auxEGMode;
+		voiceParameters->auxEGParameters->attackTime_mSec = auxEG_attackTime_mSec;
+		voiceParameters->auxEGParameters->decayTime_mSec = auxEG_decayTime_mSec;
+		voiceParameters->auxEGParameters->sustainLevel = auxEG_sustainLevel;
+		voiceParameters->auxEGParameters->releaseTime_mSec = auxEG_releaseTime_mSec;
+		voiceParameters->auxEGParameters->modKnobValue[0] = auxEG_ModKnobA;
+		voiceParameters->auxEGParameters->modKnobValue[1] = auxEG_ModKnobB;
+		voiceParameters->auxEGParameters->modKnobValue[2] = auxEG_ModKnobC;
+		voiceParameters->auxEGParameters->modKnobValue[3] = auxEG_ModKnobD;
+	}
 
 	// --- FILTER 1
-	voiceParameters->filter1Parameters->filterIndex = filter1Algorithm;
-	voiceParameters->filter1Parameters->fc = filter1_fc;
-	voiceParameters->filter1Parameters->Q = filter1_Q;
-	voiceParameters->filter1Parameters->enableKeyTrack = enableFilter1KeyTrack == 1;
-	voiceParameters->filter1Parameters->filterOutputGain_dB = filter1Output_dB;
-
-	voiceParameters->filter1Parameters->modKnobValue[0] = filter1_ModKnobA;
-	voiceParameters->filter1Parameters->modKnobValue[1] = filter1_ModKnobB;
-	voiceParameters->filter1Parameters->modKnobValue[2] = filter1_ModKnobC;
-	voiceParameters->filter1Parameters->modKnobValue[3] = filter1_ModKnobD;
+	if (boundVariableGroupChanged(kFilter1Group))
+	{
+		voiceParameters->filter1Parameters->moduleIndex = filter1Core;
+
+		voiceParameters->filter1Parameters->filterIndex = filter1Algorithm;
+		voiceParameters->filter1Parameters->fc = filter1_fc;
+		voiceParameters->filter1Parameters->Q = filter1_Q;
+		voiceParameters->filter1Parameters->enableKeyTrack = enableFilter1KeyTrack == 1;
+		voiceParameters->filter1Parameters->filterOutputGain_dB = filter1Output_dB;
+
+		voiceParameters->filter1Parameters->modKnobValue[0] = filter1_ModKnobA;
+		voiceParameters->filter1Parameters->modKnobValue[1] = filter1_ModKnobB;
+		voiceParameters->filter1Parameters->modKnobValue[2] = filter1_ModKnobC;
+		voiceParameters->filter1Parameters->modKnobValue[3] = filter1_ModKnobD;
+	}
 
 	// --- FILTER 2
-	voiceParameters->filter2Parameters->filterIndex = filter2Algorithm;
-	voiceParameters->filter2Parameters->fc = filter2_fc;
-	voiceParameters->filter2Parameters->Q = filter2_Q;
-	voiceParameters->filter2Parameters->enableKeyTrack = enableFilter2KeyTrack == 1;
-	voiceParameters->filter2Parameters->filterOutputGain_dB = filter2Output_dB;
-
-	voiceParameters->filter2Parameters->modKnobValue[0] = filter2_ModKnobA;
-	voiceParameters->filter2Parameters->modKnobValue[1] = filter2_ModKnobB;
-	voiceParameters->filter2Parameters->modKnobValue[2] = filter2_ModKnobC;
-	voiceParameters->filter2Parameters->modKnobValue[3] = filter2_ModKnobD;
+	if (boundVariableGroupChanged(kFilter2Group))
+	{
+		voiceParameters->filter2Parameters->moduleIndex = filter2Core;
+
+		voiceParameters->filter2Parameters->filterIndex = filter2Algorithm;
+		voiceParameters->filter2Parameters->fc = filter2_fc;
+		voiceParameters->filter2Parameters->Q = filter2_Q;
+		voiceParameters->filter2Parameters->enableKeyTrack = enableFilter2KeyTrack == 1;
+		voiceParameters->filter2Parameters->filterOutputGain_dB = filter2Output_dB;
+
+		voiceParameters->filter2Parameters->modKnobValue[0] = filter2_ModKnobA;
+		voiceParameters->filter2Parameters->modKnobValue[1] = filter2_ModKnobB;
+		voiceParameters->filter2Parameters->modKnobValue[2] = filter2_ModKnobC;
+		voiceParameters->filter2Parameters->modKnobValue[3] = filter2_ModKnobD;
+	}
 
 	// --- wave sequencer
-	if (true)
+	if (boundVariableGroupChanged(kWaveSequencerGroup))
 	{
 		voiceParameters->waveSequencerParameters->stepDurationNoteIndex[0] = ws1StepLenIndex;
 		voiceParameters->waveSequencerParameters->xfadeDurationNoteIndex[0] = ws1XFadeLenIndex;
@@ -4787,12 +5283,20 @@ void PluginCore::updateVoiceParameters()
 		voiceParameters->waveSequencerParameters->randomizeWaveOrder = randomizeWaveOrder;
 		voiceParameters->waveSequencerParameters->randomizeSSModOrder = randomizeSSModOrder;
 	}
+
 	// --- DCA
-	voiceParameters->dcaParameters->ampEGIntensity = ampEGIntensity;
+	if (boundVariableGroupChanged(kDCAGroup))
+	{
+		voiceParameters->dcaParameters->ampEGIntensity = ampEGIntensity;
+	}
 }
 
 void PluginCore::updateModMatrixParameters()
 {
+	// --- the mod matrix only changes with its controls
+	if (!boundVariableGroupChanged(kModMatrixGroup))
+		return;
+
 	// --- MOD MATRIX
 	//
 	// --- Source Intensities
@@ -5192,7 +5696,6 @@ void PluginCore::updateModMatrixParameters()
 	voiceParameters->modMatrixParameters->setMM_ChannelEnable(SynthLab::kSourceWStepSeqMod,
 		SynthLab::kDestFilter2_fc_Bipolar, (waveSeqMod_filter2_fc == 1));
 	// ----------------------------------------------------------------------------------------
-
 }
 
 void PluginCore::updateSequencerLEDs()
@@ -5238,6 +5741,52 @@ void PluginCore::updateSequencerLEDs()
 	ssMod8Meter = engineParameters->wsStatusMeters.stepSeqLaneMeter[meter];
 
 }
+/**
+\brief set the render quantum (block size) of the synth
+
+Operation:
+- valid sizes are powers of 2 from MIN_RENDER_QUANTUM to MAX_RENDER_QUANTUM (32, 64, 128, 256)
+- the engines are allocated for MAX_RENDER_QUANTUM so this may be called at any time
+- takes effect at the next host buffer
+
+\param quantum the new render quantum in samples
+
+\return true if the size is valid, false otherwise (the quantum is unchanged)
+*/
+bool PluginCore::setRenderQuantum(uint32_t quantum)
+{
+	if (quantum < MIN_RENDER_QUANTUM || quantum > MAX_RENDER_QUANTUM || (quantum & (quantum - 1)) != 0)
+		return false;
+
+	renderQuantum.store(quantum, std::memory_order_relaxed);
+	return true;
+}
+
+/**
+\brief find the render quantum for a host buffer
+
+Operation:
+- with the adaptive quantum enabled, a buffer size that is a multiple of the quantum is rendered
+  with the largest power-of-2 multiple (up to MAX_RENDER_QUANTUM) that divides it evenly, so
+  a 512 sample buffer renders two 256 sample blocks instead of eight 64 sample blocks
+- otherwise the base quantum is used and the remainder becomes a partial block
+
+\param numFrames host buffer size
+
+\return the render quantum for this buffer
+*/
+uint32_t PluginCore::getRenderQuantumForBuffer(uint32_t numFrames)
+{
+	uint32_t quantum = renderQuantum.load(std::memory_order_relaxed);
+	if (!enableAdaptiveRenderQuantum.load(std::memory_order_relaxed) || numFrames % quantum != 0)
+		return quantum;
+
+	while (quantum * 2 <= MAX_RENDER_QUANTUM && numFrames % (quantum * 2) == 0)
+		quantum *= 2;
+
+	return quantum;
+}
+
 // --------------------------------------------
 /**
 \brief buffer-processing method
@@ -5257,11 +5806,23 @@ bool PluginCore::processAudioBuffers(ProcessBufferInfo& processBufferInfo)
 {
 	double sampleInterval = 1.0 / audioProcDescriptor.sampleRate;
 
+#if SYNTHLAB_PROFILER
+	stageProfiler.beginBuffer();
+#endif
+
 	// --- sync internal bound variables
-	preProcessAudioBuffers(processBufferInfo);
+	{
+		PROFILE_STAGE(stageProfiler, kProfileParameters);
+		preProcessAudioBuffers(processBufferInfo);
+	}
+
+	// --- the quantum is set per buffer, so a partial block can never leak into the next buffer
+	uint32_t quantum = getRenderQuantumForBuffer(processBufferInfo.numFramesToProcess);
+	effectiveRenderQuantum.store(quantum, std::memory_order_relaxed);
+	processBlockInfo.blockSize = quantum;
 
 	// --- calculate blocks & partial blocks
-	div_t blockDiv = div((int)processBufferInfo.numFramesToProcess, processBlockInfo.blockSize);
+	div_t blockDiv = div((int)processBufferInfo.numFramesToProcess, (int)quantum);
 	int blocksPerBuffer = blockDiv.quot;
 	int partialBlockSize = blockDiv.rem;
 
@@ -5269,6 +5830,7 @@ bool PluginCore::processAudioBuffers(ProcessBufferInfo& processBufferInfo)
 	processBlockInfo.outputs = processBufferInfo.outputs;
 	processBlockInfo.auxInputs = processBufferInfo.auxInputs;
 	processBlockInfo.auxOutputs = processBufferInfo.auxOutputs;
+	processBlockInfo.outputs64 = processBufferInfo.doublePrecision ? processBufferInfo.outputs64 : nullptr;
 
 	processBlockInfo.numAudioInChannels = processBufferInfo.numAudioInChannels;
 	processBlockInfo.numAudioOutChannels = processBufferInfo.numAudioOutChannels;
@@ -5278,6 +5840,9 @@ bool PluginCore::processAudioBuffers(ProcessBufferInfo& processBufferInfo)
 	processBlockInfo.hostInfo = processBufferInfo.hostInfo;
 	processBlockInfo.midiEventQueue = processBufferInfo.midiEventQueue;
 
+	// --- the buffer is silent only if every block was skipped
+	bool bufferSilent = enableIdleRenderSkip && processBufferInfo.numFramesToProcess > 0;
+
 	// --- build blocks one block for each channel
 	for (uint32_t block = 0; block < blocksPerBuffer; block++)
 	{
@@ -5286,6 +5851,7 @@ bool PluginCore::processAudioBuffers(ProcessBufferInfo& processBufferInfo)
 
 		// --- do the block
 		processAudioBlock(processBlockInfo);
+		bufferSilent = bufferSilent && blockRenderSkipped;
 
 		// --- update per-frame
 		processBlockInfo.hostInfo->uAbsoluteFrameBufferIndex += processBlockInfo.blockSize;
@@ -5301,20 +5867,48 @@ bool PluginCore::processAudioBuffers(ProcessBufferInfo& processBufferInfo)
 
 		// --- do the block
 		processAudioBlock(processBlockInfo);
+		bufferSilent = bufferSilent && blockRenderSkipped;
+
+		processBlockInfo.hostInfo->uAbsoluteFrameBufferIndex += processBlockInfo.blockSize;
+		processBlockInfo.hostInfo->dAbsoluteFrameBufferTime += (processBlockInfo.blockSize * sampleInterval);
+		processBlockInfo.blockSize = quantum;
 	}
 
+	processBufferInfo.outputSilent = bufferSilent;
+
 	// --- generally not used
 	postProcessAudioBuffers(processBufferInfo);
 
+#if SYNTHLAB_PROFILER
+	stageProfiler.endBuffer();
+	updateProfilerMeters();
+#endif
+
 	return false; /// processed
 }
 
+#if SYNTHLAB_PROFILER
+/**
+\brief copy the stage shares of the last buffer to the profiler meters; they go out with the next
+       buffer's updateOutBoundVariables( )
+*/
+void PluginCore::updateProfilerMeters()
+{
+	profileParameters = stageProfiler.getStageShare(kProfileParameters);
+	profileMidi = stageProfiler.getStageShare(kProfileMidi);
+	profileUpdateParameters = stageProfiler.getStageShare(kProfileUpdateParameters);
+	profileRender = stageProfiler.getStageShare(kProfileRender);
+	profileOutputCopy = stageProfiler.getStageShare(kProfileOutputCopy);
+	profileOutBound = stageProfiler.getStageShare(kProfileOutBound);
+}
+#endif
+
 /**
 \brief block-processing method
 
 Operation:
 - fire all MIDI events for the block
-- do parameter smoothing 
+- do parameter smoothing for the whole block
 - perform block processing (FX or render synth)
 
 \param processBlockInfo structure of information about *block* processing
@@ -5323,6 +5917,9 @@ Operation:
 */
 bool PluginCore::processAudioBlock(ProcessBlockInfo& processBlockInfo)
 {
+	// --- the whole block counts against its deadline
+	voiceGovernor.beginBlock();
+
 	// --- clear MIDI events at top of buffer
 	synthBlockProcInfo.clearMidiEvents();
 	synthBlockProcInfo.absoluteBufferTime_Sec = processBlockInfo.hostInfo->dAbsoluteFrameBufferTime;
@@ -5330,46 +5927,212 @@ bool PluginCore::processAudioBlock(ProcessBlockInfo& processBlockInfo)
 	synthBlockProcInfo.timeSigNumerator = processBlockInfo.hostInfo->fTimeSigNumerator;
 	synthBlockProcInfo.timeSigDenomintor = processBlockInfo.hostInfo->uTimeSigDenomintor;
 
-	// --- fire ALL MIDI events for this block
-	for (uint32_t sample = processBlockInfo.blockStartIndex;
-		sample < processBlockInfo.blockStartIndex + processBlockInfo.blockSize;
-		sample++)
+	for (uint32_t shard = 1; shard < renderShardCount; shard++)
 	{
-		// --- this is for non-sample accurate MIDI
-		processBlockInfo.midiEventQueue->fireMidiEvents(sample);
+		SynthLab::SynthProcessInfo& shardProcInfo = renderShards[shard].synthProcInfo;
+		shardProcInfo.clearMidiEvents();
+		shardProcInfo.absoluteBufferTime_Sec = synthBlockProcInfo.absoluteBufferTime_Sec;
+		shardProcInfo.BPM = synthBlockProcInfo.BPM;
+		shardProcInfo.timeSigNumerator = synthBlockProcInfo.timeSigNumerator;
+		shardProcInfo.timeSigDenomintor = synthBlockProcInfo.timeSigDenomintor;
+	}
 
-		// --- do per-frame updates; VST automation and parameter smoothing
-		doSampleAccurateParameterUpdates();
+	// --- fire ALL MIDI events for this block; processMIDIEvent( ) queues them on the
+	//     sub-block scheduler along with their offset into the block
+	midiSubBlockScheduler.clear();
+	{
+		PROFILE_STAGE(stageProfiler, kProfileMidi);
+		for (uint32_t sample = processBlockInfo.blockStartIndex;
+			sample < processBlockInfo.blockStartIndex + processBlockInfo.blockSize;
+			sample++)
+		{
+			// --- this is for non-sample accurate MIDI
+			midiFireOffset = sample - processBlockInfo.blockStartIndex;
+			processBlockInfo.midiEventQueue->fireMidiEvents(sample);
+		}
 	}
 
-	// --- update parameters
-	updateParameters();
-	
-	// --- in case of partial block
-	synthBlockProcInfo.setSamplesInBlock(processBlockInfo.blockSize);
+	// --- preset change: the parameter snapshot was built off the audio thread; swap it in at
+	//     this block boundary (after the fade out, if anything is sounding) and push it through
+	//     the bound variables once, so nothing morphs in over the following blocks; only the
+	//     parameters that differ from the current preset (and their groups) are visited
+	{
+		PROFILE_STAGE(stageProfiler, kProfileParameters);
+		if (isParameterSnapshotPending() && presetFader.readyToSwap(enableIdleRenderSkip && silenceDetector.isIdle()))
+		{
+			applyParameterSnapshot();
+			syncInBoundVariables();
+		}
 
-	// --- render it
-	synthEngine->render(synthBlockProcInfo);
+		// --- VST automation and parameter smoothing; the engine reads the parameters once
+		//     per block, so the smoothers only need to produce the end-of-block values
+		doBlockParameterUpdates(processBlockInfo.blockSize);
+	}
+
+	// --- update parameters; only the structures of changed groups are rewritten
+	{
+		PROFILE_STAGE(stageProfiler, kProfileUpdateParameters);
+		updateParameters();
+		updateShardParameters();
+		clearBoundVariableChanges();
+	}
+
+	// --- idle: nothing held, the tail has settled and no MIDI arrived in this block (any
+	//     event wakes the detector when it is fired above); clear the outputs instead of rendering
+	blockRenderSkipped = enableIdleRenderSkip && silenceDetector.isIdle();
+	if (blockRenderSkipped)
+	{
+		{
+			PROFILE_STAGE(stageProfiler, kProfileOutputCopy);
+			if (processBlockInfo.outputs64)
+				clearOutputs(processBlockInfo.outputs64, processBlockInfo.numAudioOutChannels, processBlockInfo.blockStartIndex, processBlockInfo.blockSize);
+			else
+				clearOutputs(processBlockInfo.outputs, processBlockInfo.numAudioOutChannels, processBlockInfo.blockStartIndex, processBlockInfo.blockSize);
+		}
+
+		idleBlockCount.fetch_add(1, std::memory_order_relaxed);
+		updateVoiceGovernor(processBlockInfo.blockSize);
+		return true;
+	}
+
+	// --- render sub-blocks that start on MIDI event offsets; events closer together than
+	//     the minimum sub-block size share a sub-block
+	uint32_t subBlockStart = 0;
+	uint32_t subBlockLength = 0;
+	uint32_t firstEvent = 0;
+	uint32_t numEvents = 0;
+	bool firstSubBlock = true;
+	while (midiSubBlockScheduler.getNextSubBlock(processBlockInfo.blockSize, subBlockStart, subBlockLength, firstEvent, numEvents))
+	{
+		// --- the first sub-block keeps anything pushed directly (scheduler overflow)
+		if (!firstSubBlock)
+			clearSynthMidiEvents();
+		firstSubBlock = false;
+
+		{
+			PROFILE_STAGE(stageProfiler, kProfileMidi);
+			for (uint32_t i = firstEvent; i < firstEvent + numEvents; i++)
+				dispatchSynthMidiEvent(midiSubBlockScheduler.getEvent(i));
+		}
+
+		renderSynthSubBlock(processBlockInfo, subBlockStart, subBlockLength);
+	}
+
+	// --- nothing held: measure the tail until it settles
+	if (enableIdleRenderSkip && silenceDetector.wantsOutput())
+	{
+		if (processBlockInfo.outputs64)
+			silenceDetector.addOutputBlock(processBlockInfo.outputs64, processBlockInfo.numAudioOutChannels, processBlockInfo.blockStartIndex, processBlockInfo.blockSize);
+		else
+			silenceDetector.addOutputBlock(processBlockInfo.outputs, processBlockInfo.numAudioOutChannels, processBlockInfo.blockStartIndex, processBlockInfo.blockSize);
+	}
+
+	// --- fade around a preset swap
+	if (presetFader.isActive())
+	{
+		if (processBlockInfo.outputs64)
+			presetFader.applyGain(processBlockInfo.outputs64, processBlockInfo.numAudioOutChannels, processBlockInfo.blockStartIndex, processBlockInfo.blockSize);
+		else
+			presetFader.applyGain(processBlockInfo.outputs, processBlockInfo.numAudioOutChannels, processBlockInfo.blockStartIndex, processBlockInfo.blockSize);
+	}
+
+	// --- deadline governor and its meters
+	updateVoiceGovernor(processBlockInfo.blockSize);
 
 	// --- status LEDs; WS only
 	updateSequencerLEDs();
 
-	// --- output 
+	return true;
+}
+
+/**
+\brief end the governor's block timing; push a level change to the engine(s) and update the governor meters
+
+Operation:
+- a new level changes the delay FX switch, the synth mode and the amp EG release; their groups are flagged
+  so the next block's updateParameters( ) pushes them
+- the meters are normalized: load (1.0 = the block deadline), level (0 to the last level) and
+  voice limit (fraction of all voices)
+
+\param blockSize the block length in samples
+*/
+void PluginCore::updateVoiceGovernor(uint32_t blockSize)
+{
+	if (voiceGovernor.endBlock(blockSize))
+	{
+		setBoundVariableGroupChanged(kEngineGroup);
+		setBoundVariableGroupChanged(kAmpEGGroup);
+	}
+
+	governorLoad = (float)voiceGovernor.getLoad();
+	governorLevel = (float)voiceGovernor.getLevel() / (float)voiceGovernor.getMaxLevel();
+	governorVoices = (float)voiceGovernor.getVoiceLimit() / (float)voiceGovernor.getMaxVoices();
+}
+
+/**
+\brief render one sub-block of synth output and write it to the host buffers
+
+Operation:
+- render subBlockLength samples into the synth's own buffers (all shards, then mix)
+- copy them to the outputs at blockStartIndex + subBlockStart
+
+\param blockInfo structure of information about *block* processing
+\param subBlockStart offset of the sub-block within the block
+\param subBlockLength number of samples to render
+*/
+void PluginCore::renderSynthSubBlock(ProcessBlockInfo& blockInfo, uint32_t subBlockStart, uint32_t subBlockLength)
+{
+	// --- zero-copy: render straight into the host's buffers when they are safe to use
 	float** synthOutputs = synthBlockProcInfo.getOutputBuffers();
+	bool zeroCopy = enableZeroCopyRender && canRenderToHostBuffers(blockInfo, subBlockStart, subBlockLength);
+	if (zeroCopy)
+	{
+		for (uint32_t channel = 0; channel < SynthLab::STEREO_CHANNELS; channel++)
+			synthOutputs[channel] = blockInfo.outputs[channel] + blockInfo.blockStartIndex + subBlockStart;
+	}
 
-	// --- block processing -- write to outputs
-	for (uint32_t sample = processBlockInfo.blockStartIndex, i = 0; 
-		 sample < processBlockInfo.blockStartIndex + processBlockInfo.blockSize; 
-		 sample++, i++)
+	// --- in case of partial block
+	synthBlockProcInfo.setSamplesInBlock(subBlockLength);
+
+	// --- render it
 	{
-		// --- copy to outputs
-		for (uint32_t channel = 0; channel < processBlockInfo.numAudioOutChannels; channel++)
+		PROFILE_STAGE(stageProfiler, kProfileRender);
+		if (renderShardCount > 1)
 		{
-			processBlockInfo.outputs[channel][sample] = synthOutputs[channel][i];
+			// --- shards render in parallel, then mix into shard 0
+			for (uint32_t shard = 1; shard < renderShardCount; shard++)
+				renderShards[shard].synthProcInfo.setSamplesInBlock(subBlockLength);
+
+			renderWorkerPool.runJobs(this, renderShardCount);
+
+			for (uint32_t shard = 1; shard < renderShardCount; shard++)
+			{
+				float** shardOutputs = renderShards[shard].synthProcInfo.getOutputBuffers();
+				for (uint32_t channel = 0; channel < SynthLab::STEREO_CHANNELS; channel++)
+				{
+					for (uint32_t i = 0; i < subBlockLength; i++)
+						synthOutputs[channel][i] += shardOutputs[channel][i];
+				}
+			}
 		}
+		else
+			synthEngine->render(synthBlockProcInfo);
 	}
-	
-	return true;
+
+	// --- output is already in place; give the synth its own buffers back
+	if (zeroCopy)
+	{
+		for (uint32_t channel = 0; channel < SynthLab::STEREO_CHANNELS; channel++)
+			synthOutputs[channel] = ownedSynthOutputs[channel];
+		return;
+	}
+
+	// --- block processing -- write to outputs
+	PROFILE_STAGE(stageProfiler, kProfileOutputCopy);
+	if (blockInfo.outputs64)
+		writeSynthOutputs(blockInfo.outputs64, blockInfo.numAudioOutChannels, blockInfo.blockStartIndex + subBlockStart, synthOutputs, subBlockLength);
+	else
+		writeSynthOutputs(blockInfo.outputs, blockInfo.numAudioOutChannels, blockInfo.blockStartIndex + subBlockStart, synthOutputs, subBlockLength);
 }
 
 
@@ -5457,6 +6220,7 @@ bool PluginCore::postProcessAudioBuffers(ProcessBufferInfo& processInfo)
 {
 	// --- update outbound variables; currently this is meter data only, but could be extended
 	//     in the future
+	PROFILE_STAGE(stageProfiler, kProfileOutBound);
 	updateOutBoundVariables();
 
     return true;
@@ -5793,19 +6557,171 @@ NOTES:
 \return true if operation succeeds, false otherwise
 */
 bool PluginCore::processMIDIEvent(midiEvent& event)
-{	// --- push to queue for block processing
+{
+	// --- voice limit: the oldest notes are released ahead of a note-on that goes over it (Poly mode only);
+	//     getNoteToSteal( ) updates its tracking for the note it names, so only ask when the note-off is really sent
+	voiceGovernor.addMidiEvent(event);
+	if (compareEnumToInt(synthModeEnum::Poly, synthMode))
+	{
+		uint32_t stealChannel = 0;
+		uint32_t stealNote = 0;
+		while (voiceGovernor.getNoteToSteal(stealChannel, stealNote))
+		{
+			const uint32_t NOTE_OFF = 0x80;
+			midiEvent noteOff(NOTE_OFF, stealChannel, stealNote, 0, event.midiSampleOffset);
+			scheduleSynthMidiEvent(noteOff);
+		}
+	}
+
+	scheduleSynthMidiEvent(event);
+	return true;
+}
+
+/**
+\brief send a MIDI event (from the host or a voice steal) towards the synth engine(s)
+
+Operation:
+- the idle detector tracks it first, so it wakes an idle synth before this block is rendered
+- then it is scheduled for its sub-block; if the scheduler is full it goes out at the block start
+
+\param event the MIDI event
+*/
+void PluginCore::scheduleSynthMidiEvent(midiEvent& event)
+{
+	// --- track held notes
+	silenceDetector.addMidiEvent(event);
+
+	if (!midiSubBlockScheduler.addEvent(event, midiFireOffset))
+		dispatchSynthMidiEvent(event);
+}
+
+/**
+\brief push a MIDI event to the synth engine(s) for the next render
+
+\param event the MIDI event
+*/
+void PluginCore::dispatchSynthMidiEvent(midiEvent& event)
+{
+	// --- push to queue for block processing
 	SynthLab::midiEvent synthEvent(event.midiMessage,
 		event.midiChannel, event.midiData1, event.midiData2,
 		event.midiSampleOffset);
 
-	// --- push into vector
-	synthBlockProcInfo.pushMidiEvent(synthEvent);
+	// --- push into vector, or the owning shard's vector
+	if (renderShardCount > 1)
+		routeShardMidiEvent(synthEvent);
+	else
+		synthBlockProcInfo.pushMidiEvent(synthEvent);
+}
 
+/**
+\brief clear the MIDI queues of the synth engine(s) between sub-blocks
+*/
+void PluginCore::clearSynthMidiEvents()
+{
+	synthBlockProcInfo.clearMidiEvents();
+	for (uint32_t shard = 1; shard < renderShardCount; shard++)
+		renderShards[shard].synthProcInfo.clearMidiEvents();
+}
 
+/**
+\brief grow the MIDI queues of the synth engine(s) to SYNTH_MIDI_EVENT_RESERVE events
+
+NOTES:
+- the queues are vectors that keep their capacity when cleared, so filling and clearing them
+  once here means pushMidiEvent( ) does not allocate on the audio thread
+- NOT realtime safe; call from initialize( )
+*/
+void PluginCore::reserveSynthMidiEvents()
+{
+	SynthLab::midiEvent reserveEvent(0, 0, 0, 0, 0);
+	for (uint32_t i = 0; i < SYNTH_MIDI_EVENT_RESERVE; i++)
+	{
+		synthBlockProcInfo.pushMidiEvent(reserveEvent);
+		for (uint32_t shard = 1; shard < renderShardCount; shard++)
+			renderShards[shard].synthProcInfo.pushMidiEvent(reserveEvent);
+	}
+	clearSynthMidiEvents();
+}
+
+/**
+\brief check that the host output buffers can be used as the synth's render target
+
+NOTES:
+- the synth always renders stereo, so mono (or surround) outputs use the copy path
+- the synth renders float, so 64-bit host buffers use the (converting) copy path
+- unaligned sub-blocks use the copy path (16-byte, SSE alignment)
+- aliased channels (one buffer for both, or overlapping ranges) use the copy path
+
+\param blockInfo structure of information about *block* processing
+\param subBlockStart offset of the sub-block within the block
+\param subBlockLength number of samples to render
+
+\return true if the synth may render directly into the host buffers
+*/
+bool PluginCore::canRenderToHostBuffers(ProcessBlockInfo& blockInfo, uint32_t subBlockStart, uint32_t subBlockLength)
+{
+	if (blockInfo.numAudioOutChannels != SynthLab::STEREO_CHANNELS || !blockInfo.outputs)
+		return false;
+
+	if (!blockInfo.outputs[0] || !blockInfo.outputs[1])
+		return false;
+
+	float* left = blockInfo.outputs[0] + blockInfo.blockStartIndex + subBlockStart;
+	float* right = blockInfo.outputs[1] + blockInfo.blockStartIndex + subBlockStart;
+
+	// --- alignment
+	const uintptr_t alignmentMask = 15;
+	if ((((uintptr_t)left) | ((uintptr_t)right)) & alignmentMask)
+		return false;
+
+	// --- aliasing
+	if (left < right + subBlockLength && right < left + subBlockLength)
+		return false;
 
 	return true;
 }
 
+/**
+\brief send a MIDI event to the render shard that owns its note
+
+NOTES:
+- notes are only spread across shards in Poly mode; Mono, Legato and Unison modes need a single voice allocator
+- channel messages (CC, pitch bend, etc...) go to every shard
+
+\param event the SynthLab MIDI event to route
+*/
+void PluginCore::routeShardMidiEvent(SynthLab::midiEvent& event)
+{
+	bool allowSpread = compareEnumToInt(synthModeEnum::Poly, synthMode);
+
+	int32_t shard = shardNoteRouter.getShardForMessage(event.midiMessage, event.midiChannel,
+													   event.midiData1, event.midiData2, allowSpread);
+	if (shard == 0)
+		synthBlockProcInfo.pushMidiEvent(event);
+	else if (shard > 0)
+		renderShards[shard].synthProcInfo.pushMidiEvent(event);
+	else
+	{
+		synthBlockProcInfo.pushMidiEvent(event);
+		for (uint32_t i = 1; i < renderShardCount; i++)
+			renderShards[i].synthProcInfo.pushMidiEvent(event);
+	}
+}
+
+/**
+\brief IRenderJob: render one shard; called from RenderWorkerPool threads
+
+\param jobIndex the shard index
+*/
+void PluginCore::renderJob(uint32_t jobIndex)
+{
+	if (jobIndex == 0)
+		synthEngine->render(synthBlockProcInfo);
+	else if (jobIndex < renderShardCount)
+		renderShards[jobIndex].engine->render(renderShards[jobIndex].synthProcInfo);
+}
+
 /**
 \brief (for future use)
 
@@ -5823,4138 +6739,4113 @@ bool PluginCore::setVectorJoystickParameters(const VectorJoystickData& vectorJoy
 }
 
 /**
-\brief use this method to add new presets to the list
+\brief use this method to add new presets to the shared preset catalog
 
 NOTES:
 - see the SDK for examples of use
+- this is called once per process, by the first instance that needs a preset; do not touch
+  any per-instance state here
+- only the values set with setPresetParameter( ) are stored; a preset's full parameter list is
+  created from the defaults the first time it is applied
 - for non RackAFX users that have large paramter counts, there is a secret GUI control you
   can enable to write C++ code into text files, one per preset. See the SDK or http://www.willpirkle.com for details
 
 \return true if operation succeeds, false otherwise
 */
-bool PluginCore::initPluginPresets()
+bool PluginCore::initPluginPresets(PresetCatalog& presetCatalog)
 {
 	// **--0xFF7A--**
 
 	// --- Plugin Presets 
-	int index = 0;
-	PresetInfo* preset = nullptr;
+	uint32_t preset = 0;
 
 	// --- Preset: Init Patch
-	preset = new PresetInfo(index++, "Init Patch");
-	initPresetParameters(preset->presetParameters);
-	setPresetParameter(preset->presetParameters, controlID::lfo1Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_waveform, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_mode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_frequency_Hz, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_outputAmplitude, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_quantize, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_attackTime_mSec, 25.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_decayTime_mSec, 300.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_sustainLevel, 0.707000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_releaseTime_mSec, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGCore, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1Algorithm, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_fc, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_Q, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1Output_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::enableFilter1KeyTrack, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGCore, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_attackTime_mSec, 25.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_decayTime_mSec, 300.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_sustainLevel, 0.707000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_releaseTime_mSec, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_waveform, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_mode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_frequency_Hz, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_outputAmplitude, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_quantize, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGCore, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_attackTime_mSec, 25.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_decayTime_mSec, 300.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_sustainLevel, 0.707000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_releaseTime_mSec, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2Algorithm, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_fc, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_Q, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::enableFilter2KeyTrack, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2Output_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::globalVolume_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::globalTuning, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::globalUnisonDetune_Cents, 5.000000);
-	setPresetParameter(preset->presetParameters, controlID::globalPitchBendSens, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::synthMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::glideTime_mSec, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1StepLenIndex, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1XFadeLenIndex, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1Pitch_semi, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1PitchProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1ModValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1WaveIndex, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2StepLenIndex, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2XFadeLenIndex, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2WaveIndex, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2Pitch_semi, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2PitchProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2ModValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3StepLenIndex, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3XFadeLenIndex, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3WaveIndex, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3Pitch_semi, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3PitchProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3ModValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4StepLenIndex, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4XFadeLenIndex, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4WaveIndex, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4Pitch_semi, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4PitchProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4ModValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5StepLenIndex, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5XFadeLenIndex, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5WaveIndex, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5Pitch_semi, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5PitchProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5ModValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6StepLenIndex, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6XFadeLenIndex, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6WaveIndex, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6Pitch_semi, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6PitchProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6ModValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7StepLenIndex, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7XFadeLenIndex, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7WaveIndex, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7Pitch_semi, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7PitchProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7ModValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8StepLenIndex, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8XFadeLenIndex, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8WaveIndex, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8Pitch_semi, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8PitchProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8ModValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::timingStartIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::timingEndIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::timingLoopDir, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveStartIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveEndIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveLoopDir, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::pitchStartIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::pitchEndIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::pitchLoopDir, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::stepSeqModStartIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::stepSeqModEndIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::stepSeqModLoopDir, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::timeStretch, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step1Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step2Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step3Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step4Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step5Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step6Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step7Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step8Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::interpolateStepSeqMod, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::randomizeStepOrder, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::randomizePitchOrder, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterModeIndex, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::enableDelayFX, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::leftDelay_mSec, 500.000000);
-	setPresetParameter(preset->presetParameters, controlID::rightDelay_mSec, 500.000000);
-	setPresetParameter(preset->presetParameters, controlID::feedback_Pct, 20.000000);
-	setPresetParameter(preset->presetParameters, controlID::dryLevel_dB, -6.000000);
-	setPresetParameter(preset->presetParameters, controlID::wetLevel_dB, -6.000000);
-	setPresetParameter(preset->presetParameters, controlID::randomizeWaveOrder, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::randomizeSSModOrder, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_fo_Int, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc_fo_Int, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc_UniqueInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGTrigInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGTrigInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_fc_Int, 0.750000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_fc_Int, 0.750000);
-	setPresetParameter(preset->presetParameters, controlID::dcaPanInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGTrigInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1SourceInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2SourceInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGSourceInt, 0.750000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_filter1_fc, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_filter2_fc, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGSourceInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGBiasedSourceInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqModSourceInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_osc_fo, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGIntensity, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1_panValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2_panValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3_panValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq4_panValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5_panValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq6_panValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7_panValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8_panValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq4HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq4Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq6HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq6Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1DetuneCents, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2DetuneCents, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3DetuneCents, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq4DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq4DetuneCents, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5DetuneCents, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq6DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq6DetuneCents, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7DetuneCents, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8DetuneCents, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::LFO_SW, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::EG_SW, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::FILTER_SW, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::MAIN_SW, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::soloWaveLane, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::runStopWS, -0.000000);
-	addPreset(preset);
+	preset = presetCatalog.addPreset("Init Patch");
+	presetCatalog.setPresetParameter(preset, controlID::lfo1Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_waveform, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_mode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_frequency_Hz, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_outputAmplitude, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_quantize, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_attackTime_mSec, 25.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_decayTime_mSec, 300.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_sustainLevel, 0.707000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_releaseTime_mSec, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGCore, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1Algorithm, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_fc, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_Q, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1Output_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::enableFilter1KeyTrack, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGCore, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_attackTime_mSec, 25.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_decayTime_mSec, 300.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_sustainLevel, 0.707000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_releaseTime_mSec, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_waveform, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_mode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_frequency_Hz, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_outputAmplitude, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_quantize, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGCore, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_attackTime_mSec, 25.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_decayTime_mSec, 300.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_sustainLevel, 0.707000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_releaseTime_mSec, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2Algorithm, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_fc, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_Q, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::enableFilter2KeyTrack, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2Output_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::globalVolume_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::globalTuning, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::globalUnisonDetune_Cents, 5.000000);
+	presetCatalog.setPresetParameter(preset, controlID::globalPitchBendSens, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::synthMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::glideTime_mSec, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1StepLenIndex, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1XFadeLenIndex, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1Pitch_semi, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1PitchProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1ModValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1WaveIndex, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2StepLenIndex, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2XFadeLenIndex, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2WaveIndex, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2Pitch_semi, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2PitchProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2ModValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3StepLenIndex, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3XFadeLenIndex, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3WaveIndex, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3Pitch_semi, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3PitchProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3ModValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4StepLenIndex, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4XFadeLenIndex, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4WaveIndex, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4Pitch_semi, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4PitchProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4ModValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5StepLenIndex, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5XFadeLenIndex, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5WaveIndex, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5Pitch_semi, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5PitchProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5ModValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6StepLenIndex, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6XFadeLenIndex, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6WaveIndex, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6Pitch_semi, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6PitchProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6ModValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7StepLenIndex, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7XFadeLenIndex, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7WaveIndex, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7Pitch_semi, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7PitchProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7ModValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8StepLenIndex, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8XFadeLenIndex, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8WaveIndex, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8Pitch_semi, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8PitchProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8ModValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::timingStartIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::timingEndIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::timingLoopDir, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveStartIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveEndIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveLoopDir, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::pitchStartIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::pitchEndIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::pitchLoopDir, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::stepSeqModStartIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::stepSeqModEndIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::stepSeqModLoopDir, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::timeStretch, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step1Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step2Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step3Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step4Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step5Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step6Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step7Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step8Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::interpolateStepSeqMod, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::randomizeStepOrder, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::randomizePitchOrder, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterModeIndex, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::enableDelayFX, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::leftDelay_mSec, 500.000000);
+	presetCatalog.setPresetParameter(preset, controlID::rightDelay_mSec, 500.000000);
+	presetCatalog.setPresetParameter(preset, controlID::feedback_Pct, 20.000000);
+	presetCatalog.setPresetParameter(preset, controlID::dryLevel_dB, -6.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wetLevel_dB, -6.000000);
+	presetCatalog.setPresetParameter(preset, controlID::randomizeWaveOrder, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::randomizeSSModOrder, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_fo_Int, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc_fo_Int, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc_UniqueInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGTrigInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGTrigInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_fc_Int, 0.750000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_fc_Int, 0.750000);
+	presetCatalog.setPresetParameter(preset, controlID::dcaPanInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGTrigInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1SourceInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2SourceInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGSourceInt, 0.750000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_filter1_fc, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_filter2_fc, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGSourceInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGBiasedSourceInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqModSourceInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_osc_fo, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGIntensity, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1_panValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2_panValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3_panValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4_panValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5_panValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6_panValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7_panValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8_panValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1DetuneCents, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2DetuneCents, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3DetuneCents, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4DetuneCents, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5DetuneCents, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6DetuneCents, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7DetuneCents, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8DetuneCents, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::LFO_SW, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::EG_SW, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::FILTER_SW, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::MAIN_SW, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::soloWaveLane, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::runStopWS, -0.000000);
 
 	// --- Preset: UnderTheBed
-	preset = new PresetInfo(index++, "UnderTheBed");
-	initPresetParameters(preset->presetParameters);
-	setPresetParameter(preset->presetParameters, controlID::lfo1Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_waveform, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_mode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_frequency_Hz, 0.406415);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_outputAmplitude, 0.925000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_quantize, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_attackTime_mSec, 25.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_decayTime_mSec, 300.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_sustainLevel, 0.707000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_releaseTime_mSec, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGCore, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1Algorithm, 4.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobB, 0.270000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobC, 0.790000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobD, 0.705000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_fc, 435.274994);
-	setPresetParameter(preset->presetParameters, controlID::filter1_Q, 8.110001);
-	setPresetParameter(preset->presetParameters, controlID::filter1Output_dB, -6.000000);
-	setPresetParameter(preset->presetParameters, controlID::enableFilter1KeyTrack, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGCore, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_attackTime_mSec, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_decayTime_mSec, 300.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_sustainLevel, 0.707000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_releaseTime_mSec, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_waveform, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_mode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_frequency_Hz, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_outputAmplitude, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_quantize, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGCore, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_attackTime_mSec, 8250.017578);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_decayTime_mSec, 10000.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_sustainLevel, 0.375000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_releaseTime_mSec, 10000.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobA, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2Algorithm, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_fc, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_Q, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::enableFilter2KeyTrack, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2Output_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::globalVolume_dB, 5.399994);
-	setPresetParameter(preset->presetParameters, controlID::globalTuning, -0.360000);
-	setPresetParameter(preset->presetParameters, controlID::globalUnisonDetune_Cents, 5.000000);
-	setPresetParameter(preset->presetParameters, controlID::globalPitchBendSens, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::synthMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::glideTime_mSec, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1StepLenIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1XFadeLenIndex, 12.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1Pitch_semi, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1PitchProb_pct, 74.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1ModValue, -0.640000);
-	setPresetParameter(preset->presetParameters, controlID::ws1ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1WaveIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2StepLenIndex, 10.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2XFadeLenIndex, 16.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2WaveIndex, 15.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2Pitch_semi, -2.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2PitchProb_pct, 16.000002);
-	setPresetParameter(preset->presetParameters, controlID::ws2ModValue, -0.600000);
-	setPresetParameter(preset->presetParameters, controlID::ws2ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3StepLenIndex, 12.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3XFadeLenIndex, 11.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3WaveIndex, 23.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3Pitch_semi, -6.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3PitchProb_pct, 75.500000);
-	setPresetParameter(preset->presetParameters, controlID::ws3ModValue, -0.300000);
-	setPresetParameter(preset->presetParameters, controlID::ws3ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4StepLenIndex, 10.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4XFadeLenIndex, 11.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4WaveIndex, 7.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4Pitch_semi, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4PitchProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4ModValue, 0.180000);
-	setPresetParameter(preset->presetParameters, controlID::ws4ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5StepLenIndex, 11.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5XFadeLenIndex, 5.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5WaveIndex, 35.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5Pitch_semi, 11.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5PitchProb_pct, 38.000004);
-	setPresetParameter(preset->presetParameters, controlID::ws5ModValue, 0.590000);
-	setPresetParameter(preset->presetParameters, controlID::ws5ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6StepLenIndex, 6.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6XFadeLenIndex, 12.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6WaveIndex, 29.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6Pitch_semi, -9.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6PitchProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6ModValue, 0.710000);
-	setPresetParameter(preset->presetParameters, controlID::ws6ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7StepLenIndex, 7.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7XFadeLenIndex, 7.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7WaveIndex, 34.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7Pitch_semi, 12.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7PitchProb_pct, 78.500000);
-	setPresetParameter(preset->presetParameters, controlID::ws7ModValue, -0.800000);
-	setPresetParameter(preset->presetParameters, controlID::ws7ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8StepLenIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8XFadeLenIndex, 7.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8WaveIndex, 16.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8Pitch_semi, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8PitchProb_pct, 29.500002);
-	setPresetParameter(preset->presetParameters, controlID::ws8ModValue, 0.390000);
-	setPresetParameter(preset->presetParameters, controlID::ws8ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::timingStartIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::timingEndIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::timingLoopDir, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveStartIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveEndIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveLoopDir, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::pitchStartIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::pitchEndIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::pitchLoopDir, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::stepSeqModStartIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::stepSeqModEndIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::stepSeqModLoopDir, 2.000000);
-	setPresetParameter(preset->presetParameters, controlID::timeStretch, 0.100000);
-	setPresetParameter(preset->presetParameters, controlID::step1Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step2Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step3Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step4Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step5Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step6Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step7Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step8Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::interpolateStepSeqMod, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::randomizeStepOrder, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::randomizePitchOrder, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterModeIndex, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::enableDelayFX, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::leftDelay_mSec, 760.000000);
-	setPresetParameter(preset->presetParameters, controlID::rightDelay_mSec, 500.000000);
-	setPresetParameter(preset->presetParameters, controlID::feedback_Pct, 20.000000);
-	setPresetParameter(preset->presetParameters, controlID::dryLevel_dB, 1.200001);
-	setPresetParameter(preset->presetParameters, controlID::wetLevel_dB, -2.399998);
-	setPresetParameter(preset->presetParameters, controlID::randomizeWaveOrder, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::randomizeSSModOrder, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_fo_Int, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc_fo_Int, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc_UniqueInt, 0.720000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGTrigInt, 0.700000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGTrigInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_fc_Int, 0.480000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_fc_Int, 0.490000);
-	setPresetParameter(preset->presetParameters, controlID::dcaPanInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGTrigInt, 0.050000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1SourceInt, 0.690000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_filter1_fc, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_filter2_fc, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2SourceInt, 0.610000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGSourceInt, 0.600000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_filter1_fc, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_filter2_fc, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGSourceInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGBiasedSourceInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqModSourceInt, 0.730000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_osc_fo, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_oscUnique, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGIntensity, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1_panValue, -0.540000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2_panValue, 0.360000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3_panValue, -0.690000);
-	setPresetParameter(preset->presetParameters, controlID::wseq4_panValue, -0.770000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5_panValue, 0.530000);
-	setPresetParameter(preset->presetParameters, controlID::wseq6_panValue, 0.290000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7_panValue, 0.330000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8_panValue, -0.600000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2HardSync, 0.120000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3HardSync, 0.050000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq4HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq4Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq6HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq6Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8HardSync, 0.150000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1DetuneCents, 31.500000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2DetuneCents, -44.500000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3DetuneCents, 19.500008);
-	setPresetParameter(preset->presetParameters, controlID::wseq4DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq4DetuneCents, -11.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5DetuneCents, -3.000004);
-	setPresetParameter(preset->presetParameters, controlID::wseq6DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq6DetuneCents, -7.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7DetuneCents, 12.500000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8DetuneCents, -26.500000);
-	setPresetParameter(preset->presetParameters, controlID::LFO_SW, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::EG_SW, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::FILTER_SW, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::MAIN_SW, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::soloWaveLane, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::runStopWS, -0.000000);
-	addPreset(preset);
+	preset = presetCatalog.addPreset("UnderTheBed");
+	presetCatalog.setPresetParameter(preset, controlID::lfo1Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_waveform, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_mode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_frequency_Hz, 0.406415);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_outputAmplitude, 0.925000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_quantize, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_attackTime_mSec, 25.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_decayTime_mSec, 300.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_sustainLevel, 0.707000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_releaseTime_mSec, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGCore, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1Algorithm, 4.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobB, 0.270000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobC, 0.790000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobD, 0.705000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_fc, 435.274994);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_Q, 8.110001);
+	presetCatalog.setPresetParameter(preset, controlID::filter1Output_dB, -6.000000);
+	presetCatalog.setPresetParameter(preset, controlID::enableFilter1KeyTrack, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGCore, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_attackTime_mSec, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_decayTime_mSec, 300.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_sustainLevel, 0.707000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_releaseTime_mSec, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_waveform, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_mode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_frequency_Hz, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_outputAmplitude, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_quantize, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGCore, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_attackTime_mSec, 8250.017578);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_decayTime_mSec, 10000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_sustainLevel, 0.375000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_releaseTime_mSec, 10000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobA, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2Algorithm, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_fc, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_Q, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::enableFilter2KeyTrack, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2Output_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::globalVolume_dB, 5.399994);
+	presetCatalog.setPresetParameter(preset, controlID::globalTuning, -0.360000);
+	presetCatalog.setPresetParameter(preset, controlID::globalUnisonDetune_Cents, 5.000000);
+	presetCatalog.setPresetParameter(preset, controlID::globalPitchBendSens, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::synthMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::glideTime_mSec, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1StepLenIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1XFadeLenIndex, 12.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1Pitch_semi, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1PitchProb_pct, 74.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1ModValue, -0.640000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1WaveIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2StepLenIndex, 10.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2XFadeLenIndex, 16.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2WaveIndex, 15.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2Pitch_semi, -2.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2PitchProb_pct, 16.000002);
+	presetCatalog.setPresetParameter(preset, controlID::ws2ModValue, -0.600000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3StepLenIndex, 12.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3XFadeLenIndex, 11.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3WaveIndex, 23.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3Pitch_semi, -6.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3PitchProb_pct, 75.500000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3ModValue, -0.300000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4StepLenIndex, 10.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4XFadeLenIndex, 11.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4WaveIndex, 7.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4Pitch_semi, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4PitchProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4ModValue, 0.180000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5StepLenIndex, 11.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5XFadeLenIndex, 5.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5WaveIndex, 35.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5Pitch_semi, 11.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5PitchProb_pct, 38.000004);
+	presetCatalog.setPresetParameter(preset, controlID::ws5ModValue, 0.590000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6StepLenIndex, 6.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6XFadeLenIndex, 12.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6WaveIndex, 29.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6Pitch_semi, -9.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6PitchProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6ModValue, 0.710000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7StepLenIndex, 7.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7XFadeLenIndex, 7.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7WaveIndex, 34.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7Pitch_semi, 12.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7PitchProb_pct, 78.500000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7ModValue, -0.800000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8StepLenIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8XFadeLenIndex, 7.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8WaveIndex, 16.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8Pitch_semi, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8PitchProb_pct, 29.500002);
+	presetCatalog.setPresetParameter(preset, controlID::ws8ModValue, 0.390000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::timingStartIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::timingEndIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::timingLoopDir, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveStartIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveEndIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveLoopDir, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::pitchStartIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::pitchEndIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::pitchLoopDir, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::stepSeqModStartIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::stepSeqModEndIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::stepSeqModLoopDir, 2.000000);
+	presetCatalog.setPresetParameter(preset, controlID::timeStretch, 0.100000);
+	presetCatalog.setPresetParameter(preset, controlID::step1Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step2Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step3Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step4Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step5Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step6Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step7Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step8Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::interpolateStepSeqMod, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::randomizeStepOrder, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::randomizePitchOrder, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterModeIndex, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::enableDelayFX, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::leftDelay_mSec, 760.000000);
+	presetCatalog.setPresetParameter(preset, controlID::rightDelay_mSec, 500.000000);
+	presetCatalog.setPresetParameter(preset, controlID::feedback_Pct, 20.000000);
+	presetCatalog.setPresetParameter(preset, controlID::dryLevel_dB, 1.200001);
+	presetCatalog.setPresetParameter(preset, controlID::wetLevel_dB, -2.399998);
+	presetCatalog.setPresetParameter(preset, controlID::randomizeWaveOrder, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::randomizeSSModOrder, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_fo_Int, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc_fo_Int, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc_UniqueInt, 0.720000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGTrigInt, 0.700000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGTrigInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_fc_Int, 0.480000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_fc_Int, 0.490000);
+	presetCatalog.setPresetParameter(preset, controlID::dcaPanInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGTrigInt, 0.050000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1SourceInt, 0.690000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_filter1_fc, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_filter2_fc, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2SourceInt, 0.610000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGSourceInt, 0.600000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_filter1_fc, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_filter2_fc, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGSourceInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGBiasedSourceInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqModSourceInt, 0.730000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_osc_fo, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_oscUnique, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGIntensity, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1_panValue, -0.540000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2_panValue, 0.360000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3_panValue, -0.690000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4_panValue, -0.770000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5_panValue, 0.530000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6_panValue, 0.290000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7_panValue, 0.330000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8_panValue, -0.600000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2HardSync, 0.120000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3HardSync, 0.050000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8HardSync, 0.150000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1DetuneCents, 31.500000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2DetuneCents, -44.500000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3DetuneCents, 19.500008);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4DetuneCents, -11.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5DetuneCents, -3.000004);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6DetuneCents, -7.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7DetuneCents, 12.500000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8DetuneCents, -26.500000);
+	presetCatalog.setPresetParameter(preset, controlID::LFO_SW, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::EG_SW, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::FILTER_SW, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::MAIN_SW, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::soloWaveLane, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::runStopWS, -0.000000);
 
 	// --- Preset: Aliens
-	preset = new PresetInfo(index++, "Aliens");
-	initPresetParameters(preset->presetParameters);
-	setPresetParameter(preset->presetParameters, controlID::lfo1Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_waveform, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_mode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_frequency_Hz, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_outputAmplitude, 0.475000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_quantize, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_attackTime_mSec, 25.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_decayTime_mSec, 300.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_sustainLevel, 0.707000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_releaseTime_mSec, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGCore, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1Algorithm, 4.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobB, 0.270000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobC, 0.630000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobD, 0.705000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_fc, 1515.715698);
-	setPresetParameter(preset->presetParameters, controlID::filter1_Q, 5.725000);
-	setPresetParameter(preset->presetParameters, controlID::filter1Output_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::enableFilter1KeyTrack, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGCore, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_attackTime_mSec, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_decayTime_mSec, 300.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_sustainLevel, 0.707000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_releaseTime_mSec, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_waveform, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_mode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_frequency_Hz, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_outputAmplitude, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_quantize, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGCore, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_attackTime_mSec, 8250.017578);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_decayTime_mSec, 10000.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_sustainLevel, 0.375000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_releaseTime_mSec, 10000.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobA, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2Algorithm, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_fc, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_Q, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::enableFilter2KeyTrack, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2Output_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::globalVolume_dB, -3.240002);
-	setPresetParameter(preset->presetParameters, controlID::globalTuning, -0.360000);
-	setPresetParameter(preset->presetParameters, controlID::globalUnisonDetune_Cents, 5.000000);
-	setPresetParameter(preset->presetParameters, controlID::globalPitchBendSens, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::synthMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::glideTime_mSec, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1WaveAmp_dB, 5.759995);
-	setPresetParameter(preset->presetParameters, controlID::ws1StepLenIndex, 10.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1XFadeLenIndex, 12.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1Pitch_semi, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1PitchProb_pct, 35.500000);
-	setPresetParameter(preset->presetParameters, controlID::ws1ModValue, 0.530000);
-	setPresetParameter(preset->presetParameters, controlID::ws1ModProb_pct, 78.500000);
-	setPresetParameter(preset->presetParameters, controlID::ws1WaveIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2StepLenIndex, 10.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2XFadeLenIndex, 11.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2WaveIndex, 15.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2WaveAmp_dB, -6.840000);
-	setPresetParameter(preset->presetParameters, controlID::ws2Pitch_semi, -2.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2PitchProb_pct, 5.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2ModValue, 0.350000);
-	setPresetParameter(preset->presetParameters, controlID::ws2ModProb_pct, 49.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3StepLenIndex, 12.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3XFadeLenIndex, 11.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3WaveIndex, 23.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3WaveAmp_dB, -5.040001);
-	setPresetParameter(preset->presetParameters, controlID::ws3Pitch_semi, -6.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3PitchProb_pct, 55.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3ModValue, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3ModProb_pct, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4StepLenIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4XFadeLenIndex, 11.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4WaveIndex, 7.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4WaveAmp_dB, -16.920002);
-	setPresetParameter(preset->presetParameters, controlID::ws4Pitch_semi, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4PitchProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4ModValue, -0.360000);
-	setPresetParameter(preset->presetParameters, controlID::ws4ModProb_pct, 50.500000);
-	setPresetParameter(preset->presetParameters, controlID::ws5StepLenIndex, 11.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5XFadeLenIndex, 5.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5WaveIndex, 35.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5WaveAmp_dB, 4.680000);
-	setPresetParameter(preset->presetParameters, controlID::ws5Pitch_semi, 11.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5PitchProb_pct, 69.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5ModValue, -0.630000);
-	setPresetParameter(preset->presetParameters, controlID::ws5ModProb_pct, 54.000004);
-	setPresetParameter(preset->presetParameters, controlID::ws6StepLenIndex, 5.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6XFadeLenIndex, 14.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6WaveIndex, 29.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6WaveAmp_dB, 12.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6Pitch_semi, -9.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6PitchProb_pct, 15.500002);
-	setPresetParameter(preset->presetParameters, controlID::ws6ModValue, -0.340000);
-	setPresetParameter(preset->presetParameters, controlID::ws6ModProb_pct, 42.500000);
-	setPresetParameter(preset->presetParameters, controlID::ws7StepLenIndex, 5.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7XFadeLenIndex, 9.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7WaveIndex, 34.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7WaveAmp_dB, 3.959999);
-	setPresetParameter(preset->presetParameters, controlID::ws7Pitch_semi, 12.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7PitchProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7ModValue, 0.440000);
-	setPresetParameter(preset->presetParameters, controlID::ws7ModProb_pct, 71.500000);
-	setPresetParameter(preset->presetParameters, controlID::ws8StepLenIndex, 6.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8XFadeLenIndex, 9.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8WaveIndex, 16.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8WaveAmp_dB, 2.520000);
-	setPresetParameter(preset->presetParameters, controlID::ws8Pitch_semi, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8PitchProb_pct, 54.500000);
-	setPresetParameter(preset->presetParameters, controlID::ws8ModValue, 0.990000);
-	setPresetParameter(preset->presetParameters, controlID::ws8ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::timingStartIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::timingEndIndex, 6.000000);
-	setPresetParameter(preset->presetParameters, controlID::timingLoopDir, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveStartIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveEndIndex, 6.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveLoopDir, 2.000000);
-	setPresetParameter(preset->presetParameters, controlID::pitchStartIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::pitchEndIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::pitchLoopDir, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::stepSeqModStartIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::stepSeqModEndIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::stepSeqModLoopDir, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::timeStretch, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step1Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step2Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step3Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step4Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step5Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step6Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step7Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step8Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::interpolateStepSeqMod, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::randomizeStepOrder, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::randomizePitchOrder, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterModeIndex, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::enableDelayFX, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::leftDelay_mSec, 760.000000);
-	setPresetParameter(preset->presetParameters, controlID::rightDelay_mSec, 500.000000);
-	setPresetParameter(preset->presetParameters, controlID::feedback_Pct, 20.000000);
-	setPresetParameter(preset->presetParameters, controlID::dryLevel_dB, 1.200001);
-	setPresetParameter(preset->presetParameters, controlID::wetLevel_dB, -2.399998);
-	setPresetParameter(preset->presetParameters, controlID::randomizeWaveOrder, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::randomizeSSModOrder, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_fo_Int, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc_fo_Int, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc_UniqueInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGTrigInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGTrigInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_fc_Int, 0.480000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_fc_Int, 0.490000);
-	setPresetParameter(preset->presetParameters, controlID::dcaPanInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGTrigInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1SourceInt, 0.690000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_filter1_fc, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_filter2_fc, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2SourceInt, 0.610000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGSourceInt, 0.600000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_filter1_fc, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_filter2_fc, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGSourceInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGBiasedSourceInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqModSourceInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_osc_fo, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGIntensity, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1_panValue, -0.540000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2_panValue, 0.360000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3_panValue, -0.690000);
-	setPresetParameter(preset->presetParameters, controlID::wseq4_panValue, -0.770000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5_panValue, 0.530000);
-	setPresetParameter(preset->presetParameters, controlID::wseq6_panValue, 0.290000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7_panValue, 0.330000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8_panValue, -0.600000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2HardSync, 0.120000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3HardSync, 0.050000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq4HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq4Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq6HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq6Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8HardSync, 0.150000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1DetuneCents, 31.500000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2DetuneCents, -44.500000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3DetuneCents, 19.500008);
-	setPresetParameter(preset->presetParameters, controlID::wseq4DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq4DetuneCents, -11.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5DetuneCents, -3.000004);
-	setPresetParameter(preset->presetParameters, controlID::wseq6DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq6DetuneCents, -7.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7DetuneCents, 12.500000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8DetuneCents, -26.500000);
-	setPresetParameter(preset->presetParameters, controlID::LFO_SW, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::EG_SW, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::FILTER_SW, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::MAIN_SW, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::soloWaveLane, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::runStopWS, -0.000000);
-	addPreset(preset);
+	preset = presetCatalog.addPreset("Aliens");
+	presetCatalog.setPresetParameter(preset, controlID::lfo1Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_waveform, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_mode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_frequency_Hz, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_outputAmplitude, 0.475000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_quantize, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_attackTime_mSec, 25.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_decayTime_mSec, 300.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_sustainLevel, 0.707000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_releaseTime_mSec, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGCore, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1Algorithm, 4.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobB, 0.270000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobC, 0.630000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobD, 0.705000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_fc, 1515.715698);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_Q, 5.725000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1Output_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::enableFilter1KeyTrack, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGCore, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_attackTime_mSec, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_decayTime_mSec, 300.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_sustainLevel, 0.707000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_releaseTime_mSec, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_waveform, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_mode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_frequency_Hz, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_outputAmplitude, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_quantize, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGCore, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_attackTime_mSec, 8250.017578);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_decayTime_mSec, 10000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_sustainLevel, 0.375000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_releaseTime_mSec, 10000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobA, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2Algorithm, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_fc, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_Q, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::enableFilter2KeyTrack, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2Output_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::globalVolume_dB, -3.240002);
+	presetCatalog.setPresetParameter(preset, controlID::globalTuning, -0.360000);
+	presetCatalog.setPresetParameter(preset, controlID::globalUnisonDetune_Cents, 5.000000);
+	presetCatalog.setPresetParameter(preset, controlID::globalPitchBendSens, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::synthMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::glideTime_mSec, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1WaveAmp_dB, 5.759995);
+	presetCatalog.setPresetParameter(preset, controlID::ws1StepLenIndex, 10.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1XFadeLenIndex, 12.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1Pitch_semi, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1PitchProb_pct, 35.500000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1ModValue, 0.530000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1ModProb_pct, 78.500000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1WaveIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2StepLenIndex, 10.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2XFadeLenIndex, 11.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2WaveIndex, 15.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2WaveAmp_dB, -6.840000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2Pitch_semi, -2.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2PitchProb_pct, 5.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2ModValue, 0.350000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2ModProb_pct, 49.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3StepLenIndex, 12.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3XFadeLenIndex, 11.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3WaveIndex, 23.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3WaveAmp_dB, -5.040001);
+	presetCatalog.setPresetParameter(preset, controlID::ws3Pitch_semi, -6.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3PitchProb_pct, 55.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3ModValue, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3ModProb_pct, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4StepLenIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4XFadeLenIndex, 11.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4WaveIndex, 7.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4WaveAmp_dB, -16.920002);
+	presetCatalog.setPresetParameter(preset, controlID::ws4Pitch_semi, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4PitchProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4ModValue, -0.360000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4ModProb_pct, 50.500000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5StepLenIndex, 11.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5XFadeLenIndex, 5.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5WaveIndex, 35.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5WaveAmp_dB, 4.680000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5Pitch_semi, 11.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5PitchProb_pct, 69.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5ModValue, -0.630000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5ModProb_pct, 54.000004);
+	presetCatalog.setPresetParameter(preset, controlID::ws6StepLenIndex, 5.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6XFadeLenIndex, 14.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6WaveIndex, 29.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6WaveAmp_dB, 12.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6Pitch_semi, -9.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6PitchProb_pct, 15.500002);
+	presetCatalog.setPresetParameter(preset, controlID::ws6ModValue, -0.340000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6ModProb_pct, 42.500000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7StepLenIndex, 5.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7XFadeLenIndex, 9.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7WaveIndex, 34.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7WaveAmp_dB, 3.959999);
+	presetCatalog.setPresetParameter(preset, controlID::ws7Pitch_semi, 12.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7PitchProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7ModValue, 0.440000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7ModProb_pct, 71.500000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8StepLenIndex, 6.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8XFadeLenIndex, 9.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8WaveIndex, 16.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8WaveAmp_dB, 2.520000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8Pitch_semi, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8PitchProb_pct, 54.500000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8ModValue, 0.990000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::timingStartIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::timingEndIndex, 6.000000);
+	presetCatalog.setPresetParameter(preset, controlID::timingLoopDir, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveStartIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveEndIndex, 6.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveLoopDir, 2.000000);
+	presetCatalog.setPresetParameter(preset, controlID::pitchStartIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::pitchEndIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::pitchLoopDir, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::stepSeqModStartIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::stepSeqModEndIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::stepSeqModLoopDir, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::timeStretch, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step1Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step2Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step3Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step4Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step5Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step6Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step7Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step8Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::interpolateStepSeqMod, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::randomizeStepOrder, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::randomizePitchOrder, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterModeIndex, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::enableDelayFX, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::leftDelay_mSec, 760.000000);
+	presetCatalog.setPresetParameter(preset, controlID::rightDelay_mSec, 500.000000);
+	presetCatalog.setPresetParameter(preset, controlID::feedback_Pct, 20.000000);
+	presetCatalog.setPresetParameter(preset, controlID::dryLevel_dB, 1.200001);
+	presetCatalog.setPresetParameter(preset, controlID::wetLevel_dB, -2.399998);
+	presetCatalog.setPresetParameter(preset, controlID::randomizeWaveOrder, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::randomizeSSModOrder, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_fo_Int, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc_fo_Int, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc_UniqueInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGTrigInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGTrigInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_fc_Int, 0.480000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_fc_Int, 0.490000);
+	presetCatalog.setPresetParameter(preset, controlID::dcaPanInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGTrigInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1SourceInt, 0.690000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_filter1_fc, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_filter2_fc, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2SourceInt, 0.610000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGSourceInt, 0.600000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_filter1_fc, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_filter2_fc, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGSourceInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGBiasedSourceInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqModSourceInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_osc_fo, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGIntensity, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1_panValue, -0.540000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2_panValue, 0.360000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3_panValue, -0.690000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4_panValue, -0.770000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5_panValue, 0.530000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6_panValue, 0.290000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7_panValue, 0.330000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8_panValue, -0.600000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2HardSync, 0.120000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3HardSync, 0.050000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8HardSync, 0.150000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1DetuneCents, 31.500000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2DetuneCents, -44.500000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3DetuneCents, 19.500008);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4DetuneCents, -11.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5DetuneCents, -3.000004);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6DetuneCents, -7.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7DetuneCents, 12.500000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8DetuneCents, -26.500000);
+	presetCatalog.setPresetParameter(preset, controlID::LFO_SW, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::EG_SW, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::FILTER_SW, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::MAIN_SW, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::soloWaveLane, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::runStopWS, -0.000000);
 
 	// --- Preset: UnderTheBed2
-	preset = new PresetInfo(index++, "UnderTheBed2");
-	initPresetParameters(preset->presetParameters);
-	setPresetParameter(preset->presetParameters, controlID::lfo1Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_waveform, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_mode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_frequency_Hz, 0.406415);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_outputAmplitude, 0.925000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_quantize, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_attackTime_mSec, 25.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_decayTime_mSec, 300.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_sustainLevel, 0.707000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_releaseTime_mSec, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGCore, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1Algorithm, 4.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobB, 0.270000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobC, 0.790000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobD, 0.705000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_fc, 435.274994);
-	setPresetParameter(preset->presetParameters, controlID::filter1_Q, 8.110001);
-	setPresetParameter(preset->presetParameters, controlID::filter1Output_dB, -6.000000);
-	setPresetParameter(preset->presetParameters, controlID::enableFilter1KeyTrack, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGCore, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_attackTime_mSec, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_decayTime_mSec, 300.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_sustainLevel, 0.707000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_releaseTime_mSec, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_waveform, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_mode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_frequency_Hz, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_outputAmplitude, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_quantize, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGCore, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_attackTime_mSec, 8250.017578);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_decayTime_mSec, 10000.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_sustainLevel, 0.375000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_releaseTime_mSec, 10000.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobA, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2Algorithm, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_fc, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_Q, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::enableFilter2KeyTrack, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2Output_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::globalVolume_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::globalTuning, -0.360000);
-	setPresetParameter(preset->presetParameters, controlID::globalUnisonDetune_Cents, 5.000000);
-	setPresetParameter(preset->presetParameters, controlID::globalPitchBendSens, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::synthMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::glideTime_mSec, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1StepLenIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1XFadeLenIndex, 12.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1Pitch_semi, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1PitchProb_pct, 74.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1ModValue, -0.640000);
-	setPresetParameter(preset->presetParameters, controlID::ws1ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1WaveIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2StepLenIndex, 10.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2XFadeLenIndex, 16.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2WaveIndex, 15.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2Pitch_semi, -2.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2PitchProb_pct, 16.000002);
-	setPresetParameter(preset->presetParameters, controlID::ws2ModValue, -0.600000);
-	setPresetParameter(preset->presetParameters, controlID::ws2ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3StepLenIndex, 12.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3XFadeLenIndex, 11.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3WaveIndex, 23.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3Pitch_semi, -6.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3PitchProb_pct, 75.500000);
-	setPresetParameter(preset->presetParameters, controlID::ws3ModValue, -0.300000);
-	setPresetParameter(preset->presetParameters, controlID::ws3ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4StepLenIndex, 10.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4XFadeLenIndex, 11.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4WaveIndex, 7.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4Pitch_semi, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4PitchProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4ModValue, 0.180000);
-	setPresetParameter(preset->presetParameters, controlID::ws4ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5StepLenIndex, 11.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5XFadeLenIndex, 5.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5WaveIndex, 35.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5Pitch_semi, 11.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5PitchProb_pct, 38.000004);
-	setPresetParameter(preset->presetParameters, controlID::ws5ModValue, 0.590000);
-	setPresetParameter(preset->presetParameters, controlID::ws5ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6StepLenIndex, 6.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6XFadeLenIndex, 12.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6WaveIndex, 29.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6Pitch_semi, -9.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6PitchProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6ModValue, 0.710000);
-	setPresetParameter(preset->presetParameters, controlID::ws6ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7StepLenIndex, 7.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7XFadeLenIndex, 7.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7WaveIndex, 34.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7Pitch_semi, 12.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7PitchProb_pct, 78.500000);
-	setPresetParameter(preset->presetParameters, controlID::ws7ModValue, -0.800000);
-	setPresetParameter(preset->presetParameters, controlID::ws7ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8StepLenIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8XFadeLenIndex, 7.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8WaveIndex, 16.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8Pitch_semi, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8PitchProb_pct, 29.500002);
-	setPresetParameter(preset->presetParameters, controlID::ws8ModValue, 0.390000);
-	setPresetParameter(preset->presetParameters, controlID::ws8ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::timingStartIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::timingEndIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::timingLoopDir, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveStartIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveEndIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveLoopDir, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::pitchStartIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::pitchEndIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::pitchLoopDir, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::stepSeqModStartIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::stepSeqModEndIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::stepSeqModLoopDir, 2.000000);
-	setPresetParameter(preset->presetParameters, controlID::timeStretch, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step1Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step2Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step3Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step4Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step5Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step6Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step7Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step8Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::interpolateStepSeqMod, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::randomizeStepOrder, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::randomizePitchOrder, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterModeIndex, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::enableDelayFX, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::leftDelay_mSec, 760.000000);
-	setPresetParameter(preset->presetParameters, controlID::rightDelay_mSec, 500.000000);
-	setPresetParameter(preset->presetParameters, controlID::feedback_Pct, 20.000000);
-	setPresetParameter(preset->presetParameters, controlID::dryLevel_dB, 1.200001);
-	setPresetParameter(preset->presetParameters, controlID::wetLevel_dB, -2.399998);
-	setPresetParameter(preset->presetParameters, controlID::randomizeWaveOrder, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::randomizeSSModOrder, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_fo_Int, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc_fo_Int, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc_UniqueInt, 0.720000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGTrigInt, 0.700000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGTrigInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_fc_Int, 0.480000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_fc_Int, 0.490000);
-	setPresetParameter(preset->presetParameters, controlID::dcaPanInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGTrigInt, 0.050000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1SourceInt, 0.690000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_filter1_fc, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_filter2_fc, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2SourceInt, 0.610000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGSourceInt, 0.600000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_filter1_fc, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_filter2_fc, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGSourceInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGBiasedSourceInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqModSourceInt, 0.730000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_osc_fo, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_oscUnique, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGIntensity, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1_panValue, -0.540000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2_panValue, 0.360000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3_panValue, -0.690000);
-	setPresetParameter(preset->presetParameters, controlID::wseq4_panValue, -0.770000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5_panValue, 0.530000);
-	setPresetParameter(preset->presetParameters, controlID::wseq6_panValue, 0.290000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7_panValue, 0.330000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8_panValue, -0.600000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2HardSync, 0.120000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3HardSync, 0.050000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq4HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq4Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq6HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq6Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8HardSync, 0.150000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1DetuneCents, 31.500000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2DetuneCents, -44.500000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3DetuneCents, 19.500008);
-	setPresetParameter(preset->presetParameters, controlID::wseq4DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq4DetuneCents, -11.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5DetuneCents, -3.000004);
-	setPresetParameter(preset->presetParameters, controlID::wseq6DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq6DetuneCents, -7.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7DetuneCents, 12.500000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8DetuneCents, -26.500000);
-	setPresetParameter(preset->presetParameters, controlID::LFO_SW, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::EG_SW, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::FILTER_SW, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::MAIN_SW, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::soloWaveLane, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::runStopWS, -0.000000);
-	addPreset(preset);
+	preset = presetCatalog.addPreset("UnderTheBed2");
+	presetCatalog.setPresetParameter(preset, controlID::lfo1Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_waveform, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_mode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_frequency_Hz, 0.406415);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_outputAmplitude, 0.925000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_quantize, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_attackTime_mSec, 25.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_decayTime_mSec, 300.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_sustainLevel, 0.707000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_releaseTime_mSec, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGCore, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1Algorithm, 4.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobB, 0.270000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobC, 0.790000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobD, 0.705000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_fc, 435.274994);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_Q, 8.110001);
+	presetCatalog.setPresetParameter(preset, controlID::filter1Output_dB, -6.000000);
+	presetCatalog.setPresetParameter(preset, controlID::enableFilter1KeyTrack, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGCore, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_attackTime_mSec, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_decayTime_mSec, 300.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_sustainLevel, 0.707000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_releaseTime_mSec, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_waveform, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_mode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_frequency_Hz, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_outputAmplitude, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_quantize, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGCore, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_attackTime_mSec, 8250.017578);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_decayTime_mSec, 10000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_sustainLevel, 0.375000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_releaseTime_mSec, 10000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobA, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2Algorithm, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_fc, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_Q, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::enableFilter2KeyTrack, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2Output_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::globalVolume_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::globalTuning, -0.360000);
+	presetCatalog.setPresetParameter(preset, controlID::globalUnisonDetune_Cents, 5.000000);
+	presetCatalog.setPresetParameter(preset, controlID::globalPitchBendSens, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::synthMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::glideTime_mSec, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1StepLenIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1XFadeLenIndex, 12.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1Pitch_semi, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1PitchProb_pct, 74.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1ModValue, -0.640000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1WaveIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2StepLenIndex, 10.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2XFadeLenIndex, 16.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2WaveIndex, 15.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2Pitch_semi, -2.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2PitchProb_pct, 16.000002);
+	presetCatalog.setPresetParameter(preset, controlID::ws2ModValue, -0.600000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3StepLenIndex, 12.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3XFadeLenIndex, 11.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3WaveIndex, 23.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3Pitch_semi, -6.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3PitchProb_pct, 75.500000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3ModValue, -0.300000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4StepLenIndex, 10.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4XFadeLenIndex, 11.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4WaveIndex, 7.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4Pitch_semi, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4PitchProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4ModValue, 0.180000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5StepLenIndex, 11.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5XFadeLenIndex, 5.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5WaveIndex, 35.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5Pitch_semi, 11.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5PitchProb_pct, 38.000004);
+	presetCatalog.setPresetParameter(preset, controlID::ws5ModValue, 0.590000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6StepLenIndex, 6.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6XFadeLenIndex, 12.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6WaveIndex, 29.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6Pitch_semi, -9.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6PitchProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6ModValue, 0.710000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7StepLenIndex, 7.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7XFadeLenIndex, 7.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7WaveIndex, 34.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7Pitch_semi, 12.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7PitchProb_pct, 78.500000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7ModValue, -0.800000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8StepLenIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8XFadeLenIndex, 7.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8WaveIndex, 16.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8Pitch_semi, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8PitchProb_pct, 29.500002);
+	presetCatalog.setPresetParameter(preset, controlID::ws8ModValue, 0.390000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::timingStartIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::timingEndIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::timingLoopDir, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveStartIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveEndIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveLoopDir, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::pitchStartIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::pitchEndIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::pitchLoopDir, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::stepSeqModStartIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::stepSeqModEndIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::stepSeqModLoopDir, 2.000000);
+	presetCatalog.setPresetParameter(preset, controlID::timeStretch, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step1Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step2Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step3Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step4Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step5Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step6Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step7Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step8Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::interpolateStepSeqMod, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::randomizeStepOrder, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::randomizePitchOrder, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterModeIndex, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::enableDelayFX, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::leftDelay_mSec, 760.000000);
+	presetCatalog.setPresetParameter(preset, controlID::rightDelay_mSec, 500.000000);
+	presetCatalog.setPresetParameter(preset, controlID::feedback_Pct, 20.000000);
+	presetCatalog.setPresetParameter(preset, controlID::dryLevel_dB, 1.200001);
+	presetCatalog.setPresetParameter(preset, controlID::wetLevel_dB, -2.399998);
+	presetCatalog.setPresetParameter(preset, controlID::randomizeWaveOrder, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::randomizeSSModOrder, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_fo_Int, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc_fo_Int, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc_UniqueInt, 0.720000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGTrigInt, 0.700000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGTrigInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_fc_Int, 0.480000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_fc_Int, 0.490000);
+	presetCatalog.setPresetParameter(preset, controlID::dcaPanInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGTrigInt, 0.050000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1SourceInt, 0.690000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_filter1_fc, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_filter2_fc, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2SourceInt, 0.610000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGSourceInt, 0.600000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_filter1_fc, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_filter2_fc, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGSourceInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGBiasedSourceInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqModSourceInt, 0.730000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_osc_fo, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_oscUnique, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGIntensity, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1_panValue, -0.540000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2_panValue, 0.360000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3_panValue, -0.690000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4_panValue, -0.770000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5_panValue, 0.530000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6_panValue, 0.290000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7_panValue, 0.330000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8_panValue, -0.600000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2HardSync, 0.120000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3HardSync, 0.050000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8HardSync, 0.150000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1DetuneCents, 31.500000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2DetuneCents, -44.500000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3DetuneCents, 19.500008);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4DetuneCents, -11.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5DetuneCents, -3.000004);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6DetuneCents, -7.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7DetuneCents, 12.500000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8DetuneCents, -26.500000);
+	presetCatalog.setPresetParameter(preset, controlID::LFO_SW, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::EG_SW, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::FILTER_SW, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::MAIN_SW, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::soloWaveLane, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::runStopWS, -0.000000);
 
 	// --- Preset: UnderTheBedSLO
-	preset = new PresetInfo(index++, "UnderTheBedSLO");
-	initPresetParameters(preset->presetParameters);
-	setPresetParameter(preset->presetParameters, controlID::lfo1Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_waveform, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_mode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_frequency_Hz, 0.406415);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_outputAmplitude, 0.225000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_quantize, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_attackTime_mSec, 25.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_decayTime_mSec, 300.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_sustainLevel, 0.707000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_releaseTime_mSec, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGCore, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1Algorithm, 4.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobB, 0.270000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobC, 0.790000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobD, 0.705000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_fc, 435.274994);
-	setPresetParameter(preset->presetParameters, controlID::filter1_Q, 8.110001);
-	setPresetParameter(preset->presetParameters, controlID::filter1Output_dB, -4.700005);
-	setPresetParameter(preset->presetParameters, controlID::enableFilter1KeyTrack, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGCore, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_attackTime_mSec, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_decayTime_mSec, 300.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_sustainLevel, 0.707000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_releaseTime_mSec, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_waveform, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_mode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_frequency_Hz, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_outputAmplitude, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_quantize, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGCore, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_attackTime_mSec, 8250.017578);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_decayTime_mSec, 10000.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_sustainLevel, 0.375000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_releaseTime_mSec, 10000.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobA, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2Algorithm, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_fc, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_Q, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::enableFilter2KeyTrack, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2Output_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::globalVolume_dB, 9.000000);
-	setPresetParameter(preset->presetParameters, controlID::globalTuning, -0.360000);
-	setPresetParameter(preset->presetParameters, controlID::globalUnisonDetune_Cents, 5.000000);
-	setPresetParameter(preset->presetParameters, controlID::globalPitchBendSens, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::synthMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::glideTime_mSec, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1StepLenIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1XFadeLenIndex, 12.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1Pitch_semi, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1PitchProb_pct, 74.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1ModValue, -0.640000);
-	setPresetParameter(preset->presetParameters, controlID::ws1ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1WaveIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2StepLenIndex, 10.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2XFadeLenIndex, 16.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2WaveIndex, 3.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2Pitch_semi, -2.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2PitchProb_pct, 16.000002);
-	setPresetParameter(preset->presetParameters, controlID::ws2ModValue, -0.600000);
-	setPresetParameter(preset->presetParameters, controlID::ws2ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3StepLenIndex, 12.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3XFadeLenIndex, 11.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3WaveIndex, 23.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3Pitch_semi, -6.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3PitchProb_pct, 75.500000);
-	setPresetParameter(preset->presetParameters, controlID::ws3ModValue, -0.300000);
-	setPresetParameter(preset->presetParameters, controlID::ws3ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4StepLenIndex, 10.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4XFadeLenIndex, 11.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4WaveIndex, 7.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4Pitch_semi, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4PitchProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4ModValue, 0.180000);
-	setPresetParameter(preset->presetParameters, controlID::ws4ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5StepLenIndex, 11.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5XFadeLenIndex, 5.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5WaveIndex, 35.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5Pitch_semi, 11.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5PitchProb_pct, 38.000004);
-	setPresetParameter(preset->presetParameters, controlID::ws5ModValue, 0.590000);
-	setPresetParameter(preset->presetParameters, controlID::ws5ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6StepLenIndex, 6.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6XFadeLenIndex, 12.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6WaveIndex, 29.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6Pitch_semi, -9.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6PitchProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6ModValue, 0.710000);
-	setPresetParameter(preset->presetParameters, controlID::ws6ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7StepLenIndex, 7.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7XFadeLenIndex, 7.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7WaveIndex, 19.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7Pitch_semi, 12.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7PitchProb_pct, 78.500000);
-	setPresetParameter(preset->presetParameters, controlID::ws7ModValue, -0.800000);
-	setPresetParameter(preset->presetParameters, controlID::ws7ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8StepLenIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8XFadeLenIndex, 7.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8WaveIndex, 16.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8Pitch_semi, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8PitchProb_pct, 29.500002);
-	setPresetParameter(preset->presetParameters, controlID::ws8ModValue, 0.390000);
-	setPresetParameter(preset->presetParameters, controlID::ws8ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::timingStartIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::timingEndIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::timingLoopDir, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveStartIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveEndIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveLoopDir, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::pitchStartIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::pitchEndIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::pitchLoopDir, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::stepSeqModStartIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::stepSeqModEndIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::stepSeqModLoopDir, 2.000000);
-	setPresetParameter(preset->presetParameters, controlID::timeStretch, 5.000000);
-	setPresetParameter(preset->presetParameters, controlID::step1Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step2Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step3Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step4Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step5Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step6Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step7Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step8Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::interpolateStepSeqMod, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::randomizeStepOrder, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::randomizePitchOrder, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterModeIndex, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::enableDelayFX, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::leftDelay_mSec, 760.000000);
-	setPresetParameter(preset->presetParameters, controlID::rightDelay_mSec, 500.000000);
-	setPresetParameter(preset->presetParameters, controlID::feedback_Pct, 20.000000);
-	setPresetParameter(preset->presetParameters, controlID::dryLevel_dB, 1.200001);
-	setPresetParameter(preset->presetParameters, controlID::wetLevel_dB, -2.399998);
-	setPresetParameter(preset->presetParameters, controlID::randomizeWaveOrder, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::randomizeSSModOrder, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_fo_Int, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc_fo_Int, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc_UniqueInt, 0.720000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGTrigInt, 0.700000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGTrigInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_fc_Int, 0.480000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_fc_Int, 0.490000);
-	setPresetParameter(preset->presetParameters, controlID::dcaPanInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGTrigInt, 0.050000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1SourceInt, 0.690000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_filter1_fc, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_filter2_fc, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2SourceInt, 0.610000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGSourceInt, 0.600000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_filter1_fc, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_filter2_fc, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGSourceInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGBiasedSourceInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqModSourceInt, 0.730000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_osc_fo, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_oscUnique, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGIntensity, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1_panValue, -0.540000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2_panValue, 0.360000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3_panValue, -0.690000);
-	setPresetParameter(preset->presetParameters, controlID::wseq4_panValue, -0.770000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5_panValue, 0.530000);
-	setPresetParameter(preset->presetParameters, controlID::wseq6_panValue, 0.290000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7_panValue, 0.330000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8_panValue, -0.600000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2HardSync, 0.120000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3HardSync, 0.050000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq4HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq4Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq6HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq6Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8HardSync, 0.150000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1DetuneCents, 31.500000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2DetuneCents, -44.500000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3DetuneCents, 19.500008);
-	setPresetParameter(preset->presetParameters, controlID::wseq4DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq4DetuneCents, -11.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5DetuneCents, -3.000004);
-	setPresetParameter(preset->presetParameters, controlID::wseq6DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq6DetuneCents, -7.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7DetuneCents, 12.500000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8DetuneCents, -26.500000);
-	setPresetParameter(preset->presetParameters, controlID::LFO_SW, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::EG_SW, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::FILTER_SW, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::MAIN_SW, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::soloWaveLane, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::runStopWS, -0.000000);
-	addPreset(preset);
+	preset = presetCatalog.addPreset("UnderTheBedSLO");
+	presetCatalog.setPresetParameter(preset, controlID::lfo1Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_waveform, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_mode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_frequency_Hz, 0.406415);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_outputAmplitude, 0.225000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_quantize, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_attackTime_mSec, 25.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_decayTime_mSec, 300.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_sustainLevel, 0.707000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_releaseTime_mSec, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGCore, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1Algorithm, 4.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobB, 0.270000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobC, 0.790000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobD, 0.705000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_fc, 435.274994);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_Q, 8.110001);
+	presetCatalog.setPresetParameter(preset, controlID::filter1Output_dB, -4.700005);
+	presetCatalog.setPresetParameter(preset, controlID::enableFilter1KeyTrack, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGCore, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_attackTime_mSec, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_decayTime_mSec, 300.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_sustainLevel, 0.707000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_releaseTime_mSec, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_waveform, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_mode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_frequency_Hz, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_outputAmplitude, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_quantize, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGCore, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_attackTime_mSec, 8250.017578);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_decayTime_mSec, 10000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_sustainLevel, 0.375000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_releaseTime_mSec, 10000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobA, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2Algorithm, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_fc, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_Q, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::enableFilter2KeyTrack, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2Output_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::globalVolume_dB, 9.000000);
+	presetCatalog.setPresetParameter(preset, controlID::globalTuning, -0.360000);
+	presetCatalog.setPresetParameter(preset, controlID::globalUnisonDetune_Cents, 5.000000);
+	presetCatalog.setPresetParameter(preset, controlID::globalPitchBendSens, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::synthMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::glideTime_mSec, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1StepLenIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1XFadeLenIndex, 12.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1Pitch_semi, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1PitchProb_pct, 74.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1ModValue, -0.640000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1WaveIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2StepLenIndex, 10.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2XFadeLenIndex, 16.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2WaveIndex, 3.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2Pitch_semi, -2.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2PitchProb_pct, 16.000002);
+	presetCatalog.setPresetParameter(preset, controlID::ws2ModValue, -0.600000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3StepLenIndex, 12.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3XFadeLenIndex, 11.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3WaveIndex, 23.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3Pitch_semi, -6.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3PitchProb_pct, 75.500000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3ModValue, -0.300000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4StepLenIndex, 10.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4XFadeLenIndex, 11.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4WaveIndex, 7.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4Pitch_semi, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4PitchProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4ModValue, 0.180000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5StepLenIndex, 11.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5XFadeLenIndex, 5.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5WaveIndex, 35.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5Pitch_semi, 11.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5PitchProb_pct, 38.000004);
+	presetCatalog.setPresetParameter(preset, controlID::ws5ModValue, 0.590000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6StepLenIndex, 6.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6XFadeLenIndex, 12.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6WaveIndex, 29.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6Pitch_semi, -9.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6PitchProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6ModValue, 0.710000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7StepLenIndex, 7.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7XFadeLenIndex, 7.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7WaveIndex, 19.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7Pitch_semi, 12.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7PitchProb_pct, 78.500000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7ModValue, -0.800000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8StepLenIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8XFadeLenIndex, 7.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8WaveIndex, 16.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8Pitch_semi, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8PitchProb_pct, 29.500002);
+	presetCatalog.setPresetParameter(preset, controlID::ws8ModValue, 0.390000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::timingStartIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::timingEndIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::timingLoopDir, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveStartIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveEndIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveLoopDir, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::pitchStartIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::pitchEndIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::pitchLoopDir, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::stepSeqModStartIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::stepSeqModEndIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::stepSeqModLoopDir, 2.000000);
+	presetCatalog.setPresetParameter(preset, controlID::timeStretch, 5.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step1Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step2Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step3Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step4Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step5Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step6Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step7Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step8Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::interpolateStepSeqMod, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::randomizeStepOrder, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::randomizePitchOrder, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterModeIndex, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::enableDelayFX, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::leftDelay_mSec, 760.000000);
+	presetCatalog.setPresetParameter(preset, controlID::rightDelay_mSec, 500.000000);
+	presetCatalog.setPresetParameter(preset, controlID::feedback_Pct, 20.000000);
+	presetCatalog.setPresetParameter(preset, controlID::dryLevel_dB, 1.200001);
+	presetCatalog.setPresetParameter(preset, controlID::wetLevel_dB, -2.399998);
+	presetCatalog.setPresetParameter(preset, controlID::randomizeWaveOrder, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::randomizeSSModOrder, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_fo_Int, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc_fo_Int, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc_UniqueInt, 0.720000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGTrigInt, 0.700000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGTrigInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_fc_Int, 0.480000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_fc_Int, 0.490000);
+	presetCatalog.setPresetParameter(preset, controlID::dcaPanInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGTrigInt, 0.050000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1SourceInt, 0.690000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_filter1_fc, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_filter2_fc, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2SourceInt, 0.610000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGSourceInt, 0.600000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_filter1_fc, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_filter2_fc, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGSourceInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGBiasedSourceInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqModSourceInt, 0.730000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_osc_fo, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_oscUnique, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGIntensity, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1_panValue, -0.540000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2_panValue, 0.360000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3_panValue, -0.690000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4_panValue, -0.770000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5_panValue, 0.530000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6_panValue, 0.290000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7_panValue, 0.330000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8_panValue, -0.600000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2HardSync, 0.120000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3HardSync, 0.050000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8HardSync, 0.150000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1DetuneCents, 31.500000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2DetuneCents, -44.500000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3DetuneCents, 19.500008);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4DetuneCents, -11.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5DetuneCents, -3.000004);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6DetuneCents, -7.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7DetuneCents, 12.500000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8DetuneCents, -26.500000);
+	presetCatalog.setPresetParameter(preset, controlID::LFO_SW, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::EG_SW, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::FILTER_SW, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::MAIN_SW, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::soloWaveLane, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::runStopWS, -0.000000);
 
 	// --- Preset: JazzFH_SLO1
-	preset = new PresetInfo(index++, "JazzFH_SLO1");
-	initPresetParameters(preset->presetParameters);
-	setPresetParameter(preset->presetParameters, controlID::lfo1Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_waveform, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_mode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_frequency_Hz, 0.406415);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_outputAmplitude, 0.825000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_quantize, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_attackTime_mSec, 25.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_decayTime_mSec, 300.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_sustainLevel, 0.707000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_releaseTime_mSec, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGCore, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1Algorithm, 4.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobB, 0.270000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobC, 0.790000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobD, 0.705000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_fc, 435.274994);
-	setPresetParameter(preset->presetParameters, controlID::filter1_Q, 8.110001);
-	setPresetParameter(preset->presetParameters, controlID::filter1Output_dB, -6.000000);
-	setPresetParameter(preset->presetParameters, controlID::enableFilter1KeyTrack, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGCore, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_attackTime_mSec, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_decayTime_mSec, 300.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_sustainLevel, 0.707000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_releaseTime_mSec, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_waveform, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_mode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_frequency_Hz, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_outputAmplitude, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_quantize, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGCore, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_attackTime_mSec, 8250.017578);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_decayTime_mSec, 10000.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_sustainLevel, 0.375000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_releaseTime_mSec, 10000.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobA, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2Algorithm, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_fc, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_Q, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::enableFilter2KeyTrack, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2Output_dB, -36.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::globalVolume_dB, 6.479996);
-	setPresetParameter(preset->presetParameters, controlID::globalTuning, -0.360000);
-	setPresetParameter(preset->presetParameters, controlID::globalUnisonDetune_Cents, 5.000000);
-	setPresetParameter(preset->presetParameters, controlID::globalPitchBendSens, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::synthMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::glideTime_mSec, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1WaveAmp_dB, 0.359997);
-	setPresetParameter(preset->presetParameters, controlID::ws1StepLenIndex, 14.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1XFadeLenIndex, 13.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1Pitch_semi, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1PitchProb_pct, 74.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1ModValue, -0.640000);
-	setPresetParameter(preset->presetParameters, controlID::ws1ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1WaveIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2StepLenIndex, 16.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2XFadeLenIndex, 12.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2WaveIndex, 4.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2Pitch_semi, -2.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2PitchProb_pct, 16.000002);
-	setPresetParameter(preset->presetParameters, controlID::ws2ModValue, -0.600000);
-	setPresetParameter(preset->presetParameters, controlID::ws2ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3StepLenIndex, 14.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3XFadeLenIndex, 13.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3WaveIndex, 19.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3Pitch_semi, -6.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3PitchProb_pct, 75.500000);
-	setPresetParameter(preset->presetParameters, controlID::ws3ModValue, -0.300000);
-	setPresetParameter(preset->presetParameters, controlID::ws3ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4StepLenIndex, 15.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4XFadeLenIndex, 14.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4WaveIndex, 7.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4Pitch_semi, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4PitchProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4ModValue, 0.180000);
-	setPresetParameter(preset->presetParameters, controlID::ws4ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5StepLenIndex, 14.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5XFadeLenIndex, 4.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5WaveIndex, 7.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5Pitch_semi, 11.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5PitchProb_pct, 38.000004);
-	setPresetParameter(preset->presetParameters, controlID::ws5ModValue, 0.590000);
-	setPresetParameter(preset->presetParameters, controlID::ws5ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6StepLenIndex, 14.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6XFadeLenIndex, 9.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6WaveIndex, 20.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6Pitch_semi, -9.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6PitchProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6ModValue, 0.710000);
-	setPresetParameter(preset->presetParameters, controlID::ws6ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7StepLenIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7XFadeLenIndex, 7.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7WaveIndex, 24.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7Pitch_semi, 12.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7PitchProb_pct, 78.500000);
-	setPresetParameter(preset->presetParameters, controlID::ws7ModValue, -0.800000);
-	setPresetParameter(preset->presetParameters, controlID::ws7ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8StepLenIndex, 10.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8XFadeLenIndex, 7.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8WaveIndex, 25.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8Pitch_semi, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8PitchProb_pct, 82.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8ModValue, 0.390000);
-	setPresetParameter(preset->presetParameters, controlID::ws8ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::timingStartIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::timingEndIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::timingLoopDir, 2.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveStartIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveEndIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveLoopDir, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::pitchStartIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::pitchEndIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::pitchLoopDir, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::stepSeqModStartIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::stepSeqModEndIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::stepSeqModLoopDir, 2.000000);
-	setPresetParameter(preset->presetParameters, controlID::timeStretch, 4.000000);
-	setPresetParameter(preset->presetParameters, controlID::step1Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step2Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step3Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step4Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step5Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step6Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step7Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step8Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::interpolateStepSeqMod, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::randomizeStepOrder, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::randomizePitchOrder, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterModeIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::enableDelayFX, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::leftDelay_mSec, 760.000000);
-	setPresetParameter(preset->presetParameters, controlID::rightDelay_mSec, 280.000000);
-	setPresetParameter(preset->presetParameters, controlID::feedback_Pct, 66.000000);
-	setPresetParameter(preset->presetParameters, controlID::dryLevel_dB, -0.959999);
-	setPresetParameter(preset->presetParameters, controlID::wetLevel_dB, -11.400002);
-	setPresetParameter(preset->presetParameters, controlID::randomizeWaveOrder, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::randomizeSSModOrder, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_fo_Int, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc_fo_Int, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc_UniqueInt, 0.720000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGTrigInt, 0.700000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGTrigInt, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_fc_Int, -0.350000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_fc_Int, 0.470000);
-	setPresetParameter(preset->presetParameters, controlID::dcaPanInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGTrigInt, 0.050000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1SourceInt, 0.690000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_auxEGTrig, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_filter1_fc, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_filter2_fc, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2SourceInt, 0.610000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGSourceInt, 0.600000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_filter1_fc, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_filter2_fc, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGSourceInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGBiasedSourceInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqModSourceInt, 0.730000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_osc_fo, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGIntensity, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1_panValue, -0.080000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2_panValue, 0.230000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3_panValue, -0.140000);
-	setPresetParameter(preset->presetParameters, controlID::wseq4_panValue, -0.140000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5_panValue, 0.370000);
-	setPresetParameter(preset->presetParameters, controlID::wseq6_panValue, 0.050000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7_panValue, -0.130000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8_panValue, 0.250000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1HardSync, 0.245000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2HardSync, 0.120000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3HardSync, 0.050000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq4HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq4Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq6HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq6Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8HardSync, 0.150000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1DetuneSemis, -3.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1DetuneCents, 31.500000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2DetuneSemis, 7.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2DetuneCents, -37.500000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3DetuneSemis, 3.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3DetuneCents, 19.500008);
-	setPresetParameter(preset->presetParameters, controlID::wseq4DetuneSemis, -5.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq4DetuneCents, 26.500000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5DetuneCents, -18.500004);
-	setPresetParameter(preset->presetParameters, controlID::wseq6DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq6DetuneCents, -16.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7DetuneSemis, 7.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7DetuneCents, 29.500000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8DetuneSemis, 5.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8DetuneCents, -26.500000);
-	setPresetParameter(preset->presetParameters, controlID::LFO_SW, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::EG_SW, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::FILTER_SW, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::MAIN_SW, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::soloWaveLane, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::runStopWS, -0.000000);
-	addPreset(preset);
+	preset = presetCatalog.addPreset("JazzFH_SLO1");
+	presetCatalog.setPresetParameter(preset, controlID::lfo1Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_waveform, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_mode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_frequency_Hz, 0.406415);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_outputAmplitude, 0.825000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_quantize, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_attackTime_mSec, 25.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_decayTime_mSec, 300.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_sustainLevel, 0.707000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_releaseTime_mSec, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGCore, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1Algorithm, 4.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobB, 0.270000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobC, 0.790000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobD, 0.705000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_fc, 435.274994);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_Q, 8.110001);
+	presetCatalog.setPresetParameter(preset, controlID::filter1Output_dB, -6.000000);
+	presetCatalog.setPresetParameter(preset, controlID::enableFilter1KeyTrack, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGCore, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_attackTime_mSec, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_decayTime_mSec, 300.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_sustainLevel, 0.707000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_releaseTime_mSec, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_waveform, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_mode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_frequency_Hz, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_outputAmplitude, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_quantize, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGCore, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_attackTime_mSec, 8250.017578);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_decayTime_mSec, 10000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_sustainLevel, 0.375000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_releaseTime_mSec, 10000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobA, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2Algorithm, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_fc, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_Q, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::enableFilter2KeyTrack, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2Output_dB, -36.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::globalVolume_dB, 6.479996);
+	presetCatalog.setPresetParameter(preset, controlID::globalTuning, -0.360000);
+	presetCatalog.setPresetParameter(preset, controlID::globalUnisonDetune_Cents, 5.000000);
+	presetCatalog.setPresetParameter(preset, controlID::globalPitchBendSens, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::synthMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::glideTime_mSec, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1WaveAmp_dB, 0.359997);
+	presetCatalog.setPresetParameter(preset, controlID::ws1StepLenIndex, 14.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1XFadeLenIndex, 13.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1Pitch_semi, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1PitchProb_pct, 74.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1ModValue, -0.640000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1WaveIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2StepLenIndex, 16.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2XFadeLenIndex, 12.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2WaveIndex, 4.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2Pitch_semi, -2.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2PitchProb_pct, 16.000002);
+	presetCatalog.setPresetParameter(preset, controlID::ws2ModValue, -0.600000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3StepLenIndex, 14.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3XFadeLenIndex, 13.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3WaveIndex, 19.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3Pitch_semi, -6.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3PitchProb_pct, 75.500000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3ModValue, -0.300000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4StepLenIndex, 15.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4XFadeLenIndex, 14.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4WaveIndex, 7.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4Pitch_semi, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4PitchProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4ModValue, 0.180000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5StepLenIndex, 14.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5XFadeLenIndex, 4.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5WaveIndex, 7.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5Pitch_semi, 11.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5PitchProb_pct, 38.000004);
+	presetCatalog.setPresetParameter(preset, controlID::ws5ModValue, 0.590000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6StepLenIndex, 14.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6XFadeLenIndex, 9.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6WaveIndex, 20.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6Pitch_semi, -9.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6PitchProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6ModValue, 0.710000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7StepLenIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7XFadeLenIndex, 7.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7WaveIndex, 24.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7Pitch_semi, 12.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7PitchProb_pct, 78.500000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7ModValue, -0.800000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8StepLenIndex, 10.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8XFadeLenIndex, 7.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8WaveIndex, 25.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8Pitch_semi, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8PitchProb_pct, 82.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8ModValue, 0.390000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::timingStartIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::timingEndIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::timingLoopDir, 2.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveStartIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveEndIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveLoopDir, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::pitchStartIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::pitchEndIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::pitchLoopDir, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::stepSeqModStartIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::stepSeqModEndIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::stepSeqModLoopDir, 2.000000);
+	presetCatalog.setPresetParameter(preset, controlID::timeStretch, 4.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step1Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step2Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step3Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step4Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step5Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step6Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step7Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step8Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::interpolateStepSeqMod, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::randomizeStepOrder, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::randomizePitchOrder, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterModeIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::enableDelayFX, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::leftDelay_mSec, 760.000000);
+	presetCatalog.setPresetParameter(preset, controlID::rightDelay_mSec, 280.000000);
+	presetCatalog.setPresetParameter(preset, controlID::feedback_Pct, 66.000000);
+	presetCatalog.setPresetParameter(preset, controlID::dryLevel_dB, -0.959999);
+	presetCatalog.setPresetParameter(preset, controlID::wetLevel_dB, -11.400002);
+	presetCatalog.setPresetParameter(preset, controlID::randomizeWaveOrder, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::randomizeSSModOrder, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_fo_Int, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc_fo_Int, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc_UniqueInt, 0.720000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGTrigInt, 0.700000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGTrigInt, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_fc_Int, -0.350000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_fc_Int, 0.470000);
+	presetCatalog.setPresetParameter(preset, controlID::dcaPanInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGTrigInt, 0.050000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1SourceInt, 0.690000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_auxEGTrig, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_filter1_fc, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_filter2_fc, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2SourceInt, 0.610000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGSourceInt, 0.600000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_filter1_fc, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_filter2_fc, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGSourceInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGBiasedSourceInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqModSourceInt, 0.730000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_osc_fo, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGIntensity, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1_panValue, -0.080000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2_panValue, 0.230000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3_panValue, -0.140000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4_panValue, -0.140000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5_panValue, 0.370000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6_panValue, 0.050000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7_panValue, -0.130000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8_panValue, 0.250000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1HardSync, 0.245000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2HardSync, 0.120000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3HardSync, 0.050000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8HardSync, 0.150000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1DetuneSemis, -3.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1DetuneCents, 31.500000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2DetuneSemis, 7.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2DetuneCents, -37.500000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3DetuneSemis, 3.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3DetuneCents, 19.500008);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4DetuneSemis, -5.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4DetuneCents, 26.500000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5DetuneCents, -18.500004);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6DetuneCents, -16.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7DetuneSemis, 7.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7DetuneCents, 29.500000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8DetuneSemis, 5.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8DetuneCents, -26.500000);
+	presetCatalog.setPresetParameter(preset, controlID::LFO_SW, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::EG_SW, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::FILTER_SW, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::MAIN_SW, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::soloWaveLane, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::runStopWS, -0.000000);
 
 	// --- Preset: JazzFH_F1
-	preset = new PresetInfo(index++, "JazzFH_F1");
-	initPresetParameters(preset->presetParameters);
-	setPresetParameter(preset->presetParameters, controlID::lfo1Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_waveform, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_mode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_frequency_Hz, 0.406415);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_outputAmplitude, 0.825000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_quantize, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_attackTime_mSec, 25.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_decayTime_mSec, 300.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_sustainLevel, 0.707000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_releaseTime_mSec, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGCore, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1Algorithm, 4.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobB, 0.270000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobC, 0.790000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobD, 0.705000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_fc, 435.274994);
-	setPresetParameter(preset->presetParameters, controlID::filter1_Q, 8.110001);
-	setPresetParameter(preset->presetParameters, controlID::filter1Output_dB, -6.000000);
-	setPresetParameter(preset->presetParameters, controlID::enableFilter1KeyTrack, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGCore, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_attackTime_mSec, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_decayTime_mSec, 300.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_sustainLevel, 0.707000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_releaseTime_mSec, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_waveform, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_mode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_frequency_Hz, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_outputAmplitude, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_quantize, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGCore, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_attackTime_mSec, 8250.017578);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_decayTime_mSec, 10000.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_sustainLevel, 0.375000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_releaseTime_mSec, 10000.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobA, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2Algorithm, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_fc, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_Q, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::enableFilter2KeyTrack, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2Output_dB, -36.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::globalVolume_dB, 6.479996);
-	setPresetParameter(preset->presetParameters, controlID::globalTuning, -0.360000);
-	setPresetParameter(preset->presetParameters, controlID::globalUnisonDetune_Cents, 5.000000);
-	setPresetParameter(preset->presetParameters, controlID::globalPitchBendSens, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::synthMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::glideTime_mSec, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1WaveAmp_dB, 0.359997);
-	setPresetParameter(preset->presetParameters, controlID::ws1StepLenIndex, 14.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1XFadeLenIndex, 13.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1Pitch_semi, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1PitchProb_pct, 74.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1ModValue, -0.640000);
-	setPresetParameter(preset->presetParameters, controlID::ws1ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1WaveIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2StepLenIndex, 16.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2XFadeLenIndex, 12.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2WaveIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2Pitch_semi, -2.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2PitchProb_pct, 33.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2ModValue, -0.600000);
-	setPresetParameter(preset->presetParameters, controlID::ws2ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3StepLenIndex, 14.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3XFadeLenIndex, 13.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3WaveIndex, 19.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3Pitch_semi, -6.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3PitchProb_pct, 75.500000);
-	setPresetParameter(preset->presetParameters, controlID::ws3ModValue, -0.300000);
-	setPresetParameter(preset->presetParameters, controlID::ws3ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4StepLenIndex, 15.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4XFadeLenIndex, 14.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4WaveIndex, 7.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4Pitch_semi, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4PitchProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4ModValue, 0.180000);
-	setPresetParameter(preset->presetParameters, controlID::ws4ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5StepLenIndex, 14.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5XFadeLenIndex, 4.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5WaveIndex, 7.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5Pitch_semi, 11.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5PitchProb_pct, 38.000004);
-	setPresetParameter(preset->presetParameters, controlID::ws5ModValue, 0.590000);
-	setPresetParameter(preset->presetParameters, controlID::ws5ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6StepLenIndex, 14.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6XFadeLenIndex, 9.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6WaveIndex, 20.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6Pitch_semi, -9.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6PitchProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6ModValue, 0.710000);
-	setPresetParameter(preset->presetParameters, controlID::ws6ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7StepLenIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7XFadeLenIndex, 7.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7WaveIndex, 24.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7Pitch_semi, 12.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7PitchProb_pct, 78.500000);
-	setPresetParameter(preset->presetParameters, controlID::ws7ModValue, -0.800000);
-	setPresetParameter(preset->presetParameters, controlID::ws7ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8StepLenIndex, 10.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8XFadeLenIndex, 7.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8WaveIndex, 25.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8Pitch_semi, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8PitchProb_pct, 82.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8ModValue, 0.390000);
-	setPresetParameter(preset->presetParameters, controlID::ws8ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::timingStartIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::timingEndIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::timingLoopDir, 2.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveStartIndex, 2.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveEndIndex, 6.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveLoopDir, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::pitchStartIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::pitchEndIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::pitchLoopDir, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::stepSeqModStartIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::stepSeqModEndIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::stepSeqModLoopDir, 2.000000);
-	setPresetParameter(preset->presetParameters, controlID::timeStretch, -2.300000);
-	setPresetParameter(preset->presetParameters, controlID::step1Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step2Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step3Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step4Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step5Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step6Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step7Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step8Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::interpolateStepSeqMod, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::randomizeStepOrder, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::randomizePitchOrder, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterModeIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::enableDelayFX, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::leftDelay_mSec, 1280.000000);
-	setPresetParameter(preset->presetParameters, controlID::rightDelay_mSec, 1510.000000);
-	setPresetParameter(preset->presetParameters, controlID::feedback_Pct, 44.000008);
-	setPresetParameter(preset->presetParameters, controlID::dryLevel_dB, -0.599998);
-	setPresetParameter(preset->presetParameters, controlID::wetLevel_dB, 1.559998);
-	setPresetParameter(preset->presetParameters, controlID::randomizeWaveOrder, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::randomizeSSModOrder, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_fo_Int, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc_fo_Int, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc_UniqueInt, 0.720000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGTrigInt, 0.700000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGTrigInt, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_fc_Int, -0.350000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_fc_Int, 0.470000);
-	setPresetParameter(preset->presetParameters, controlID::dcaPanInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGTrigInt, 0.050000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1SourceInt, 0.690000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_auxEGTrig, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_filter1_fc, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_filter2_fc, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2SourceInt, 0.610000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGSourceInt, 0.600000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_filter1_fc, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_filter2_fc, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGSourceInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGBiasedSourceInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqModSourceInt, 0.730000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_osc_fo, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGIntensity, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1_panValue, 0.190000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2_panValue, -0.220000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3_panValue, 0.390000);
-	setPresetParameter(preset->presetParameters, controlID::wseq4_panValue, -0.460000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5_panValue, -0.230000);
-	setPresetParameter(preset->presetParameters, controlID::wseq6_panValue, 0.340000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7_panValue, -0.300000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8_panValue, 0.270000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1HardSync, 0.245000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2HardSync, 0.120000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3HardSync, 0.050000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq4HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq4Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq6HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq6Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8HardSync, 0.150000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1DetuneSemis, -3.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1DetuneCents, 31.500000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2DetuneSemis, 7.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2DetuneCents, -37.500000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3DetuneSemis, 3.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3DetuneCents, 19.500008);
-	setPresetParameter(preset->presetParameters, controlID::wseq4DetuneSemis, -5.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq4DetuneCents, 26.500000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5DetuneCents, -18.500004);
-	setPresetParameter(preset->presetParameters, controlID::wseq6DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq6DetuneCents, -16.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7DetuneSemis, 7.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7DetuneCents, 29.500000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8DetuneSemis, 5.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8DetuneCents, -26.500000);
-	setPresetParameter(preset->presetParameters, controlID::LFO_SW, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::EG_SW, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::FILTER_SW, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::MAIN_SW, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::soloWaveLane, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::runStopWS, -0.000000);
-	addPreset(preset);
+	preset = presetCatalog.addPreset("JazzFH_F1");
+	presetCatalog.setPresetParameter(preset, controlID::lfo1Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_waveform, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_mode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_frequency_Hz, 0.406415);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_outputAmplitude, 0.825000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_quantize, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_attackTime_mSec, 25.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_decayTime_mSec, 300.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_sustainLevel, 0.707000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_releaseTime_mSec, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGCore, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1Algorithm, 4.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobB, 0.270000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobC, 0.790000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobD, 0.705000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_fc, 435.274994);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_Q, 8.110001);
+	presetCatalog.setPresetParameter(preset, controlID::filter1Output_dB, -6.000000);
+	presetCatalog.setPresetParameter(preset, controlID::enableFilter1KeyTrack, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGCore, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_attackTime_mSec, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_decayTime_mSec, 300.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_sustainLevel, 0.707000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_releaseTime_mSec, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_waveform, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_mode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_frequency_Hz, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_outputAmplitude, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_quantize, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGCore, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_attackTime_mSec, 8250.017578);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_decayTime_mSec, 10000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_sustainLevel, 0.375000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_releaseTime_mSec, 10000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobA, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2Algorithm, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_fc, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_Q, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::enableFilter2KeyTrack, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2Output_dB, -36.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::globalVolume_dB, 6.479996);
+	presetCatalog.setPresetParameter(preset, controlID::globalTuning, -0.360000);
+	presetCatalog.setPresetParameter(preset, controlID::globalUnisonDetune_Cents, 5.000000);
+	presetCatalog.setPresetParameter(preset, controlID::globalPitchBendSens, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::synthMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::glideTime_mSec, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1WaveAmp_dB, 0.359997);
+	presetCatalog.setPresetParameter(preset, controlID::ws1StepLenIndex, 14.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1XFadeLenIndex, 13.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1Pitch_semi, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1PitchProb_pct, 74.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1ModValue, -0.640000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1WaveIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2StepLenIndex, 16.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2XFadeLenIndex, 12.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2WaveIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2Pitch_semi, -2.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2PitchProb_pct, 33.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2ModValue, -0.600000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3StepLenIndex, 14.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3XFadeLenIndex, 13.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3WaveIndex, 19.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3Pitch_semi, -6.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3PitchProb_pct, 75.500000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3ModValue, -0.300000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4StepLenIndex, 15.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4XFadeLenIndex, 14.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4WaveIndex, 7.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4Pitch_semi, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4PitchProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4ModValue, 0.180000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5StepLenIndex, 14.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5XFadeLenIndex, 4.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5WaveIndex, 7.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5Pitch_semi, 11.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5PitchProb_pct, 38.000004);
+	presetCatalog.setPresetParameter(preset, controlID::ws5ModValue, 0.590000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6StepLenIndex, 14.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6XFadeLenIndex, 9.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6WaveIndex, 20.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6Pitch_semi, -9.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6PitchProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6ModValue, 0.710000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7StepLenIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7XFadeLenIndex, 7.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7WaveIndex, 24.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7Pitch_semi, 12.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7PitchProb_pct, 78.500000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7ModValue, -0.800000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8StepLenIndex, 10.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8XFadeLenIndex, 7.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8WaveIndex, 25.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8Pitch_semi, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8PitchProb_pct, 82.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8ModValue, 0.390000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::timingStartIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::timingEndIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::timingLoopDir, 2.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveStartIndex, 2.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveEndIndex, 6.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveLoopDir, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::pitchStartIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::pitchEndIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::pitchLoopDir, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::stepSeqModStartIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::stepSeqModEndIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::stepSeqModLoopDir, 2.000000);
+	presetCatalog.setPresetParameter(preset, controlID::timeStretch, -2.300000);
+	presetCatalog.setPresetParameter(preset, controlID::step1Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step2Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step3Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step4Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step5Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step6Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step7Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step8Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::interpolateStepSeqMod, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::randomizeStepOrder, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::randomizePitchOrder, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterModeIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::enableDelayFX, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::leftDelay_mSec, 1280.000000);
+	presetCatalog.setPresetParameter(preset, controlID::rightDelay_mSec, 1510.000000);
+	presetCatalog.setPresetParameter(preset, controlID::feedback_Pct, 44.000008);
+	presetCatalog.setPresetParameter(preset, controlID::dryLevel_dB, -0.599998);
+	presetCatalog.setPresetParameter(preset, controlID::wetLevel_dB, 1.559998);
+	presetCatalog.setPresetParameter(preset, controlID::randomizeWaveOrder, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::randomizeSSModOrder, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_fo_Int, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc_fo_Int, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc_UniqueInt, 0.720000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGTrigInt, 0.700000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGTrigInt, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_fc_Int, -0.350000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_fc_Int, 0.470000);
+	presetCatalog.setPresetParameter(preset, controlID::dcaPanInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGTrigInt, 0.050000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1SourceInt, 0.690000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_auxEGTrig, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_filter1_fc, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_filter2_fc, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2SourceInt, 0.610000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGSourceInt, 0.600000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_filter1_fc, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_filter2_fc, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGSourceInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGBiasedSourceInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqModSourceInt, 0.730000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_osc_fo, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGIntensity, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1_panValue, 0.190000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2_panValue, -0.220000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3_panValue, 0.390000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4_panValue, -0.460000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5_panValue, -0.230000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6_panValue, 0.340000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7_panValue, -0.300000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8_panValue, 0.270000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1HardSync, 0.245000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2HardSync, 0.120000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3HardSync, 0.050000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8HardSync, 0.150000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1DetuneSemis, -3.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1DetuneCents, 31.500000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2DetuneSemis, 7.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2DetuneCents, -37.500000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3DetuneSemis, 3.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3DetuneCents, 19.500008);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4DetuneSemis, -5.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4DetuneCents, 26.500000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5DetuneCents, -18.500004);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6DetuneCents, -16.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7DetuneSemis, 7.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7DetuneCents, 29.500000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8DetuneSemis, 5.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8DetuneCents, -26.500000);
+	presetCatalog.setPresetParameter(preset, controlID::LFO_SW, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::EG_SW, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::FILTER_SW, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::MAIN_SW, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::soloWaveLane, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::runStopWS, -0.000000);
 
 	// --- Preset: ForeverVai
-	preset = new PresetInfo(index++, "ForeverVai");
-	initPresetParameters(preset->presetParameters);
-	setPresetParameter(preset->presetParameters, controlID::lfo1Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_waveform, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_mode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_frequency_Hz, 0.130008);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_outputAmplitude, 0.825000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_quantize, 12.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_attackTime_mSec, 25.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_decayTime_mSec, 300.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_sustainLevel, 0.707000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_releaseTime_mSec, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGCore, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1Algorithm, 4.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobB, 0.270000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobC, 0.790000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobD, 0.705000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_fc, 3999.997314);
-	setPresetParameter(preset->presetParameters, controlID::filter1_Q, 6.715001);
-	setPresetParameter(preset->presetParameters, controlID::filter1Output_dB, -6.000000);
-	setPresetParameter(preset->presetParameters, controlID::enableFilter1KeyTrack, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGCore, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_attackTime_mSec, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_decayTime_mSec, 300.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_sustainLevel, 0.707000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_releaseTime_mSec, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_waveform, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_mode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_frequency_Hz, 0.117211);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_outputAmplitude, 0.775000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_quantize, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGCore, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_attackTime_mSec, 8250.017578);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_decayTime_mSec, 10000.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_sustainLevel, 0.375000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_releaseTime_mSec, 10000.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobA, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2Algorithm, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_fc, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_Q, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::enableFilter2KeyTrack, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2Output_dB, -36.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::globalVolume_dB, 7.919998);
-	setPresetParameter(preset->presetParameters, controlID::globalTuning, -0.360000);
-	setPresetParameter(preset->presetParameters, controlID::globalUnisonDetune_Cents, 5.000000);
-	setPresetParameter(preset->presetParameters, controlID::globalPitchBendSens, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::synthMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::glideTime_mSec, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1WaveAmp_dB, 0.359997);
-	setPresetParameter(preset->presetParameters, controlID::ws1StepLenIndex, 14.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1XFadeLenIndex, 13.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1Pitch_semi, -12.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1PitchProb_pct, 74.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1ModValue, -0.640000);
-	setPresetParameter(preset->presetParameters, controlID::ws1ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1WaveIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2StepLenIndex, 16.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2XFadeLenIndex, 12.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2WaveIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2Pitch_semi, -7.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2PitchProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2ModValue, -0.600000);
-	setPresetParameter(preset->presetParameters, controlID::ws2ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3StepLenIndex, 14.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3XFadeLenIndex, 13.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3WaveIndex, 19.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3Pitch_semi, -4.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3PitchProb_pct, 75.500000);
-	setPresetParameter(preset->presetParameters, controlID::ws3ModValue, -0.300000);
-	setPresetParameter(preset->presetParameters, controlID::ws3ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4StepLenIndex, 15.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4XFadeLenIndex, 14.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4WaveIndex, 7.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4Pitch_semi, 7.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4PitchProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4ModValue, 0.180000);
-	setPresetParameter(preset->presetParameters, controlID::ws4ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5StepLenIndex, 14.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5XFadeLenIndex, 4.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5WaveIndex, 7.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5Pitch_semi, 12.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5PitchProb_pct, 66.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5ModValue, 0.590000);
-	setPresetParameter(preset->presetParameters, controlID::ws5ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6StepLenIndex, 14.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6XFadeLenIndex, 9.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6WaveIndex, 20.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6Pitch_semi, 3.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6PitchProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6ModValue, 0.710000);
-	setPresetParameter(preset->presetParameters, controlID::ws6ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7StepLenIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7XFadeLenIndex, 7.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7WaveIndex, 24.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7Pitch_semi, 4.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7PitchProb_pct, 78.500000);
-	setPresetParameter(preset->presetParameters, controlID::ws7ModValue, -0.800000);
-	setPresetParameter(preset->presetParameters, controlID::ws7ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8StepLenIndex, 10.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8XFadeLenIndex, 7.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8WaveIndex, 25.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8Pitch_semi, -5.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8PitchProb_pct, 82.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8ModValue, 0.390000);
-	setPresetParameter(preset->presetParameters, controlID::ws8ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::timingStartIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::timingEndIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::timingLoopDir, 2.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveStartIndex, 2.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveEndIndex, 6.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveLoopDir, 2.000000);
-	setPresetParameter(preset->presetParameters, controlID::pitchStartIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::pitchEndIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::pitchLoopDir, 2.000000);
-	setPresetParameter(preset->presetParameters, controlID::stepSeqModStartIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::stepSeqModEndIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::stepSeqModLoopDir, 2.000000);
-	setPresetParameter(preset->presetParameters, controlID::timeStretch, -1.000000);
-	setPresetParameter(preset->presetParameters, controlID::step1Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step2Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step3Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step4Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step5Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step6Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step7Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step8Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::interpolateStepSeqMod, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::randomizeStepOrder, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::randomizePitchOrder, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterModeIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::enableDelayFX, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::leftDelay_mSec, 760.000000);
-	setPresetParameter(preset->presetParameters, controlID::rightDelay_mSec, 280.000000);
-	setPresetParameter(preset->presetParameters, controlID::feedback_Pct, 66.000000);
-	setPresetParameter(preset->presetParameters, controlID::dryLevel_dB, 0.840004);
-	setPresetParameter(preset->presetParameters, controlID::wetLevel_dB, -17.880001);
-	setPresetParameter(preset->presetParameters, controlID::randomizeWaveOrder, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::randomizeSSModOrder, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_fo_Int, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc_fo_Int, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc_UniqueInt, 0.720000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGTrigInt, 0.700000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGTrigInt, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_fc_Int, -0.350000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_fc_Int, 0.470000);
-	setPresetParameter(preset->presetParameters, controlID::dcaPanInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGTrigInt, 0.050000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1SourceInt, 0.690000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_osc_fc, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_auxEGTrig, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_filter1_fc, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_filter2_fc, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2SourceInt, 0.610000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGSourceInt, 0.600000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_filter1_fc, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_filter2_fc, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGSourceInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGBiasedSourceInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqModSourceInt, 0.730000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_osc_fo, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGIntensity, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1_panValue, -0.540000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2_panValue, 0.360000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3_panValue, -0.690000);
-	setPresetParameter(preset->presetParameters, controlID::wseq4_panValue, -0.770000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5_panValue, 0.530000);
-	setPresetParameter(preset->presetParameters, controlID::wseq6_panValue, 0.710000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7_panValue, -0.570000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8_panValue, 0.540000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1HardSync, 0.245000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2HardSync, 0.120000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3HardSync, 0.050000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq4HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq4Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq6HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq6Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8HardSync, 0.150000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1DetuneCents, 31.500000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2DetuneCents, -37.500000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3DetuneCents, 19.500008);
-	setPresetParameter(preset->presetParameters, controlID::wseq4DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq4DetuneCents, 26.500000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5DetuneCents, -18.500004);
-	setPresetParameter(preset->presetParameters, controlID::wseq6DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq6DetuneCents, -16.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7DetuneCents, 29.500000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8DetuneCents, -26.500000);
-	setPresetParameter(preset->presetParameters, controlID::LFO_SW, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::EG_SW, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::FILTER_SW, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::MAIN_SW, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::soloWaveLane, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::runStopWS, -0.000000);
-	addPreset(preset);
+	preset = presetCatalog.addPreset("ForeverVai");
+	presetCatalog.setPresetParameter(preset, controlID::lfo1Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_waveform, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_mode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_frequency_Hz, 0.130008);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_outputAmplitude, 0.825000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_quantize, 12.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_attackTime_mSec, 25.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_decayTime_mSec, 300.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_sustainLevel, 0.707000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_releaseTime_mSec, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGCore, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1Algorithm, 4.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobB, 0.270000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobC, 0.790000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobD, 0.705000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_fc, 3999.997314);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_Q, 6.715001);
+	presetCatalog.setPresetParameter(preset, controlID::filter1Output_dB, -6.000000);
+	presetCatalog.setPresetParameter(preset, controlID::enableFilter1KeyTrack, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGCore, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_attackTime_mSec, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_decayTime_mSec, 300.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_sustainLevel, 0.707000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_releaseTime_mSec, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_waveform, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_mode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_frequency_Hz, 0.117211);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_outputAmplitude, 0.775000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_quantize, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGCore, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_attackTime_mSec, 8250.017578);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_decayTime_mSec, 10000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_sustainLevel, 0.375000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_releaseTime_mSec, 10000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobA, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2Algorithm, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_fc, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_Q, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::enableFilter2KeyTrack, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2Output_dB, -36.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::globalVolume_dB, 7.919998);
+	presetCatalog.setPresetParameter(preset, controlID::globalTuning, -0.360000);
+	presetCatalog.setPresetParameter(preset, controlID::globalUnisonDetune_Cents, 5.000000);
+	presetCatalog.setPresetParameter(preset, controlID::globalPitchBendSens, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::synthMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::glideTime_mSec, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1WaveAmp_dB, 0.359997);
+	presetCatalog.setPresetParameter(preset, controlID::ws1StepLenIndex, 14.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1XFadeLenIndex, 13.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1Pitch_semi, -12.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1PitchProb_pct, 74.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1ModValue, -0.640000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1WaveIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2StepLenIndex, 16.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2XFadeLenIndex, 12.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2WaveIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2Pitch_semi, -7.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2PitchProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2ModValue, -0.600000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3StepLenIndex, 14.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3XFadeLenIndex, 13.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3WaveIndex, 19.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3Pitch_semi, -4.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3PitchProb_pct, 75.500000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3ModValue, -0.300000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4StepLenIndex, 15.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4XFadeLenIndex, 14.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4WaveIndex, 7.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4Pitch_semi, 7.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4PitchProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4ModValue, 0.180000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5StepLenIndex, 14.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5XFadeLenIndex, 4.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5WaveIndex, 7.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5Pitch_semi, 12.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5PitchProb_pct, 66.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5ModValue, 0.590000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6StepLenIndex, 14.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6XFadeLenIndex, 9.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6WaveIndex, 20.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6Pitch_semi, 3.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6PitchProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6ModValue, 0.710000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7StepLenIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7XFadeLenIndex, 7.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7WaveIndex, 24.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7Pitch_semi, 4.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7PitchProb_pct, 78.500000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7ModValue, -0.800000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8StepLenIndex, 10.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8XFadeLenIndex, 7.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8WaveIndex, 25.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8Pitch_semi, -5.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8PitchProb_pct, 82.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8ModValue, 0.390000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::timingStartIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::timingEndIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::timingLoopDir, 2.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveStartIndex, 2.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveEndIndex, 6.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveLoopDir, 2.000000);
+	presetCatalog.setPresetParameter(preset, controlID::pitchStartIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::pitchEndIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::pitchLoopDir, 2.000000);
+	presetCatalog.setPresetParameter(preset, controlID::stepSeqModStartIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::stepSeqModEndIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::stepSeqModLoopDir, 2.000000);
+	presetCatalog.setPresetParameter(preset, controlID::timeStretch, -1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step1Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step2Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step3Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step4Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step5Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step6Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step7Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step8Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::interpolateStepSeqMod, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::randomizeStepOrder, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::randomizePitchOrder, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterModeIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::enableDelayFX, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::leftDelay_mSec, 760.000000);
+	presetCatalog.setPresetParameter(preset, controlID::rightDelay_mSec, 280.000000);
+	presetCatalog.setPresetParameter(preset, controlID::feedback_Pct, 66.000000);
+	presetCatalog.setPresetParameter(preset, controlID::dryLevel_dB, 0.840004);
+	presetCatalog.setPresetParameter(preset, controlID::wetLevel_dB, -17.880001);
+	presetCatalog.setPresetParameter(preset, controlID::randomizeWaveOrder, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::randomizeSSModOrder, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_fo_Int, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc_fo_Int, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc_UniqueInt, 0.720000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGTrigInt, 0.700000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGTrigInt, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_fc_Int, -0.350000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_fc_Int, 0.470000);
+	presetCatalog.setPresetParameter(preset, controlID::dcaPanInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGTrigInt, 0.050000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1SourceInt, 0.690000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_osc_fc, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_auxEGTrig, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_filter1_fc, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_filter2_fc, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2SourceInt, 0.610000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGSourceInt, 0.600000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_filter1_fc, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_filter2_fc, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGSourceInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGBiasedSourceInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqModSourceInt, 0.730000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_osc_fo, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGIntensity, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1_panValue, -0.540000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2_panValue, 0.360000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3_panValue, -0.690000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4_panValue, -0.770000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5_panValue, 0.530000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6_panValue, 0.710000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7_panValue, -0.570000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8_panValue, 0.540000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1HardSync, 0.245000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2HardSync, 0.120000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3HardSync, 0.050000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8HardSync, 0.150000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1DetuneCents, 31.500000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2DetuneCents, -37.500000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3DetuneCents, 19.500008);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4DetuneCents, 26.500000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5DetuneCents, -18.500004);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6DetuneCents, -16.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7DetuneCents, 29.500000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8DetuneCents, -26.500000);
+	presetCatalog.setPresetParameter(preset, controlID::LFO_SW, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::EG_SW, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::FILTER_SW, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::MAIN_SW, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::soloWaveLane, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::runStopWS, -0.000000);
 
 	// --- Preset: ForeverVai5ths
-	preset = new PresetInfo(index++, "ForeverVai5ths");
-	initPresetParameters(preset->presetParameters);
-	setPresetParameter(preset->presetParameters, controlID::lfo1Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_waveform, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_mode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_frequency_Hz, 0.130008);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_outputAmplitude, 0.825000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_quantize, 12.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_attackTime_mSec, 25.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_decayTime_mSec, 300.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_sustainLevel, 0.707000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_releaseTime_mSec, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGCore, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1Algorithm, 4.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobB, 0.270000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobC, 0.790000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobD, 0.705000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_fc, 3999.997314);
-	setPresetParameter(preset->presetParameters, controlID::filter1_Q, 6.715001);
-	setPresetParameter(preset->presetParameters, controlID::filter1Output_dB, -6.000000);
-	setPresetParameter(preset->presetParameters, controlID::enableFilter1KeyTrack, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGCore, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_attackTime_mSec, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_decayTime_mSec, 700.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_sustainLevel, 0.707000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_releaseTime_mSec, 4750.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_waveform, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_mode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_frequency_Hz, 0.117211);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_outputAmplitude, 0.775000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_quantize, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGCore, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_attackTime_mSec, 8250.017578);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_decayTime_mSec, 10000.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_sustainLevel, 0.375000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_releaseTime_mSec, 10000.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobA, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2Algorithm, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_fc, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_Q, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::enableFilter2KeyTrack, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2Output_dB, -36.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::globalVolume_dB, 9.000000);
-	setPresetParameter(preset->presetParameters, controlID::globalTuning, -0.360000);
-	setPresetParameter(preset->presetParameters, controlID::globalUnisonDetune_Cents, 5.000000);
-	setPresetParameter(preset->presetParameters, controlID::globalPitchBendSens, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::synthMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::glideTime_mSec, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1WaveAmp_dB, 0.359997);
-	setPresetParameter(preset->presetParameters, controlID::ws1StepLenIndex, 14.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1XFadeLenIndex, 13.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1Pitch_semi, -12.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1PitchProb_pct, 74.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1ModValue, -0.640000);
-	setPresetParameter(preset->presetParameters, controlID::ws1ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1WaveIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2StepLenIndex, 16.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2XFadeLenIndex, 12.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2WaveIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2Pitch_semi, -7.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2PitchProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2ModValue, -0.600000);
-	setPresetParameter(preset->presetParameters, controlID::ws2ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3StepLenIndex, 14.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3XFadeLenIndex, 13.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3WaveIndex, 19.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3Pitch_semi, -4.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3PitchProb_pct, 75.500000);
-	setPresetParameter(preset->presetParameters, controlID::ws3ModValue, -0.300000);
-	setPresetParameter(preset->presetParameters, controlID::ws3ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4StepLenIndex, 15.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4XFadeLenIndex, 14.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4WaveIndex, 7.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4Pitch_semi, 7.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4PitchProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4ModValue, 0.180000);
-	setPresetParameter(preset->presetParameters, controlID::ws4ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5StepLenIndex, 14.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5XFadeLenIndex, 4.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5WaveIndex, 7.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5Pitch_semi, 12.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5PitchProb_pct, 66.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5ModValue, 0.590000);
-	setPresetParameter(preset->presetParameters, controlID::ws5ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6StepLenIndex, 14.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6XFadeLenIndex, 9.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6WaveIndex, 20.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6Pitch_semi, 3.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6PitchProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6ModValue, 0.710000);
-	setPresetParameter(preset->presetParameters, controlID::ws6ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7StepLenIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7XFadeLenIndex, 7.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7WaveIndex, 24.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7Pitch_semi, 4.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7PitchProb_pct, 78.500000);
-	setPresetParameter(preset->presetParameters, controlID::ws7ModValue, -0.800000);
-	setPresetParameter(preset->presetParameters, controlID::ws7ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8StepLenIndex, 10.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8XFadeLenIndex, 7.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8WaveIndex, 25.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8Pitch_semi, -5.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8PitchProb_pct, 82.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8ModValue, 0.390000);
-	setPresetParameter(preset->presetParameters, controlID::ws8ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::timingStartIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::timingEndIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::timingLoopDir, 2.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveStartIndex, 2.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveEndIndex, 6.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveLoopDir, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::pitchStartIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::pitchEndIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::pitchLoopDir, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::stepSeqModStartIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::stepSeqModEndIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::stepSeqModLoopDir, 2.000000);
-	setPresetParameter(preset->presetParameters, controlID::timeStretch, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step1Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step2Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step3Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step4Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step5Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step6Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step7Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step8Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::interpolateStepSeqMod, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::randomizeStepOrder, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::randomizePitchOrder, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterModeIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::enableDelayFX, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::leftDelay_mSec, 1699.999878);
-	setPresetParameter(preset->presetParameters, controlID::rightDelay_mSec, 280.000000);
-	setPresetParameter(preset->presetParameters, controlID::feedback_Pct, 41.500004);
-	setPresetParameter(preset->presetParameters, controlID::dryLevel_dB, -0.600002);
-	setPresetParameter(preset->presetParameters, controlID::wetLevel_dB, -10.320000);
-	setPresetParameter(preset->presetParameters, controlID::randomizeWaveOrder, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::randomizeSSModOrder, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_fo_Int, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc_fo_Int, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc_UniqueInt, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGTrigInt, 0.700000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGTrigInt, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_fc_Int, -0.350000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_fc_Int, 0.470000);
-	setPresetParameter(preset->presetParameters, controlID::dcaPanInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGTrigInt, 0.050000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1SourceInt, 0.690000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_osc_fc, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_auxEGTrig, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_filter1_fc, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_filter2_fc, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2SourceInt, 0.870000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_oscUnique, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGSourceInt, 0.600000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_filter1_fc, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_filter2_fc, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGSourceInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGBiasedSourceInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqModSourceInt, 0.820000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_osc_fo, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGIntensity, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1_panValue, -0.540000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2_panValue, 0.360000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3_panValue, -0.690000);
-	setPresetParameter(preset->presetParameters, controlID::wseq4_panValue, -0.770000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5_panValue, 0.530000);
-	setPresetParameter(preset->presetParameters, controlID::wseq6_panValue, 0.710000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7_panValue, -0.570000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8_panValue, 0.540000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1HardSync, 0.105000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2HardSync, 0.010000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3HardSync, 0.050000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq4HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq4Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq6HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq6Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8HardSync, 0.150000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1DetuneSemis, 7.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1DetuneCents, 31.500000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2DetuneSemis, 7.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2DetuneCents, -37.500000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3DetuneSemis, 7.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3DetuneCents, 19.500008);
-	setPresetParameter(preset->presetParameters, controlID::wseq4DetuneSemis, 7.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq4DetuneCents, 26.500000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5DetuneSemis, 7.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5DetuneCents, -18.500004);
-	setPresetParameter(preset->presetParameters, controlID::wseq6DetuneSemis, 7.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq6DetuneCents, -16.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7DetuneSemis, 7.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7DetuneCents, 16.500000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8DetuneSemis, 7.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8DetuneCents, -9.500000);
-	setPresetParameter(preset->presetParameters, controlID::LFO_SW, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::EG_SW, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::FILTER_SW, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::MAIN_SW, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::soloWaveLane, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::runStopWS, -0.000000);
-	addPreset(preset);
+	preset = presetCatalog.addPreset("ForeverVai5ths");
+	presetCatalog.setPresetParameter(preset, controlID::lfo1Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_waveform, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_mode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_frequency_Hz, 0.130008);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_outputAmplitude, 0.825000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_quantize, 12.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_attackTime_mSec, 25.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_decayTime_mSec, 300.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_sustainLevel, 0.707000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_releaseTime_mSec, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGCore, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1Algorithm, 4.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobB, 0.270000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobC, 0.790000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobD, 0.705000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_fc, 3999.997314);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_Q, 6.715001);
+	presetCatalog.setPresetParameter(preset, controlID::filter1Output_dB, -6.000000);
+	presetCatalog.setPresetParameter(preset, controlID::enableFilter1KeyTrack, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGCore, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_attackTime_mSec, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_decayTime_mSec, 700.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_sustainLevel, 0.707000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_releaseTime_mSec, 4750.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_waveform, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_mode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_frequency_Hz, 0.117211);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_outputAmplitude, 0.775000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_quantize, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGCore, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_attackTime_mSec, 8250.017578);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_decayTime_mSec, 10000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_sustainLevel, 0.375000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_releaseTime_mSec, 10000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobA, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2Algorithm, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_fc, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_Q, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::enableFilter2KeyTrack, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2Output_dB, -36.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::globalVolume_dB, 9.000000);
+	presetCatalog.setPresetParameter(preset, controlID::globalTuning, -0.360000);
+	presetCatalog.setPresetParameter(preset, controlID::globalUnisonDetune_Cents, 5.000000);
+	presetCatalog.setPresetParameter(preset, controlID::globalPitchBendSens, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::synthMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::glideTime_mSec, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1WaveAmp_dB, 0.359997);
+	presetCatalog.setPresetParameter(preset, controlID::ws1StepLenIndex, 14.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1XFadeLenIndex, 13.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1Pitch_semi, -12.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1PitchProb_pct, 74.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1ModValue, -0.640000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1WaveIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2StepLenIndex, 16.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2XFadeLenIndex, 12.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2WaveIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2Pitch_semi, -7.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2PitchProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2ModValue, -0.600000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3StepLenIndex, 14.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3XFadeLenIndex, 13.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3WaveIndex, 19.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3Pitch_semi, -4.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3PitchProb_pct, 75.500000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3ModValue, -0.300000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4StepLenIndex, 15.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4XFadeLenIndex, 14.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4WaveIndex, 7.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4Pitch_semi, 7.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4PitchProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4ModValue, 0.180000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5StepLenIndex, 14.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5XFadeLenIndex, 4.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5WaveIndex, 7.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5Pitch_semi, 12.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5PitchProb_pct, 66.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5ModValue, 0.590000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6StepLenIndex, 14.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6XFadeLenIndex, 9.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6WaveIndex, 20.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6Pitch_semi, 3.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6PitchProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6ModValue, 0.710000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7StepLenIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7XFadeLenIndex, 7.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7WaveIndex, 24.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7Pitch_semi, 4.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7PitchProb_pct, 78.500000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7ModValue, -0.800000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8StepLenIndex, 10.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8XFadeLenIndex, 7.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8WaveIndex, 25.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8Pitch_semi, -5.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8PitchProb_pct, 82.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8ModValue, 0.390000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::timingStartIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::timingEndIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::timingLoopDir, 2.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveStartIndex, 2.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveEndIndex, 6.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveLoopDir, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::pitchStartIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::pitchEndIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::pitchLoopDir, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::stepSeqModStartIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::stepSeqModEndIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::stepSeqModLoopDir, 2.000000);
+	presetCatalog.setPresetParameter(preset, controlID::timeStretch, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step1Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step2Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step3Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step4Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step5Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step6Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step7Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step8Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::interpolateStepSeqMod, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::randomizeStepOrder, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::randomizePitchOrder, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterModeIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::enableDelayFX, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::leftDelay_mSec, 1699.999878);
+	presetCatalog.setPresetParameter(preset, controlID::rightDelay_mSec, 280.000000);
+	presetCatalog.setPresetParameter(preset, controlID::feedback_Pct, 41.500004);
+	presetCatalog.setPresetParameter(preset, controlID::dryLevel_dB, -0.600002);
+	presetCatalog.setPresetParameter(preset, controlID::wetLevel_dB, -10.320000);
+	presetCatalog.setPresetParameter(preset, controlID::randomizeWaveOrder, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::randomizeSSModOrder, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_fo_Int, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc_fo_Int, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc_UniqueInt, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGTrigInt, 0.700000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGTrigInt, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_fc_Int, -0.350000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_fc_Int, 0.470000);
+	presetCatalog.setPresetParameter(preset, controlID::dcaPanInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGTrigInt, 0.050000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1SourceInt, 0.690000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_osc_fc, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_auxEGTrig, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_filter1_fc, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_filter2_fc, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2SourceInt, 0.870000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_oscUnique, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGSourceInt, 0.600000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_filter1_fc, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_filter2_fc, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGSourceInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGBiasedSourceInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqModSourceInt, 0.820000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_osc_fo, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGIntensity, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1_panValue, -0.540000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2_panValue, 0.360000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3_panValue, -0.690000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4_panValue, -0.770000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5_panValue, 0.530000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6_panValue, 0.710000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7_panValue, -0.570000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8_panValue, 0.540000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1HardSync, 0.105000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2HardSync, 0.010000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3HardSync, 0.050000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8HardSync, 0.150000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1DetuneSemis, 7.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1DetuneCents, 31.500000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2DetuneSemis, 7.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2DetuneCents, -37.500000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3DetuneSemis, 7.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3DetuneCents, 19.500008);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4DetuneSemis, 7.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4DetuneCents, 26.500000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5DetuneSemis, 7.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5DetuneCents, -18.500004);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6DetuneSemis, 7.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6DetuneCents, -16.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7DetuneSemis, 7.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7DetuneCents, 16.500000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8DetuneSemis, 7.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8DetuneCents, -9.500000);
+	presetCatalog.setPresetParameter(preset, controlID::LFO_SW, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::EG_SW, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::FILTER_SW, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::MAIN_SW, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::soloWaveLane, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::runStopWS, -0.000000);
 
 	// --- Preset: Plan9
-	preset = new PresetInfo(index++, "Plan9");
-	initPresetParameters(preset->presetParameters);
-	setPresetParameter(preset->presetParameters, controlID::lfo1Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_waveform, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_mode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_frequency_Hz, 0.210848);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_outputAmplitude, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_quantize, 4.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_attackTime_mSec, 25.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_decayTime_mSec, 300.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_sustainLevel, 0.707000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_releaseTime_mSec, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGCore, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1Algorithm, 4.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobB, 0.270000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobC, 0.630000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobD, 0.850000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_fc, 233.258148);
-	setPresetParameter(preset->presetParameters, controlID::filter1_Q, 5.725000);
-	setPresetParameter(preset->presetParameters, controlID::filter1Output_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::enableFilter1KeyTrack, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGCore, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_attackTime_mSec, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_decayTime_mSec, 300.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_sustainLevel, 0.707000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_releaseTime_mSec, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_waveform, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_mode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_frequency_Hz, 11.586972);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_outputAmplitude, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_quantize, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGCore, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_attackTime_mSec, 8250.017578);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_decayTime_mSec, 10000.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_sustainLevel, 0.375000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_releaseTime_mSec, 10000.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobA, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2Algorithm, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_fc, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_Q, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::enableFilter2KeyTrack, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2Output_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::globalVolume_dB, -8.639999);
-	setPresetParameter(preset->presetParameters, controlID::globalTuning, -0.360000);
-	setPresetParameter(preset->presetParameters, controlID::globalUnisonDetune_Cents, 5.000000);
-	setPresetParameter(preset->presetParameters, controlID::globalPitchBendSens, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::synthMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::glideTime_mSec, 10000.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1StepLenIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1XFadeLenIndex, 12.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1Pitch_semi, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1PitchProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1ModValue, -0.830000);
-	setPresetParameter(preset->presetParameters, controlID::ws1ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1WaveIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2StepLenIndex, 10.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2XFadeLenIndex, 16.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2WaveIndex, 15.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2Pitch_semi, -2.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2PitchProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2ModValue, -0.580000);
-	setPresetParameter(preset->presetParameters, controlID::ws2ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3StepLenIndex, 12.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3XFadeLenIndex, 11.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3WaveIndex, 23.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3Pitch_semi, -6.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3PitchProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3ModValue, -0.280000);
-	setPresetParameter(preset->presetParameters, controlID::ws3ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4StepLenIndex, 10.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4XFadeLenIndex, 11.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4WaveIndex, 7.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4Pitch_semi, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4PitchProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4ModValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5StepLenIndex, 6.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5XFadeLenIndex, 9.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5WaveIndex, 35.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5Pitch_semi, 11.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5PitchProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5ModValue, 0.400000);
-	setPresetParameter(preset->presetParameters, controlID::ws5ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6StepLenIndex, 15.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6XFadeLenIndex, 12.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6WaveIndex, 29.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6Pitch_semi, -9.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6PitchProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6ModValue, 0.680000);
-	setPresetParameter(preset->presetParameters, controlID::ws6ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7StepLenIndex, 7.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7XFadeLenIndex, 7.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7WaveIndex, 34.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7Pitch_semi, 12.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7PitchProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7ModValue, 0.710000);
-	setPresetParameter(preset->presetParameters, controlID::ws7ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8StepLenIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8XFadeLenIndex, 7.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8WaveIndex, 16.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8Pitch_semi, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8PitchProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8ModValue, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::timingStartIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::timingEndIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::timingLoopDir, 2.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveStartIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveEndIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveLoopDir, 2.000000);
-	setPresetParameter(preset->presetParameters, controlID::pitchStartIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::pitchEndIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::pitchLoopDir, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::stepSeqModStartIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::stepSeqModEndIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::stepSeqModLoopDir, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::timeStretch, 5.000000);
-	setPresetParameter(preset->presetParameters, controlID::step1Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step2Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step3Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step4Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step5Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step6Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step7Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step8Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::interpolateStepSeqMod, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::randomizeStepOrder, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::randomizePitchOrder, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterModeIndex, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::enableDelayFX, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::leftDelay_mSec, 760.000000);
-	setPresetParameter(preset->presetParameters, controlID::rightDelay_mSec, 500.000000);
-	setPresetParameter(preset->presetParameters, controlID::feedback_Pct, 20.000000);
-	setPresetParameter(preset->presetParameters, controlID::dryLevel_dB, 1.200001);
-	setPresetParameter(preset->presetParameters, controlID::wetLevel_dB, -2.399998);
-	setPresetParameter(preset->presetParameters, controlID::randomizeWaveOrder, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::randomizeSSModOrder, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_fo_Int, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc_fo_Int, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc_UniqueInt, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGTrigInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGTrigInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_fc_Int, 0.480000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_fc_Int, 0.490000);
-	setPresetParameter(preset->presetParameters, controlID::dcaPanInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGTrigInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1SourceInt, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_oscUnique, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_filter1_fc, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_filter2_fc, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2SourceInt, 0.610000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGSourceInt, 0.600000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_filter1_fc, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_filter2_fc, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGSourceInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGBiasedSourceInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqModSourceInt, 0.720000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_osc_fo, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGIntensity, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1_panValue, -0.540000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2_panValue, 0.360000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3_panValue, -0.690000);
-	setPresetParameter(preset->presetParameters, controlID::wseq4_panValue, -0.770000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5_panValue, 0.530000);
-	setPresetParameter(preset->presetParameters, controlID::wseq6_panValue, 0.290000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7_panValue, 0.330000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8_panValue, -0.600000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1HardSync, 0.245000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2HardSync, 0.120000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3HardSync, 0.050000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq4HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq4Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq6HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq6Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8HardSync, 0.150000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1DetuneCents, 31.500000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2DetuneCents, -44.500000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3DetuneCents, 19.500008);
-	setPresetParameter(preset->presetParameters, controlID::wseq4DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq4DetuneCents, -11.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5DetuneCents, -3.000004);
-	setPresetParameter(preset->presetParameters, controlID::wseq6DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq6DetuneCents, -7.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7DetuneCents, 12.500000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8DetuneCents, -26.500000);
-	setPresetParameter(preset->presetParameters, controlID::LFO_SW, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::EG_SW, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::FILTER_SW, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::MAIN_SW, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::soloWaveLane, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::runStopWS, -0.000000);
-	addPreset(preset);
+	preset = presetCatalog.addPreset("Plan9");
+	presetCatalog.setPresetParameter(preset, controlID::lfo1Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_waveform, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_mode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_frequency_Hz, 0.210848);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_outputAmplitude, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_quantize, 4.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_attackTime_mSec, 25.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_decayTime_mSec, 300.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_sustainLevel, 0.707000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_releaseTime_mSec, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGCore, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1Algorithm, 4.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobB, 0.270000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobC, 0.630000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobD, 0.850000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_fc, 233.258148);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_Q, 5.725000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1Output_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::enableFilter1KeyTrack, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGCore, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_attackTime_mSec, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_decayTime_mSec, 300.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_sustainLevel, 0.707000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_releaseTime_mSec, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_waveform, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_mode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_frequency_Hz, 11.586972);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_outputAmplitude, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_quantize, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGCore, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_attackTime_mSec, 8250.017578);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_decayTime_mSec, 10000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_sustainLevel, 0.375000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_releaseTime_mSec, 10000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobA, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2Algorithm, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_fc, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_Q, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::enableFilter2KeyTrack, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2Output_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::globalVolume_dB, -8.639999);
+	presetCatalog.setPresetParameter(preset, controlID::globalTuning, -0.360000);
+	presetCatalog.setPresetParameter(preset, controlID::globalUnisonDetune_Cents, 5.000000);
+	presetCatalog.setPresetParameter(preset, controlID::globalPitchBendSens, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::synthMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::glideTime_mSec, 10000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1StepLenIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1XFadeLenIndex, 12.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1Pitch_semi, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1PitchProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1ModValue, -0.830000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1WaveIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2StepLenIndex, 10.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2XFadeLenIndex, 16.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2WaveIndex, 15.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2Pitch_semi, -2.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2PitchProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2ModValue, -0.580000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3StepLenIndex, 12.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3XFadeLenIndex, 11.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3WaveIndex, 23.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3Pitch_semi, -6.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3PitchProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3ModValue, -0.280000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4StepLenIndex, 10.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4XFadeLenIndex, 11.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4WaveIndex, 7.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4Pitch_semi, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4PitchProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4ModValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5StepLenIndex, 6.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5XFadeLenIndex, 9.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5WaveIndex, 35.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5Pitch_semi, 11.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5PitchProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5ModValue, 0.400000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6StepLenIndex, 15.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6XFadeLenIndex, 12.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6WaveIndex, 29.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6Pitch_semi, -9.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6PitchProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6ModValue, 0.680000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7StepLenIndex, 7.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7XFadeLenIndex, 7.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7WaveIndex, 34.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7Pitch_semi, 12.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7PitchProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7ModValue, 0.710000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8StepLenIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8XFadeLenIndex, 7.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8WaveIndex, 16.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8Pitch_semi, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8PitchProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8ModValue, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::timingStartIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::timingEndIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::timingLoopDir, 2.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveStartIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveEndIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveLoopDir, 2.000000);
+	presetCatalog.setPresetParameter(preset, controlID::pitchStartIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::pitchEndIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::pitchLoopDir, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::stepSeqModStartIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::stepSeqModEndIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::stepSeqModLoopDir, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::timeStretch, 5.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step1Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step2Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step3Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step4Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step5Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step6Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step7Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step8Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::interpolateStepSeqMod, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::randomizeStepOrder, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::randomizePitchOrder, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterModeIndex, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::enableDelayFX, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::leftDelay_mSec, 760.000000);
+	presetCatalog.setPresetParameter(preset, controlID::rightDelay_mSec, 500.000000);
+	presetCatalog.setPresetParameter(preset, controlID::feedback_Pct, 20.000000);
+	presetCatalog.setPresetParameter(preset, controlID::dryLevel_dB, 1.200001);
+	presetCatalog.setPresetParameter(preset, controlID::wetLevel_dB, -2.399998);
+	presetCatalog.setPresetParameter(preset, controlID::randomizeWaveOrder, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::randomizeSSModOrder, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_fo_Int, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc_fo_Int, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc_UniqueInt, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGTrigInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGTrigInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_fc_Int, 0.480000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_fc_Int, 0.490000);
+	presetCatalog.setPresetParameter(preset, controlID::dcaPanInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGTrigInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1SourceInt, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_oscUnique, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_filter1_fc, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_filter2_fc, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2SourceInt, 0.610000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGSourceInt, 0.600000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_filter1_fc, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_filter2_fc, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGSourceInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGBiasedSourceInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqModSourceInt, 0.720000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_osc_fo, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGIntensity, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1_panValue, -0.540000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2_panValue, 0.360000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3_panValue, -0.690000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4_panValue, -0.770000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5_panValue, 0.530000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6_panValue, 0.290000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7_panValue, 0.330000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8_panValue, -0.600000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1HardSync, 0.245000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2HardSync, 0.120000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3HardSync, 0.050000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8HardSync, 0.150000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1DetuneCents, 31.500000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2DetuneCents, -44.500000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3DetuneCents, 19.500008);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4DetuneCents, -11.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5DetuneCents, -3.000004);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6DetuneCents, -7.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7DetuneCents, 12.500000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8DetuneCents, -26.500000);
+	presetCatalog.setPresetParameter(preset, controlID::LFO_SW, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::EG_SW, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::FILTER_SW, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::MAIN_SW, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::soloWaveLane, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::runStopWS, -0.000000);
 
 	// --- Preset: JonnyCaged
-	preset = new PresetInfo(index++, "JonnyCaged");
-	initPresetParameters(preset->presetParameters);
-	setPresetParameter(preset->presetParameters, controlID::lfo1Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_waveform, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_mode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_frequency_Hz, 0.139306);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_outputAmplitude, 0.775000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_quantize, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_attackTime_mSec, 25.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_decayTime_mSec, 300.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_sustainLevel, 0.707000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_releaseTime_mSec, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGCore, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1Algorithm, 13.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobC, 0.670000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobD, 0.490000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_fc, 183.010712);
-	setPresetParameter(preset->presetParameters, controlID::filter1_Q, 7.885000);
-	setPresetParameter(preset->presetParameters, controlID::filter1Output_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::enableFilter1KeyTrack, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGCore, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_attackTime_mSec, 25.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_decayTime_mSec, 300.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_sustainLevel, 0.707000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_releaseTime_mSec, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_waveform, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_mode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_frequency_Hz, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_outputAmplitude, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_quantize, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGCore, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_attackTime_mSec, 8250.017578);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_decayTime_mSec, 6750.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_sustainLevel, 0.707000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_releaseTime_mSec, 3000.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2Algorithm, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_fc, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_Q, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::enableFilter2KeyTrack, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2Output_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::globalVolume_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::globalTuning, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::globalUnisonDetune_Cents, 5.000000);
-	setPresetParameter(preset->presetParameters, controlID::globalPitchBendSens, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::synthMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::glideTime_mSec, 10000.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1StepLenIndex, 9.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1XFadeLenIndex, 11.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1Pitch_semi, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1PitchProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1ModValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1WaveIndex, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2StepLenIndex, 11.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2XFadeLenIndex, 11.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2WaveIndex, 2.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2Pitch_semi, -6.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2PitchProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2ModValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3StepLenIndex, 10.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3XFadeLenIndex, 9.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3WaveIndex, 14.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3Pitch_semi, -10.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3PitchProb_pct, 34.500004);
-	setPresetParameter(preset->presetParameters, controlID::ws3ModValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4StepLenIndex, 15.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4XFadeLenIndex, 17.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4WaveIndex, 21.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4Pitch_semi, -7.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4PitchProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4ModValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5StepLenIndex, 13.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5XFadeLenIndex, 14.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5WaveIndex, 19.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5Pitch_semi, 15.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5PitchProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5ModValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6StepLenIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6XFadeLenIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6WaveIndex, 39.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6Pitch_semi, -12.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6PitchProb_pct, 34.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6ModValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7StepLenIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7XFadeLenIndex, 6.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7WaveIndex, 6.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7Pitch_semi, 7.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7PitchProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7ModValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8StepLenIndex, 9.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8XFadeLenIndex, 7.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8WaveIndex, 23.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8Pitch_semi, 9.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8PitchProb_pct, 67.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8ModValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::timingStartIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::timingEndIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::timingLoopDir, 2.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveStartIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveEndIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveLoopDir, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::pitchStartIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::pitchEndIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::pitchLoopDir, 2.000000);
-	setPresetParameter(preset->presetParameters, controlID::stepSeqModStartIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::stepSeqModEndIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::stepSeqModLoopDir, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::timeStretch, 2.450000);
-	setPresetParameter(preset->presetParameters, controlID::step1Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step2Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step3Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step4Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step5Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step6Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step7Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step8Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::interpolateStepSeqMod, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::randomizeStepOrder, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::randomizePitchOrder, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterModeIndex, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::enableDelayFX, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::leftDelay_mSec, 500.000000);
-	setPresetParameter(preset->presetParameters, controlID::rightDelay_mSec, 1290.000000);
-	setPresetParameter(preset->presetParameters, controlID::feedback_Pct, 62.000000);
-	setPresetParameter(preset->presetParameters, controlID::dryLevel_dB, -0.959999);
-	setPresetParameter(preset->presetParameters, controlID::wetLevel_dB, -7.439999);
-	setPresetParameter(preset->presetParameters, controlID::randomizeWaveOrder, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::randomizeSSModOrder, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_fo_Int, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc_fo_Int, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc_UniqueInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGTrigInt, 0.810000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGTrigInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_fc_Int, 0.750000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_fc_Int, 0.750000);
-	setPresetParameter(preset->presetParameters, controlID::dcaPanInt, 0.420000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGTrigInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1SourceInt, 0.830000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_filterEGTrig, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_auxEGTrig, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2SourceInt, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_dcaPan, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGSourceInt, 0.750000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_filter1_fc, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_filter2_fc, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGSourceInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGBiasedSourceInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqModSourceInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_osc_fo, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGIntensity, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1_panValue, -0.460000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2_panValue, 0.430000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3_panValue, 0.650000);
-	setPresetParameter(preset->presetParameters, controlID::wseq4_panValue, -0.330000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5_panValue, -0.350000);
-	setPresetParameter(preset->presetParameters, controlID::wseq6_panValue, -0.560000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7_panValue, 0.650000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8_panValue, 0.090000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq4HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq4Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq6HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq6Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1DetuneSemis, 6.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1DetuneCents, 10.500000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2DetuneSemis, -3.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2DetuneCents, -11.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3DetuneSemis, 5.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3DetuneCents, -12.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq4DetuneSemis, 6.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq4DetuneCents, 25.500000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5DetuneSemis, -8.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5DetuneCents, -9.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq6DetuneSemis, -9.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq6DetuneCents, -8.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7DetuneSemis, 6.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7DetuneCents, 21.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8DetuneSemis, 7.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8DetuneCents, 20.500000);
-	setPresetParameter(preset->presetParameters, controlID::LFO_SW, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::EG_SW, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::FILTER_SW, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::MAIN_SW, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::soloWaveLane, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::runStopWS, -0.000000);
-	addPreset(preset);
+	preset = presetCatalog.addPreset("JonnyCaged");
+	presetCatalog.setPresetParameter(preset, controlID::lfo1Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_waveform, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_mode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_frequency_Hz, 0.139306);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_outputAmplitude, 0.775000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_quantize, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_attackTime_mSec, 25.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_decayTime_mSec, 300.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_sustainLevel, 0.707000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_releaseTime_mSec, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGCore, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1Algorithm, 13.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobC, 0.670000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobD, 0.490000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_fc, 183.010712);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_Q, 7.885000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1Output_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::enableFilter1KeyTrack, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGCore, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_attackTime_mSec, 25.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_decayTime_mSec, 300.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_sustainLevel, 0.707000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_releaseTime_mSec, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_waveform, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_mode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_frequency_Hz, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_outputAmplitude, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_quantize, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGCore, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_attackTime_mSec, 8250.017578);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_decayTime_mSec, 6750.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_sustainLevel, 0.707000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_releaseTime_mSec, 3000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2Algorithm, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_fc, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_Q, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::enableFilter2KeyTrack, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2Output_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::globalVolume_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::globalTuning, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::globalUnisonDetune_Cents, 5.000000);
+	presetCatalog.setPresetParameter(preset, controlID::globalPitchBendSens, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::synthMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::glideTime_mSec, 10000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1StepLenIndex, 9.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1XFadeLenIndex, 11.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1Pitch_semi, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1PitchProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1ModValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1WaveIndex, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2StepLenIndex, 11.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2XFadeLenIndex, 11.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2WaveIndex, 2.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2Pitch_semi, -6.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2PitchProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2ModValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3StepLenIndex, 10.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3XFadeLenIndex, 9.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3WaveIndex, 14.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3Pitch_semi, -10.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3PitchProb_pct, 34.500004);
+	presetCatalog.setPresetParameter(preset, controlID::ws3ModValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4StepLenIndex, 15.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4XFadeLenIndex, 17.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4WaveIndex, 21.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4Pitch_semi, -7.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4PitchProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4ModValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5StepLenIndex, 13.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5XFadeLenIndex, 14.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5WaveIndex, 19.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5Pitch_semi, 15.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5PitchProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5ModValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6StepLenIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6XFadeLenIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6WaveIndex, 39.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6Pitch_semi, -12.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6PitchProb_pct, 34.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6ModValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7StepLenIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7XFadeLenIndex, 6.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7WaveIndex, 6.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7Pitch_semi, 7.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7PitchProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7ModValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8StepLenIndex, 9.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8XFadeLenIndex, 7.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8WaveIndex, 23.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8Pitch_semi, 9.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8PitchProb_pct, 67.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8ModValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::timingStartIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::timingEndIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::timingLoopDir, 2.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveStartIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveEndIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveLoopDir, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::pitchStartIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::pitchEndIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::pitchLoopDir, 2.000000);
+	presetCatalog.setPresetParameter(preset, controlID::stepSeqModStartIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::stepSeqModEndIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::stepSeqModLoopDir, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::timeStretch, 2.450000);
+	presetCatalog.setPresetParameter(preset, controlID::step1Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step2Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step3Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step4Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step5Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step6Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step7Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step8Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::interpolateStepSeqMod, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::randomizeStepOrder, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::randomizePitchOrder, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterModeIndex, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::enableDelayFX, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::leftDelay_mSec, 500.000000);
+	presetCatalog.setPresetParameter(preset, controlID::rightDelay_mSec, 1290.000000);
+	presetCatalog.setPresetParameter(preset, controlID::feedback_Pct, 62.000000);
+	presetCatalog.setPresetParameter(preset, controlID::dryLevel_dB, -0.959999);
+	presetCatalog.setPresetParameter(preset, controlID::wetLevel_dB, -7.439999);
+	presetCatalog.setPresetParameter(preset, controlID::randomizeWaveOrder, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::randomizeSSModOrder, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_fo_Int, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc_fo_Int, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc_UniqueInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGTrigInt, 0.810000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGTrigInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_fc_Int, 0.750000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_fc_Int, 0.750000);
+	presetCatalog.setPresetParameter(preset, controlID::dcaPanInt, 0.420000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGTrigInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1SourceInt, 0.830000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_filterEGTrig, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_auxEGTrig, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2SourceInt, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_dcaPan, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGSourceInt, 0.750000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_filter1_fc, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_filter2_fc, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGSourceInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGBiasedSourceInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqModSourceInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_osc_fo, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGIntensity, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1_panValue, -0.460000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2_panValue, 0.430000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3_panValue, 0.650000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4_panValue, -0.330000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5_panValue, -0.350000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6_panValue, -0.560000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7_panValue, 0.650000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8_panValue, 0.090000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1DetuneSemis, 6.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1DetuneCents, 10.500000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2DetuneSemis, -3.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2DetuneCents, -11.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3DetuneSemis, 5.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3DetuneCents, -12.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4DetuneSemis, 6.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4DetuneCents, 25.500000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5DetuneSemis, -8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5DetuneCents, -9.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6DetuneSemis, -9.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6DetuneCents, -8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7DetuneSemis, 6.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7DetuneCents, 21.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8DetuneSemis, 7.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8DetuneCents, 20.500000);
+	presetCatalog.setPresetParameter(preset, controlID::LFO_SW, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::EG_SW, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::FILTER_SW, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::MAIN_SW, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::soloWaveLane, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::runStopWS, -0.000000);
 
 	// --- Preset: CirclesOfFear
-	preset = new PresetInfo(index++, "CirclesOfFear");
-	initPresetParameters(preset->presetParameters);
-	setPresetParameter(preset->presetParameters, controlID::lfo1Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_waveform, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_mode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_frequency_Hz, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_outputAmplitude, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_quantize, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_attackTime_mSec, 25.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_decayTime_mSec, 300.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_sustainLevel, 0.707000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_releaseTime_mSec, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGCore, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1Algorithm, 4.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobB, 0.270000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobC, 0.630000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobD, 0.705000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_fc, 1515.715698);
-	setPresetParameter(preset->presetParameters, controlID::filter1_Q, 5.725000);
-	setPresetParameter(preset->presetParameters, controlID::filter1Output_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::enableFilter1KeyTrack, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGCore, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_attackTime_mSec, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_decayTime_mSec, 300.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_sustainLevel, 0.707000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_releaseTime_mSec, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_waveform, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_mode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_frequency_Hz, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_outputAmplitude, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_quantize, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGCore, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_attackTime_mSec, 8250.017578);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_decayTime_mSec, 10000.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_sustainLevel, 0.375000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_releaseTime_mSec, 10000.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobA, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2Algorithm, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_fc, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_Q, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::enableFilter2KeyTrack, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2Output_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::globalVolume_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::globalTuning, -0.360000);
-	setPresetParameter(preset->presetParameters, controlID::globalUnisonDetune_Cents, 5.000000);
-	setPresetParameter(preset->presetParameters, controlID::globalPitchBendSens, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::synthMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::glideTime_mSec, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1StepLenIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1XFadeLenIndex, 12.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1Pitch_semi, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1PitchProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1ModValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1WaveIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2StepLenIndex, 10.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2XFadeLenIndex, 16.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2WaveIndex, 15.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2Pitch_semi, -2.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2PitchProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2ModValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3StepLenIndex, 12.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3XFadeLenIndex, 11.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3WaveIndex, 23.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3Pitch_semi, -6.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3PitchProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3ModValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4StepLenIndex, 10.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4XFadeLenIndex, 11.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4WaveIndex, 7.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4Pitch_semi, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4PitchProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4ModValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5StepLenIndex, 11.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5XFadeLenIndex, 5.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5WaveIndex, 35.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5Pitch_semi, 11.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5PitchProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5ModValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6StepLenIndex, 6.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6XFadeLenIndex, 12.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6WaveIndex, 29.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6Pitch_semi, -9.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6PitchProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6ModValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7StepLenIndex, 7.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7XFadeLenIndex, 7.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7WaveIndex, 34.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7Pitch_semi, 12.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7PitchProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7ModValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8StepLenIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8XFadeLenIndex, 7.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8WaveIndex, 16.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8Pitch_semi, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8PitchProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8ModValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::timingStartIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::timingEndIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::timingLoopDir, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveStartIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveEndIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveLoopDir, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::pitchStartIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::pitchEndIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::pitchLoopDir, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::stepSeqModStartIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::stepSeqModEndIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::stepSeqModLoopDir, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::timeStretch, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step1Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step2Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step3Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step4Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step5Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step6Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step7Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step8Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::interpolateStepSeqMod, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::randomizeStepOrder, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::randomizePitchOrder, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterModeIndex, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::enableDelayFX, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::leftDelay_mSec, 760.000000);
-	setPresetParameter(preset->presetParameters, controlID::rightDelay_mSec, 500.000000);
-	setPresetParameter(preset->presetParameters, controlID::feedback_Pct, 20.000000);
-	setPresetParameter(preset->presetParameters, controlID::dryLevel_dB, 1.200001);
-	setPresetParameter(preset->presetParameters, controlID::wetLevel_dB, -2.399998);
-	setPresetParameter(preset->presetParameters, controlID::randomizeWaveOrder, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::randomizeSSModOrder, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_fo_Int, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc_fo_Int, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc_UniqueInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGTrigInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGTrigInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_fc_Int, 0.480000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_fc_Int, 0.490000);
-	setPresetParameter(preset->presetParameters, controlID::dcaPanInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGTrigInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1SourceInt, 0.690000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_filter1_fc, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_filter2_fc, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2SourceInt, 0.610000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGSourceInt, 0.600000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_filter1_fc, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_filter2_fc, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGSourceInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGBiasedSourceInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqModSourceInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_osc_fo, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGIntensity, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1_panValue, -0.540000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2_panValue, 0.360000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3_panValue, -0.690000);
-	setPresetParameter(preset->presetParameters, controlID::wseq4_panValue, -0.770000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5_panValue, 0.530000);
-	setPresetParameter(preset->presetParameters, controlID::wseq6_panValue, 0.290000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7_panValue, 0.330000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8_panValue, -0.600000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2HardSync, 0.120000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3HardSync, 0.050000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq4HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq4Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq6HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq6Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8HardSync, 0.150000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1DetuneCents, 31.500000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2DetuneCents, -44.500000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3DetuneCents, 19.500008);
-	setPresetParameter(preset->presetParameters, controlID::wseq4DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq4DetuneCents, -11.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5DetuneCents, -3.000004);
-	setPresetParameter(preset->presetParameters, controlID::wseq6DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq6DetuneCents, -7.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7DetuneCents, 12.500000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8DetuneCents, -26.500000);
-	setPresetParameter(preset->presetParameters, controlID::LFO_SW, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::EG_SW, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::FILTER_SW, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::MAIN_SW, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::soloWaveLane, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::runStopWS, -0.000000);
-	addPreset(preset);
+	preset = presetCatalog.addPreset("CirclesOfFear");
+	presetCatalog.setPresetParameter(preset, controlID::lfo1Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_waveform, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_mode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_frequency_Hz, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_outputAmplitude, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_quantize, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_attackTime_mSec, 25.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_decayTime_mSec, 300.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_sustainLevel, 0.707000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_releaseTime_mSec, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGCore, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1Algorithm, 4.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobB, 0.270000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobC, 0.630000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobD, 0.705000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_fc, 1515.715698);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_Q, 5.725000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1Output_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::enableFilter1KeyTrack, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGCore, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_attackTime_mSec, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_decayTime_mSec, 300.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_sustainLevel, 0.707000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_releaseTime_mSec, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_waveform, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_mode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_frequency_Hz, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_outputAmplitude, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_quantize, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGCore, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_attackTime_mSec, 8250.017578);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_decayTime_mSec, 10000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_sustainLevel, 0.375000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_releaseTime_mSec, 10000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobA, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2Algorithm, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_fc, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_Q, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::enableFilter2KeyTrack, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2Output_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::globalVolume_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::globalTuning, -0.360000);
+	presetCatalog.setPresetParameter(preset, controlID::globalUnisonDetune_Cents, 5.000000);
+	presetCatalog.setPresetParameter(preset, controlID::globalPitchBendSens, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::synthMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::glideTime_mSec, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1StepLenIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1XFadeLenIndex, 12.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1Pitch_semi, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1PitchProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1ModValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1WaveIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2StepLenIndex, 10.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2XFadeLenIndex, 16.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2WaveIndex, 15.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2Pitch_semi, -2.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2PitchProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2ModValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3StepLenIndex, 12.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3XFadeLenIndex, 11.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3WaveIndex, 23.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3Pitch_semi, -6.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3PitchProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3ModValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4StepLenIndex, 10.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4XFadeLenIndex, 11.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4WaveIndex, 7.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4Pitch_semi, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4PitchProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4ModValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5StepLenIndex, 11.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5XFadeLenIndex, 5.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5WaveIndex, 35.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5Pitch_semi, 11.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5PitchProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5ModValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6StepLenIndex, 6.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6XFadeLenIndex, 12.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6WaveIndex, 29.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6Pitch_semi, -9.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6PitchProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6ModValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7StepLenIndex, 7.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7XFadeLenIndex, 7.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7WaveIndex, 34.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7Pitch_semi, 12.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7PitchProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7ModValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8StepLenIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8XFadeLenIndex, 7.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8WaveIndex, 16.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8Pitch_semi, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8PitchProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8ModValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::timingStartIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::timingEndIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::timingLoopDir, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveStartIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveEndIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveLoopDir, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::pitchStartIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::pitchEndIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::pitchLoopDir, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::stepSeqModStartIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::stepSeqModEndIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::stepSeqModLoopDir, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::timeStretch, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step1Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step2Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step3Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step4Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step5Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step6Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step7Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step8Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::interpolateStepSeqMod, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::randomizeStepOrder, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::randomizePitchOrder, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterModeIndex, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::enableDelayFX, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::leftDelay_mSec, 760.000000);
+	presetCatalog.setPresetParameter(preset, controlID::rightDelay_mSec, 500.000000);
+	presetCatalog.setPresetParameter(preset, controlID::feedback_Pct, 20.000000);
+	presetCatalog.setPresetParameter(preset, controlID::dryLevel_dB, 1.200001);
+	presetCatalog.setPresetParameter(preset, controlID::wetLevel_dB, -2.399998);
+	presetCatalog.setPresetParameter(preset, controlID::randomizeWaveOrder, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::randomizeSSModOrder, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_fo_Int, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc_fo_Int, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc_UniqueInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGTrigInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGTrigInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_fc_Int, 0.480000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_fc_Int, 0.490000);
+	presetCatalog.setPresetParameter(preset, controlID::dcaPanInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGTrigInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1SourceInt, 0.690000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_filter1_fc, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_filter2_fc, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2SourceInt, 0.610000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGSourceInt, 0.600000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_filter1_fc, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_filter2_fc, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGSourceInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGBiasedSourceInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqModSourceInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_osc_fo, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGIntensity, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1_panValue, -0.540000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2_panValue, 0.360000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3_panValue, -0.690000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4_panValue, -0.770000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5_panValue, 0.530000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6_panValue, 0.290000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7_panValue, 0.330000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8_panValue, -0.600000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2HardSync, 0.120000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3HardSync, 0.050000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8HardSync, 0.150000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1DetuneCents, 31.500000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2DetuneCents, -44.500000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3DetuneCents, 19.500008);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4DetuneCents, -11.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5DetuneCents, -3.000004);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6DetuneCents, -7.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7DetuneCents, 12.500000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8DetuneCents, -26.500000);
+	presetCatalog.setPresetParameter(preset, controlID::LFO_SW, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::EG_SW, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::FILTER_SW, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::MAIN_SW, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::soloWaveLane, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::runStopWS, -0.000000);
 
 	// --- Preset: majorscale
-	preset = new PresetInfo(index++, "majorscale");
-	initPresetParameters(preset->presetParameters);
-	setPresetParameter(preset->presetParameters, controlID::lfo1Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_waveform, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_mode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_frequency_Hz, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_outputAmplitude, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_quantize, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_attackTime_mSec, 25.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_decayTime_mSec, 300.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_sustainLevel, 0.707000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_releaseTime_mSec, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGCore, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1Algorithm, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_fc, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_Q, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1Output_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::enableFilter1KeyTrack, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGCore, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_attackTime_mSec, 25.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_decayTime_mSec, 300.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_sustainLevel, 0.707000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_releaseTime_mSec, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_waveform, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_mode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_frequency_Hz, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_outputAmplitude, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_quantize, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGCore, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_attackTime_mSec, 25.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_decayTime_mSec, 300.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_sustainLevel, 0.707000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_releaseTime_mSec, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2Algorithm, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_fc, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_Q, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::enableFilter2KeyTrack, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2Output_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::globalVolume_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::globalTuning, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::globalUnisonDetune_Cents, 5.000000);
-	setPresetParameter(preset->presetParameters, controlID::globalPitchBendSens, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::synthMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::glideTime_mSec, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1StepLenIndex, 10.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1XFadeLenIndex, 10.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1Pitch_semi, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1PitchProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1ModValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1WaveIndex, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2StepLenIndex, 11.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2XFadeLenIndex, 11.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2WaveIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2Pitch_semi, 2.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2PitchProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2ModValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3StepLenIndex, 11.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3XFadeLenIndex, 11.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3WaveIndex, 3.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3Pitch_semi, 4.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3PitchProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3ModValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4StepLenIndex, 11.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4XFadeLenIndex, 10.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4WaveIndex, 2.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4Pitch_semi, 5.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4PitchProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4ModValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5StepLenIndex, 11.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5XFadeLenIndex, 10.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5WaveIndex, 4.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5Pitch_semi, 7.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5PitchProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5ModValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6StepLenIndex, 11.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6XFadeLenIndex, 11.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6WaveIndex, 6.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6Pitch_semi, 9.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6PitchProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6ModValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7StepLenIndex, 11.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7XFadeLenIndex, 10.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7WaveIndex, 12.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7Pitch_semi, 11.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7PitchProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7ModValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8StepLenIndex, 10.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8XFadeLenIndex, 10.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8WaveIndex, 17.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8Pitch_semi, 12.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8PitchProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8ModValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::timingStartIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::timingEndIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::timingLoopDir, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveStartIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveEndIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveLoopDir, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::pitchStartIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::pitchEndIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::pitchLoopDir, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::stepSeqModStartIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::stepSeqModEndIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::stepSeqModLoopDir, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::timeStretch, -3.000000);
-	setPresetParameter(preset->presetParameters, controlID::step1Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step2Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step3Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step4Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step5Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step6Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step7Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step8Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::interpolateStepSeqMod, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::randomizeStepOrder, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::randomizePitchOrder, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterModeIndex, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::enableDelayFX, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::leftDelay_mSec, 500.000000);
-	setPresetParameter(preset->presetParameters, controlID::rightDelay_mSec, 500.000000);
-	setPresetParameter(preset->presetParameters, controlID::feedback_Pct, 20.000000);
-	setPresetParameter(preset->presetParameters, controlID::dryLevel_dB, -6.000000);
-	setPresetParameter(preset->presetParameters, controlID::wetLevel_dB, -6.000000);
-	setPresetParameter(preset->presetParameters, controlID::randomizeWaveOrder, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::randomizeSSModOrder, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_fo_Int, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc_fo_Int, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc_UniqueInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGTrigInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGTrigInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_fc_Int, 0.750000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_fc_Int, 0.750000);
-	setPresetParameter(preset->presetParameters, controlID::dcaPanInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGTrigInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1SourceInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2SourceInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGSourceInt, 0.750000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_filter1_fc, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_filter2_fc, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGSourceInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGBiasedSourceInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqModSourceInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_osc_fo, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGIntensity, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1_panValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2_panValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3_panValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq4_panValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5_panValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq6_panValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7_panValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8_panValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq4HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq4Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq6HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq6Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1DetuneCents, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2DetuneCents, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3DetuneCents, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq4DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq4DetuneCents, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5DetuneCents, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq6DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq6DetuneCents, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7DetuneCents, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8DetuneSemis, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8DetuneCents, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::LFO_SW, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::EG_SW, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::FILTER_SW, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::MAIN_SW, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::soloWaveLane, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::runStopWS, -0.000000);
-	addPreset(preset);
+	preset = presetCatalog.addPreset("majorscale");
+	presetCatalog.setPresetParameter(preset, controlID::lfo1Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_waveform, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_mode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_frequency_Hz, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_outputAmplitude, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_quantize, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_attackTime_mSec, 25.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_decayTime_mSec, 300.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_sustainLevel, 0.707000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_releaseTime_mSec, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGCore, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1Algorithm, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_fc, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_Q, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1Output_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::enableFilter1KeyTrack, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGCore, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_attackTime_mSec, 25.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_decayTime_mSec, 300.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_sustainLevel, 0.707000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_releaseTime_mSec, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_waveform, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_mode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_frequency_Hz, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_outputAmplitude, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_quantize, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGCore, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_attackTime_mSec, 25.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_decayTime_mSec, 300.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_sustainLevel, 0.707000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_releaseTime_mSec, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2Algorithm, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_fc, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_Q, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::enableFilter2KeyTrack, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2Output_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::globalVolume_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::globalTuning, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::globalUnisonDetune_Cents, 5.000000);
+	presetCatalog.setPresetParameter(preset, controlID::globalPitchBendSens, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::synthMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::glideTime_mSec, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1StepLenIndex, 10.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1XFadeLenIndex, 10.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1Pitch_semi, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1PitchProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1ModValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1WaveIndex, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2StepLenIndex, 11.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2XFadeLenIndex, 11.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2WaveIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2Pitch_semi, 2.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2PitchProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2ModValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3StepLenIndex, 11.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3XFadeLenIndex, 11.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3WaveIndex, 3.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3Pitch_semi, 4.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3PitchProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3ModValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4StepLenIndex, 11.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4XFadeLenIndex, 10.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4WaveIndex, 2.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4Pitch_semi, 5.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4PitchProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4ModValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5StepLenIndex, 11.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5XFadeLenIndex, 10.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5WaveIndex, 4.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5Pitch_semi, 7.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5PitchProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5ModValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6StepLenIndex, 11.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6XFadeLenIndex, 11.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6WaveIndex, 6.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6Pitch_semi, 9.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6PitchProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6ModValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7StepLenIndex, 11.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7XFadeLenIndex, 10.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7WaveIndex, 12.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7Pitch_semi, 11.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7PitchProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7ModValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8StepLenIndex, 10.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8XFadeLenIndex, 10.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8WaveIndex, 17.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8Pitch_semi, 12.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8PitchProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8ModValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::timingStartIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::timingEndIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::timingLoopDir, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveStartIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveEndIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveLoopDir, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::pitchStartIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::pitchEndIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::pitchLoopDir, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::stepSeqModStartIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::stepSeqModEndIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::stepSeqModLoopDir, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::timeStretch, -3.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step1Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step2Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step3Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step4Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step5Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step6Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step7Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step8Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::interpolateStepSeqMod, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::randomizeStepOrder, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::randomizePitchOrder, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterModeIndex, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::enableDelayFX, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::leftDelay_mSec, 500.000000);
+	presetCatalog.setPresetParameter(preset, controlID::rightDelay_mSec, 500.000000);
+	presetCatalog.setPresetParameter(preset, controlID::feedback_Pct, 20.000000);
+	presetCatalog.setPresetParameter(preset, controlID::dryLevel_dB, -6.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wetLevel_dB, -6.000000);
+	presetCatalog.setPresetParameter(preset, controlID::randomizeWaveOrder, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::randomizeSSModOrder, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_fo_Int, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc_fo_Int, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc_UniqueInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGTrigInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGTrigInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_fc_Int, 0.750000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_fc_Int, 0.750000);
+	presetCatalog.setPresetParameter(preset, controlID::dcaPanInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGTrigInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1SourceInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2SourceInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGSourceInt, 0.750000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_filter1_fc, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_filter2_fc, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGSourceInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGBiasedSourceInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqModSourceInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_osc_fo, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGIntensity, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1_panValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2_panValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3_panValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4_panValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5_panValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6_panValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7_panValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8_panValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1DetuneCents, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2DetuneCents, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3DetuneCents, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4DetuneCents, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5DetuneCents, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6DetuneCents, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7DetuneCents, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8DetuneSemis, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8DetuneCents, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::LFO_SW, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::EG_SW, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::FILTER_SW, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::MAIN_SW, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::soloWaveLane, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::runStopWS, -0.000000);
 
 	// --- Preset: majorscaleFreak
-	preset = new PresetInfo(index++, "majorscaleFreak");
-	initPresetParameters(preset->presetParameters);
-	setPresetParameter(preset->presetParameters, controlID::lfo1Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_waveform, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_mode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_frequency_Hz, 0.101398);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_outputAmplitude, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_quantize, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_attackTime_mSec, 25.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_decayTime_mSec, 300.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_sustainLevel, 0.707000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_releaseTime_mSec, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGCore, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEG_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1Algorithm, 4.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobC, 0.935000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_fc, 1231.144409);
-	setPresetParameter(preset->presetParameters, controlID::filter1_Q, 6.175000);
-	setPresetParameter(preset->presetParameters, controlID::filter1Output_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::enableFilter1KeyTrack, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGCore, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_attackTime_mSec, 400.059967);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_decayTime_mSec, 725.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_sustainLevel, 0.125000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_releaseTime_mSec, 3999.999756);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobA, 0.475000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_waveform, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_mode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_frequency_Hz, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_outputAmplitude, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_quantize, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGCore, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_attackTime_mSec, 4000.059814);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_decayTime_mSec, 9250.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_sustainLevel, 0.675000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_releaseTime_mSec, 8750.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2Core, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2Algorithm, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_fc, 1000.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_Q, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::enableFilter2KeyTrack, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2Output_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobA, 0.500000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobC, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_ModKnobD, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::globalVolume_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::globalTuning, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::globalUnisonDetune_Cents, 5.000000);
-	setPresetParameter(preset->presetParameters, controlID::globalPitchBendSens, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::synthMode, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::glideTime_mSec, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1StepLenIndex, 10.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1XFadeLenIndex, 10.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1Pitch_semi, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1PitchProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1ModValue, -0.790000);
-	setPresetParameter(preset->presetParameters, controlID::ws1ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws1WaveIndex, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2StepLenIndex, 11.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2XFadeLenIndex, 11.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2WaveIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2Pitch_semi, 2.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2PitchProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws2ModValue, -0.550000);
-	setPresetParameter(preset->presetParameters, controlID::ws2ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3StepLenIndex, 11.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3XFadeLenIndex, 11.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3WaveIndex, 18.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3Pitch_semi, 4.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3PitchProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws3ModValue, -0.360000);
-	setPresetParameter(preset->presetParameters, controlID::ws3ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4StepLenIndex, 11.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4XFadeLenIndex, 10.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4WaveIndex, 2.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4Pitch_semi, 5.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4PitchProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws4ModValue, -0.120000);
-	setPresetParameter(preset->presetParameters, controlID::ws4ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5StepLenIndex, 11.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5XFadeLenIndex, 10.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5WaveIndex, 4.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5Pitch_semi, 7.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5PitchProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5ModValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws5ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6StepLenIndex, 12.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6XFadeLenIndex, 11.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6WaveIndex, 17.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6WaveAmp_dB, -3.240002);
-	setPresetParameter(preset->presetParameters, controlID::ws6Pitch_semi, 9.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6PitchProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws6ModValue, 0.200000);
-	setPresetParameter(preset->presetParameters, controlID::ws6ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7StepLenIndex, 11.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7XFadeLenIndex, 10.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7WaveIndex, 12.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7Pitch_semi, 11.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7PitchProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws7ModValue, 0.610000);
-	setPresetParameter(preset->presetParameters, controlID::ws7ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8StepLenIndex, 10.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8XFadeLenIndex, 10.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8WaveIndex, 17.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8WaveAmp_dB, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8Pitch_semi, 12.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8PitchProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::ws8ModValue, 0.950000);
-	setPresetParameter(preset->presetParameters, controlID::ws8ModProb_pct, 100.000000);
-	setPresetParameter(preset->presetParameters, controlID::timingStartIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::timingEndIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::timingLoopDir, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveStartIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveEndIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveLoopDir, 2.000000);
-	setPresetParameter(preset->presetParameters, controlID::pitchStartIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::pitchEndIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::pitchLoopDir, 2.000000);
-	setPresetParameter(preset->presetParameters, controlID::stepSeqModStartIndex, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::stepSeqModEndIndex, 8.000000);
-	setPresetParameter(preset->presetParameters, controlID::stepSeqModLoopDir, 2.000000);
-	setPresetParameter(preset->presetParameters, controlID::timeStretch, -3.000000);
-	setPresetParameter(preset->presetParameters, controlID::step1Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step2Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step3Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step4Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step5Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step6Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step7Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::step8Type, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::interpolateStepSeqMod, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::randomizeStepOrder, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::randomizePitchOrder, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterModeIndex, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::enableDelayFX, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::leftDelay_mSec, 500.000000);
-	setPresetParameter(preset->presetParameters, controlID::rightDelay_mSec, 500.000000);
-	setPresetParameter(preset->presetParameters, controlID::feedback_Pct, 20.000000);
-	setPresetParameter(preset->presetParameters, controlID::dryLevel_dB, -6.000000);
-	setPresetParameter(preset->presetParameters, controlID::wetLevel_dB, -6.000000);
-	setPresetParameter(preset->presetParameters, controlID::randomizeWaveOrder, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::randomizeSSModOrder, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_fo_Int, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::osc_fo_Int, 0.780000);
-	setPresetParameter(preset->presetParameters, controlID::osc_UniqueInt, 0.700000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGTrigInt, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGTrigInt, 0.680000);
-	setPresetParameter(preset->presetParameters, controlID::filter1_fc_Int, 0.750000);
-	setPresetParameter(preset->presetParameters, controlID::filter2_fc_Int, 0.750000);
-	setPresetParameter(preset->presetParameters, controlID::dcaPanInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGTrigInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1SourceInt, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_filterEGTrig, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo1_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2SourceInt, 0.820000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_auxEGTrig, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::lfo2_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEGSourceInt, 0.750000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_filter1_fc, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_filter2_fc, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::filterEG_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGSourceInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEG_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGBiasedSourceInt, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_osc_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_oscUnique, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::auxEGB_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqModSourceInt, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_lfo2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_osc_fo, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_oscUnique, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_filterEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_auxEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_filter1_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_filter2_fc, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_dcaPan, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::waveSeqMod_ampEGTrig, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::ampEGIntensity, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1_panValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2_panValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3_panValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq4_panValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5_panValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq6_panValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7_panValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8_panValue, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq4HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq4Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq6HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq6Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8HardSync, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8Morph, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1DetuneSemis, 5.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq1DetuneCents, 8.999996);
-	setPresetParameter(preset->presetParameters, controlID::wseq2DetuneSemis, 5.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq2DetuneCents, -5.500000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3DetuneSemis, 5.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq3DetuneCents, 14.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq4DetuneSemis, 5.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq4DetuneCents, -16.500000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5DetuneSemis, 5.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq5DetuneCents, 15.500000);
-	setPresetParameter(preset->presetParameters, controlID::wseq6DetuneSemis, 5.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq6DetuneCents, -17.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7DetuneSemis, 5.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq7DetuneCents, 13.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8DetuneSemis, 5.000000);
-	setPresetParameter(preset->presetParameters, controlID::wseq8DetuneCents, -17.000000);
-	setPresetParameter(preset->presetParameters, controlID::LFO_SW, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::EG_SW, 1.000000);
-	setPresetParameter(preset->presetParameters, controlID::FILTER_SW, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::MAIN_SW, 0.000000);
-	setPresetParameter(preset->presetParameters, controlID::soloWaveLane, -0.000000);
-	setPresetParameter(preset->presetParameters, controlID::runStopWS, -0.000000);
-	addPreset(preset);
+	preset = presetCatalog.addPreset("majorscaleFreak");
+	presetCatalog.setPresetParameter(preset, controlID::lfo1Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_waveform, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_mode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_frequency_Hz, 0.101398);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_outputAmplitude, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_quantize, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_attackTime_mSec, 25.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_decayTime_mSec, 300.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_sustainLevel, 0.707000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_releaseTime_mSec, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGCore, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEG_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1Algorithm, 4.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobC, 0.935000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_fc, 1231.144409);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_Q, 6.175000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1Output_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::enableFilter1KeyTrack, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGCore, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_attackTime_mSec, 400.059967);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_decayTime_mSec, 725.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_sustainLevel, 0.125000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_releaseTime_mSec, 3999.999756);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobA, 0.475000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_waveform, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_mode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_frequency_Hz, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_outputAmplitude, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_quantize, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGCore, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_attackTime_mSec, 4000.059814);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_decayTime_mSec, 9250.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_sustainLevel, 0.675000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_releaseTime_mSec, 8750.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2Core, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2Algorithm, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_fc, 1000.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_Q, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::enableFilter2KeyTrack, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2Output_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobA, 0.500000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobC, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_ModKnobD, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::globalVolume_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::globalTuning, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::globalUnisonDetune_Cents, 5.000000);
+	presetCatalog.setPresetParameter(preset, controlID::globalPitchBendSens, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::synthMode, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::glideTime_mSec, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1StepLenIndex, 10.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1XFadeLenIndex, 10.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1Pitch_semi, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1PitchProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1ModValue, -0.790000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws1WaveIndex, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2StepLenIndex, 11.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2XFadeLenIndex, 11.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2WaveIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2Pitch_semi, 2.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2PitchProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2ModValue, -0.550000);
+	presetCatalog.setPresetParameter(preset, controlID::ws2ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3StepLenIndex, 11.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3XFadeLenIndex, 11.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3WaveIndex, 18.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3Pitch_semi, 4.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3PitchProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3ModValue, -0.360000);
+	presetCatalog.setPresetParameter(preset, controlID::ws3ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4StepLenIndex, 11.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4XFadeLenIndex, 10.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4WaveIndex, 2.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4Pitch_semi, 5.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4PitchProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4ModValue, -0.120000);
+	presetCatalog.setPresetParameter(preset, controlID::ws4ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5StepLenIndex, 11.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5XFadeLenIndex, 10.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5WaveIndex, 4.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5Pitch_semi, 7.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5PitchProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5ModValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws5ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6StepLenIndex, 12.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6XFadeLenIndex, 11.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6WaveIndex, 17.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6WaveAmp_dB, -3.240002);
+	presetCatalog.setPresetParameter(preset, controlID::ws6Pitch_semi, 9.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6PitchProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6ModValue, 0.200000);
+	presetCatalog.setPresetParameter(preset, controlID::ws6ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7StepLenIndex, 11.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7XFadeLenIndex, 10.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7WaveIndex, 12.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7Pitch_semi, 11.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7PitchProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7ModValue, 0.610000);
+	presetCatalog.setPresetParameter(preset, controlID::ws7ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8StepLenIndex, 10.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8XFadeLenIndex, 10.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8WaveIndex, 17.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8WaveAmp_dB, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8Pitch_semi, 12.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8PitchProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8ModValue, 0.950000);
+	presetCatalog.setPresetParameter(preset, controlID::ws8ModProb_pct, 100.000000);
+	presetCatalog.setPresetParameter(preset, controlID::timingStartIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::timingEndIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::timingLoopDir, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveStartIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveEndIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveLoopDir, 2.000000);
+	presetCatalog.setPresetParameter(preset, controlID::pitchStartIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::pitchEndIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::pitchLoopDir, 2.000000);
+	presetCatalog.setPresetParameter(preset, controlID::stepSeqModStartIndex, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::stepSeqModEndIndex, 8.000000);
+	presetCatalog.setPresetParameter(preset, controlID::stepSeqModLoopDir, 2.000000);
+	presetCatalog.setPresetParameter(preset, controlID::timeStretch, -3.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step1Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step2Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step3Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step4Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step5Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step6Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step7Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::step8Type, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::interpolateStepSeqMod, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::randomizeStepOrder, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::randomizePitchOrder, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterModeIndex, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::enableDelayFX, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::leftDelay_mSec, 500.000000);
+	presetCatalog.setPresetParameter(preset, controlID::rightDelay_mSec, 500.000000);
+	presetCatalog.setPresetParameter(preset, controlID::feedback_Pct, 20.000000);
+	presetCatalog.setPresetParameter(preset, controlID::dryLevel_dB, -6.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wetLevel_dB, -6.000000);
+	presetCatalog.setPresetParameter(preset, controlID::randomizeWaveOrder, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::randomizeSSModOrder, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_fo_Int, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::osc_fo_Int, 0.780000);
+	presetCatalog.setPresetParameter(preset, controlID::osc_UniqueInt, 0.700000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGTrigInt, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGTrigInt, 0.680000);
+	presetCatalog.setPresetParameter(preset, controlID::filter1_fc_Int, 0.750000);
+	presetCatalog.setPresetParameter(preset, controlID::filter2_fc_Int, 0.750000);
+	presetCatalog.setPresetParameter(preset, controlID::dcaPanInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGTrigInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1SourceInt, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_filterEGTrig, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo1_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2SourceInt, 0.820000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_auxEGTrig, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::lfo2_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEGSourceInt, 0.750000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_filter1_fc, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_filter2_fc, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::filterEG_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGSourceInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEG_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGBiasedSourceInt, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_osc_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_oscUnique, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::auxEGB_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqModSourceInt, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_lfo2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_osc_fo, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_oscUnique, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_filterEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_auxEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_filter1_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_filter2_fc, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_dcaPan, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::waveSeqMod_ampEGTrig, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::ampEGIntensity, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1_panValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2_panValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3_panValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4_panValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5_panValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6_panValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7_panValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8_panValue, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8HardSync, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8Morph, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1DetuneSemis, 5.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq1DetuneCents, 8.999996);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2DetuneSemis, 5.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq2DetuneCents, -5.500000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3DetuneSemis, 5.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq3DetuneCents, 14.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4DetuneSemis, 5.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq4DetuneCents, -16.500000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5DetuneSemis, 5.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq5DetuneCents, 15.500000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6DetuneSemis, 5.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq6DetuneCents, -17.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7DetuneSemis, 5.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq7DetuneCents, 13.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8DetuneSemis, 5.000000);
+	presetCatalog.setPresetParameter(preset, controlID::wseq8DetuneCents, -17.000000);
+	presetCatalog.setPresetParameter(preset, controlID::LFO_SW, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::EG_SW, 1.000000);
+	presetCatalog.setPresetParameter(preset, controlID::FILTER_SW, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::MAIN_SW, 0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::soloWaveLane, -0.000000);
+	presetCatalog.setPresetParameter(preset, controlID::runStopWS, -0.000000);
 
 
 	// **--0xA7FF--**
@@ -16,6 +16,13 @@
 // --- support multichannel operation up to 128 channels
 #define MAX_CHANNEL_COUNT 128
 
+// --- bound variable change tracking: one bit per group in a 64-bit mask
+#define MAX_BOUND_VARIABLE_GROUPS 64
+
+// --- controlID -> parameter index: 256 IDs per page
+#define PARAMETER_INDEX_PAGE_BITS 8
+#define PARAMETER_INDEX_PAGE_SIZE (1 << PARAMETER_INDEX_PAGE_BITS)
+
 #include <string>
 #include <sstream>
 #include <vector>
@@ -947,12 +954,12 @@ struct AuxParameterAttribute
 	void setBoolAttribute(bool b) { value.b = b; }
 	void setVoidPtrAttribute(void* vp) { value.vp = vp; }
 
-	float getFloatAttribute( ) { return value.f; }
-	double getDoubleAttribute( ) { return value.d; }
-	int getIntAttribute( ) { return value.n; }
-	unsigned int getUintAttribute( ) { return  value.u; }
-	bool getBoolAttribute( ) { return value.b; }
-	void* getVoidPtrAttribute( ) { return value.vp; }
+	float getFloatAttribute( ) const { return value.f; }
+	double getDoubleAttribute( ) const { return value.d; }
+	int getIntAttribute( ) const { return value.n; }
+	unsigned int getUintAttribute( ) const { return  value.u; }
+	bool getBoolAttribute( ) const { return value.b; }
+	void* getVoidPtrAttribute( ) const { return value.vp; }
 
 	attributeValue value;	///< value in union form
 	uint32_t attributeID = 0;	///< attribute ID
@@ -1077,6 +1084,14 @@ struct ProcessBufferInfo
 	float** outputs = nullptr;		///< audio output buffers
 	float** auxInputs = nullptr;	///< aux (sidechain) input buffers
 	float** auxOutputs = nullptr;	///< aux outputs - for future use
+
+	// --- 64-bit audio (VST3 kSample64 only); when set, the float pointers above are nullptr
+	bool doublePrecision = false;		///< true if the buffers are the double versions
+	double** inputs64 = nullptr;		///< audio input buffers, double
+	double** outputs64 = nullptr;		///< audio output buffers, double
+	double** auxInputs64 = nullptr;		///< aux (sidechain) input buffers, double
+	double** auxOutputs64 = nullptr;	///< aux outputs - for future use
+
 	uint32_t numAudioInChannels = 0;		///< audio input channel count
 	uint32_t numAudioOutChannels = 0;		///< audio output channel count
 	uint32_t numAuxAudioInChannels = 0;		///< aux input channel count
@@ -1095,6 +1110,9 @@ struct ProcessBufferInfo
 	// --- should make these const?
     HostInfo* hostInfo = nullptr;			///< pointer to host data for this buffer
     IMidiEventQueue* midiEventQueue = nullptr;	///< MIDI event queue
+
+	// --- set by the core
+	bool outputSilent = false;				///< every output sample of this buffer is zero (VST3 silence flags)
 };
 
 /**
@@ -0,0 +1,161 @@
+// -----------------------------------------------------------------------------
+//    ASPiK Plugin Kernel File:  presetfader.h
+//
+/**
+    \file   presetfader.h
+    \author Will Pirkle
+    \date   17-September-2018
+    \brief  interface file for the preset change fader (fade out, swap, fade in)
+    		- http://www.aspikplugins.com
+    		- http://www.willpirkle.com
+*/
+// -----------------------------------------------------------------------------
+#ifndef _PresetFader_H_
+#define _PresetFader_H_
+
+#include <stdint.h>
+
+/**
+\enum presetFadeState
+\ingroup ASPiK-Core
+\brief
+Preset fader states
+
+- kIdle: unity gain, nothing to do
+- kFadingOut: a preset is waiting; the output ramps down to silence before it is swapped in
+- kFadingIn: the preset was swapped in; the output ramps back up to unity
+*/
+enum class presetFadeState { kIdle, kFadingOut, kFadingIn };
+
+/**
+\class PresetFader
+\ingroup ASPiK-Core
+\brief
+Short fade around a preset change, so the new settings never cut in mid-waveform.
+
+PresetFader Operations:
+- readyToSwap( ) is asked at each block boundary while a preset is waiting; it starts the fade out
+  and says yes once the output is silent (or right away if the fade time is zero or nothing sounds)
+- applyGain( ) ramps the rendered output; it does nothing at unity gain
+- a preset that arrives during the fade in fades out again from the current gain
+- keep the fade time well below the silence detector hold time: the fade in only moves while
+  blocks are rendered
+- no allocation, no locks; audio thread only
+
+\author Will Pirkle http://www.willpirkle.com
+\remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
+\version Revision : 1.0
+\date Date : 2018 / 09 / 7
+*/
+class PresetFader
+{
+public:
+	PresetFader() {}
+
+	/** back to unity gain; call from reset( ) */
+	void reset(double _sampleRate)
+	{
+		sampleRate = _sampleRate;
+		state = presetFadeState::kIdle;
+		gain = 1.0;
+		updateGainStep();
+	}
+
+	/** fade time for each direction in mSec; 0 swaps presets at the next block boundary */
+	void setFadeTime_mSec(double _fadeTime_mSec)
+	{
+		fadeTime_mSec = _fadeTime_mSec;
+		updateGainStep();
+	}
+
+	/**
+	\brief a preset is waiting: should it be swapped in at this block boundary?
+
+	\param silent true if nothing is sounding, so no fade is needed
+
+	\return true to swap now
+	*/
+	bool readyToSwap(bool silent)
+	{
+		// --- nothing sounds (or no fade): no fade in either
+		if (gainStep <= 0.0 || silent)
+		{
+			state = presetFadeState::kIdle;
+			gain = 1.0;
+			return true;
+		}
+
+		if (state == presetFadeState::kFadingOut && gain <= 0.0)
+		{
+			state = presetFadeState::kFadingIn;
+			return true;
+		}
+
+		state = presetFadeState::kFadingOut;
+		return false;
+	}
+
+	/** true while fading */
+	bool isActive() { return state != presetFadeState::kIdle; }
+
+	/** current state */
+	presetFadeState getState() { return state; }
+
+	/**
+	\brief ramp a rendered block (float or double outputs)
+
+	\param outputs output channel arrays
+	\param numChannels channel count
+	\param start index of the first sample of the block
+	\param length block length
+	*/
+	template <typename SampleType>
+	void applyGain(SampleType** outputs, uint32_t numChannels, uint32_t start, uint32_t length)
+	{
+		if (state == presetFadeState::kIdle)
+			return;
+
+		double step = state == presetFadeState::kFadingOut ? -gainStep : gainStep;
+		double blockGain = gain;
+		for (uint32_t channel = 0; channel < numChannels; channel++)
+		{
+			if (!outputs[channel])
+				continue;
+
+			SampleType* output = outputs[channel] + start;
+			blockGain = gain;
+			for (uint32_t i = 0; i < length; i++)
+			{
+				blockGain += step;
+				blockGain = blockGain < 0.0 ? 0.0 : (blockGain > 1.0 ? 1.0 : blockGain);
+				output[i] = (SampleType)(output[i] * blockGain);
+			}
+		}
+
+		// --- no output channels: the ramp still moves with time
+		if (numChannels == 0)
+		{
+			blockGain = gain + step * length;
+			blockGain = blockGain < 0.0 ? 0.0 : (blockGain > 1.0 ? 1.0 : blockGain);
+		}
+		gain = blockGain;
+
+		if (state == presetFadeState::kFadingIn && gain >= 1.0)
+			state = presetFadeState::kIdle;
+	}
+
+protected:
+	presetFadeState state = presetFadeState::kIdle;	///< fade state
+	double sampleRate = 44100.0;					///< fs
+	double fadeTime_mSec = 0.0;						///< time for each direction
+	double gainStep = 0.0;							///< per-sample gain change; 0 = no fading
+	double gain = 1.0;								///< current gain
+
+	void updateGainStep()
+	{
+		double fadeSamples = fadeTime_mSec * 0.001 * sampleRate;
+		gainStep = fadeSamples >= 1.0 ? 1.0 / fadeSamples : 0.0;
+	}
+};
+
+#endif /* defined(_PresetFader_H_) */
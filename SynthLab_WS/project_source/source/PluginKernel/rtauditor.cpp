@@ -0,0 +1,361 @@
+// -----------------------------------------------------------------------------
+//    ASPiK Plugin Kernel File:  rtauditor.cpp
+//
+/**
+    \file   rtauditor.cpp
+    \author Will Pirkle
+    \date   17-September-2018
+    \brief  implementation file for the real-time safety auditor, including the operator new/delete
+    		replacements and (RT_AUDIT_INTERPOSE_LIBC=1) the malloc and pthread_mutex_lock interposers
+    		- http://www.aspikplugins.com
+    		- http://www.willpirkle.com
+*/
+// -----------------------------------------------------------------------------
+#include "rtauditor.h"
+
+#if SYNTHLAB_RT_AUDIT
+
+#include <new>
+#include <stdlib.h>
+
+#if defined(__GLIBC__) || defined(__APPLE__)
+	#include <execinfo.h>
+	#define RT_AUDIT_BACKTRACE 1
+#else
+	#define RT_AUDIT_BACKTRACE 0
+#endif
+
+#ifndef RT_AUDIT_INTERPOSE_LIBC
+	#define RT_AUDIT_INTERPOSE_LIBC 0
+#endif
+
+// --- the libc interposers need glibc's own entry points to forward to
+#if RT_AUDIT_INTERPOSE_LIBC && !defined(__GLIBC__)
+	#undef RT_AUDIT_INTERPOSE_LIBC
+	#define RT_AUDIT_INTERPOSE_LIBC 0
+#endif
+
+#if RT_AUDIT_INTERPOSE_LIBC
+	#include <dlfcn.h>
+	#include <pthread.h>
+
+	extern "C" void* __libc_malloc(size_t size);
+	extern "C" void* __libc_calloc(size_t count, size_t size);
+	extern "C" void* __libc_realloc(void* ptr, size_t size);
+	extern "C" void* __libc_memalign(size_t alignment, size_t size);
+	extern "C" void __libc_free(void* ptr);
+
+	#define RT_AUDIT_RAW_MALLOC(size) __libc_malloc(size)
+	#define RT_AUDIT_RAW_FREE(ptr) __libc_free(ptr)
+#else
+	#define RT_AUDIT_RAW_MALLOC(size) malloc(size)
+	#define RT_AUDIT_RAW_FREE(ptr) free(ptr)
+#endif
+
+// --- per thread audit state; plain data, so touching it never allocates in an executable
+static thread_local uint32_t auditScopeDepth = 0;
+static thread_local const char* auditScopeTags[RT_AUDIT_TAG_DEPTH];
+static thread_local bool insideAuditor = false;
+
+// --- the lock-free log
+static RTViolationRecord violationLog[RT_AUDIT_LOG_SIZE];
+static std::atomic<uint32_t> violationLogCount{ 0 };
+static std::atomic<uint64_t> violationCounts[kNumRTViolations];
+
+/**
+\brief flag the calling thread as an audio thread (nested scopes push their tag)
+
+\param tag string literal naming the scope
+*/
+void RTAuditor::enterScope(const char* tag)
+{
+	if (auditScopeDepth < RT_AUDIT_TAG_DEPTH)
+		auditScopeTags[auditScopeDepth] = tag;
+	auditScopeDepth++;
+}
+
+/**
+\brief leave the innermost audit scope
+*/
+void RTAuditor::leaveScope()
+{
+	if (auditScopeDepth > 0)
+		auditScopeDepth--;
+}
+
+/**
+\brief true if the calling thread is inside an audit scope
+*/
+bool RTAuditor::isAudioThread()
+{
+	return auditScopeDepth > 0;
+}
+
+/**
+\brief log a violation if the calling thread is an audio thread
+
+Operation:
+- operations the auditor itself causes (backtrace( )) are not logged
+- the record slot is claimed with one fetch_add; once the log is full only the counts go up
+
+\param violation rtViolation
+\param size bytes allocated, or 0
+*/
+void RTAuditor::checkViolation(uint32_t violation, uint64_t size)
+{
+	if (auditScopeDepth == 0 || insideAuditor || violation >= kNumRTViolations)
+		return;
+
+	insideAuditor = true;
+	violationCounts[violation].fetch_add(1, std::memory_order_relaxed);
+
+	uint32_t index = violationLogCount.fetch_add(1, std::memory_order_relaxed);
+	if (index < RT_AUDIT_LOG_SIZE)
+	{
+		RTViolationRecord& record = violationLog[index];
+		record.violation = violation;
+		record.size = size;
+
+		record.numTags = auditScopeDepth < RT_AUDIT_TAG_DEPTH ? auditScopeDepth : RT_AUDIT_TAG_DEPTH;
+		for (uint32_t i = 0; i < record.numTags; i++)
+			record.tags[i] = auditScopeTags[i];
+
+#if RT_AUDIT_BACKTRACE
+		int numFrames = backtrace(record.frames, RT_AUDIT_STACK_FRAMES);
+		record.numFrames = numFrames > 0 ? (uint32_t)numFrames : 0;
+#else
+		record.numFrames = 0;
+#endif
+		record.complete.store(true, std::memory_order_release);
+	}
+	insideAuditor = false;
+}
+
+/**
+\brief violations of all kinds since reset( )
+*/
+uint64_t RTAuditor::getViolationCount()
+{
+	uint64_t count = 0;
+	for (uint32_t violation = 0; violation < kNumRTViolations; violation++)
+		count += violationCounts[violation].load(std::memory_order_relaxed);
+	return count;
+}
+
+/**
+\brief violations of one kind since reset( )
+
+\param violation rtViolation
+*/
+uint64_t RTAuditor::getViolationCount(uint32_t violation)
+{
+	return violation < kNumRTViolations ? violationCounts[violation].load(std::memory_order_relaxed) : 0;
+}
+
+/**
+\brief print the logged violations; NOT realtime safe
+
+\param file output, e.g. stderr
+\param maxRecords the most records to print
+*/
+void RTAuditor::writeReport(FILE* file, uint32_t maxRecords)
+{
+	if (!file)
+		return;
+
+	uint32_t logged = violationLogCount.load(std::memory_order_relaxed);
+	if (logged > RT_AUDIT_LOG_SIZE)
+		logged = RT_AUDIT_LOG_SIZE;
+
+	fprintf(file, "RT audit: %llu violation(s): %llu allocate, %llu free, %llu mutexLock\n",
+			(unsigned long long)getViolationCount(),
+			(unsigned long long)getViolationCount(kRTAllocate),
+			(unsigned long long)getViolationCount(kRTFree),
+			(unsigned long long)getViolationCount(kRTMutexLock));
+
+	for (uint32_t index = 0; index < logged && index < maxRecords; index++)
+	{
+		RTViolationRecord& record = violationLog[index];
+		if (!record.complete.load(std::memory_order_acquire))
+			continue;
+
+		fprintf(file, "#%u %s", index, getViolationName(record.violation));
+		if (record.size > 0)
+			fprintf(file, " (%llu bytes)", (unsigned long long)record.size);
+		fprintf(file, " in ");
+		for (uint32_t i = 0; i < record.numTags; i++)
+			fprintf(file, "%s%s", i == 0 ? "" : " > ", record.tags[i]);
+		fprintf(file, "\n");
+		fflush(file);
+
+#if RT_AUDIT_BACKTRACE
+		// --- writes straight to the descriptor; skip the auditor's own frames
+		if (record.numFrames > 2)
+			backtrace_symbols_fd(record.frames + 2, (int)record.numFrames - 2, fileno(file));
+#endif
+	}
+
+	if (violationLogCount.load(std::memory_order_relaxed) > RT_AUDIT_LOG_SIZE)
+		fprintf(file, "(log full: only the first %u violations were recorded)\n", RT_AUDIT_LOG_SIZE);
+}
+
+/**
+\brief clear the log and the counts; not while an audit scope is open
+*/
+void RTAuditor::reset()
+{
+	for (uint32_t index = 0; index < RT_AUDIT_LOG_SIZE; index++)
+		violationLog[index].complete.store(false, std::memory_order_relaxed);
+
+	for (uint32_t violation = 0; violation < kNumRTViolations; violation++)
+		violationCounts[violation].store(0, std::memory_order_relaxed);
+
+	violationLogCount.store(0, std::memory_order_release);
+}
+
+/**
+\brief violation name, as used in the report
+*/
+const char* RTAuditor::getViolationName(uint32_t violation)
+{
+	static const char* violationNames[kNumRTViolations] = { "allocate", "free", "mutexLock" };
+	return violation < kNumRTViolations ? violationNames[violation] : "unknown";
+}
+
+// -----------------------------------------------------------------------------
+// --- startup: backtrace( ) loads the unwinder (and allocates) on its first call, so make
+//     that call here rather than on an audio thread; resolve the real pthread_mutex_lock
+// -----------------------------------------------------------------------------
+#if RT_AUDIT_INTERPOSE_LIBC
+typedef int(*PthreadMutexLockFunction)(pthread_mutex_t*);
+static PthreadMutexLockFunction realPthreadMutexLock = nullptr;
+
+static PthreadMutexLockFunction getRealPthreadMutexLock()
+{
+	if (!realPthreadMutexLock)
+		realPthreadMutexLock = (PthreadMutexLockFunction)dlsym(RTLD_NEXT, "pthread_mutex_lock");
+	return realPthreadMutexLock;
+}
+#endif
+
+struct RTAuditorStartup
+{
+	RTAuditorStartup()
+	{
+#if RT_AUDIT_BACKTRACE
+		void* frames[2];
+		backtrace(frames, 2);
+#endif
+#if RT_AUDIT_INTERPOSE_LIBC
+		getRealPthreadMutexLock();
+#endif
+	}
+};
+static RTAuditorStartup rtAuditorStartup;
+
+// -----------------------------------------------------------------------------
+// --- global operator new/delete replacements
+// -----------------------------------------------------------------------------
+static void* auditedNew(size_t size)
+{
+	RTAuditor::checkViolation(kRTAllocate, size);
+	void* ptr = RT_AUDIT_RAW_MALLOC(size ? size : 1);
+	if (!ptr)
+		throw std::bad_alloc();
+	return ptr;
+}
+
+static void* auditedNewNoThrow(size_t size)
+{
+	RTAuditor::checkViolation(kRTAllocate, size);
+	return RT_AUDIT_RAW_MALLOC(size ? size : 1);
+}
+
+static void auditedDelete(void* ptr)
+{
+	if (!ptr)
+		return;
+	RTAuditor::checkViolation(kRTFree, 0);
+	RT_AUDIT_RAW_FREE(ptr);
+}
+
+void* operator new(size_t size) { return auditedNew(size); }
+void* operator new[](size_t size) { return auditedNew(size); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept { return auditedNewNoThrow(size); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept { return auditedNewNoThrow(size); }
+void operator delete(void* ptr) noexcept { auditedDelete(ptr); }
+void operator delete[](void* ptr) noexcept { auditedDelete(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { auditedDelete(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { auditedDelete(ptr); }
+
+#if defined(__cpp_sized_deallocation)
+void operator delete(void* ptr, size_t) noexcept { auditedDelete(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { auditedDelete(ptr); }
+#endif
+
+// -----------------------------------------------------------------------------
+// --- glibc malloc family and pthread_mutex_lock interposers (executables only: the
+//     definitions here win over libc's for the whole process)
+// -----------------------------------------------------------------------------
+#if RT_AUDIT_INTERPOSE_LIBC
+extern "C" {
+
+void* malloc(size_t size)
+{
+	RTAuditor::checkViolation(kRTAllocate, size);
+	return __libc_malloc(size);
+}
+
+void* calloc(size_t count, size_t size)
+{
+	RTAuditor::checkViolation(kRTAllocate, (uint64_t)count * size);
+	return __libc_calloc(count, size);
+}
+
+void* realloc(void* ptr, size_t size)
+{
+	RTAuditor::checkViolation(kRTAllocate, size);
+	return __libc_realloc(ptr, size);
+}
+
+void* memalign(size_t alignment, size_t size)
+{
+	RTAuditor::checkViolation(kRTAllocate, size);
+	return __libc_memalign(alignment, size);
+}
+
+void* aligned_alloc(size_t alignment, size_t size)
+{
+	RTAuditor::checkViolation(kRTAllocate, size);
+	return __libc_memalign(alignment, size);
+}
+
+int posix_memalign(void** ptr, size_t alignment, size_t size)
+{
+	RTAuditor::checkViolation(kRTAllocate, size);
+	if (alignment < sizeof(void*) || (alignment & (alignment - 1)) != 0)
+		return 22; // --- EINVAL
+
+	*ptr = __libc_memalign(alignment, size);
+	return *ptr ? 0 : 12; // --- ENOMEM
+}
+
+void free(void* ptr)
+{
+	if (!ptr)
+		return;
+	RTAuditor::checkViolation(kRTFree, 0);
+	__libc_free(ptr);
+}
+
+int pthread_mutex_lock(pthread_mutex_t* mutex)
+{
+	RTAuditor::checkViolation(kRTMutexLock, 0);
+	PthreadMutexLockFunction lock = getRealPthreadMutexLock();
+	return lock ? lock(mutex) : 22; // --- EINVAL
+}
+
+} // extern "C"
+#endif // RT_AUDIT_INTERPOSE_LIBC
+
+#endif // SYNTHLAB_RT_AUDIT
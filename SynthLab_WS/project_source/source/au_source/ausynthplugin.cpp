@@ -994,7 +994,7 @@ OSStatus AUSynthPlugin::NewFactoryPresetSet(const AUPreset & inNewFactoryPreset)
     // --- set name
     SetAFactoryPresetAsCurrent(auPreset);
 
-    PresetInfo* preset = pluginCore->getPreset(currentPreset);
+    const PresetInfo* preset = pluginCore->getPreset(currentPreset);
     if(preset)
     {
         for(int j=0; j<preset->presetParameters.size(); j++)
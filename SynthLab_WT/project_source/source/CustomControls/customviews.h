@@ -99,9 +99,8 @@ private:
 
 };
 
-#ifdef HAVE_FFTW
-// --- FFTW (REQUIRED)
-#include "fftw3.h"
+// --- FFT: FFTW if the build defines HAVE_FFTW 1 (LINK_FFTW), otherwise the built-in FFT
+#include "../PluginKernel/fftbackend.h"
 
 /**
 \enum spectrumViewWindowType
@@ -135,6 +134,7 @@ SpectrumView:
 - implements ICustomView::pushDataValue() and ICustomView::updateData()
 - uses a pair of lock-free ring buffers to implement a safe double-buffering system
 - during updates, the queue is dumped into the FFT array
+- the audio is real, so a real FFT computes only the FFT_LEN/2 + 1 bins that are displayed
 - when a new FFT is processed, its magnitude array is calculated in the first
 available buffer in the empty queue; it is then placed in the filled (ready) queue
 - the draw() function is on the same thread with the PluginKernel/PluginGUI paradigm\
@@ -179,11 +179,9 @@ protected:
 	spectrumViewWindowType window = spectrumViewWindowType::kRectWindow; ///< window type
 
     // --- setup FFTW
-    fftw_complex* data = nullptr;			///< fft input data
-	fftw_complex* fft_result = nullptr;		///< fft output data
-	fftw_complex* ifft_result = nullptr;	///< ifft output (not used)
+    double* data = nullptr;					///< fft input data, FFT_LEN
+	fftw_complex* fft_result = nullptr;		///< fft output data, FFT_LEN/2 + 1
 	fftw_plan plan_forward;					///< plan for FFT
-	fftw_plan plan_backward;				///< plan for IFFT (not used)
 
     // --- for FFT data input
     int fftInputCounter = 0;				///< input counter for FFT
@@ -285,7 +283,6 @@ private:
     moodycamel::ReaderWriterQueue<double*,2>* fftMagBuffersReady = nullptr; ///< example of queuing system (yes I know it is overkill here)
     moodycamel::ReaderWriterQueue<double*,2>* fftMagBuffersEmpty = nullptr; ///< example of queuing system (yes I know it is overkill here)
 };
-#endif // defined FFTW
 
 
 // --- custom view example
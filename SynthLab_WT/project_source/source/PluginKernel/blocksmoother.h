@@ -0,0 +1,128 @@
+// -----------------------------------------------------------------------------
+//    ASPiK Plugin Kernel File:  blocksmoother.h
+//
+/**
+    \file   blocksmoother.h
+    \author Will Pirkle
+    \date   17-September-2018
+    \brief  interface file for the block parameter smoother
+    		- http://www.aspikplugins.com
+    		- http://www.willpirkle.com
+*/
+// -----------------------------------------------------------------------------
+#ifndef _BlockSmoother_H_
+#define _BlockSmoother_H_
+
+#include <stdint.h>
+#include "guiconstants.h"
+
+/**
+\class BlockParamSmoother
+\ingroup ASPiK-Core
+\brief
+Smooths a whole set of parameters one block at a time, replacing the per-sample ParamSmoother
+update of each parameter with a single pass over a structure-of-arrays.
+
+BlockParamSmoother Operations:
+- each smoother has a slot; the slot state (value, target, coefficients) lives in flat arrays
+- setTarget( ) activates a slot; only active slots are kept in the compact active lists, so idle
+  parameters cost nothing
+- advanceBlock( ) moves every active slot to its value at the end of the block in closed form:
+  LPF: v[N] = target + (v[0] - target) * a^N, linear: v[N] = v[0] +/- N * increment (clamped)
+- the active lists are contiguous and branch free, so the compiler can vectorize the pass
+- getRamp( ) produces the per-sample ramp of one slot for DSP that needs it
+- slots that arrive at their target snap to it and leave the active list; a slot has arrived
+  when it is within its settle epsilon (a fraction of the control range, as for ParamSmoother)
+  or equal to the target at float precision, the precision of the PluginParameter control value
+
+\author Will Pirkle http://www.willpirkle.com
+\remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
+\version Revision : 1.0
+\date Date : 2018 / 09 / 7
+*/
+class BlockParamSmoother
+{
+public:
+	BlockParamSmoother() {}
+	~BlockParamSmoother() { destroy(); }
+
+	/** allocate the slots; NOT realtime safe */
+	void create(uint32_t _numSlots);
+
+	/** free the slots; NOT realtime safe */
+	void destroy();
+
+	/** set up a slot and snap it to a value; NOT realtime safe */
+	void initSlot(uint32_t slot, double smoothingTimeMsec, double sampleRate,
+				  double minValue, double maxValue, smoothingMethod method, double initValue,
+				  double settleEpsilon = kSmoothingSettleEpsilon);
+
+	/** set a new target; activates the slot if it is not already at the target */
+	void setTarget(uint32_t slot, double target);
+
+	/** jump a slot to a value without smoothing; deactivates the slot */
+	void snapSlot(uint32_t slot, double newValue);
+
+	/** advance all active slots by numSamples */
+	void advanceBlock(uint32_t numSamples);
+
+	/** write the per-sample ramp of the NEXT numSamples of a slot; does not advance it */
+	void getRamp(uint32_t slot, double* ramp, uint32_t numSamples);
+
+	/** slots that moved in the last advanceBlock( ), including those that just arrived */
+	uint32_t getUpdatedCount() { return numUpdated; }
+	uint32_t getUpdatedSlot(uint32_t index) { return updatedSlots[index]; }
+
+	/** current value of a slot */
+	double getValue(uint32_t slot) { return value[slot]; }
+
+	/** number of slots still moving */
+	uint32_t getActiveCount() { return lpfActive.count + linearActive.count; }
+	uint32_t getSlotCount() { return numSlots; }
+
+protected:
+	/**
+	\struct ActiveList
+	\brief compact structure-of-arrays of the moving slots of one smoother type
+	*/
+	struct ActiveList
+	{
+		uint32_t* slot = nullptr;		///< owning slot
+		double* value = nullptr;		///< current value
+		double* target = nullptr;		///< target value
+		double* coeff = nullptr;		///< per-sample pole (LPF) or increment (linear)
+		double* blockCoeff = nullptr;	///< coeff for the cached block length
+		uint32_t count = 0;				///< number of active entries
+
+		void create(uint32_t size);
+		void destroy();
+	};
+
+	void activate(uint32_t slot);
+	bool hasArrived(uint32_t slot, double slotValue, double slotTarget)
+	{
+		return (float)slotValue == (float)slotTarget || fabs(slotTarget - slotValue) <= settleThreshold[slot];
+	}
+	void removeActive(ActiveList& list, uint32_t index);
+	double getBlockCoeff(uint32_t slot, uint32_t numSamples);
+
+	uint32_t numSlots = 0;					///< slot count
+
+	// --- per slot state
+	double* value = nullptr;				///< current value
+	double* target = nullptr;				///< target value
+	double* pole = nullptr;					///< LPF pole (per sample)
+	double* increment = nullptr;			///< linear increment (per sample)
+	double* settleThreshold = nullptr;		///< arrival distance in control units
+	bool* linear = nullptr;					///< true = linear smoother, false = LPF
+	int32_t* activeIndex = nullptr;			///< index into the active list, -1 = idle
+
+	ActiveList lpfActive;					///< moving LPF slots
+	ActiveList linearActive;				///< moving linear slots
+	uint32_t blockCoeffLength = 0;			///< block length of the cached blockCoeff values
+
+	uint32_t* updatedSlots = nullptr;		///< slots moved in the last block
+	uint32_t numUpdated = 0;				///< number of slots moved in the last block
+};
+
+#endif
@@ -0,0 +1,405 @@
+// -----------------------------------------------------------------------------
+//    ASPiK Plugin Kernel File:  parallelrender.cpp
+//
+/**
+    \file   parallelrender.cpp
+    \author Will Pirkle
+    \date   17-September-2018
+    \brief  implementation file for the optional multi-threaded render objects
+    		- http://www.aspikplugins.com
+    		- http://www.willpirkle.com
+*/
+// -----------------------------------------------------------------------------
+#include "parallelrender.h"
+#include "rtauditor.h"
+#include "denormalguard.h"
+
+#include <chrono>
+#include <string.h>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#include <emmintrin.h>
+#define RENDER_CPU_RELAX() _mm_pause()
+#elif defined(__aarch64__) || defined(__arm__)
+#define RENDER_CPU_RELAX() __asm__ __volatile__("yield")
+#else
+#define RENDER_CPU_RELAX()
+#endif
+
+// --- job index of a finished block; above any job count, so nothing more can be claimed
+const uint32_t kClosedJobIndex = 0xFFFFFFFF;
+
+#if defined(__APPLE__) || defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+/**
+\brief RenderWorkerPool constructor
+
+Operation:
+- clear the counters; threads are not created until start( )
+*/
+RenderWorkerPool::RenderWorkerPool()
+{
+	running.store(false);
+	jobCursor.store(0);
+	jobsDone.store(0);
+	currentJob.store(nullptr);
+	currentJobCount.store(0);
+	parkedWorkers.store(0);
+	callerPriorityReady.store(false);
+
+	for (uint32_t i = 0; i < MAX_RENDER_JOBS; i++)
+		jobTime_uSec[i].store(0.f);
+}
+
+/**
+\brief RenderWorkerPool destructor
+
+Operation:
+- join all threads
+*/
+RenderWorkerPool::~RenderWorkerPool()
+{
+	stop();
+}
+
+/**
+\brief create the worker threads
+
+Operation:
+- creates _numWorkers threads, clamped to MAX_RENDER_JOBS - 1 (the calling thread is the last worker)
+  and to the number of cores - 1; a single core machine gets no workers and renders serially
+- the threads start at normal priority; they take the audio thread's priority once runJobs( )
+  has read it
+
+\param _numWorkers number of threads to add to the calling thread
+
+\return true if operation succeeds, false otherwise
+*/
+bool RenderWorkerPool::start(uint32_t _numWorkers)
+{
+	stop();
+
+	if (_numWorkers > MAX_RENDER_JOBS - 1)
+		_numWorkers = MAX_RENDER_JOBS - 1;
+
+	// --- never more threads than cores; runJobs( ) spins for the last job, so a worker waiting
+	//     for a core would hold the audio thread up
+	uint32_t numCores = std::thread::hardware_concurrency();
+	if (numCores > 0 && _numWorkers > numCores - 1)
+		_numWorkers = numCores - 1;
+
+	// --- the audio thread may be a different one after a restart
+	callerPriorityRead = false;
+	callerPriorityReady.store(false);
+
+	running.store(true);
+	for (uint32_t i = 0; i < _numWorkers; i++)
+		workers.push_back(std::thread(&RenderWorkerPool::workerLoop, this));
+
+	return true;
+}
+
+/**
+\brief stop and join the worker threads
+*/
+void RenderWorkerPool::stop()
+{
+	running.store(false);
+
+	// --- wake every parked worker so it sees the flag
+	if (workers.size() > 0)
+		wakeSemaphore.signal((int)workers.size());
+
+	for (uint32_t i = 0; i < workers.size(); i++)
+	{
+		if (workers[i].joinable())
+			workers[i].join();
+	}
+	workers.clear();
+
+	// --- drop the posts nobody waited for
+	while (wakeSemaphore.try_wait())
+		;
+	parkedWorkers.store(0);
+}
+
+/**
+\brief read the scheduling policy and priority of the calling (audio) thread for the workers
+
+Operation:
+- called once, on the first runJobs( ) with workers; the workers apply it themselves
+  (applyCallerPriority( )) so the audio thread does not change other threads' priorities
+*/
+void RenderWorkerPool::readCallerPriority()
+{
+	callerPriorityRead = true;
+
+#if defined(__APPLE__) || defined(__linux__)
+	sched_param param;
+	memset(&param, 0, sizeof(sched_param));
+	if (pthread_getschedparam(pthread_self(), &callerPolicy, &param) != 0)
+		return;
+
+	callerPriority = param.sched_priority;
+	callerPriorityReady.store(true, std::memory_order_release);
+#endif
+}
+
+/**
+\brief give the calling worker thread the audio thread's policy and priority
+
+Operation:
+- failure is harmless (e.g. no privileges): the worker keeps its priority
+*/
+void RenderWorkerPool::applyCallerPriority()
+{
+#if defined(__APPLE__) || defined(__linux__)
+	sched_param param;
+	memset(&param, 0, sizeof(sched_param));
+	param.sched_priority = callerPriority;
+	pthread_setschedparam(pthread_self(), callerPolicy, &param);
+#endif
+}
+
+/**
+\brief render one block of jobs; called on the audio thread
+
+Operation:
+- on the first call, read this thread's priority for the workers
+- publish the job and bump the generation in jobCursor
+- post the semaphore once for each parked worker
+- claim and render jobs alongside the workers
+- spin until every job has been completed, then close the block in jobCursor
+
+NOTES:
+- closing matters: a worker that read the cursor of the finished block could otherwise pass the
+  job count check against the NEXT block's count (stored before its generation is published) and
+  claim a job that does not exist; with the cursor closed its claim fails
+
+\param job the object that renders the jobs
+\param numJobs number of jobs in this block
+*/
+void RenderWorkerPool::runJobs(IRenderJob* job, uint32_t numJobs)
+{
+	if (!job || numJobs == 0)
+		return;
+
+	if (numJobs > MAX_RENDER_JOBS)
+		numJobs = MAX_RENDER_JOBS;
+
+	// --- single threaded; no handoff needed and the published job is left untouched
+	if (workers.size() == 0 || numJobs == 1)
+	{
+		for (uint32_t i = 0; i < numJobs; i++)
+		{
+			std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+			job->renderJob(i);
+			std::chrono::duration<float, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+			jobTime_uSec[i].store(elapsed.count(), std::memory_order_relaxed);
+		}
+		return;
+	}
+
+	// --- the workers follow this thread's priority
+	if (!callerPriorityRead)
+		readCallerPriority();
+
+	// --- all jobs of the previous generation are done, so these are safe to overwrite
+	currentJob.store(job, std::memory_order_relaxed);
+	currentJobCount.store(numJobs, std::memory_order_relaxed);
+	jobsDone.store(0, std::memory_order_relaxed);
+
+	// --- publish, then wake; seq_cst pairs with the park in workerLoop( ) so no wake is lost
+	generation++;
+	jobCursor.store((uint64_t)generation << 32, std::memory_order_seq_cst);
+
+	uint32_t parked = parkedWorkers.exchange(0, std::memory_order_seq_cst);
+	if (parked > 0)
+		wakeSemaphore.signal((int)parked);
+
+	// --- help out
+	claimAndRenderJobs(generation);
+
+	// --- wait for the stragglers
+	while (jobsDone.load(std::memory_order_acquire) < numJobs)
+		RENDER_CPU_RELAX();
+
+	// --- close the block before the next one changes the job count
+	jobCursor.store(((uint64_t)generation << 32) | kClosedJobIndex, std::memory_order_seq_cst);
+}
+
+/**
+\brief claim unrendered jobs of one generation until there are none left
+
+\param _generation the block generation the caller observed
+*/
+void RenderWorkerPool::claimAndRenderJobs(uint32_t _generation)
+{
+	uint64_t cursor = jobCursor.load(std::memory_order_acquire);
+	while (true)
+	{
+		// --- a new block has started (or this one is finished)
+		if ((uint32_t)(cursor >> 32) != _generation)
+			return;
+
+		uint32_t jobIndex = (uint32_t)(cursor & 0xFFFFFFFF);
+		if (jobIndex >= currentJobCount.load(std::memory_order_relaxed))
+			return;
+
+		// --- claim it; on failure cursor is reloaded and we try again
+		if (!jobCursor.compare_exchange_weak(cursor, cursor + 1, std::memory_order_acq_rel, std::memory_order_acquire))
+			continue;
+
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		currentJob.load(std::memory_order_relaxed)->renderJob(jobIndex);
+		std::chrono::duration<float, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+		jobTime_uSec[jobIndex].store(elapsed.count(), std::memory_order_relaxed);
+
+		jobsDone.fetch_add(1, std::memory_order_release);
+		cursor = jobCursor.load(std::memory_order_acquire);
+	}
+}
+
+/**
+\brief worker thread function
+
+Operation:
+- park on the semaphore until a new generation is published
+- take on the audio thread's priority once it is known
+- claim and render jobs of that generation under the same FTZ/DAZ mode as the audio thread's
+  process call, so a worker's voice tails do not stall on denormals
+
+NOTES:
+- a worker counts itself as parked before its last check of the generation; every count gets
+  exactly one post, so a post that arrives after that check only makes a later park return early
+*/
+void RenderWorkerPool::workerLoop()
+{
+	uint32_t lastGeneration = (uint32_t)(jobCursor.load(std::memory_order_acquire) >> 32);
+	bool priorityApplied = false;
+
+	while (running.load(std::memory_order_relaxed))
+	{
+		uint32_t thisGeneration = (uint32_t)(jobCursor.load(std::memory_order_seq_cst) >> 32);
+		if (thisGeneration != lastGeneration)
+		{
+			lastGeneration = thisGeneration;
+
+			if (!priorityApplied && callerPriorityReady.load(std::memory_order_acquire))
+			{
+				applyCallerPriority();
+				priorityApplied = true;
+			}
+
+			// --- debug/test builds: rendering is audio thread work (see rtauditor.h)
+			RT_AUDIT_SCOPE("RenderWorkerPool::workerLoop");
+			ScopedDenormalGuard denormalGuard(DENORMAL_GUARD_ACTIVE != 0);
+			claimAndRenderJobs(thisGeneration);
+			continue;
+		}
+
+		// --- park; check once more after counting in, so a block published in between is not missed
+		parkedWorkers.fetch_add(1, std::memory_order_seq_cst);
+		if ((uint32_t)(jobCursor.load(std::memory_order_seq_cst) >> 32) != lastGeneration ||
+			!running.load(std::memory_order_seq_cst))
+			continue;
+
+		wakeSemaphore.wait();
+	}
+}
+
+/**
+\brief forget all notes and set the shard count
+
+\param _numShards number of render shards
+*/
+void ShardNoteRouter::reset(uint32_t _numShards)
+{
+	numShards = _numShards < 1 ? 1 : _numShards;
+	if (numShards > MAX_RENDER_JOBS)
+		numShards = MAX_RENDER_JOBS;
+
+	nextShard = 0;
+	memset(heldNotes, 0, sizeof(uint32_t) * MAX_RENDER_JOBS);
+	memset(noteShard, 0xFF, sizeof(uint8_t) * 16 * 128);
+}
+
+/**
+\brief find the render shard for a MIDI message
+
+Operation:
+- note-on: re-use the owning shard for a retrigger, otherwise pick the shard with the fewest held notes
+- note-off and poly pressure: the owning shard
+- everything else: broadcast
+
+\param message MIDI message (status nibble, without channel)
+\param channel MIDI channel 0-15
+\param note MIDI note number (data byte 1)
+\param velocity MIDI velocity (data byte 2)
+\param allowSpread false forces all notes into shard 0
+
+\return shard index or -1 for broadcast
+*/
+int32_t ShardNoteRouter::getShardForMessage(uint32_t message, uint32_t channel, uint32_t note, uint32_t velocity, bool allowSpread)
+{
+	const uint32_t NOTE_OFF = 0x80;
+	const uint32_t NOTE_ON = 0x90;
+	const uint32_t POLY_PRESSURE = 0xA0;
+
+	channel &= 0x0F;
+	note &= 0x7F;
+
+	// --- note on with zero velocity is a note off
+	if (message == NOTE_ON && velocity == 0)
+		message = NOTE_OFF;
+
+	if (message == NOTE_ON)
+	{
+		uint8_t owner = noteShard[channel][note];
+		if (owner != 0xFF)
+			return owner;
+
+		uint32_t shard = 0;
+		if (allowSpread)
+		{
+			// --- fewest held notes wins; ties rotate
+			shard = nextShard;
+			for (uint32_t i = 1; i < numShards; i++)
+			{
+				uint32_t candidate = (nextShard + i) % numShards;
+				if (heldNotes[candidate] < heldNotes[shard])
+					shard = candidate;
+			}
+			nextShard = (shard + 1) % numShards;
+		}
+
+		noteShard[channel][note] = (uint8_t)shard;
+		heldNotes[shard]++;
+		return (int32_t)shard;
+	}
+
+	if (message == NOTE_OFF)
+	{
+		uint8_t owner = noteShard[channel][note];
+
+		// --- unknown note: let every shard release it
+		if (owner == 0xFF)
+			return -1;
+
+		noteShard[channel][note] = 0xFF;
+		if (heldNotes[owner] > 0)
+			heldNotes[owner]--;
+		return owner;
+	}
+
+	if (message == POLY_PRESSURE)
+	{
+		uint8_t owner = noteShard[channel][note];
+		return owner == 0xFF ? -1 : owner;
+	}
+
+	return -1;
+}
@@ -0,0 +1,74 @@
+// -----------------------------------------------------------------------------
+//    ASPiK Plugin Kernel File:  pluginstate.h
+//
+/**
+    \file   pluginstate.h
+    \author Will Pirkle
+    \date   17-September-2018
+    \brief  interface file for the binary plugin state chunk
+    		- http://www.aspikplugins.com
+    		- http://www.willpirkle.com
+*/
+// -----------------------------------------------------------------------------
+#ifndef _PluginState_H_
+#define _PluginState_H_
+
+#include "pluginstructures.h"
+
+// --- "ASPs" in the first four bytes of the chunk
+const uint32_t STATE_CHUNK_MAGIC = 0x73505341;
+
+// --- current format version; newer versions may only append data after the value list
+const uint16_t STATE_CHUNK_VERSION = 1;
+
+// --- header: magic (4), version (2), flags (2), value count (4)
+const size_t STATE_CHUNK_HEADER_SIZE = 12;
+
+// --- one value: controlID (4), value as float (4)
+const size_t STATE_CHUNK_VALUE_SIZE = 8;
+
+// --- flags
+const uint16_t STATE_CHUNK_FLAG_BYPASS = 0x0001;	///< plugin side bypass is on
+
+/**
+\class PluginStateChunk
+\ingroup ASPiK-Core
+\brief
+Encodes and decodes the binary plugin state: a versioned, controlID keyed list that only
+holds the values that differ from their defaults.
+
+Chunk layout (little endian):
+- uint32 magic, uint16 version, uint16 flags, uint32 value count
+- value count x { uint32 controlID, float value }
+- anything after the value list belongs to a newer version and is skipped
+
+PluginStateChunk Operations:
+- values are stored as float; the parameter value itself is an atomic float so nothing is lost
+- a missing controlID means "default"; an unknown controlID (a removed parameter) is ignored by
+  PluginBase::setStateChunk( ), so parameters can be added, removed or re-ordered without breaking
+  saved sessions
+- NOT realtime safe (the value list may grow)
+
+\author Will Pirkle http://www.willpirkle.com
+\remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
+\version Revision : 1.0
+\date Date : 2018 / 09 / 7
+*/
+class PluginStateChunk
+{
+public:
+	/** true if the data starts with a state chunk header */
+	static bool isStateChunk(const uint8_t* chunk, size_t size);
+
+	/** write a chunk; the chunk is cleared first */
+	static void write(std::vector<uint8_t>& chunk, const std::vector<PresetParameter>& values, uint16_t flags);
+
+	/** read a chunk; false if it is not a state chunk or it is truncated */
+	static bool read(const uint8_t* chunk, size_t size, std::vector<PresetParameter>& values, uint16_t& flags);
+
+protected:
+	static void writeUInt32(uint8_t* data, uint32_t value);
+	static uint32_t readUInt32(const uint8_t* data);
+};
+
+#endif /* defined(_PluginState_H_) */
@@ -1062,7 +1062,7 @@ OSStatus AUFXPlugin::NewFactoryPresetSet(const AUPreset & inNewFactoryPreset)
     // --- set name
     SetAFactoryPresetAsCurrent(auPreset);
 
-    PresetInfo* preset = pluginCore->getPreset(currentPreset);
+    const PresetInfo* preset = pluginCore->getPreset(currentPreset);
     if(preset)
     {
         for(int j=0; j<preset->presetParameters.size(); j++)
@@ -0,0 +1,304 @@
+// -----------------------------------------------------------------------------
+//    ASPiK Bench File:  floatbench.cpp
+//
+/**
+    \file   floatbench.cpp
+    \author Will Pirkle
+    \date   17-September-2018
+    \brief  float vs. double throughput of the templated fxobjects
+    		- each object runs as kBenchInstances instances (tracks, voices) over the
+    		  same noise, so the delay lines add up to more than the caches hold
+    		- BiquadT runs blocks of its own sample type (processBlock); the delays run
+    		  per sample or per frame; BiquadBankT (8 lanes x 4 stages, fanned out) and
+    		  ReverbTankT run processAudioBlock
+    		- the delays have no float typedef; their rows show why (the double sample
+    		  interface makes the float buffers slower, not faster)
+    		- maxDiff and errorDb compare the float output of instance 0 with the double
+    		  output; errorDb is relative to the double output peak
+    		- prints one JSON object per (object, sample type) run to stdout
+    		- http://www.aspikplugins.com
+    		- http://www.willpirkle.com
+*/
+// -----------------------------------------------------------------------------
+#include "fxobjects.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+const double kBenchSampleRate = 48000.0;
+const uint32_t kBenchBlockSize = 512;
+const uint32_t kBenchInstances = 16;
+
+/**
+\brief name of a sample type
+*/
+template <typename T> const char* getTypeName();
+template <> const char* getTypeName<float>() { return "float"; }
+template <> const char* getTypeName<double>() { return "double"; }
+
+/**
+\brief setup functions: the same settings for both sample types
+*/
+template <typename T>
+void setupObject(BiquadT<T>& biquad)
+{
+	AudioFilter calculator;
+	AudioFilterParameters filterParams;
+	filterParams.algorithm = filterAlgorithm::kLPF2;
+	filterParams.fc = 1000.0;
+	filterParams.Q = 2.0;
+	calculator.setParameters(filterParams);
+	calculator.reset(kBenchSampleRate);
+
+	double coeffs[numCoeffs];
+	memcpy(&coeffs[0], calculator.getCoefficients(), sizeof(double) * numCoeffs);
+
+	BiquadParameters params;
+	params.biquadCalcType = biquadAlgorithm::kTransposeCanonical;
+	biquad.setParameters(params);
+	biquad.setCoefficients(coeffs);
+	biquad.reset(kBenchSampleRate);
+}
+
+template <typename T>
+void setupObject(BiquadBankT<T>& bank)
+{
+	BiquadBankParameters params;
+	params.lanes = BIQUAD_BANK_MAX_LANES;
+	params.stages = 4;
+	params.input = biquadBankInput::kFanOut;
+	bank.reset(kBenchSampleRate);
+	bank.setParameters(params);
+
+	AudioFilterParameters filterParams;
+	filterParams.algorithm = filterAlgorithm::kLPF2;
+	filterParams.Q = 2.0;
+	for (uint32_t lane = 0; lane < params.lanes; lane++)
+	{
+		for (uint32_t stage = 0; stage < params.stages; stage++)
+		{
+			filterParams.fc = 200.0 * (lane + 1) + 50.0 * stage;
+			bank.setFilterParameters(lane, stage, filterParams);
+		}
+	}
+}
+
+template <typename T>
+void setupObject(SimpleDelayT<T>& delay)
+{
+	delay.createDelayBuffer(kBenchSampleRate, 500.0);
+	SimpleDelayParameters params;
+	params.delayTime_mSec = 250.3;
+	params.interpolate = true;
+	delay.setParameters(params);
+}
+
+template <typename T>
+void setupObject(CombFilterT<T>& comb)
+{
+	comb.createDelayBuffer(kBenchSampleRate, 100.0);
+	CombFilterParameters params;
+	params.delayTime_mSec = 41.7;
+	params.RT60Time_mSec = 2000.0;
+	params.enableLPF = true;
+	params.lpf_g = 0.3;
+	comb.setParameters(params);
+	comb.reset(kBenchSampleRate);
+}
+
+template <typename T>
+void setupObject(NestedDelayAPFT<T>& apf)
+{
+	apf.reset(kBenchSampleRate);
+	apf.createDelayBuffers(kBenchSampleRate, 100.0, 100.0);
+	NestedDelayAPFParameters params;
+	params.outerAPFdelayTime_mSec = 37.1;
+	params.innerAPFdelayTime_mSec = 13.3;
+	params.outerAPF_g = 0.5;
+	params.innerAPF_g = -0.5;
+	params.enableLFO = true;
+	params.lfoRate_Hz = 0.33;
+	params.lfoMaxModulation_mSec = 0.3;
+	apf.setParameters(params);
+}
+
+template <typename T>
+void setupObject(AudioDelayT<T>& delay)
+{
+	delay.reset(kBenchSampleRate);
+	delay.createDelayBuffers(kBenchSampleRate, 2000.0);
+	AudioDelayParameters params;
+	params.algorithm = delayAlgorithm::kPingPong;
+	params.feedback_Pct = 50.0;
+	params.leftDelay_mSec = 1500.0;
+	params.rightDelay_mSec = 1125.0;
+	delay.setParameters(params);
+}
+
+template <typename T>
+void setupObject(ReverbTankT<T>& reverb)
+{
+	reverb.reset(kBenchSampleRate);
+	ReverbTankParameters params;
+	params.kRT = 0.8;
+	params.lpf_g = 0.3;
+	params.density = reverbDensity::kThick;
+	reverb.setParameters(params);
+}
+
+/**
+\brief process functions: one block of stereo input into stereo output, per the object's natural call
+*/
+template <typename T>
+void processObject(BiquadT<T>& biquad, const float* const* inputs, float* const* outputs, uint32_t frames)
+{
+	T work[kBenchBlockSize];
+	for (uint32_t i = 0; i < frames; i++)
+		work[i] = (T)inputs[0][i];
+	biquad.processBlock(work, frames);
+	for (uint32_t i = 0; i < frames; i++)
+		outputs[0][i] = outputs[1][i] = (float)work[i];
+}
+
+template <typename Object>
+void processObject(Object& object, const float* const* inputs, float* const* outputs, uint32_t frames)
+{
+	for (uint32_t i = 0; i < frames; i++)
+		outputs[0][i] = outputs[1][i] = (float)object.processAudioSample(inputs[0][i]);
+}
+
+template <typename T>
+void processObject(AudioDelayT<T>& delay, const float* const* inputs, float* const* outputs, uint32_t frames)
+{
+	for (uint32_t i = 0; i < frames; i++)
+	{
+		float inputFrame[2] = { inputs[0][i], inputs[1][i] };
+		float outputFrame[2] = { 0.f, 0.f };
+		delay.processAudioFrame(inputFrame, outputFrame, 2, 2);
+		outputs[0][i] = outputFrame[0];
+		outputs[1][i] = outputFrame[1];
+	}
+}
+
+template <typename T>
+void processObject(BiquadBankT<T>& bank, const float* const* inputs, float* const* outputs, uint32_t frames)
+{
+	bank.processAudioBlock(inputs, outputs, 2, frames);
+}
+
+template <typename T>
+void processObject(ReverbTankT<T>& reverb, const float* const* inputs, float* const* outputs, uint32_t frames)
+{
+	reverb.processAudioBlock(inputs, outputs, 2, frames);
+}
+
+/**
+\brief run kBenchInstances instances of an object over the input; the output of instance 0 is kept
+
+\return nanoseconds per sample per instance
+*/
+template <typename Object>
+double runObject(const std::vector<float>& input, std::vector<float>& output)
+{
+	std::vector<Object> objects(kBenchInstances);
+	for (uint32_t instance = 0; instance < kBenchInstances; instance++)
+		setupObject(objects[instance]);
+
+	uint32_t length = (uint32_t)input.size() / 2;
+	output.assign(input.size(), 0.f);
+
+	float scratchL[kBenchBlockSize];
+	float scratchR[kBenchBlockSize];
+	double sink = 0.0;
+
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for (uint32_t n = 0; n < length; n += kBenchBlockSize)
+	{
+		uint32_t frames = length - n < kBenchBlockSize ? length - n : kBenchBlockSize;
+		const float* inputs[2] = { &input[n], &input[length + n] };
+
+		for (uint32_t instance = 0; instance < kBenchInstances; instance++)
+		{
+			float* outputs[2] = { scratchL, scratchR };
+			if (instance == 0)
+			{
+				outputs[0] = &output[n];
+				outputs[1] = &output[length + n];
+			}
+			processObject(objects[instance], inputs, outputs, frames);
+			sink += outputs[0][frames - 1];
+		}
+	}
+	std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+	// --- keep the output alive
+	if (sink == 1.2345)
+		printf("%f\n", sink);
+
+	double elapsed = std::chrono::duration<double>(end - start).count();
+	return elapsed * 1.0e9 / ((double)length * kBenchInstances);
+}
+
+/**
+\brief run the float and double versions of an object and print both
+*/
+template <template <typename> class Object>
+void benchObject(const char* name, const std::vector<float>& input)
+{
+	std::vector<float> outputDouble;
+	std::vector<float> outputFloat;
+	double nsDouble = runObject<Object<double> >(input, outputDouble);
+	double nsFloat = runObject<Object<float> >(input, outputFloat);
+
+	double peak = 0.0;
+	double maxDiff = 0.0;
+	for (size_t i = 0; i < outputDouble.size(); i++)
+	{
+		peak = fmax(peak, fabs((double)outputDouble[i]));
+		maxDiff = fmax(maxDiff, fabs((double)outputFloat[i] - (double)outputDouble[i]));
+	}
+	double errorDb = maxDiff > 0.0 && peak > 0.0 ? 20.0 * log10(maxDiff / peak) : -999.0;
+
+	const char* types[2] = { getTypeName<double>(), getTypeName<float>() };
+	double ns[2] = { nsDouble, nsFloat };
+	for (uint32_t i = 0; i < 2; i++)
+	{
+		printf("{\"object\":\"%s\",\"type\":\"%s\",\"instances\":%u,\"nsPerSample\":%.3f,\"speedup\":%.2f,\"maxDiff\":%g,\"errorDb\":%.1f}\n",
+			   name, types[i], kBenchInstances, ns[i], ns[i] > 0.0 ? nsDouble / ns[i] : 0.0,
+			   i == 0 ? 0.0 : maxDiff, i == 0 ? -999.0 : errorDb);
+	}
+	fflush(stdout);
+}
+
+/**
+\brief bench entry point: [seconds] (5)
+*/
+int main(int argc, char* argv[])
+{
+	double seconds = argc > 1 ? atof(argv[1]) : 5.0;
+	if (seconds <= 0.0)
+		seconds = 1.0;
+
+	// --- stereo noise at -6dB, channel-major
+	uint32_t length = (uint32_t)(seconds * kBenchSampleRate);
+	std::vector<float> input(length * 2);
+	uint32_t seed = 12345;
+	for (size_t i = 0; i < input.size(); i++)
+	{
+		seed = seed * 1664525 + 1013904223;
+		input[i] = (float)(((double)seed / 4294967295.0) - 0.5);
+	}
+
+	benchObject<BiquadT>("Biquad", input);
+	benchObject<BiquadBankT>("BiquadBank", input);
+	benchObject<SimpleDelayT>("SimpleDelay", input);
+	benchObject<CombFilterT>("CombFilter", input);
+	benchObject<NestedDelayAPFT>("NestedDelayAPF", input);
+	benchObject<AudioDelayT>("AudioDelay", input);
+	benchObject<ReverbTankT>("ReverbTank", input);
+
+	return 0;
+}
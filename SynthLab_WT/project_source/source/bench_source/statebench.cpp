@@ -0,0 +1,250 @@
+// -----------------------------------------------------------------------------
+//    ASPiK Bench File:  statebench.cpp
+//
+/**
+    \file   statebench.cpp
+    \author Will Pirkle
+    \date   17-September-2018
+    \brief  parameter state save/load cost, as in a large session save and recall
+    		- creates N PluginCore instances, each with a different quarter of its
+    		  parameters moved away from the defaults
+    		- saves every instance, then loads each saved state into the next
+    		  instance and checks that every value arrived
+    		- v0 is the old VST3 layout (one double per parameter in index order,
+    		  loaded one parameter at a time with smoothing toggled off and on);
+    		  v1 is the PluginStateChunk used by VST3 getState( )/setState( ) now
+    		- prints one JSON object per format to stdout
+    		- http://www.aspikplugins.com
+    		- http://www.willpirkle.com
+*/
+// -----------------------------------------------------------------------------
+#include "plugincore.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+/**
+\brief seconds since the previous call with the same time point; resets the time point
+*/
+double lapSeconds(std::chrono::steady_clock::time_point& last)
+{
+	std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+	double seconds = std::chrono::duration<double>(now - last).count();
+	last = now;
+	return seconds;
+}
+
+/**
+\brief value at a percentile of a sorted list
+*/
+double getPercentile(const std::vector<double>& sorted, double percent)
+{
+	if (sorted.empty())
+		return 0.0;
+	size_t index = (size_t)(percent * 0.01 * (double)(sorted.size() - 1) + 0.5);
+	return sorted[index];
+}
+
+/**
+\brief print the stats of one per-instance timing list (microseconds)
+*/
+void printTimes(const char* name, std::vector<double> microseconds)
+{
+	double total = 0.0;
+	for (size_t i = 0; i < microseconds.size(); i++)
+		total += microseconds[i];
+	std::sort(microseconds.begin(), microseconds.end());
+
+	printf(",\"%s\":{\"total_ms\":%.3f,\"mean_us\":%.2f,\"p50_us\":%.2f,\"max_us\":%.2f}",
+		   name, total * 1.0e-3,
+		   microseconds.empty() ? 0.0 : total / (double)microseconds.size(),
+		   getPercentile(microseconds, 50.0),
+		   microseconds.empty() ? 0.0 : microseconds.back());
+}
+
+/**
+\brief true for the parameters that are saved and restored (not meters)
+*/
+bool isStateParameter(PluginParameter* piParam)
+{
+	return piParam && piParam->getControlVariableType() != controlVariableType::kMeter;
+}
+
+/**
+\brief give an instance its session state: defaults, with every 4th parameter (offset by the
+       instance number) moved to a different, valid value
+*/
+void setSessionState(PluginCore* pluginCore, uint32_t instance)
+{
+	std::vector<PresetParameter> noValues;
+	pluginCore->setPIParamValues(noValues, true);
+
+	for (uint32_t i = 0; i < pluginCore->getPluginParameterCount(); i++)
+	{
+		PluginParameter* piParam = pluginCore->getPluginParameterByIndex(i);
+		if (!isStateParameter(piParam) || (i + instance) % 4 != 0)
+			continue;
+
+		double normalized = piParam->getDefaultValueNormalized() < 0.5 ? 0.75 : 0.25;
+		piParam->setControlValueNormalized(normalized, true, true); // true = ignore smoothing
+	}
+}
+
+/**
+\brief the current values of the state parameters, in parameter order
+*/
+void getStateValues(PluginCore* pluginCore, std::vector<float>& values)
+{
+	values.clear();
+	for (uint32_t i = 0; i < pluginCore->getPluginParameterCount(); i++)
+	{
+		PluginParameter* piParam = pluginCore->getPluginParameterByIndex(i);
+		if (isStateParameter(piParam))
+			values.push_back((float)piParam->getControlValue());
+	}
+}
+
+/**
+\brief v0 save: one double per parameter in index order, then the bypass flag
+*/
+void saveLegacyState(PluginCore* pluginCore, std::vector<uint8_t>& chunk)
+{
+	chunk.clear();
+	for (uint32_t i = 0; i < pluginCore->getPluginParameterCount(); i++)
+	{
+		PluginParameter* piParam = pluginCore->getPluginParameterByIndex(i);
+		if (!piParam)
+			continue;
+
+		double value = piParam->getControlValue();
+		const uint8_t* bytes = (const uint8_t*)&value;
+		chunk.insert(chunk.end(), bytes, bytes + sizeof(double));
+	}
+	chunk.push_back(0); // bypass
+}
+
+/**
+\brief v0 load: one parameter at a time, smoothing toggled off and back on around each value
+*/
+bool loadLegacyState(PluginCore* pluginCore, const std::vector<uint8_t>& chunk)
+{
+	size_t offset = 0;
+	for (uint32_t i = 0; i < pluginCore->getPluginParameterCount(); i++)
+	{
+		PluginParameter* piParam = pluginCore->getPluginParameterByIndex(i);
+		if (!piParam)
+			continue;
+
+		if (offset + sizeof(double) > chunk.size())
+			return false;
+
+		double value = 0.0;
+		memcpy(&value, &chunk[offset], sizeof(double));
+		offset += sizeof(double);
+
+		bool smooth = piParam->getParameterSmoothing();
+		piParam->setParameterSmoothing(false);
+		piParam->setControlValue(value);
+		piParam->setParameterSmoothing(smooth);
+	}
+	return offset < chunk.size();
+}
+
+/**
+\brief save every instance, load each state into the next instance, check the values and print
+       the results for one format
+*/
+void runFormat(const char* format, std::vector<PluginCore*>& pluginCores, bool legacy)
+{
+	uint32_t numInstances = (uint32_t)pluginCores.size();
+	std::vector<std::vector<uint8_t>> chunks(numInstances);
+	std::vector<std::vector<float>> savedValues(numInstances);
+	std::vector<double> saveTimes;
+	std::vector<double> loadTimes;
+
+	for (uint32_t i = 0; i < numInstances; i++)
+	{
+		setSessionState(pluginCores[i], i);
+		getStateValues(pluginCores[i], savedValues[i]);
+	}
+
+	// --- session save
+	size_t totalBytes = 0;
+	std::chrono::steady_clock::time_point lap = std::chrono::steady_clock::now();
+	for (uint32_t i = 0; i < numInstances; i++)
+	{
+		if (legacy)
+			saveLegacyState(pluginCores[i], chunks[i]);
+		else
+			pluginCores[i]->getStateChunk(chunks[i]);
+		saveTimes.push_back(lapSeconds(lap) * 1.0e6);
+		totalBytes += chunks[i].size();
+	}
+
+	// --- session recall; each instance gets its neighbour's state so every load changes values
+	uint32_t failures = 0;
+	lap = std::chrono::steady_clock::now();
+	for (uint32_t i = 0; i < numInstances; i++)
+	{
+		PluginCore* pluginCore = pluginCores[(i + 1) % numInstances];
+		uint16_t flags = 0;
+		bool loaded = legacy ? loadLegacyState(pluginCore, chunks[i])
+							 : pluginCore->setStateChunk(chunks[i].data(), chunks[i].size(), flags);
+		loadTimes.push_back(lapSeconds(lap) * 1.0e6);
+		if (!loaded)
+			failures++;
+	}
+
+	// --- every value must have arrived
+	uint32_t mismatches = 0;
+	std::vector<float> loadedValues;
+	for (uint32_t i = 0; i < numInstances; i++)
+	{
+		getStateValues(pluginCores[(i + 1) % numInstances], loadedValues);
+		for (size_t j = 0; j < loadedValues.size() && j < savedValues[i].size(); j++)
+		{
+			if (loadedValues[j] != savedValues[i][j])
+				mismatches++;
+		}
+	}
+
+	printf("{\"plugin\":\"%s\",\"format\":\"%s\",\"instances\":%u,\"parameters\":%u,\"bytesPerInstance\":%.1f",
+		   pluginCores[0]->getPluginName(), format, numInstances, (uint32_t)savedValues[0].size(),
+		   (double)totalBytes / (double)numInstances);
+	printTimes("save", saveTimes);
+	printTimes("load", loadTimes);
+	printf(",\"loadFailures\":%u,\"mismatches\":%u}\n", failures, mismatches);
+	fflush(stdout);
+}
+
+/**
+\brief bench entry point: [numInstances] (80)
+
+Operation:
+- the cores are only constructed; parameter state does not need the synth engine
+- load_us covers the API side of a restore; the bound variables are synced by the audio thread
+  on its next block in both formats
+
+\return 0
+*/
+int main(int argc, char* argv[])
+{
+	uint32_t numInstances = argc > 1 ? (uint32_t)atoi(argv[1]) : 80;
+	if (numInstances < 2)
+		numInstances = 2;
+
+	std::vector<PluginCore*> pluginCores;
+	for (uint32_t i = 0; i < numInstances; i++)
+		pluginCores.push_back(new PluginCore);
+
+	runFormat("v0", pluginCores, true);
+	runFormat("v1", pluginCores, false);
+
+	for (size_t i = 0; i < pluginCores.size(); i++)
+		delete pluginCores[i];
+
+	return 0;
+}
@@ -14,6 +14,8 @@
 
 // --- our plugin core object
 #include "plugincore.h"
+#include "denormalguard.h"
+#include "rtauditor.h"
 #include "plugingui.h"
 
 // --- windows.h bug
@@ -194,6 +196,8 @@ private:
     VSTMIDIEventQueue* midiEventQueue = nullptr;            ///< queue for sample accurate MIDI messaging
 	bool plugInSideBypass = false; ///< bypass flag
 	bool hasSidechain = false; ///< sidechain flag
+	std::vector<uint8_t> stateChunk;			///< state chunk memory, reused by getState( ) and setState( )
+	std::vector<PresetParameter> stateValues;	///< decoded state values, reused by setState( ) and setComponentState( )
 
 protected:
 	// --- sample accurate parameter automation
@@ -730,6 +734,7 @@ The VSTMIDIEventQueue interface queues incoming MIDI messages and blasts them ou
 NOTES:
 - this is a simple object because the VST spec automatically delivers queues of MIDI messages
 - so this provides a kind of thin wrapper around those messages to deliver to the core
+- the MIDI CC proxy list is reserved up front so process( ) never grows it; extra proxy events are dropped
 
 \author Will Pirkle http://www.willpirkle.com
 \remark This object is included in Designing Audio Effects Plugins in C++ 2nd Ed. by Will Pirkle
@@ -742,6 +747,7 @@ public:
     VSTMIDIEventQueue(PluginCore* _pluginCore)
     {
         pluginCore = _pluginCore;
+        proxyMIDIEvents.reserve(MAX_MIDI_PROXY_EVENTS);
     };
 
     virtual ~VSTMIDIEventQueue(){ clearMIDIProxyEvents(); }
@@ -755,7 +761,8 @@ public:
 
      void addMIDIProxyEvent(midiEvent& event)
      {
-         proxyMIDIEvents.push_back(event);
+         if (proxyMIDIEvents.size() < MAX_MIDI_PROXY_EVENTS)
+             proxyMIDIEvents.push_back(event);
      }
 
     /** set a new list from VST host*/
@@ -892,7 +899,8 @@ protected:
     PluginCore* pluginCore = nullptr; ///< the core object
     IEventList* inputEvents = nullptr;	///< the current event list for this buffer cycle
     unsigned int currentEventIndex = 0;	///< index of current event
-    std::vector<midiEvent> proxyMIDIEvents;
+    std::vector<midiEvent> proxyMIDIEvents; ///< MIDI CC proxy events of this buffer cycle
+    static const uint32_t MAX_MIDI_PROXY_EVENTS = 256; ///< proxy events kept per buffer cycle
 
 };
 